@@ -22,7 +22,8 @@ enum {
 	MODE_DIST_LEVENSTEIN,
 	MODE_CODE,
 	MODE_GRAPH,
-	MODE_COLS
+	MODE_COLS,
+	MODE_DELTA
 };
 
 static char *file = NULL;
@@ -387,8 +388,61 @@ static int bcb(RDiff *d, void *user, RDiffOp *op) {
 	return 0;
 }
 
+static bool delta_cb(void *user, RDiffBlock *op) {
+	ut64 i;
+	if (showcount) {
+		count++;
+		return true;
+	}
+	if (op->copy) {
+		printf ("copy 0x%08"PFMT64x" 0x%08"PFMT64x" %"PFMT64d"\n",
+			op->b_off, op->a_off, op->len);
+	} else {
+		printf ("insert 0x%08"PFMT64x" %"PFMT64d" ", op->b_off, op->len);
+		for (i = 0; i < op->len; i++) {
+			printf ("%02x", op->data[i]);
+		}
+		printf ("\n");
+	}
+	return true;
+}
+
+static double elapsed(ut64 t0) {
+	/* r_sys_now keeps the seconds above the low 20 bits */
+	ut64 t1 = r_sys_now ();
+	return (double)((t1 >> 20) - (t0 >> 20))
+		+ ((double)(t1 & 0xfffff) - (double)(t0 & 0xfffff)) / 1000000;
+}
+
+static int do_delta(const ut8 *a, int la, const ut8 *b, int lb) {
+	ut64 t0 = r_sys_now ();
+	ut64 len = 0;
+	ut8 *patch;
+	double secs;
+	if (!file3) {
+		return r_diff_blocks (a, la, b, lb, 0, delta_cb, NULL)? 0: 1;
+	}
+	patch = r_diff_patch_new (a, la, b, lb, 0, &len);
+	if (!patch) {
+		eprintf ("radiff2: Cannot create the patch\n");
+		return 1;
+	}
+	secs = elapsed (t0);
+	if (verbose) {
+		eprintf ("patch: %"PFMT64d" bytes, %.3f seconds, %.1f MB/s\n",
+			len, secs, secs > 0? (la + lb) / secs / (1024 * 1024): 0);
+	}
+	if (len > ST32_MAX || !r_file_dump (file3, patch, (int)len, false)) {
+		eprintf ("radiff2: Cannot write '%s'\n", file3);
+		free (patch);
+		return 1;
+	}
+	free (patch);
+	return 0;
+}
+
 static int show_help(int v) {
-	printf ("Usage: radiff2 [-abcCdjrspOxuUvV] [-A[A]] [-g sym] [-t %%] [file] [file] [-B patch_file]\n");
+	printf ("Usage: radiff2 [-abcCdjrspPOxuUvV] [-A[A]] [-g sym] [-t %%] [file] [file] [-B|-P patch_file]\n");
 	if (v) {
 		printf (
 			"  -a [arch]  specify architecture plugin to use (x86, arm, ..)\n"
@@ -407,17 +461,19 @@ static int show_help(int v) {
 			"  -n         print bare addresses only (diff.bare=1)\n"
 			"  -O         code diffing with opcode bytes only\n"
 			"  -p         use physical addressing (io.va=0)\n"
+			"  -P         rolling-hash block delta, list the copy/insert ops or write a patch for 'wpb'\n"
 			"  -q         quiet mode (disable colors, reduce output)\n"
 			"  -r         output in radare commands\n"
-			"  -s         compute edit distance (no substitution, Eugene W. Myers' O(ND) diff algorithm)\n"
-			"  -ss        compute Levenshtein edit distance (substitution is allowed, O(N^2))\n"
+			"  -s         compute Levenshtein edit distance (bit-parallel, approximated for huge files)\n"
+			"  -ss        compute Levenshtein edit distance (diagonal search, O(N^2) worst case)\n"
+			"  -sss       compute edit distance (no substitution, Eugene W. Myers' O(ND) diff algorithm)\n"
 			"  -S [name]  sort code diff (name, namelen, addr, size, type, dist) (only for -C or -g)\n"
 			"  -t [0-100] set threshold for code diff (default is 70%%)\n"
 			"  -x         show two column hexdump diffing\n"
 			"  -u         unified output (---+++)\n"
 			"  -U         unified output using system 'diff'\n"
 			"  -v         show version information\n"
-			"  -V         be verbose (current only for -s)\n"
+			"  -V         be verbose (for -s and -P, shows the algorithm and its runtime)\n"
 			"  -z         diff on extracted strings\n");
 	}
 	return 1;
@@ -667,7 +723,7 @@ int main(int argc, char **argv) {
 
 	evals = r_list_newf (NULL);
 
-	while ((o = getopt (argc, argv, "Aa:b:CDe:npg:G:BOijrhcdsS:uUvVxt:zq")) != -1) {
+	while ((o = getopt (argc, argv, "Aa:b:CDe:npPg:G:BOijrhcdsS:uUvVxt:zq")) != -1) {
 		switch (o) {
 		case 'a':
 			arch = optarg;
@@ -687,6 +743,9 @@ int main(int argc, char **argv) {
 		case 'p':
 			useva = false;
 			break;
+		case 'P':
+			mode = MODE_DELTA;
+			break;
 		case 'r':
 			diffmode = 'r';
 			break;
@@ -880,7 +939,7 @@ int main(int argc, char **argv) {
 			free (bufa);
 			return 1;
 		}
-		if (sza != szb) {
+		if (sza != szb && mode != MODE_DELTA) {
 			eprintf ("File size differs %d vs %d\n", sza, szb);
 		}
 		break;
@@ -959,6 +1018,13 @@ int main(int argc, char **argv) {
 		printf ("similarity: %.3f\n", sim);
 		printf ("distance: %d\n", count);
 		break;
+	case MODE_DELTA:
+		if (do_delta (bufa, sza, bufb, szb)) {
+			free (bufa);
+			free (bufb);
+			return 1;
+		}
+		break;
 	}
 
 	if (diffmode == 'j' && showcount) {
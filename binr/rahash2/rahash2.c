@@ -10,11 +10,14 @@
 #include <r_crypto.h>
 #include "../blob/version.c"
 
+#define RAHASH_CHUNK (4 * 1024 * 1024)
+
 static ut64 from = 0LL;
 static ut64 to = 0LL;
 static int incremental = 1;
 static int iterations = 0;
 static int quiet = 0;
+static int threads = 0;
 static RHashSeed s = {
 	0
 }, *_s = NULL;
@@ -118,6 +121,51 @@ static void do_hash_print(RHash *ctx, int hash, int dlen, int rad, int ule) {
 	}
 }
 
+static void do_entropy_print(double e, int rad) {
+	if (rad) {
+		eprintf ("entropy: %10f\n", e);
+	} else {
+		printf ("0x%08"PFMT64x "-0x%08"PFMT64x " %10f: ",
+			from, to > 0? to - 1: 0, e);
+		r_print_progressbar (NULL, 12.5 * e, 60);
+		printf ("\n");
+	}
+}
+
+typedef struct {
+	RHash *ctx;
+	int rad;
+	int ule;
+} BlockPrint;
+
+/* prints all the algorithms for one block of a -B map */
+static void do_hash_block(RHashBlockMap *bm, void *user) {
+	BlockPrint *bp = user;
+	ut64 i;
+	from = bm->addr;
+	to = bm->addr + bm->len;
+	for (i = 1; i < R_HASH_ALL; i <<= 1) {
+		if (!(bm->algobits & i)) {
+			continue;
+		}
+		if (i == R_HASH_ENTROPY) {
+			memset (bp->ctx->digest, 0, R_HASH_SIZE_ENTROPY);
+			*bp->ctx->digest = (ut8)bm->entropy;
+			do_entropy_print (bm->entropy, bp->rad);
+			continue;
+		}
+		RHashMultiAlgo *a = r_hash_multi_get (bm->hm, i);
+		if (!a) {
+			continue;
+		}
+		if (iterations > 0) {
+			r_hash_do_spice (a->ctx, i, iterations, _s);
+		}
+		memcpy (bp->ctx->digest, a->ctx->digest, sizeof (bp->ctx->digest));
+		do_hash_print (a->ctx, i, a->dlen, bp->rad, bp->ule);
+	}
+}
+
 static int do_hash_internal(RHash *ctx, ut64 hash, const ut8 *buf, int len, int rad, int print, int le) {
 	int dlen;
 	if (len < 0) {
@@ -131,15 +179,7 @@ static int do_hash_internal(RHash *ctx, ut64 hash, const ut8 *buf, int len, int
 		return 1;
 	}
 	if (hash == R_HASH_ENTROPY) {
-		double e = r_hash_entropy (buf, len);
-		if (rad) {
-			eprintf ("entropy: %10f\n", e);
-		} else {
-			printf ("0x%08"PFMT64x "-0x%08"PFMT64x " %10f: ",
-				from, to > 0? to - 1: 0, e);
-			r_print_progressbar (NULL, 12.5 * e, 60);
-			printf ("\n");
-		}
+		do_entropy_print (r_hash_entropy (buf, len), rad);
 	} else {
 		if (iterations > 0) {
 			r_hash_do_spice (ctx, hash, iterations, _s);
@@ -153,7 +193,7 @@ static int do_hash(const char *file, const char *algo, RIO *io, int bsize, int r
 	ut64 j, fsize, algobit = r_hash_name_to_bits (algo);
 	RHash *ctx;
 	ut8 *buf;
-	int ret = 0;
+	int k, ret = 0;
 	ut64 i;
 	bool first = true;
 	if (algobit == R_HASH_NONE) {
@@ -182,7 +222,11 @@ static int do_hash(const char *file, const char *algo, RIO *io, int bsize, int r
 		eprintf ("rahash2: Unknown file size\n");
 		return 1;
 	}
-	buf = calloc (1, bsize + 1);
+	if (incremental) {
+		/* the block size doesn't change the digests, keep reads bounded */
+		bsize = R_MIN (bsize, RAHASH_CHUNK);
+	}
+	buf = calloc (1, R_MIN (bsize, RAHASH_CHUNK) + 1);
 	if (!buf) {
 		return 1;
 	}
@@ -192,79 +236,88 @@ static int do_hash(const char *file, const char *algo, RIO *io, int bsize, int r
 		printf ("[");
 	}
 	if (incremental) {
-		for (i = 1; i < R_HASH_ALL; i <<= 1) {
-			if (algobit & i) {
-				ut64 hashbit = i & algobit;
-				int dlen = r_hash_size (hashbit);
-				r_hash_do_begin (ctx, i);
-				if (s.buf && s.prefix) {
-					do_hash_internal (ctx, hashbit, s.buf, s.len, rad, 0, ule);
-				}
-				for (j = from; j < to; j += bsize) {
-					int len = ((j + bsize) > to)? (to - j): bsize;
-					r_io_pread_at (io, j, buf, len);
-					do_hash_internal (ctx, hashbit, buf, len, rad, 0, ule);
-				}
-				if (s.buf && !s.prefix) {
-					do_hash_internal (ctx, hashbit, s.buf, s.len, rad, 0, ule);
-				}
-				r_hash_do_end (ctx, i);
-				if (iterations > 0) {
-					r_hash_do_spice (ctx, i, iterations, _s);
-				}
-				if (!*r_hash_name (i)) {
-					continue;
-				}
-				if (rad == 'j') {
-					if (first) {
-						first = false;
-					} else {
-						printf (",");
-					}
-				}
-				if (!quiet && rad != 'j') {
-					printf ("%s: ", file);
-				}
-				do_hash_print (ctx, i, dlen, quiet? 'n': rad, ule);
-				if (quiet == 1) {
-					printf (" %s\n", file);
+		/* every block is read once and fed to all the algorithms */
+		RHashMulti *hm = r_hash_multi_new (algobit);
+		if (!hm) {
+			eprintf ("rahash2: Cannot allocate the hashing contexts\n");
+			r_hash_free (ctx);
+			free (buf);
+			return 1;
+		}
+		if (s.buf && s.prefix) {
+			r_hash_multi_update (hm, s.buf, s.len);
+		}
+		for (j = from; j < to; j += bsize) {
+			int len = ((j + bsize) > to)? (to - j): bsize;
+			r_io_pread_at (io, j, buf, len);
+			r_hash_multi_update (hm, buf, len);
+		}
+		if (s.buf && !s.prefix) {
+			r_hash_multi_update (hm, s.buf, s.len);
+		}
+		r_hash_multi_end (hm);
+		for (k = 0; k < hm->count; k++) {
+			RHashMultiAlgo *a = &hm->algos[k];
+			i = a->bit;
+			if (iterations > 0) {
+				r_hash_do_spice (a->ctx, i, iterations, _s);
+			}
+			/* the last digest is the one checked by -c */
+			memcpy (ctx->digest, a->ctx->digest, sizeof (ctx->digest));
+			if (rad == 'j') {
+				if (first) {
+					first = false;
 				} else {
-					if (quiet && !rad) {
-						printf ("\n");
-					}
+					printf (",");
+				}
+			}
+			if (!quiet && rad != 'j') {
+				printf ("%s: ", file);
+			}
+			do_hash_print (a->ctx, i, a->dlen, quiet? 'n': rad, ule);
+			if (quiet == 1) {
+				printf (" %s\n", file);
+			} else {
+				if (quiet && !rad) {
+					printf ("\n");
 				}
 			}
 		}
+		r_hash_multi_free (hm);
 		if (_s) {
 			free (_s->buf);
 		}
 	} else {
-		/* iterate over all algorithm bits */
+		/* the file is read in big chunks and split into blocks by the
+		 * block map, which prints every block as soon as it is done */
+		ut64 ofrom = from, oto = to, end = R_MIN (to, fsize);
+		BlockPrint bp = { ctx, rad, ule };
+		RHashBlockMap *bm = r_hash_blockmap_new (algobit, bsize, 0, from, do_hash_block, &bp);
+		ut8 *chunk = malloc (RAHASH_CHUNK);
+		if (bm) {
+			bm->threads = threads > 0? threads: r_th_ncpus ();
+		}
 		if (s.buf) {
 			eprintf ("Warning: Seed ignored on per-block hashing.\n");
 		}
-		for (i = 1; i < R_HASH_ALL; i <<= 1) {
-			ut64 f, t, ofrom, oto;
-			if (algobit & i) {
-				ut64 hashbit = i & algobit;
-				ofrom = from;
-				oto = to;
-				f = from;
-				t = to;
-				for (j = f; j < t; j += bsize) {
-					int nsize = (j + bsize < fsize)? bsize: (fsize - j);
-					r_io_pread_at (io, j, buf, bsize);
-					from = j;
-					to = j + bsize;
-					if (to > fsize) {
-						to = fsize;
-					}
-					do_hash_internal (ctx, hashbit, buf, nsize, rad, 1, ule);
-				}
-				from = ofrom;
-				to = oto;
-			}
+		if (!bm || !chunk) {
+			eprintf ("rahash2: Cannot allocate the hashing contexts\n");
+			r_hash_blockmap_free (bm);
+			r_hash_free (ctx);
+			free (chunk);
+			free (buf);
+			return 1;
+		}
+		for (j = ofrom; j < end; j += RAHASH_CHUNK) {
+			int len = (int)R_MIN (end - j, RAHASH_CHUNK);
+			r_io_pread_at (io, j, chunk, len);
+			r_hash_blockmap_update (bm, chunk, len);
 		}
+		r_hash_blockmap_end (bm);
+		r_hash_blockmap_free (bm);
+		free (chunk);
+		from = ofrom;
+		to = oto;
 	}
 	if (rad == 'j') {
 		printf ("]\n");
@@ -300,6 +353,7 @@ static int do_help(int line) {
 		" -r          output radare commands\n"
 		" -s string   hash this string instead of files\n"
 		" -t to       stop hashing at given address\n"
+		" -T threads  threads hashing the blocks of -B (0 = one per cpu)\n"
 		" -x hexstr   hash this hexpair string instead of files\n"
 		" -v          show version information\n");
 	return 0;
@@ -448,7 +502,7 @@ int main(int argc, char **argv) {
 	RHash *ctx;
 	RIO *io;
 
-	while ((c = getopt (argc, argv, "jD:rveE:a:i:I:S:s:x:b:nBhf:t:kLqc:")) != -1) {
+	while ((c = getopt (argc, argv, "jD:rveE:a:i:I:S:s:x:b:nBhf:t:T:kLqc:")) != -1) {
 		switch (c) {
 		case 'q': quiet++; break;
 		case 'i':
@@ -473,6 +527,7 @@ int main(int argc, char **argv) {
 		case 'b': bsize = (int) r_num_math (NULL, optarg); break;
 		case 'f': from = r_num_math (NULL, optarg); break;
 		case 't': to = 1 + r_num_math (NULL, optarg); break;
+		case 'T': threads = atoi (optarg); break;
 		case 'v': return blob_version ("rahash2");
 		case 'h': return do_help (0);
 		case 's': setHashString (optarg, 0); break;
@@ -33,6 +33,7 @@ LDFLAGS+=../../shlr/windbg/libr_windbg.a
 LDFLAGS+=../../shlr/capstone/libcapstone.a
 LDFLAGS+=../../shlr/java/libr_java.a
 LDFLAGS+=../../libr/socket/libr_socket.a
+LDFLAGS+=../../shlr/lz4/liblz4.a
 LDFLAGS+=../../libr/util/libr_util.a
 ifneq (${OSTYPE},haiku)
 ifneq ($(CC),cccl)
@@ -75,6 +75,7 @@ R_API RAnal *r_anal_new() {
 	r_space_new (&anal->zign_spaces, "zs", zign_unset_for, zign_count_for, zign_rename_for, anal);
 	anal->sdb_fcns = sdb_ns (anal->sdb, "fcns", 1);
 	anal->sdb_meta = sdb_ns (anal->sdb, "meta", 1);
+	r_meta_init (anal);
 	anal->sdb_hints = sdb_ns (anal->sdb, "hints", 1);
 	anal->sdb_xrefs = sdb_ns (anal->sdb, "xrefs", 1);
 	anal->sdb_types = sdb_ns (anal->sdb, "types", 1);
@@ -133,6 +134,9 @@ R_API RAnal *r_anal_free(RAnal *a) {
 	r_list_free (a->plugins);
 	a->fcns->free = r_anal_fcn_free;
 	r_list_free (a->fcns);
+	r_anal_var_fini (a);
+	r_anal_type_ids_fini (a);
+	r_meta_fini (a);
 	r_space_free (&a->meta_spaces);
 	r_space_free (&a->zign_spaces);
 	r_anal_pin_fini (a);
@@ -407,6 +411,7 @@ R_API bool r_anal_op_is_eob (RAnalOp *op) {
 R_API int r_anal_purge (RAnal *anal) {
 	sdb_reset (anal->sdb_fcns);
 	sdb_reset (anal->sdb_meta);
+	r_meta_fini (anal);
 	sdb_reset (anal->sdb_hints);
 	sdb_reset (anal->sdb_xrefs);
 	sdb_reset (anal->sdb_types);
@@ -414,6 +419,8 @@ R_API int r_anal_purge (RAnal *anal) {
 	r_list_free (anal->fcns);
 	anal->fcns = r_anal_fcn_list_new ();
 	anal->fcn_tree = NULL;
+	r_anal_var_fini (anal);
+	r_anal_type_ids_fini (anal);
 #if USE_NEW_FCN_STORE
 	r_listrange_free (anal->fcnstore);
 	anal->fcnstore = r_listrange_new ();
@@ -270,7 +270,7 @@ R_API void r_anal_fcn_free(void *_fcn) {
 		return;
 	}
 	fcn->_size = 0;
-	free (fcn->name);
+	r_strpool_intern_release (fcn->name);
 	free (fcn->attr);
 	r_tinyrange_fini (&fcn->bbr);
 #if FCN_OLD
@@ -1430,6 +1430,14 @@ R_API int r_anal_fcn(RAnal *anal, RAnalFunction *fcn, ut64 addr, ut8 *buf, ut64
 }
 
 // TODO: need to implement r_anal_fcn_remove(RAnal *anal, RAnalFunction *fcn);
+/* function names are interned, the same string is shared with the
+ * flags and the bin symbols. name can be the current one */
+R_API void r_anal_fcn_set_name(RAnalFunction *fcn, const char *name) {
+	const char *s = name? r_strpool_intern (name): NULL;
+	r_strpool_intern_release (fcn->name);
+	fcn->name = (char *)s;
+}
+
 R_API int r_anal_fcn_insert(RAnal *anal, RAnalFunction *fcn) {
 	// RAnalFunction *f = r_anal_get_fcn_in (anal, fcn->addr, R_ANAL_FCN_TYPE_ROOT);
 	RAnalFunction *f = r_anal_get_fcn_at (anal, fcn->addr, R_ANAL_FCN_TYPE_ROOT);
@@ -1462,11 +1470,12 @@ R_API int r_anal_fcn_add(RAnal *a, ut64 addr, ut64 size, const char *name, int t
 	fcn->cc = r_str_const (r_anal_cc_default (a));
 	fcn->bits = a->bits;
 	r_anal_fcn_set_size (fcn, size);
-	free (fcn->name);
 	if (!name) {
-		fcn->name = r_str_newf ("fcn.%08"PFMT64x, fcn->addr);
+		char *s = r_str_newf ("fcn.%08"PFMT64x, fcn->addr);
+		r_anal_fcn_set_name (fcn, s);
+		free (s);
 	} else {
-		fcn->name = strdup (name);
+		r_anal_fcn_set_name (fcn, name);
 	}
 	fcn->type = type;
 	if (diff) {
@@ -559,7 +559,7 @@ static int module_match_buffer(const RAnal *anal, const RFlirtModule *module,
 
 		next_module_function = r_anal_get_fcn_at ((RAnal *) anal, address + flirt_func->offset, 0);
 		if (next_module_function) {
-			char *name;
+			char *name, *fname;
 			int name_offs = 0;
 			ut32 next_module_function_size;
 
@@ -606,8 +606,9 @@ static int module_match_buffer(const RAnal *anal, const RFlirtModule *module,
 				continue;
 			}
 			name = r_name_filter2 (flirt_func->name + name_offs);
-			free (next_module_function->name);
-			next_module_function->name = r_str_newf ("flirt.%s", name);
+			fname = r_str_newf ("flirt.%s", name);
+			r_anal_fcn_set_name (next_module_function, fname);
+			free (fname);
 			anal->flb.set (anal->flb.f, next_module_function->name,
 				next_module_function->addr, next_module_function_size);
 			anal->cb_printf ("Found %s\n", next_module_function->name);
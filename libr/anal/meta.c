@@ -8,7 +8,6 @@
     - actually listing only works in memory
     - array_add doesnt needs index, right?
     - remove unused arguments from r_meta_find (where ?)
-    - implement r_meta_find
 #endif
 #if 0
   SDB SPECS
@@ -16,84 +15,151 @@
 DatabaseName:
   'anal.meta'
 Keys:
-  'meta.<type>.count=<int>'     number of added metas where 'type' is a single char
-  'meta.<type>.<last>=<array>'  splitted array, each block contains K elements
   'meta.<type>.<addr>=<string>' string representing extra information of the meta type at given address
-  'range.<baddr>=<array>'       store valid addresses in a base range array
+  'meta.<addr>=<array>'         types added with r_meta_add at given address
+
+The meta.<type>.<addr> keys are mirrored in anal->meta_tree by a hook
+on the sdb, all the lookups are done there.
 #endif
 
 #include <r_anal.h>
 #include <r_core.h>
 #include <r_print.h>
 
-#define META_RANGE_BASE(x) ((x)>>12)
-#define META_RANGE_SIZE 0xfff
 #undef DB
 #define DB a->sdb_meta
 
-#if 0
-// Defined but not used. Shall we remove it?
-static char *meta_inrange_get (RAnal *a, ut64 addr, int size) {
-	char key[64];
-	ut64 base, base2;
-	base = META_RANGE_BASE (addr);
-	base2 = META_RANGE_BASE (addr+size);
-	// return string array of all the offsets where there are stuff
-	for (; base<base2; base += META_RANGE_SIZE) {
-		snprintf (key, sizeof (key)-1, "range.0x%"PFMT64x, base);
-		sdb_array_get (DB, key, 0, 0);
+/* the metas are kept in a tree sorted by address and type, each node
+ * knows the last address covered by its subtree, so the ones overlapping
+ * a range are found in O(log(n) + k) like the functions in fcn_tree */
+typedef struct meta_node_t {
+	RAnalMetaItem item;
+	ut64 rb_max_addr;
+	RBNode rb;
+} MetaNode;
+
+#define META_NODE(x) container_of (x, MetaNode, rb)
+
+typedef bool (*MetaForeachCallback)(RAnalMetaItem *mi, void *user);
+
+/* comments and highlights keep the length of the text in size, they
+ * only cover their own address */
+static ut64 meta_last_addr(const RAnalMetaItem *mi) {
+	ut64 last = mi->from + mi->size - 1;
+	if (!mi->size || mi->type == R_META_TYPE_COMMENT || mi->type == R_META_TYPE_HIGHLIGHT) {
+		return mi->from;
 	}
-	return NULL;
+	return last < mi->from? UT64_MAX: last;
 }
-#endif
 
-static int meta_inrange_add (RAnal *a, ut64 addr, int size) {
-	int set = 0;
-	char key[64];
-	ut64 base, base2;
-	base = META_RANGE_BASE (addr);
-	base2 = META_RANGE_BASE (addr+size);
-	for (; base<base2; base += META_RANGE_SIZE) {
-		snprintf (key, sizeof (key)-1, "range.0x%"PFMT64x, base);
-		if (sdb_array_add_num (DB, key, addr, 0))
-			set = 1;
-	}
-	return set;
-}
-
-static int meta_inrange_del (RAnal *a, ut64 addr, int size) {
-	int set = 0;
-	char key[64];
-	ut64 base = META_RANGE_BASE (addr);
-	ut64 base2 = META_RANGE_BASE (addr+size);
-// TODO: optimize this thing?
-	for (; base<base2; base += META_RANGE_SIZE) {
-		snprintf (key, sizeof (key)-1, "range.0x%"PFMT64x, base);
-		if (sdb_array_remove_num (DB, key, addr, 0))
-			set = 1;
-	}
-	//sdb_array_del (DB);
-	return set;
-}
-
-// 512 = 1.5s
-// 256 = 1.3s
-// 128 = 1.2s
-// 64 = 1.14
-// 32 = 1.12
-// not storing any = 1
-#define K 256
-
-static int meta_type_add(RAnal *a, char type, ut64 addr) {
-	char key[32];
-	ut32 count, last;
-	snprintf (key, sizeof (key)-1, "meta.%c.count", type);
-	count = (ut32)sdb_num_inc (DB, key, 1, 0);
-	last = count/K;
-
-	snprintf (key, sizeof (key)-1, "meta.%c.%d", type, last);
-	sdb_array_add_num (DB, key, addr, 0);
-	return count;
+static int meta_cmp(const void *incoming, const RBNode *in_tree) {
+	const RAnalMetaItem *a = incoming;
+	const RAnalMetaItem *b = &container_of (in_tree, const MetaNode, rb)->item;
+	if (a->from != b->from) {
+		return a->from < b->from? -1: 1;
+	}
+	if (a->type != b->type) {
+		return a->type < b->type? -1: 1;
+	}
+	return 0;
+}
+
+static void meta_calc_max_addr(RBNode *node) {
+	MetaNode *m = META_NODE (node), *m1;
+	int i;
+	m->rb_max_addr = meta_last_addr (&m->item);
+	for (i = 0; i < 2; i++) {
+		if (node->child[i]) {
+			m1 = META_NODE (node->child[i]);
+			if (m1->rb_max_addr > m->rb_max_addr) {
+				m->rb_max_addr = m1->rb_max_addr;
+			}
+		}
+	}
+}
+
+static void meta_node_free(RBNode *node) {
+	MetaNode *m = META_NODE (node);
+	free (m->item.str);
+	free (m);
+}
+
+static MetaNode *meta_node_get(RAnal *a, ut64 from, int type) {
+	RAnalMetaItem key = { .from = from, .type = type };
+	RBNode *node = r_rbtree_find (a->meta_tree, &key, meta_cmp);
+	return node? META_NODE (node): NULL;
+}
+
+/* calls cb in address order for the metas overlapping [from, to) until
+ * it returns false. the subtrees ending before from are skipped and the
+ * walk stops at the first node starting after to */
+static bool meta_foreach_in(RBNode *node, ut64 from, ut64 to, int type, MetaForeachCallback cb, void *user) {
+	MetaNode *m;
+	if (!node || (m = META_NODE (node))->rb_max_addr < from) {
+		return true;
+	}
+	if (!meta_foreach_in (node->child[0], from, to, type, cb, user)) {
+		return false;
+	}
+	if (m->item.from >= to) {
+		return true;
+	}
+	if (meta_last_addr (&m->item) >= from && (type == R_META_TYPE_ANY || type == m->item.type)) {
+		if (!cb (&m->item, user)) {
+			return false;
+		}
+	}
+	return meta_foreach_in (node->child[1], from, to, type, cb, user);
+}
+
+/* keeps meta_tree in sync with the meta.<type>.<addr> keys, v is empty
+ * when the key is unset */
+static void meta_hook(Sdb *s, void *user, const char *k, const char *v) {
+	RAnal *a = user;
+	RAnalMetaItem mi = {0};
+	MetaNode *m;
+	char *end;
+	if (strncmp (k, "meta.", 5) || !k[5] || strncmp (k + 6, ".0x", 3)) {
+		return;
+	}
+	mi.type = k[5];
+	mi.from = strtoull (k + 9, &end, 16);
+	if (*end) {
+		/* var comments have an index after the address */
+		return;
+	}
+	m = meta_node_get (a, mi.from, mi.type);
+	if (!v || !*v || !r_meta_deserialize_val (&mi, mi.type, mi.from, v)) {
+		if (m) {
+			r_rbtree_aug_delete (&a->meta_tree, &mi, meta_cmp, meta_node_free, meta_calc_max_addr);
+		}
+		free (mi.str);
+		return;
+	}
+	if (m && meta_last_addr (&m->item) == meta_last_addr (&mi)) {
+		/* same range, the pointers given out stay valid */
+		free (m->item.str);
+		m->item = mi;
+		return;
+	}
+	if (m) {
+		r_rbtree_aug_delete (&a->meta_tree, &mi, meta_cmp, meta_node_free, meta_calc_max_addr);
+	}
+	if (!(m = R_NEW0 (MetaNode))) {
+		free (mi.str);
+		return;
+	}
+	m->item = mi;
+	r_rbtree_aug_insert (&a->meta_tree, &m->item, &m->rb, meta_cmp, meta_calc_max_addr);
+}
+
+R_API void r_meta_init(RAnal *a) {
+	sdb_hook (DB, meta_hook, a);
+}
+
+R_API void r_meta_fini(RAnal *a) {
+	r_rbtree_free (a->meta_tree, meta_node_free);
+	a->meta_tree = NULL;
 }
 
 // TODO: Add APIs to resize meta? nope, just del and add
@@ -102,13 +168,11 @@ R_API int r_meta_set_string(RAnal *a, int type, ut64 addr, const char *s) {
 	int ret;
 	ut64 size;
 	int space_idx = a->meta_spaces.space_idx;
-	meta_type_add (a, type, addr);
 
 	snprintf (key, sizeof (key)-1, "meta.%c.0x%"PFMT64x, type, addr);
 	size = sdb_array_get_num (DB, key, 0, 0);
 	if (!size) {
 		size = strlen (s);
-		meta_inrange_add (a, addr, size);
 		ret = true;
 	} else {
 		ret = false;
@@ -130,13 +194,11 @@ R_API int r_meta_set_var_comment(RAnal *a, int type, ut64 idx, ut64 addr, const
 	int ret;
 	ut64 size;
 	int space_idx = a->meta_spaces.space_idx;
-	meta_type_add (a, type, addr);
 
 	snprintf (key, sizeof (key)-1, "meta.%c.0x%"PFMT64x".0x%"PFMT64x, type, addr, idx);
 	size = sdb_array_get_num (DB, key, 0, 0);
 	if (!size) {
 		size = strlen (s);
-		meta_inrange_add (a, addr, size);
 		ret = true;
 	} else {
 		ret = false;
@@ -149,30 +211,8 @@ R_API int r_meta_set_var_comment(RAnal *a, int type, ut64 idx, ut64 addr, const
 }
 
 R_API char *r_meta_get_string(RAnal *a, int type, ut64 addr) {
-	char key[100];
-	const char *k, *p, *p2, *p3;
-	snprintf (key, sizeof (key)-1, "meta.%c.0x%"PFMT64x, type, addr);
-	k = sdb_const_get (DB, key, NULL);
-	if (!k) {
-		return NULL;
-	}
-	p = strchr (k, SDB_RS);
-	if (!p) {
-		return NULL;
-	}
-	k = p + 1;
-	p2 = strchr (k, SDB_RS);
-	if (!p2) {
-		return (char *)sdb_decode (k, NULL);
-	}
-	k = p2 + 1;
-	if (type == R_META_TYPE_STRING) {
-		p3 = strchr (k, SDB_RS);
-		if (p3) {
-			return (char *)sdb_decode (p3 + 1, NULL);
-		}
-	}
-	return (char *)sdb_decode (k, NULL);
+	MetaNode *m = meta_node_get (a, addr, type);
+	return (m && m->item.str)? strdup (m->item.str): NULL;
 }
 
 R_API char *r_meta_get_var_comment (RAnal *a, int type, ut64 idx, ut64 addr) {
@@ -196,31 +236,31 @@ R_API char *r_meta_get_var_comment (RAnal *a, int type, ut64 idx, ut64 addr) {
 }
 
 R_API int r_meta_del(RAnal *a, int type, ut64 addr, ut64 size) {
-	char key[100], *dtr, *s, *p, *next;
+	char key[100];
 	const char *val;
-	int i;
 	if (size == UT64_MAX) {
 		// FULL CLEANUP
-		// XXX: this thing ignores the type
 		if (type == R_META_TYPE_ANY) {
+			/* sdb_reset does not call the hooks */
 			sdb_reset (DB);
+			r_meta_fini (a);
 		} else {
-			snprintf (key, sizeof (key)-1, "meta.%c.count", type);
-			int last = (ut64)sdb_num_get (DB, key, NULL)/K;
-			for (i=0; i<last; i++) {
-				snprintf (key, sizeof (key)-1, "meta.%c.%d", type, i);
-				dtr = sdb_get (DB, key, 0);
-				for (p = dtr; p; p = next) {
-					s = sdb_anext (p, &next);
-					snprintf (key, sizeof (key)-1,
-						"meta.%c.0x%"PFMT64x,
-						type, sdb_atoi (s));
-					eprintf ("--> %s\n", key);
-					sdb_unset (DB, key, 0);
-					if (!next) break;
+			RList *list = r_meta_find_list_in (a, 0, UT64_MAX, type);
+			int i = 0, n = r_list_length (list);
+			ut64 *addrs = n? calloc (n, sizeof (ut64)): NULL;
+			RAnalMetaItem *mi;
+			RListIter *iter;
+			/* the items go away with their keys */
+			if (addrs) {
+				r_list_foreach (list, iter, mi) {
+					addrs[i++] = mi->from;
+				}
+				for (i = 0; i < n; i++) {
+					r_meta_del (a, type, addrs[i], 1);
 				}
-				free (dtr);
+				free (addrs);
 			}
+			r_list_free (list);
 		}
 		return false;
 	}
@@ -228,7 +268,6 @@ R_API int r_meta_del(RAnal *a, int type, ut64 addr, ut64 size) {
 		/* special case */
 		r_meta_del (a, R_META_TYPE_COMMENT, addr, size);
 	}
-	meta_inrange_del (a, addr, size);
 	snprintf (key, sizeof (key)-1, type == R_META_TYPE_COMMENT ?
 		"meta.C.0x%"PFMT64x : "meta.0x%"PFMT64x, addr);
 	val = sdb_const_get (DB, key, 0);
@@ -267,9 +306,9 @@ R_API int r_meta_del(RAnal *a, int type, ut64 addr, ut64 size) {
 	return false;
 }
 R_API int r_meta_var_comment_del(RAnal *a, int type, ut64 idx, ut64 addr) {
-	char *key;
-	key = r_str_newf ("meta.%c.0x%"PFMT64x"0x%"PFMT64x, type, addr, idx);
+	char *key = r_str_newf ("meta.%c.0x%"PFMT64x".0x%"PFMT64x, type, addr, idx);
 	sdb_unset (DB, key, 0);
+	free (key);
 	return 0;
 }
 
@@ -381,41 +420,64 @@ R_API int r_meta_add_with_subtype(RAnal *a, int type, int subtype, ut64 from, ut
 	return meta_add (a, type, subtype, from, to, str);
 }
 
+/* the item stays valid until the metas at its address change. comments
+ * and highlights are not returned for R_META_TYPE_ANY */
 R_API RAnalMetaItem *r_meta_find(RAnal *a, ut64 at, int type, int where) {
-	const char *infos, *metas;
-	char key[100];
-	Sdb *s = a->sdb_meta;
-	static RAnalMetaItem mi = {0};
-	// XXX: return allocated item? wtf
+	RAnalMetaItem key = { .from = at, .type = R_META_TYPE_ANY };
+	MetaNode *m;
+	RBIter it;
 	if (where != R_META_WHERE_HERE) {
 		eprintf ("THIS WAS NOT SUPOSED TO HAPPEN\n");
 		return NULL;
 	}
-
-	snprintf (key, sizeof (key), "meta.0x%" PFMT64x, at);
-	infos = sdb_const_get (s, key, 0);
-	if (!infos) {
-		return NULL;
+	if (type != R_META_TYPE_ANY) {
+		m = meta_node_get (a, at, type);
+		return m? &m->item: NULL;
 	}
-	for (; *infos; infos++) {
-		if (*infos == ',') {
-			continue;
-		}
-		if (type != R_META_TYPE_ANY && type != *infos) {
-			continue;
+	it = r_rbtree_lower_bound_forward (a->meta_tree, &key, meta_cmp);
+	r_rbtree_iter_while (it, m, MetaNode, rb) {
+		if (m->item.from != at) {
+			break;
 		}
-		snprintf (key, sizeof (key), "meta.%c.0x%" PFMT64x, *infos, at);
-		metas = sdb_const_get (s, key, 0);
-		if (metas) {
-			if (!r_meta_deserialize_val (&mi, *infos, at, metas)) {
-				continue;
-			}
-			return &mi;
+		if (m->item.type != R_META_TYPE_COMMENT && m->item.type != R_META_TYPE_HIGHLIGHT) {
+			return &m->item;
 		}
 	}
 	return NULL;
 }
 
+static bool meta_list_cb(RAnalMetaItem *mi, void *user) {
+	RList **list = user;
+	if (!*list && !(*list = r_list_new ())) {
+		return false;
+	}
+	r_list_append (*list, mi);
+	return true;
+}
+
+/* metas overlapping [from, to) sorted by address, NULL if there are none.
+ * the items belong to the meta store like the ones from r_meta_find */
+R_API RList *r_meta_find_list_in(RAnal *a, ut64 from, ut64 to, int type) {
+	RList *list = NULL;
+	if (from < to) {
+		meta_foreach_in (a->meta_tree, from, to, type, meta_list_cb, &list);
+	}
+	return list;
+}
+
+static bool meta_count_in_cb(RAnalMetaItem *mi, void *user) {
+	(*(int *)user)++;
+	return true;
+}
+
+R_API int r_meta_count(RAnal *a, int type, ut64 from, ut64 to) {
+	int count = 0;
+	if (from < to) {
+		meta_foreach_in (a->meta_tree, from, to, type, meta_count_in_cb, &count);
+	}
+	return count;
+}
+
 R_API const char *r_meta_type_to_string(int type) {
 	// XXX: use type as '%c'
 	switch (type) {
@@ -681,29 +743,19 @@ R_API int r_meta_list_at(RAnal *a, int type, int rad, ut64 addr) {
 	return r_meta_list_cb (a, type, rad, NULL, NULL, addr);
 }
 
-static int meta_enumerate_cb(void *user, const char *k, const char *v) {
-	RAnalMetaUserItem *ui = user;
-	RList *list = ui->user;
-	RAnalMetaItem *it = R_NEW0 (RAnalMetaItem);
-	if (!it) {
-		return 0;
-	}
-	if (!meta_deserialize (it, k, v)) {
-		free (it);
-		goto beach;
+static bool meta_enumerate_cb(RAnalMetaItem *mi, void *user) {
+	if (mi->str) {
+		r_list_append (user, mi);
 	}
-	if (!it->str) {
-		free (it);
-		goto beach;
-	}
-	r_list_append (list, it);
-beach:
-	return 1;
+	return true;
 }
 
+/* the items belong to the meta store, see r_meta_find */
 R_API RList *r_meta_enumerate(RAnal *a, int type) {
 	RList *list = r_list_new ();
-	r_meta_list_cb (a, type, 0, meta_enumerate_cb, list, UT64_MAX);
+	if (list) {
+		meta_foreach_in (a->meta_tree, 0, UT64_MAX, type, meta_enumerate_cb, list);
+	}
 	return list;
 }
 
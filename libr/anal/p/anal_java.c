@@ -473,11 +473,10 @@ static int analyze_from_code_buffer(RAnal *anal, RAnalFunction *fcn, ut64 addr,
 	int result = R_ANAL_RET_ERROR;
 	RAnalJavaLinearSweep *nodes;
 
-	free (fcn->name);
 	free (fcn->dsc);
 	snprintf (gen_name, 1024, "sym.%08"PFMT64x"", addr);
 
-	fcn->name = strdup (gen_name);
+	r_anal_fcn_set_name (fcn, gen_name);
 	fcn->dsc = strdup ("unknown");
 	r_anal_fcn_set_size (fcn, code_length);
 	fcn->type = R_ANAL_FCN_TYPE_FCN;
@@ -516,7 +515,7 @@ static int analyze_from_code_attr (RAnal *anal, RAnalFunction *fcn, RBinJavaFiel
 	ut64 code_addr = -1;
 
 	if (!code_attr) {
-		fcn->name = strdup ("sym.UNKNOWN");
+		r_anal_fcn_set_name (fcn, "sym.UNKNOWN");
 		fcn->dsc = strdup ("unknown");
 		r_anal_fcn_set_size (fcn, code_length);
 		fcn->type = R_ANAL_FCN_TYPE_FCN;
@@ -534,16 +533,18 @@ static int analyze_from_code_attr (RAnal *anal, RAnalFunction *fcn, RBinJavaFiel
 
 	{
 		char *name = strdup (method->name);
+		char *fname;
 		r_name_filter (name, 80);
-		free (fcn->name);
 		if (method->class_name) {
 			char *cname = strdup (method->class_name);
 			r_name_filter (cname, 50);
-			fcn->name = r_str_newf ("sym.%s.%s", cname, name);
+			fname = r_str_newf ("sym.%s.%s", cname, name);
 			free (cname);
 		} else {
-			fcn->name = r_str_newf ("sym.%s", name);
+			fname = r_str_newf ("sym.%s", name);
 		}
+		r_anal_fcn_set_name (fcn, fname);
+		free (fname);
 		free (name);
 	}
 
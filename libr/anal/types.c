@@ -70,6 +70,58 @@ R_API void r_anal_type_del(RAnal *anal, const char *name) {
 	}
 }
 
+static void type_ids_free_kv(HtKv *kv) {
+	free (kv->key);
+	free (kv);
+}
+
+/* the variables keep their type as an id, the same name always gets the
+ * same id and ids are not reused, so they stay valid if the type changes */
+R_API int r_anal_type_id(RAnal *anal, const char *name) {
+	RAnalTypeIds *t = &anal->type_ids;
+	bool found = false;
+	int id;
+	if (!name) {
+		return -1;
+	}
+	if (!t->ids && !(t->ids = ht_new (NULL, type_ids_free_kv, NULL))) {
+		return -1;
+	}
+	id = (int)(size_t)ht_find (t->ids, name, &found);
+	if (found) {
+		return id - 1;
+	}
+	if (t->count == t->size) {
+		int size = t->size? t->size * 2: 64;
+		const char **names = realloc (t->names, size * sizeof (char *));
+		if (!names) {
+			return -1;
+		}
+		t->names = names;
+		t->size = size;
+	}
+	t->names[t->count] = r_strpool_intern (name);
+	ht_insert (t->ids, name, (void *)(size_t)(t->count + 1));
+	return t->count++;
+}
+
+R_API const char *r_anal_type_id_name(RAnal *anal, int id) {
+	RAnalTypeIds *t = &anal->type_ids;
+	return (id >= 0 && id < t->count)? t->names[id]: NULL;
+}
+
+R_API void r_anal_type_ids_fini(RAnal *anal) {
+	RAnalTypeIds *t = &anal->type_ids;
+	int i;
+	for (i = 0; i < t->count; i++) {
+		r_strpool_intern_release (t->names[i]);
+	}
+	R_FREE (t->names);
+	t->count = t->size = 0;
+	ht_free (t->ids);
+	t->ids = NULL;
+}
+
 R_API int r_anal_type_get_size(RAnal *anal, const char *type) {
 	char *query;
 	/* Filter out the structure keyword if type looks like "struct mystruc" */
@@ -7,19 +7,129 @@
 
 #define DB a->sdb_fcns
 
-struct VarType {
-	char kind;
-	char *type;
-	int size;
-	char *name;
-};
-
-#define SDB_VARTYPE_FMT "czdz"
-
 #define EXISTS(x, ...) snprintf (key, sizeof (key) - 1, x, ## __VA_ARGS__), sdb_exists (DB, key)
 #define SETKEY(x, ...) snprintf (key, sizeof (key) - 1, x, ## __VA_ARGS__);
 #define SETKEY2(x, ...) snprintf (key2, sizeof (key) - 1, x, ## __VA_ARGS__);
 #define SETVAL(x, ...) snprintf (val, sizeof (val) - 1, x, ## __VA_ARGS__);
+
+/* the local variables are kept in anal->var_tree, one array per function
+ * in a tree sorted by address, not in sdb_fcns */
+
+static int fcn_vars_cmp(const void *incoming, const RBNode *in_tree) {
+	ut64 addr = *(const ut64 *)incoming;
+	const RAnalFcnVars *fv = container_of (in_tree, const RAnalFcnVars, rb);
+	if (addr != fv->addr) {
+		return addr < fv->addr? -1: 1;
+	}
+	return 0;
+}
+
+static void fcn_vars_free(RBNode *node) {
+	RAnalFcnVars *fv = container_of (node, RAnalFcnVars, rb);
+	int i;
+	for (i = 0; i < fv->count; i++) {
+		r_strpool_intern_release (fv->vars[i].name);
+	}
+	free (fv->vars);
+	free (fv);
+}
+
+static RAnalFcnVars *fcn_vars(RAnal *a, ut64 addr, bool create) {
+	RBNode *node = r_rbtree_find (a->var_tree, &addr, fcn_vars_cmp);
+	RAnalFcnVars *fv;
+	if (node) {
+		return container_of (node, RAnalFcnVars, rb);
+	}
+	if (!create || !(fv = R_NEW0 (RAnalFcnVars))) {
+		return NULL;
+	}
+	fv->addr = addr;
+	r_rbtree_insert (&a->var_tree, &addr, &fv->rb, fcn_vars_cmp);
+	return fv;
+}
+
+static RAnalVarItem *var_item_find(RAnalFcnVars *fv, char kind, int delta) {
+	int i;
+	if (fv) {
+		for (i = 0; i < fv->count; i++) {
+			if (fv->vars[i].delta == delta && fv->vars[i].kind == kind) {
+				return &fv->vars[i];
+			}
+		}
+	}
+	return NULL;
+}
+
+/* names are interned, so they can be compared by pointer. the last
+ * variable added wins if two of them share a name */
+static RAnalVarItem *var_item_find_name(RAnalFcnVars *fv, char kind, const char *name) {
+	const char *iname = name? r_strpool_intern_find (name): NULL;
+	int i;
+	if (fv && iname) {
+		for (i = fv->count - 1; i >= 0; i--) {
+			if (fv->vars[i].name == iname && (!kind || fv->vars[i].kind == kind)) {
+				return &fv->vars[i];
+			}
+		}
+	}
+	return NULL;
+}
+
+static RAnalVarItem *var_item_add(RAnalFcnVars *fv, char kind, int delta) {
+	RAnalVarItem *v = var_item_find (fv, kind, delta);
+	if (v) {
+		return v;
+	}
+	if (fv->count == fv->size) {
+		int size = fv->size? fv->size * 2: 8;
+		RAnalVarItem *vars = realloc (fv->vars, size * sizeof (RAnalVarItem));
+		if (!vars) {
+			return NULL;
+		}
+		fv->vars = vars;
+		fv->size = size;
+	}
+	v = &fv->vars[fv->count++];
+	memset (v, 0, sizeof (RAnalVarItem));
+	v->kind = kind;
+	v->delta = delta;
+	return v;
+}
+
+static void var_item_set(RAnal *a, RAnalVarItem *v, const char *type, int size, const char *name) {
+	const char *iname = r_strpool_intern (name? name: "");
+	r_strpool_intern_release (v->name);
+	v->name = iname;
+	v->type = r_anal_type_id (a, type);
+	v->size = size;
+}
+
+static void var_item_remove(RAnalFcnVars *fv, RAnalVarItem *v) {
+	int i = v - fv->vars;
+	r_strpool_intern_release (v->name);
+	memmove (v, v + 1, (fv->count - i - 1) * sizeof (RAnalVarItem));
+	fv->count--;
+}
+
+static RAnalVar *var_item_get(RAnal *a, RAnalVarItem *v) {
+	const char *type = r_anal_type_id_name (a, v->type);
+	RAnalVar *av = R_NEW0 (RAnalVar);
+	if (!av) {
+		return NULL;
+	}
+	av->delta = v->delta;
+	av->kind = v->kind;
+	av->name = strdup (v->name? v->name: "unkown_var");
+	av->size = v->size;
+	av->type = strdup (type? type: "unkown_type");
+	return av;
+}
+
+R_API void r_anal_var_fini(RAnal *a) {
+	r_rbtree_free (a->var_tree, fcn_vars_free);
+	a->var_tree = NULL;
+}
+
 R_API bool r_anal_var_display(RAnal *anal, int delta, char kind, const char *type) {
 	char *fmt = r_anal_type_format (anal, type);
 	RRegItem *i;
@@ -87,32 +197,20 @@ R_API bool r_anal_var_add(RAnal *a, ut64 addr, int scope, int delta, char kind,
 		eprintf ("Invalid var kind '%c'\n", kind);
 		return false;
 	}
-	const char *var_def = sdb_fmt (0, "%c,%s,%d,%s", kind, type, size, name);
 	if (scope > 0) {
-		const char *sign = "";
-		if (delta < 0) {
-			delta = -delta;
-			sign = "_";
-		}
 		/* local variable */
-		const char *fcn_key = sdb_fmt (1, "fcn.0x%"PFMT64x ".%c", addr, kind);
-		const char *var_key = sdb_fmt (2, "var.0x%"PFMT64x ".%c.%d.%s%d", addr, kind, scope, sign, delta);
-		const char *name_key = sdb_fmt (3, "var.0x%"PFMT64x ".%d.%s", addr, scope, name);
-		const char *shortvar = sdb_fmt (4, "%d.%s%d", scope, sign, delta);
-		sdb_array_add (DB, fcn_key, shortvar, 0);
-		sdb_set (DB, var_key, var_def, 0);
-		if (*sign) {
-			delta = -delta;
+		RAnalFcnVars *fv = fcn_vars (a, addr, true);
+		RAnalVarItem *v = fv? var_item_add (fv, kind, delta): NULL;
+		if (!v) {
+			return false;
 		}
-		const char *name_val = sdb_fmt (5, "%c,%d", kind, delta);
-		sdb_set (DB, name_key, name_val, 0);
+		var_item_set (a, v, type, size, name);
 	} else {
 		/* global variable */
 		const char *var_global = sdb_fmt (1, "var.0x%"PFMT64x, addr);
 		const char *var_def = sdb_fmt (2, "%c.%s,%d,%s", kind, type, size, name);
 		sdb_array_add (DB, var_global, var_def, 0);
 	}
-// ls_sort (DB->ht->list, mystrcmp);
 	return true;
 }
 
@@ -131,19 +229,6 @@ R_API int r_anal_var_retype(RAnal *a, ut64 addr, int scope, int delta, char kind
 		eprintf ("Cant find function here\n");
 		return false;
 	}
-	if (size == -1) {
-		RList *list = r_anal_var_list (a, fcn, kind);
-		RListIter *iter;
-		RAnalVar *var;
-		r_list_foreach (list, iter, var) {
-			if (delta == -1 && !strcmp (var->name, name)) {
-				delta = var->delta;
-				size = var->size;
-				break;
-			}
-		}
-		r_list_free (list);
-	}
 	switch (kind) {
 	case R_ANAL_VAR_KIND_REG:
 	case R_ANAL_VAR_KIND_BPV:
@@ -153,18 +238,21 @@ R_API int r_anal_var_retype(RAnal *a, ut64 addr, int scope, int delta, char kind
 		eprintf ("Invalid var kind '%c'\n", kind);
 		return false;
 	}
-	const char *var_def = sdb_fmt (0, "%c,%s,%d,%s", kind, type, size, name);
 	if (scope > 0) {
-		char *sign = delta> 0? "": "_";
 		/* local variable */
-		const char *fcn_key = sdb_fmt (1, "fcn.0x%"PFMT64x ".%c", fcn->addr, kind);
-		const char *var_key = sdb_fmt (2, "var.0x%"PFMT64x ".%c.%d.%s%d", fcn->addr, kind, scope, sign, R_ABS(delta));
-		const char *name_key = sdb_fmt (3, "var.0x%"PFMT64x ".%d.%s", fcn->addr, scope, name);
-		const char *shortvar = sdb_fmt (4, "%d.%s%d", scope, sign, R_ABS(delta));
-		const char *name_val = sdb_fmt (5, "%c,%d", kind, delta);
-		sdb_array_add (DB, fcn_key, shortvar, 0);
-		sdb_set (DB, var_key, var_def, 0);
-		sdb_set (DB, name_key, name_val, 0);
+		RAnalFcnVars *fv = fcn_vars (a, fcn->addr, true);
+		RAnalVarItem *v;
+		if (!fv) {
+			return false;
+		}
+		if (size == -1 && delta == -1 && (v = var_item_find_name (fv, kind, name))) {
+			delta = v->delta;
+			size = v->size;
+		}
+		if (!(v = var_item_add (fv, kind, delta))) {
+			return false;
+		}
+		var_item_set (a, v, type, size, name);
 		Sdb *TDB = a->sdb_types;
 		const char *type_kind = sdb_const_get (TDB, type, 0);
 		if (type_kind && r_str_startswith (type_kind, "struct")) {
@@ -186,6 +274,7 @@ R_API int r_anal_var_retype(RAnal *a, ut64 addr, int scope, int delta, char kind
 		}
 	} else {
 		/* global variable */
+		const char *var_def = sdb_fmt (0, "%c,%s,%d,%s", kind, type, size, name);
 		const char *var_global = sdb_fmt (1, "var.0x%"PFMT64x, fcn->addr);
 		sdb_array_add (DB, var_global, var_def, 0);
 	}
@@ -194,160 +283,81 @@ R_API int r_anal_var_retype(RAnal *a, ut64 addr, int scope, int delta, char kind
 
 R_API int r_anal_var_delete_all(RAnal *a, ut64 addr, const char kind) {
 	RAnalFunction *fcn = r_anal_get_fcn_in (a, addr, 0);
-	if (fcn) {
-		RAnalVar *v;
-		RListIter *iter;
-		RList *list = r_anal_var_list (a, fcn, kind);
-		r_list_foreach (list, iter, v) {
-			// r_anal_var_delete (a, addr, kind, v->scope, v->delta);
-			r_anal_var_delete (a, addr, kind, 1, v->delta);
+	RAnalFcnVars *fv = fcn? fcn_vars (a, fcn->addr, false): NULL;
+	int i = 0;
+	while (fv && i < fv->count) {
+		RAnalVarItem *v = &fv->vars[i];
+		if (v->kind == kind) {
+			int delta = v->delta;
+			var_item_remove (fv, v);
+			r_anal_var_access_clear (a, addr, 1, delta);
+		} else {
+			i++;
 		}
-		// XXX: i dont think we want to alocate and free by hand. r_anal_var_delete should be the list->free already
-		r_list_free (list);
 	}
 	return 0;
 }
 
 R_API int r_anal_var_delete(RAnal *a, ut64 addr, const char kind, int scope, int delta) {
-	RAnalVar *av = r_anal_var_get (a, addr, kind, scope, delta);
-	if (!av) {
-		return false;
-	}
 	if (scope > 0) {
-		char *sign = "";
-		if (delta < 0) {
-			delta = -delta;
-			sign = "_";
-		}
-		char *fcn_key = sdb_fmt (1, "fcn.0x%"PFMT64x ".%c", addr, kind);
-		char *var_key = sdb_fmt (2, "var.0x%"PFMT64x ".%c.%d.%s%d", addr, kind, scope, sign, delta);
-		char *name_key = sdb_fmt (3, "var.0x%"PFMT64x ".%d.%s", addr, scope, av->name);
-		char *shortvar = sdb_fmt (4, "%d.%s%d", scope, sign, delta);
-		sdb_array_remove (DB, fcn_key, shortvar, 0);
-		sdb_unset (DB, var_key, 0);
-		sdb_unset (DB, name_key, 0);
-		if (*sign) {
-			delta = -delta;
+		RAnalFunction *fcn = r_anal_get_fcn_in (a, addr, 0);
+		RAnalFcnVars *fv = fcn? fcn_vars (a, fcn->addr, false): NULL;
+		RAnalVarItem *v = var_item_find (fv, kind, delta);
+		if (!v) {
+			return false;
 		}
+		var_item_remove (fv, v);
 	} else {
+		RAnalVar *av = r_anal_var_get (a, addr, kind, scope, delta);
+		if (!av) {
+			return false;
+		}
 		char *var_global = sdb_fmt (1, "var.0x%"PFMT64x, addr);
 		char *var_def = sdb_fmt (2, "%c.%s,%d,%s", kind, av->type, av->size, av->name);
 		sdb_array_remove (DB, var_global, var_def, 0);
+		r_anal_var_free (av);
 	}
-	r_anal_var_free (av);
 	r_anal_var_access_clear (a, addr, scope, delta);
 	return true;
 }
 
 R_API bool r_anal_var_delete_byname(RAnal *a, RAnalFunction *fcn, int kind, const char *name) {
-	char *varlist;
+	RAnalVarItem *v;
 	if (!a || !fcn) {
 		return false;
 	}
-	varlist = sdb_get (DB, sdb_fmt (0, "fcn.0x%"PFMT64x ".%c",
-			fcn->addr, kind), 0);
-	if (varlist) {
-		char *next, *ptr = varlist;
-		if (varlist && *varlist) {
-			do {
-				char *word = sdb_anext (ptr, &next);
-				char *sign = strstr (word, "_");
-				const char *vardef = sdb_const_get (DB, sdb_fmt (1,
-						"var.0x%"PFMT64x ".%c.%s",
-						fcn->addr, kind, word), 0);
-				if (sign) {
-					*sign = '-';
-				}
-				int delta = strlen (word) < 3? -1: atoi (word + 2);
-				if (vardef) {
-					const char *p = strchr (vardef, ',');
-					if (p) {
-						p = strchr (p + 1, ',');
-						if (p) {
-							p = strchr (p + 1, ',');
-							if (p) {
-								int mykind = vardef[0];
-								if (!strcmp (p + 1, name)) {
-									return r_anal_var_delete (a, fcn->addr,
-										mykind, 1, delta);
-								}
-							}
-						}
-					}
-				} else {
-					eprintf ("Inconsistent Sdb storage, Cannot find '%s'\n", word);
-				}
-				ptr = next;
-			} while (next);
-		}
-	}
-	free (varlist);
-	return false;
+	v = var_item_find_name (fcn_vars (a, fcn->addr, false), kind, name);
+	return v? r_anal_var_delete (a, fcn->addr, v->kind, 1, v->delta): false;
 }
 
 R_API RAnalVar *r_anal_var_get_byname(RAnal *a, RAnalFunction *fcn, const char *name) {
+	RAnalVarItem *v;
+	RAnalVar *av;
 	if (!fcn || !a || !name) {
-		// eprintf ("No something\n");
 		return NULL;
 	}
-	char *name_key = sdb_fmt (-1, "var.0x%"PFMT64x ".%d.%s", fcn->addr, 1, name);
-	const char *name_value = sdb_const_get (DB, name_key, 0);
-	if (!name_value) {
-		// eprintf ("Cant find key for %s\n", name_key);
+	v = var_item_find_name (fcn_vars (a, fcn->addr, false), 0, name);
+	if (!v || !(av = var_item_get (a, v))) {
 		return NULL;
 	}
-	const char *comma = strchr (name_value, ',');
-	if (comma) {
-		int delta = r_num_math (NULL, comma + 1);
-		// eprintf ("Silently failing (%s)\n", name_value);
-		return r_anal_var_get (a, fcn->addr, *name_value, 1, delta);
-	}
-	return NULL;
+	av->addr = fcn->addr;
+	av->scope = 1;
+	return av;
 }
 
 R_API RAnalVar *r_anal_var_get(RAnal *a, ut64 addr, char kind, int scope, int delta) {
-	RAnalVar *av;
-	struct VarType vt = {
-		0
-	};
-	char *sign = "";
 	RAnalFunction *fcn = r_anal_get_fcn_in (a, addr, 0);
-	if (!fcn) {
-		return NULL;
-	}
-	if (delta < 0) {
-		delta = -delta;
-		sign = "_";
-	}
-	const char *varkey = sdb_fmt (-1, "var.0x%"PFMT64x ".%c.%d.%s%d",
-			fcn->addr, kind, scope, sign, delta);
-	const char *vardef = sdb_const_get (DB, varkey, 0);
-	if (!vardef) {
+	RAnalVarItem *v;
+	RAnalVar *av;
+	if (!fcn || scope < 1) {
 		return NULL;
 	}
-	if (*sign) {
-		delta = -delta;
-	}
-	sdb_fmt_init (&vt, SDB_VARTYPE_FMT);
-	sdb_fmt_tobin (vardef, SDB_VARTYPE_FMT, &vt);
-
-	av = R_NEW0 (RAnalVar);
-	if (!av) {
-		sdb_fmt_free (&vt, SDB_VARTYPE_FMT);
+	v = var_item_find (fcn_vars (a, fcn->addr, false), kind, delta);
+	if (!v || !(av = var_item_get (a, v))) {
 		return NULL;
 	}
 	av->addr = fcn->addr;
 	av->scope = scope;
-	av->delta = delta;
-	av->name = vt.name? strdup (vt.name): strdup ("unkown_var");
-	av->size = vt.size;
-	av->type = vt.type? strdup (vt.type): strdup ("unkown_type");
-	av->kind = kind;
-	sdb_fmt_free (&vt, SDB_VARTYPE_FMT);
-	// TODO:
-	// get name from sdb
-	// get size from sdb
-	// get type from sdb
 	return av;
 }
 
@@ -374,7 +384,6 @@ R_API bool r_anal_var_check_name(const char *name) {
 // afvn local_48 counter
 R_API int r_anal_var_rename(RAnal *a, ut64 var_addr, int scope, char kind, const char *old_name, const char *new_name) {
 	char key[128], *stored_name;
-	int delta;
 
 	if (!r_anal_var_check_name (new_name)) {
 		// eprintf ("Invalid name\n");
@@ -389,25 +398,13 @@ R_API int r_anal_var_rename(RAnal *a, ut64 var_addr, int scope, char kind, const
 	}
 	// XXX: This is hardcoded because ->kind seems to be 0
 	scope = 1;
-	// XXX. this is pretty weak, because oldname may not exist  too and error returned.
 	if (scope > 0) { // local
-		const char *sign = "";
-		SETKEY ("var.0x%"PFMT64x ".%d.%s", var_addr, scope, old_name);
-		char *name_val = sdb_get (DB, key, 0);
-		char *comma = strchr (name_val, ',');
-		if (comma) {
-			delta = r_num_math (NULL, comma + 1);
-			sdb_unset (DB, key, 0);
-			SETKEY ("var.0x%"PFMT64x ".%d.%s", var_addr, scope, new_name);
-			sdb_set (DB, key, name_val, 0);
-			free (name_val);
-			if (delta < 0) {
-				delta = -delta;
-				sign = "_";
-			}
-			SETKEY ("var.0x%"PFMT64x ".%c.%d.%s%d", var_addr, kind, scope, sign, delta);
-			sdb_array_set (DB, key, R_ANAL_VAR_SDB_NAME, new_name, 0);
+		RAnalVarItem *v = var_item_find_name (fcn_vars (a, var_addr, false), 0, old_name);
+		if (!v) {
+			return 0;
 		}
+		r_strpool_intern_release (v->name);
+		v->name = r_strpool_intern (new_name);
 	} else { // global
 		SETKEY ("var.0x%"PFMT64x, var_addr);
 		stored_name = sdb_array_get (DB, key, R_ANAL_VAR_SDB_NAME, 0);
@@ -425,7 +422,6 @@ R_API int r_anal_var_rename(RAnal *a, ut64 var_addr, int scope, char kind, const
 		SETKEY ("var.0x%"PFMT64x, var_addr);
 		sdb_array_set (DB, key, R_ANAL_VAR_SDB_NAME, new_name, 0);
 	}
-	// var.sdb_hash(old_name)=var_addr.scope.delta
 	return 1;
 }
 
@@ -463,35 +459,29 @@ R_API void r_anal_var_access_clear(RAnal *a, ut64 var_addr, int scope, int delta
 }
 
 R_API int r_anal_fcn_var_del_bydelta(RAnal *a, ut64 fna, const char kind, int scope, ut32 delta) {
-	int idx;
-	char key[128], val[128], *v;
-	SETKEY ("fcn.0x%08"PFMT64x ".%c", fna, kind);
-	v = sdb_itoa (delta, val, 10);
-	idx = sdb_array_indexof (DB, key, v, 0);
-	if (idx != -1) {
-		sdb_array_delete (DB, key, idx, 0);
-		SETKEY ("fcn.0x%08"PFMT64x ".%c.%d", fna, kind, delta);
-		sdb_unset (DB, key, 0);
-	}
-	return false;
+	return r_anal_var_delete (a, fna, kind, scope, (int)delta);
 }
 
 R_API int r_anal_var_count(RAnal *a, RAnalFunction *fcn, int kind, int type) {
 	// type { local: 0, arg: 1 };
-	RList *list = r_anal_var_list (a, fcn, kind);
-	RAnalVar *var;
-	RListIter *iter;
-	int count[2] = {
+	RAnalFcnVars *fv = fcn? fcn_vars (a, fcn->addr, false): NULL;
+	int i, count[2] = {
 		0
 	};
-	r_list_foreach (list, iter, var) {
+	if (kind < 1) {
+		kind = R_ANAL_VAR_KIND_BPV;
+	}
+	for (i = 0; fv && i < fv->count; i++) {
+		RAnalVarItem *v = &fv->vars[i];
+		if (v->kind != kind) {
+			continue;
+		}
 		if (kind == R_ANAL_VAR_KIND_REG) {
 			count[1]++;
 			continue;
 		}
-		count[(kind == R_ANAL_VAR_KIND_BPV && var->delta > 0) || (kind == R_ANAL_VAR_KIND_SPV && var->delta > fcn->maxstack)]++;
+		count[(kind == R_ANAL_VAR_KIND_BPV && v->delta > 0) || (kind == R_ANAL_VAR_KIND_SPV && v->delta > fcn->maxstack)]++;
 	}
-	r_list_free (list);
 	return count[type];
 }
 
@@ -536,6 +526,8 @@ static void var_add_structure_fields_to_list(RAnal *a, RAnalVar *av, const char
 }
 
 static RList *var_generate_list(RAnal *a, RAnalFunction *fcn, int kind, bool dynamicVars) {
+	RAnalFcnVars *fv;
+	int i;
 	if (!a || !fcn) {
 		return NULL;
 	}
@@ -543,55 +535,22 @@ static RList *var_generate_list(RAnal *a, RAnalFunction *fcn, int kind, bool dyn
 	if (kind < 1) {
 		kind = R_ANAL_VAR_KIND_BPV; // by default show vars
 	}
-	char *varlist = sdb_get (DB, sdb_fmt (0, "fcn.0x%"PFMT64x ".%c", fcn->addr, kind), 0);
-	if (varlist && *varlist) {
-		char *next, *ptr = varlist;
-		do {
-			char *word = sdb_anext (ptr, &next);
-			if (r_str_nlen (word, 3) < 3) {
-				return NULL;
-			}
-			const char *vardef = sdb_const_get (DB, sdb_fmt (1,
-				"var.0x%"PFMT64x ".%c.%s",
-				fcn->addr, kind, word), 0);
-			if (word[2] == '_') {
-				word[2] = '-';
-			}
-			int delta = atoi (word + 2);
-			if (vardef) {
-				struct VarType vt = { 0 };
-				sdb_fmt_init (&vt, SDB_VARTYPE_FMT);
-				sdb_fmt_tobin (vardef, SDB_VARTYPE_FMT, &vt);
-				RAnalVar *av = R_NEW0 (RAnalVar);
-				if (!av) {
-					free (varlist);
-					r_list_free (list);
-					return NULL;
-				}
-				if (!vt.name || !vt.type) {
-					// This should be properly fixed
-					eprintf ("Warning null var in fcn.0x%"PFMT64x ".%c.%s\n",
-						fcn->addr, kind, word);
-					free (av);
-					continue;
-				}
-				av->delta = delta;
-				av->kind = kind;
-				av->name = strdup (vt.name);
-				av->size = vt.size;
-				av->type = strdup (vt.type);
-				r_list_append (list, av);
-				if (dynamicVars) { // make dynamic variables like structure fields
-					var_add_structure_fields_to_list (a, av, vt.name, delta, list);
-				}
-				sdb_fmt_free (&vt, SDB_VARTYPE_FMT);
-			} else {
-				eprintf ("Cannot find var definition for '%s'\n", word);
-			}
-			ptr = next;
-		} while (next);
+	fv = fcn_vars (a, fcn->addr, false);
+	for (i = 0; fv && i < fv->count; i++) {
+		RAnalVarItem *v = &fv->vars[i];
+		RAnalVar *av;
+		if (v->kind != kind) {
+			continue;
+		}
+		if (!(av = var_item_get (a, v))) {
+			r_list_free (list);
+			return NULL;
+		}
+		r_list_append (list, av);
+		if (dynamicVars) { // make dynamic variables like structure fields
+			var_add_structure_fields_to_list (a, av, v->name, v->delta, list);
+		}
 	}
-	free (varlist);
 	return list;
 }
 
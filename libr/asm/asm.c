@@ -564,14 +564,49 @@ R_API int r_asm_assemble(RAsm *a, RAsmOp *op, const char *buf) {
 	return ret;
 }
 
-R_API RAsmCode* r_asm_mdisassemble(RAsm *a, const ut8 *buf, int len) {
-	RStrBuf *buf_asm;
-	RAsmCode *acode;
+/* linear sweep over buf starting at a->pc, appends at most max ops (or
+ * all of them if max < 1) to the batch. plugins with a batch entry point
+ * decode runs of valid instructions in one call, everything else (and
+ * the invalid instructions where they stop) goes through the one op path */
+R_API int r_asm_disassemble_batch(RAsm *a, RAsmBatch *b, const ut8 *buf, int len, int max) {
+	const int addrbytes = a->user ? ((RCore *)a->user)->io->addrbytes : 1;
+	const bool batch = a->cur && a->cur->disassemble_batch
+		&& !a->pcalign && !a->bitshift && !a->ofilter && addrbytes == 1;
 	ut64 pc = a->pc;
+	int i, n, ret, idx = 0, count = 0;
 	RAsmOp op;
-	ut64 idx;
-	int ret, slen;
-	const int addrbytes = a->user ? ((RCore *)a->user)->io->addrbytes : 1;
+	if (max < 1) {
+		max = ST32_MAX;
+	}
+	while (idx + addrbytes <= len && count < max) {
+		r_asm_set_pc (a, pc + idx);
+		if (batch) {
+			int start = b->count;
+			n = a->cur->disassemble_batch (a, b, buf + idx, len - idx, max - count);
+			if (n > 0) {
+				for (i = start; i < b->count; i++) {
+					idx += b->ops[i].size;
+				}
+				count += n;
+				continue;
+			}
+		}
+		ret = r_asm_disassemble (a, &op, buf + idx, len - idx);
+		if (!r_asm_batch_add (b, pc + idx, ret < 1? 1: ret,
+				ret < 1? R_ASM_BATCH_INVALID: R_ASM_BATCH_VALID, op.buf_asm)) {
+			break;
+		}
+		idx += addrbytes * (ret < 1? 1: ret);
+		count++;
+	}
+	b->len += idx;
+	r_asm_set_pc (a, pc);
+	return count;
+}
+
+R_API RAsmCode* r_asm_mdisassemble(RAsm *a, const ut8 *buf, int len) {
+	RAsmBatch *b;
+	RAsmCode *acode;
 
 	if (!(acode = r_asm_code_new ())) {
 		return NULL;
@@ -584,23 +619,13 @@ R_API RAsmCode* r_asm_mdisassemble(RAsm *a, const ut8 *buf, int len) {
 		return r_asm_code_free (acode);
 	}
 	r_hex_bin2str (buf, len, acode->buf_hex);
-	if (!(buf_asm = r_strbuf_new (NULL))) {
+	if (!(b = r_asm_batch_new ())) {
 		return r_asm_code_free (acode);
 	}
-	for (idx = ret = slen = 0; idx + addrbytes <= len; idx += addrbytes * ret) {
-		r_asm_set_pc (a, pc + idx);
-		ret = r_asm_disassemble (a, &op, buf + idx, len - idx);
-		if (ret < 1) {
-			ret = 1;
-		}
-		if (a->ofilter) {
-			r_parse_parse (a->ofilter, op.buf_asm, op.buf_asm);
-		}
-		r_strbuf_append (buf_asm, op.buf_asm);
-		r_strbuf_append (buf_asm, "\n");
-	}
-	acode->buf_asm = r_strbuf_drain (buf_asm);
-	acode->len = idx;
+	r_asm_disassemble_batch (a, b, buf, len, 0);
+	acode->len = b->len;
+	acode->buf_asm = r_asm_batch_drain (b, '\n');
+	r_asm_batch_free (b);
 	return acode;
 }
 
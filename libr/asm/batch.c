@@ -0,0 +1,82 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+#include <r_asm.h>
+
+R_API RAsmBatch *r_asm_batch_new(void) {
+	return R_NEW0 (RAsmBatch);
+}
+
+R_API void r_asm_batch_free(RAsmBatch *b) {
+	if (b) {
+		free (b->ops);
+		free (b->text);
+		free (b);
+	}
+}
+
+/* keeps the buffers for the next sweep */
+R_API void r_asm_batch_reset(RAsmBatch *b) {
+	b->count = 0;
+	b->text_len = 0;
+	b->len = 0;
+}
+
+R_API bool r_asm_batch_add(RAsmBatch *b, ut64 addr, int size, int type, const char *text) {
+	RAsmBatchOp *op;
+	int tlen = strlen (text) + 1;
+	if (b->count == b->ops_size) {
+		int n = b->ops_size? b->ops_size * 2: 64;
+		RAsmBatchOp *ops = realloc (b->ops, n * sizeof (RAsmBatchOp));
+		if (!ops) {
+			return false;
+		}
+		b->ops = ops;
+		b->ops_size = n;
+	}
+	if (b->text_len + tlen >= b->text_size) {
+		int n = R_MAX (b->text_size * 2, b->text_len + tlen + 1);
+		char *t = realloc (b->text, R_MAX (n, 1024));
+		if (!t) {
+			return false;
+		}
+		b->text = t;
+		b->text_size = R_MAX (n, 1024);
+	}
+	op = &b->ops[b->count++];
+	op->addr = addr;
+	op->size = size;
+	op->type = type;
+	op->text = b->text_len;
+	memcpy (b->text + b->text_len, text, tlen);
+	b->text_len += tlen;
+	return true;
+}
+
+R_API const char *r_asm_batch_text(RAsmBatch *b, int idx) {
+	if (idx < 0 || idx >= b->count) {
+		return NULL;
+	}
+	return b->text + b->ops[idx].text;
+}
+
+/* returns all the text as one string with every instruction followed by
+ * sep, the batch is left empty */
+R_API char *r_asm_batch_drain(RAsmBatch *b, char sep) {
+	char *ret;
+	int i;
+	if (!b->text) {
+		r_asm_batch_reset (b);
+		return strdup ("");
+	}
+	for (i = 0; i < b->text_len; i++) {
+		if (!b->text[i]) {
+			b->text[i] = sep;
+		}
+	}
+	b->text[b->text_len] = 0;
+	ret = b->text;
+	b->text = NULL;
+	b->text_size = 0;
+	r_asm_batch_reset (b);
+	return ret;
+}
@@ -41,9 +41,9 @@ static int modify(RAsm *a, ut8 *buf, int field, ut64 val) {
 	return 0;
 }
 
-static int disassemble(RAsm *a, RAsmOp *op, const ut8 *buf, int len) {
-	int opsize;
-	static ud_t d = {0};
+static ud_t d = {0};
+
+static void setup(RAsm *a, const ut8 *buf, int len) {
 	static int osyntax = 0;
 	if (!d.dis_mode)
 		ud_init (&d);
@@ -55,20 +55,52 @@ static int disassemble(RAsm *a, RAsmOp *op, const ut8 *buf, int len) {
 	ud_set_input_buffer (&d, (uint8_t*) buf, len);
 	ud_set_pc (&d, a->pc);
 	ud_set_mode (&d, a->bits);
+}
+
+static void jz_syntax(RAsm *a, char *str) {
+	if (a->syntax == R_ASM_SYNTAX_JZ) {
+		if (!strncmp (str, "je ", 3)) {
+			memcpy (str, "jz", 2);
+		} else if (!strncmp (str, "jne ", 4)) {
+			memcpy (str, "jnz", 3);
+		}
+	}
+}
+
+static int disassemble(RAsm *a, RAsmOp *op, const ut8 *buf, int len) {
+	int opsize;
+	setup (a, buf, len);
 	opsize = ud_disassemble (&d);
 	strncpy (op->buf_asm, ud_insn_asm (&d), R_ASM_BUFSIZE-1);
 	op->buf_asm[R_ASM_BUFSIZE-1] = 0;
 	if (opsize<1 || strstr (op->buf_asm, "invalid"))
 		opsize = 0;
 	op->size = opsize;
-	if (a->syntax == R_ASM_SYNTAX_JZ) {
-		if (!strncmp (op->buf_asm, "je ", 3)) {
-			memcpy (op->buf_asm, "jz", 2);
-		} else if (!strncmp (op->buf_asm, "jne ", 4)) {
-			memcpy (op->buf_asm, "jnz", 3);
+	jz_syntax (a, op->buf_asm);
+	return opsize;
+}
+
+/* the decoder keeps walking the same input buffer */
+static int disassemble_batch(RAsm *a, RAsmBatch *b, const ut8 *buf, int len, int max) {
+	char str[R_ASM_BUFSIZE];
+	int opsize, n = 0;
+	setup (a, buf, len);
+	while (n < max && (opsize = ud_disassemble (&d)) > 0) {
+		const char *s = ud_insn_asm (&d);
+		if (strstr (s, "invalid")) {
+			break;
+		}
+		if (a->syntax == R_ASM_SYNTAX_JZ) {
+			r_str_ncpy (str, s, sizeof (str));
+			jz_syntax (a, str);
+			s = str;
 		}
+		if (!r_asm_batch_add (b, ud_insn_off (&d), opsize, R_ASM_BATCH_VALID, s)) {
+			break;
+		}
+		n++;
 	}
-	return opsize;
+	return n;
 }
 
 RAsmPlugin r_asm_plugin_x86_udis = {
@@ -79,6 +111,7 @@ RAsmPlugin r_asm_plugin_x86_udis = {
 	.bits = 16 | 32 | 64,
 	.endian = R_SYS_ENDIAN_LITTLE,
 	.disassemble = &disassemble,
+	.disassemble_batch = &disassemble_batch,
 	.modify = &modify,
 };
 
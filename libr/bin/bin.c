@@ -1205,6 +1205,7 @@ static void r_bin_file_free(void /*RBinFile*/ *bf_) {
 		sdb_free (a->sdb_addrinfo);
 		a->sdb_addrinfo = NULL;
 	}
+	r_bin_dwarf_lines_free (a->dwarf_lines);
 	free (a->file);
 	a->o = NULL;
 	r_list_free (a->objs);
@@ -21,7 +21,7 @@
 #define STANDARD_OPERAND_COUNT_DWARF3 12
 #define R_BIN_DWARF_INFO 1
 
-#define READ(x,y) ((x + sizeof (y) < buf_end)? *((y*)x): 0); x += sizeof (y)
+static ut8 *get_section_bytes(RBin *a, const char *sn, size_t *len);
 
 static const char *dwarf_tag_name_encodings[] = {
 	[DW_TAG_array_type] = "DW_TAG_array_type",
@@ -190,48 +190,367 @@ static const char *dwarf_langs[] = {
 	[DW_LANG_Fortran08] = "Fortran08"
 };
 
-static int add_sdb_include_dir(Sdb *s, const char *incl, int idx) {
-	if (!s || !incl)
-		return false;
-	return sdb_array_set (s, "includedirs", idx, incl, 0);
+/* reads a little endian value of n bytes, *p is moved to end when
+ * there are not enough of them */
+static ut64 dwarf_read(const ut8 **p, const ut8 *end, int n) {
+	const ut8 *b = *p;
+	ut64 v = 0;
+	int i;
+	if (!b || n < 1 || n > 8 || b + n > end) {
+		*p = end;
+		return 0;
+	}
+	for (i = 0; i < n; i++) {
+		v |= (ut64)b[i] << (8 * i);
+	}
+	*p = b + n;
+	return v;
 }
 
-static const ut8 *r_bin_dwarf_parse_lnp_header (
-		RBinFile *bf, const ut8 *buf, const ut8 *buf_end,
-		RBinDwarfLNPHeader *hdr, FILE *f, int mode) {
-	int i;
-	Sdb *s;
-	size_t count;
-	const ut8 *tmp_buf = NULL;
+static ut64 dwarf_uleb(const ut8 **p, const ut8 *end) {
+	ut64 v = 0;
+	if (*p && *p < end) {
+		*p = r_uleb128 (*p, end - *p, &v);
+	}
+	if (!*p || *p > end) {
+		*p = end;
+	}
+	return v;
+}
 
-	if (!hdr || !bf || !buf) return NULL;
+static st64 dwarf_sleb(const ut8 **p, const ut8 *end) {
+	const ut8 *b = *p;
+	st64 v = 0;
+	int shift = 0;
+	ut8 c = 0;
+	while (b && b < end) {
+		c = *b++;
+		if (shift < 64) {
+			v |= (st64)(c & 0x7f) << shift;
+		}
+		shift += 7;
+		if (!(c & 0x80)) {
+			break;
+		}
+	}
+	if (shift < 64 && (c & 0x40)) {
+		v |= -((st64)1 << shift);
+	}
+	*p = b? b: end;
+	return v;
+}
 
-	hdr->unit_length.part1 = READ (buf, ut32);
-	if (hdr->unit_length.part1 == DWARF_INIT_LEN_64) {
-		hdr->unit_length.part2 = READ (buf, ut32);
+static const char *dwarf_string(const ut8 *sec, size_t len, ut64 off) {
+	if (!sec || off >= len || r_str_nlen ((const char *)sec + off, len - off) == len - off) {
+		return NULL;
 	}
+	return (const char *)sec + off;
+}
 
-	s = sdb_new (NULL, NULL, 0);
+/* decoding state of the line programs of .debug_line */
+typedef struct {
+	RBinDwarfLines *lt;
+	RBinDwarfLNPHeader *hdr;
+	const ut8 *str;
+	size_t str_len;
+	const ut8 *line_str;
+	size_t line_str_len;
+	FILE *f;
+	int mode;
+} LineCtx;
+
+static bool lines_add(RBinDwarfLines *lt, ut64 addr, const char *file, ut32 line, ut32 column) {
+	RBinDwarfLine *row;
+	if (lt->count == lt->size) {
+		size_t n = lt->size? lt->size * 2: 1024;
+		RBinDwarfLine *rows = realloc (lt->rows, n * sizeof (RBinDwarfLine));
+		if (!rows) {
+			return false;
+		}
+		lt->rows = rows;
+		lt->size = n;
+	}
+	row = &lt->rows[lt->count++];
+	row->address = addr;
+	row->file = file;
+	row->line = line;
+	row->column = column;
+	return true;
+}
 
-	hdr->version = READ (buf, ut16);
+/* stable, the first row decoded for an address is the one returned */
+static void lines_sort(RBinDwarfLine *rows, RBinDwarfLine *tmp, size_t n) {
+	size_t w, i;
+	for (w = 1; w < n; w *= 2) {
+		for (i = 0; i < n; i += 2 * w) {
+			size_t a = i, am = R_MIN (i + w, n), b = am, bm = R_MIN (i + 2 * w, n), o = i;
+			if (am == bm) {
+				memcpy (tmp + i, rows + i, (bm - i) * sizeof (RBinDwarfLine));
+				continue;
+			}
+			while (a < am && b < bm) {
+				tmp[o++] = (rows[b].address < rows[a].address)? rows[b++]: rows[a++];
+			}
+			while (a < am) {
+				tmp[o++] = rows[a++];
+			}
+			while (b < bm) {
+				tmp[o++] = rows[b++];
+			}
+		}
+		memcpy (rows, tmp, n * sizeof (RBinDwarfLine));
+	}
+}
 
-	if (hdr->unit_length.part1 == DWARF_INIT_LEN_64) {
-		hdr->header_length = READ (buf, ut64);
+R_API void r_bin_dwarf_lines_free(RBinDwarfLines *lt) {
+	if (lt) {
+		r_list_free (lt->files);
+		free (lt->rows);
+		free (lt);
+	}
+}
+
+/* the first row at exactly addr */
+R_API const RBinDwarfLine *r_bin_dwarf_lines_get(const RBinDwarfLines *lt, ut64 addr) {
+	size_t lo = 0, hi;
+	if (!lt || !lt->count) {
+		return NULL;
+	}
+	hi = lt->count;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (lt->rows[mid].address < addr) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return (lo < lt->count && lt->rows[lo].address == addr)? &lt->rows[lo]: NULL;
+}
+
+static const char *line_file_path(LineCtx *lc, const char *dir, const char *name) {
+	const char *comp_dir = lc->hdr->include_directories? lc->hdr->include_directories[0]: NULL;
+	const char *ret;
+	char *path;
+	if (!name) {
+		return NULL;
+	}
+	if (*name == '/' || !dir || !*dir) {
+		path = strdup (name);
+	} else if (*dir != '/' && comp_dir && dir != comp_dir) {
+		path = r_str_newf ("%s/%s/%s", comp_dir, dir, name);
+	} else {
+		path = r_str_newf ("%s/%s", dir, name);
+	}
+	ret = path? r_strpool_intern (path): NULL;
+	free (path);
+	if (ret) {
+		r_list_append (lc->lt->files, (void *)ret);
+	}
+	return ret;
+}
+
+/* content of an entry of the DWARF5 directory and file tables */
+static const ut8 *line_entry_value(LineCtx *lc, const ut8 *buf, const ut8 *buf_end,
+		ut64 form, const char **str, ut64 *num) {
+	ut64 off;
+	int offset_size = lc->hdr->unit_length.part1 == DWARF_INIT_LEN_64? 8: 4;
+	switch (form) {
+	case DW_FORM_string:
+		off = r_str_nlen ((const char *)buf, buf_end - buf);
+		if (buf + off >= buf_end) {
+			return buf_end;
+		}
+		*str = (const char *)buf;
+		return buf + off + 1;
+	case DW_FORM_line_strp:
+		off = dwarf_read (&buf, buf_end, offset_size);
+		*str = dwarf_string (lc->line_str, lc->line_str_len, off);
+		return buf;
+	case DW_FORM_strp:
+		off = dwarf_read (&buf, buf_end, offset_size);
+		*str = dwarf_string (lc->str, lc->str_len, off);
+		return buf;
+	case DW_FORM_udata:
+		*num = dwarf_uleb (&buf, buf_end);
+		return buf;
+	case DW_FORM_data1:
+		*num = dwarf_read (&buf, buf_end, 1);
+		return buf;
+	case DW_FORM_data2:
+		*num = dwarf_read (&buf, buf_end, 2);
+		return buf;
+	case DW_FORM_data4:
+		*num = dwarf_read (&buf, buf_end, 4);
+		return buf;
+	case DW_FORM_data8:
+		*num = dwarf_read (&buf, buf_end, 8);
+		return buf;
+	case DW_FORM_data16:
+		return buf + 16 <= buf_end? buf + 16: buf_end;
+	case DW_FORM_block:
+		off = dwarf_uleb (&buf, buf_end);
+		return off <= (ut64)(buf_end - buf)? buf + off: buf_end;
+	}
+	return NULL;
+}
+
+/* DWARF5 directory and file name tables */
+static const ut8 *line_entries(LineCtx *lc, const ut8 *buf, const ut8 *buf_end, bool files) {
+	RBinDwarfLNPHeader *hdr = lc->hdr;
+	ut64 formats[16][2], i, j, count;
+	ut8 nformats;
+	if (buf >= buf_end) {
+		return NULL;
+	}
+	nformats = *buf++;
+	if (nformats > 16) {
+		return NULL;
+	}
+	for (i = 0; i < nformats; i++) {
+		formats[i][0] = dwarf_uleb (&buf, buf_end);
+		formats[i][1] = dwarf_uleb (&buf, buf_end);
+	}
+	count = dwarf_uleb (&buf, buf_end);
+	if (count > (ut64)(buf_end - buf)) {
+		return NULL;
+	}
+	if (files) {
+		hdr->file_names = count? calloc (count, sizeof (file_entry)): NULL;
+		if (count && !hdr->file_names) {
+			return NULL;
+		}
+		hdr->file_names_count = count;
 	} else {
-		hdr->header_length = READ (buf, ut32);
+		hdr->include_directories = count? calloc (count, sizeof (char *)): NULL;
+	}
+	for (i = 0; i < count; i++) {
+		const char *path = NULL;
+		ut64 dir = 0;
+		for (j = 0; j < nformats; j++) {
+			const char *str = NULL;
+			ut64 num = 0;
+			buf = line_entry_value (lc, buf, buf_end, formats[j][1], &str, &num);
+			if (!buf || buf > buf_end) {
+				return NULL;
+			}
+			if (formats[j][0] == DW_LNCT_path) {
+				path = str;
+			} else if (formats[j][0] == DW_LNCT_directory_index) {
+				dir = num;
+			}
+		}
+		if (files) {
+			const char *dname = dir < hdr->include_directories_count? hdr->include_directories[dir]: NULL;
+			hdr->file_names[i].name = (char *)line_file_path (lc, dname, path);
+			hdr->file_names[i].id_idx = dir;
+			if (lc->f) {
+				fprintf (lc->f, "FILE (%s)\n", path? path: "");
+				fprintf (lc->f, "| dir idx %"PFMT64d"\n", dir);
+			}
+		} else if (hdr->include_directories) {
+			hdr->include_directories[i] = (char *)path;
+			hdr->include_directories_count = i + 1;
+			if (lc->f && path) {
+				fprintf (lc->f, "INCLUDEDIR (%s)\n", path);
+			}
+		}
+	}
+	return buf;
+}
+
+/* directory and file name tables before DWARF5 */
+static const ut8 *line_entries_v4(LineCtx *lc, const ut8 *buf, const ut8 *buf_end, const char *comp_dir) {
+	RBinDwarfLNPHeader *hdr = lc->hdr;
+	const ut8 *p;
+	size_t i, count = 0;
+	/* the directory 0 is the one of the unit */
+	for (p = buf; p < buf_end && *p; p += r_str_nlen ((const char *)p, buf_end - p) + 1) {
+		count++;
+	}
+	hdr->include_directories = calloc (count + 1, sizeof (char *));
+	if (!hdr->include_directories) {
+		return NULL;
+	}
+	hdr->include_directories[0] = (char *)comp_dir;
+	for (i = 1; i <= count; i++) {
+		hdr->include_directories[i] = (char *)buf;
+		if (lc->f) {
+			fprintf (lc->f, "INCLUDEDIR (%s)\n", buf);
+		}
+		buf += strlen ((const char *)buf) + 1;
+	}
+	hdr->include_directories_count = count + 1;
+	buf++;
+	count = 0;
+	for (p = buf; p < buf_end && *p; count++) {
+		p += r_str_nlen ((const char *)p, buf_end - p) + 1;
+		dwarf_uleb (&p, buf_end);
+		dwarf_uleb (&p, buf_end);
+		dwarf_uleb (&p, buf_end);
+	}
+	if (p >= buf_end) {
+		return NULL;
 	}
+	hdr->file_names = count? calloc (count, sizeof (file_entry)): NULL;
+	hdr->file_names_count = count;
+	for (i = 0; i < count && hdr->file_names; i++) {
+		const char *name = (const char *)buf;
+		ut64 dir, mod_time, file_len;
+		buf += strlen (name) + 1;
+		dir = dwarf_uleb (&buf, buf_end);
+		mod_time = dwarf_uleb (&buf, buf_end);
+		file_len = dwarf_uleb (&buf, buf_end);
+		hdr->file_names[i].name = (char *)line_file_path (lc,
+			dir < hdr->include_directories_count? hdr->include_directories[dir]: NULL, name);
+		hdr->file_names[i].id_idx = dir;
+		hdr->file_names[i].mod_time = mod_time;
+		hdr->file_names[i].file_len = file_len;
+		if (lc->f) {
+			fprintf (lc->f, "FILE (%s)\n", name);
+			fprintf (lc->f, "| dir idx %"PFMT64d"\n", dir);
+			fprintf (lc->f, "| lastmod %"PFMT64d"\n", mod_time);
+			fprintf (lc->f, "| filelen %"PFMT64d"\n", file_len);
+		}
+	}
+	return p + 1;
+}
+
+/* parses the header of the unit at buf, returns where its program starts */
+static const ut8 *r_bin_dwarf_parse_lnp_header(LineCtx *lc, const ut8 *buf,
+		const ut8 *buf_end, const char *comp_dir) {
+	RBinDwarfLNPHeader *hdr = lc->hdr;
+	const ut8 *program;
+	FILE *f = lc->f;
+	int i, offset_size = 4;
 
-	if (buf_end-buf < 8) {
-		sdb_free (s);
+	hdr->unit_length.part1 = dwarf_read (&buf, buf_end, 4);
+	if (hdr->unit_length.part1 == DWARF_INIT_LEN_64) {
+		hdr->unit_length.part2 = dwarf_read (&buf, buf_end, 8);
+		offset_size = 8;
+	}
+	hdr->version = dwarf_read (&buf, buf_end, 2);
+	if (hdr->version < 2 || hdr->version > 5) {
+		return NULL;
+	}
+	if (hdr->version >= 5) {
+		hdr->address_size = dwarf_read (&buf, buf_end, 1);
+		dwarf_read (&buf, buf_end, 1); // segment selector size
+	}
+	hdr->header_length = dwarf_read (&buf, buf_end, offset_size);
+	if (hdr->header_length > (ut64)(buf_end - buf)) {
+		return NULL;
+	}
+	program = buf + hdr->header_length;
+	hdr->min_inst_len = dwarf_read (&buf, buf_end, 1);
+	hdr->max_ops_per_inst = hdr->version >= 4? dwarf_read (&buf, buf_end, 1): 1;
+	hdr->default_is_stmt = dwarf_read (&buf, buf_end, 1);
+	hdr->line_base = (char)dwarf_read (&buf, buf_end, 1);
+	hdr->line_range = dwarf_read (&buf, buf_end, 1);
+	hdr->opcode_base = dwarf_read (&buf, buf_end, 1);
+	if (buf >= program) {
 		return NULL;
 	}
-	hdr->min_inst_len = READ (buf, ut8);
-	//hdr->max_ops_per_inst = READ (buf, ut8);
-	hdr->file_names = NULL;
-	hdr->default_is_stmt = READ (buf, ut8);
-	hdr->line_base = READ (buf, char);
-	hdr->line_range = READ (buf, ut8);
-	hdr->opcode_base = READ (buf, ut8);
 
 	if (f) {
 		fprintf (f, "DWARF LINE HEADER\n");
@@ -245,124 +564,35 @@ static const ut8 *r_bin_dwarf_parse_lnp_header (
 		fprintf (f, "  opcode_base: %d\n", hdr->opcode_base);
 	}
 
-	if (hdr->opcode_base>0) {
-		hdr->std_opcode_lengths = calloc(sizeof(ut8), hdr->opcode_base);
-
+	if (hdr->opcode_base > 0) {
+		hdr->std_opcode_lengths = calloc (sizeof (ut8), hdr->opcode_base);
+		if (!hdr->std_opcode_lengths) {
+			return NULL;
+		}
 		for (i = 1; i <= hdr->opcode_base - 1; i++) {
-			if (buf+2>buf_end) break;
-			hdr->std_opcode_lengths[i] = READ (buf, ut8);
+			hdr->std_opcode_lengths[i] = dwarf_read (&buf, program, 1);
 			if (f) {
 				fprintf (f, " op %d %d\n", i, hdr->std_opcode_lengths[i]);
 			}
 		}
-	} else {
-		hdr->std_opcode_lengths = NULL;
-	}
-
-	i = 0;
-	while (buf+1 < buf_end) {
-		int maxlen = R_MIN ((size_t)(buf_end-buf)-1, 0xfff);
-		int len = r_str_nlen ((const char*)buf, maxlen);
-		char *str = r_str_ndup ((const char *)buf, len);
-		if (len<1 || len >= 0xfff) {
-			buf += 1;
-			free (str);
-			break;
-		}
-		if (*str != '/' && *str != '.') {
-			// no more paths in here
-			free (str);
-			break;
-		}
-		if (f) {
-			fprintf (f, "INCLUDEDIR (%s)\n", str);
-		}
-		add_sdb_include_dir (s, str, i);
-		free (str);
-		i++;
-		buf += len + 1;
 	}
-
-	tmp_buf = buf;
-	count = 0;
-	for (i = 0; i < 2; i++) {
-		while (buf+1<buf_end) {
-			const char *filename = (const char *)buf;
-			int maxlen = R_MIN ((size_t)(buf_end-buf-1), 0xfff);
-			ut64 id_idx, mod_time, file_len;
-			size_t namelen, len = r_str_nlen (filename, maxlen);
-
-			if (!len) {
-				buf++;
-				break;
-			}
-			buf += len + 1;
-			if (buf>=buf_end) { buf = NULL; goto beach; }
-			buf = r_uleb128 (buf, buf_end-buf, &id_idx);
-			if (buf>=buf_end) { buf = NULL; goto beach; }
-			buf = r_uleb128 (buf, buf_end-buf, &mod_time);
-			if (buf>=buf_end) { buf = NULL; goto beach; }
-			buf = r_uleb128 (buf, buf_end-buf, &file_len);
-			if (buf>=buf_end) { buf = NULL; goto beach; }
-
-			if (i) {
-				char *include_dir = NULL, *comp_dir = NULL;
-				char *allocated_id = NULL;
-				if (id_idx > 0) {
-					include_dir = sdb_array_get (s, "includedirs", id_idx - 1, 0);
-					if (include_dir && include_dir[0] != '/') {
-						comp_dir = sdb_get (bf->sdb_addrinfo, "DW_AT_comp_dir", 0);
-						if (comp_dir) {
-							allocated_id = calloc (1, strlen (comp_dir) +
-									strlen (include_dir) + 8);
-							snprintf (allocated_id, strlen (comp_dir) + strlen (include_dir) + 8,
-									"%s/%s/", comp_dir, include_dir);
-							include_dir = allocated_id;
-						}
-					}
-				} else {
-					include_dir = sdb_get (bf->sdb_addrinfo, "DW_AT_comp_dir", 0);
-					if (!include_dir)
-						include_dir = "./";
-				}
-
-				namelen = len + (include_dir?strlen (include_dir):0) + 8;
-
-				if (hdr->file_names) {
-					hdr->file_names[count].name = calloc (sizeof(char), namelen);
-					snprintf (hdr->file_names[count].name, namelen - 1,
-						"%s/%s", include_dir? include_dir : "", filename);
-					hdr->file_names[count].name[namelen - 1] = '\0';
-					free (allocated_id);
-					hdr->file_names[count].id_idx = id_idx;
-					hdr->file_names[count].mod_time = mod_time;
-					hdr->file_names[count].file_len = file_len;
-				}
-			}
-			count++;
-			if (f && i) {
-				fprintf (f, "FILE (%s)\n", filename);
-				fprintf (f, "| dir idx %"PFMT64d"\n", id_idx);
-				fprintf (f, "| lastmod %"PFMT64d"\n", mod_time);
-				fprintf (f, "| filelen %"PFMT64d"\n", file_len);
-			}
-		}
-		if (i == 0) {
-			if (count>0) {
-				hdr->file_names = calloc(sizeof(file_entry), count);
-			} else {
-				hdr->file_names = NULL;
-			}
-			hdr->file_names_count = count;
-			buf = tmp_buf;
-			count = 0;
+	if (hdr->version >= 5) {
+		buf = line_entries (lc, buf, program, false);
+		if (buf) {
+			buf = line_entries (lc, buf, program, true);
 		}
+	} else {
+		buf = line_entries_v4 (lc, buf, program, comp_dir);
 	}
+	return buf? program: NULL;
+}
 
-beach:
-	sdb_free (s);
-
-	return buf;
+static void line_header_fini(RBinDwarfLNPHeader *hdr) {
+	R_FREE (hdr->std_opcode_lengths);
+	R_FREE (hdr->include_directories);
+	R_FREE (hdr->file_names);
+	hdr->file_names_count = 0;
+	hdr->include_directories_count = 0;
 }
 
 static inline void add_sdb_addrline(Sdb *s, ut64 addr, const char *file, ut64 line, FILE *f, int mode) {
@@ -390,40 +620,48 @@ static inline void add_sdb_addrline(Sdb *s, ut64 addr, const char *file, ut64 li
 		fprintf (f, "CL %s:%d 0x%08"PFMT64x"\n", p, (int)line, addr);
 		break;
 	}
-#if 0
-	/* THIS IS TOO SLOW */
-	if (r_file_exists (file)) {
-		p = file;
+	if (!s) {
+		return;
 	}
-#else
-	p = file;
-#endif
-	fileline = r_str_newf ("%s|%"PFMT64d, p, line);
+	fileline = r_str_newf ("%s|%"PFMT64d, file, line);
 	offset_ptr = sdb_itoa (addr, offset, 16);
 	sdb_add (s, offset_ptr, fileline, 0);
 	sdb_add (s, fileline, offset_ptr, 0);
 	free (fileline);
 }
 
-static const ut8* r_bin_dwarf_parse_ext_opcode(const RBin *a, const ut8 *obuf,
-		size_t len, const RBinDwarfLNPHeader *hdr,
-		RBinDwarfSMRegisters *regs, FILE *f, int mode) {
-	// XXX - list is an unused parameter.
-	const ut8 *buf;
-	const ut8 *buf_end;
+/* appends a row of the matrix for the current registers */
+static void line_emit(LineCtx *lc, const RBinDwarfSMRegisters *regs) {
+	const RBinDwarfLNPHeader *hdr = lc->hdr;
+	/* file numbers start at 1 before DWARF5 */
+	st64 idx = hdr->version >= 5? (st64)regs->file: (st64)regs->file - 1;
+	const char *file;
+	if (!hdr->file_names || idx < 0 || idx >= hdr->file_names_count) {
+		return;
+	}
+	file = hdr->file_names[idx].name;
+	if (!file) {
+		return;
+	}
+	if (lc->mode == 1 || lc->mode == 'r' || lc->mode == '*') {
+		add_sdb_addrline (NULL, regs->address, file, regs->line, lc->f, lc->mode);
+	}
+	lines_add (lc->lt, regs->address, file, regs->line, regs->column);
+}
+
+static const ut8* r_bin_dwarf_parse_ext_opcode(LineCtx *lc, const ut8 *obuf,
+		size_t len, RBinDwarfSMRegisters *regs) {
+	const ut8 *buf = obuf, *buf_end = obuf + len, *next;
+	FILE *f = lc->f;
 	ut8 opcode;
-	ut64 addr;
-	buf = obuf;
-	st64 op_len;
-	RBinFile *binfile = a ? a->cur : NULL;
-	RBinObject *o = binfile ? binfile->o : NULL;
-	ut32 addr_size = o && o->info && o->info->bits ? o->info->bits / 8 : 4;
+	ut64 addr, op_len;
 	const char *filename;
 
-	if (!binfile || !obuf || !hdr || !regs) return NULL;
-
-	buf = r_leb128 (buf, &op_len);
-	buf_end = buf+len;
+	op_len = dwarf_uleb (&buf, buf_end);
+	if (!op_len || op_len > (ut64)(buf_end - buf)) {
+		return NULL;
+	}
+	next = buf + op_len;
 	opcode = *buf++;
 
 	if (f) {
@@ -433,47 +671,26 @@ static const ut8* r_bin_dwarf_parse_ext_opcode(const RBin *a, const ut8 *obuf,
 	switch (opcode) {
 	case DW_LNE_end_sequence:
 		regs->end_sequence = DWARF_TRUE;
-
-		if (binfile && binfile->sdb_addrinfo && hdr->file_names) {
-			int fnidx = regs->file - 1;
-			if (fnidx >= 0 && fnidx < hdr->file_names_count) {
-				add_sdb_addrline(binfile->sdb_addrinfo, regs->address,
-						hdr->file_names[fnidx].name, regs->line, f, mode);
-			}
-		}
-
 		if (f) {
 			fprintf (f, "End of Sequence\n");
 		}
 		break;
 	case DW_LNE_set_address:
-		if (addr_size == 8) {
-			addr = READ (buf, ut64);
-		} else {
-			addr = READ (buf, ut32);
-		}
-
+		addr = dwarf_read (&buf, next, (int)(op_len - 1));
 		regs->address = addr;
-
 		if (f) {
 			fprintf (f, "set Address to 0x%"PFMT64x"\n", addr);
 		}
 		break;
 	case DW_LNE_define_file:
 		filename = (const char*)buf;
-
 		if (f) {
 			fprintf (f, "define_file\n");
 			fprintf (f, "filename %s\n", filename);
 		}
-
-		buf += (strlen (filename) + 1);
-		ut64 dir_idx;
-		if (buf+1 < buf_end)
-			buf = r_uleb128 (buf, ST32_MAX, &dir_idx);
 		break;
 	case DW_LNE_set_discriminator:
-		buf = r_uleb128 (buf, ST32_MAX, &addr);
+		addr = dwarf_uleb (&buf, next);
 		if (f) {
 			fprintf (f, "set Discriminator to %"PFMT64d"\n", addr);
 		}
@@ -485,31 +702,22 @@ static const ut8* r_bin_dwarf_parse_ext_opcode(const RBin *a, const ut8 *obuf,
 		}
 		break;
 	}
-
-	return buf;
+	return next;
 }
 
-static const ut8* r_bin_dwarf_parse_spec_opcode(
-		const RBin *a, const ut8 *obuf, size_t len,
-		const RBinDwarfLNPHeader *hdr,
-		RBinDwarfSMRegisters *regs,
-		ut8 opcode, FILE *f, int mode) {
-	// XXX - list is not used
-	const ut8 *buf = obuf;
+static const ut8* r_bin_dwarf_parse_spec_opcode(LineCtx *lc, const ut8 *obuf,
+		size_t len, RBinDwarfSMRegisters *regs, ut8 opcode) {
+	const RBinDwarfLNPHeader *hdr = lc->hdr;
+	FILE *f = lc->f;
 	ut8 adj_opcode = 0;
 	ut64 advance_adr;
-	RBinFile *binfile = a ? a->cur : NULL;
-
-	if (!obuf || !hdr || !regs) {
-		return NULL;
-	}
 
 	adj_opcode = opcode - hdr->opcode_base;
 	if (!hdr->line_range) {
 		// line line-range information. move away
 		return NULL;
 	}
-	advance_adr = adj_opcode / hdr->line_range;
+	advance_adr = (adj_opcode / hdr->line_range) * hdr->min_inst_len;
 	regs->address += advance_adr;
 	regs->line += hdr->line_base + (adj_opcode % hdr->line_range);
 	if (f) {
@@ -518,56 +726,39 @@ static const ut8* r_bin_dwarf_parse_spec_opcode(
 			advance_adr, regs->address, hdr->line_base +
 			(adj_opcode % hdr->line_range), regs->line);
 	}
-	if (binfile && binfile->sdb_addrinfo && hdr->file_names) {
-		int idx = regs->file -1;
-		if (idx >= 0 && idx < hdr->file_names_count) {
-			add_sdb_addrline (binfile->sdb_addrinfo, regs->address,
-					hdr->file_names[idx].name,
-					regs->line, f, mode);
-		}
-	}
+	line_emit (lc, regs);
 	regs->basic_block = DWARF_FALSE;
 	regs->prologue_end = DWARF_FALSE;
 	regs->epilogue_begin = DWARF_FALSE;
 	regs->discriminator = 0;
 
-	return buf;
+	return obuf;
 }
 
-static const ut8* r_bin_dwarf_parse_std_opcode(
-		const RBin *a, const ut8 *obuf, size_t len,
-		const RBinDwarfLNPHeader *hdr, RBinDwarfSMRegisters *regs,
-		ut8 opcode, FILE *f, int mode) {
+static const ut8* r_bin_dwarf_parse_std_opcode(LineCtx *lc, const ut8 *obuf,
+		size_t len, RBinDwarfSMRegisters *regs, ut8 opcode) {
+	const RBinDwarfLNPHeader *hdr = lc->hdr;
 	const ut8* buf = obuf;
 	const ut8* buf_end = obuf + len;
+	FILE *f = lc->f;
 	ut64 addr = 0LL;
 	st64 sbuf;
 	ut8 adj_opcode;
 	ut64 op_advance;
 	ut16 operand;
-	RBinFile *binfile = a ? a->cur : NULL;
+	int i;
 
-	if (!binfile || !hdr || !regs || !obuf) {
-		return NULL;
-	}
 	switch (opcode) {
 	case DW_LNS_copy:
 		if (f) {
 			fprintf (f, "Copy\n");
 		}
-		if (binfile && binfile->sdb_addrinfo && hdr->file_names) {
-			int fnidx = regs->file - 1;
-			if (fnidx >= 0 && fnidx < hdr->file_names_count) {
-				add_sdb_addrline (binfile->sdb_addrinfo,
-					regs->address,
-					hdr->file_names[fnidx].name,
-					regs->line, f, mode);
-			}
-		}
+		line_emit (lc, regs);
 		regs->basic_block = DWARF_FALSE;
+		regs->discriminator = 0;
 		break;
 	case DW_LNS_advance_pc:
-		buf = r_uleb128 (buf, ST32_MAX, &addr);
+		addr = dwarf_uleb (&buf, buf_end);
 		regs->address += addr * hdr->min_inst_len;
 		if (f) {
 			fprintf (f, "Advance PC by %"PFMT64d" to 0x%"PFMT64x"\n",
@@ -575,21 +766,21 @@ static const ut8* r_bin_dwarf_parse_std_opcode(
 		}
 		break;
 	case DW_LNS_advance_line:
-		buf = r_leb128(buf, &sbuf);
+		sbuf = dwarf_sleb (&buf, buf_end);
 		regs->line += sbuf;
 		if (f) {
 			fprintf (f, "Advance line by %"PFMT64d", to %"PFMT64d"\n", sbuf, regs->line);
 		}
 		break;
 	case DW_LNS_set_file:
-		buf = r_uleb128 (buf, ST32_MAX, &addr);
+		addr = dwarf_uleb (&buf, buf_end);
 		if (f) {
 			fprintf (f, "Set file to %"PFMT64d"\n", addr);
 		}
 		regs->file = addr;
 		break;
 	case DW_LNS_set_column:
-		buf = r_uleb128 (buf, ST32_MAX, &addr);
+		addr = dwarf_uleb (&buf, buf_end);
 		if (f) {
 			fprintf (f, "Set column to %"PFMT64d"\n", addr);
 		}
@@ -610,7 +801,7 @@ static const ut8* r_bin_dwarf_parse_std_opcode(
 	case DW_LNS_const_add_pc:
 		adj_opcode = 255 - hdr->opcode_base;
 		if (hdr->line_range > 0) {
-			op_advance = adj_opcode / hdr->line_range;
+			op_advance = (adj_opcode / hdr->line_range) * hdr->min_inst_len;
 		} else {
 			op_advance = 0;
 		}
@@ -621,7 +812,7 @@ static const ut8* r_bin_dwarf_parse_std_opcode(
 		}
 		break;
 	case DW_LNS_fixed_advance_pc:
-		operand = READ (buf, ut16);
+		operand = dwarf_read (&buf, buf_end, 2);
 		regs->address += operand;
 		if (f) {
 			fprintf (f,"Fixed advance pc to %"PFMT64d"\n", regs->address);
@@ -640,13 +831,17 @@ static const ut8* r_bin_dwarf_parse_std_opcode(
 		}
 		break;
 	case DW_LNS_set_isa:
-		buf = r_uleb128 (buf, ST32_MAX, &addr);
+		addr = dwarf_uleb (&buf, buf_end);
 		regs->isa = addr;
 		if (f) {
 			fprintf (f, "set_isa\n");
 		}
 		break;
 	default:
+		/* newer opcodes, skip their operands */
+		for (i = 0; hdr->std_opcode_lengths && i < hdr->std_opcode_lengths[opcode]; i++) {
+			dwarf_uleb (&buf, buf_end);
+		}
 		if (f) {
 			fprintf (f, "Unexpected opcode\n");
 		}
@@ -655,37 +850,6 @@ static const ut8* r_bin_dwarf_parse_std_opcode(
 	return buf;
 }
 
-static const ut8* r_bin_dwarf_parse_opcodes(const RBin *a, const ut8 *obuf,
-		size_t len, const RBinDwarfLNPHeader *hdr,
-		RBinDwarfSMRegisters *regs, FILE *f, int mode) {
-	const ut8 *buf, *buf_end;
-	ut8 opcode, ext_opcode;
-
-	if (!a || !obuf || len < 8) {
-		return NULL;
-	}
-	buf = obuf;
-	buf_end = obuf + len;
-
-	while (buf && buf + 1 < buf_end) {
-		opcode = *buf++;
-		len--;
-		if (!opcode) {
-			ext_opcode = *buf;
-			buf = r_bin_dwarf_parse_ext_opcode (a, buf, len, hdr, regs, f, mode);
-			if (ext_opcode == DW_LNE_end_sequence) {
-				break;
-			}
-		} else if (opcode >= hdr->opcode_base) {
-			buf = r_bin_dwarf_parse_spec_opcode (a, buf, len, hdr, regs, opcode, f, mode);
-		} else {
-			buf = r_bin_dwarf_parse_std_opcode (a, buf, len, hdr, regs, opcode, f, mode);
-		}
-		len = (int)(buf_end - buf);
-	}
-	return buf;
-}
-
 static void r_bin_dwarf_set_regs_default (const RBinDwarfLNPHeader *hdr, RBinDwarfSMRegisters *regs) {
 	regs->address = 0;
 	regs->file = 1;
@@ -694,43 +858,98 @@ static void r_bin_dwarf_set_regs_default (const RBinDwarfLNPHeader *hdr, RBinDwa
 	regs->is_stmt = hdr->default_is_stmt;
 	regs->basic_block = DWARF_FALSE;
 	regs->end_sequence = DWARF_FALSE;
+	regs->prologue_end = DWARF_FALSE;
+	regs->epilogue_begin = DWARF_FALSE;
+	regs->discriminator = 0;
+}
+
+/* runs all the sequences of the program of one unit */
+static void r_bin_dwarf_parse_opcodes(LineCtx *lc, const ut8 *obuf, size_t len) {
+	const ut8 *buf = obuf, *buf_end = obuf + len;
+	RBinDwarfSMRegisters regs;
+	ut8 opcode;
+
+	r_bin_dwarf_set_regs_default (lc->hdr, &regs);
+	while (buf && buf < buf_end) {
+		opcode = *buf++;
+		if (!opcode) {
+			buf = r_bin_dwarf_parse_ext_opcode (lc, buf, buf_end - buf, &regs);
+			if (regs.end_sequence) {
+				r_bin_dwarf_set_regs_default (lc->hdr, &regs);
+			}
+		} else if (opcode >= lc->hdr->opcode_base) {
+			buf = r_bin_dwarf_parse_spec_opcode (lc, buf, buf_end - buf, &regs, opcode);
+		} else {
+			buf = r_bin_dwarf_parse_std_opcode (lc, buf, buf_end - buf, &regs, opcode);
+		}
+	}
 }
 
+/* decodes the line programs of all the units of .debug_line into a table
+ * sorted by address, replacing the one of the current file */
 R_API int r_bin_dwarf_parse_line_raw2(const RBin *a, const ut8 *obuf,
 				       size_t len, int mode) {
 	RBinDwarfLNPHeader hdr = {{0}};
-	const ut8 *buf = NULL, *buf_tmp = NULL, *buf_end = NULL;
-	RBinDwarfSMRegisters regs;
-	int tmplen;
-	FILE *f = NULL;
+	const ut8 *buf, *buf_end, *program, *unit_end;
 	RBinFile *binfile = a ? a->cur : NULL;
+	RBinDwarfLine *tmp;
+	LineCtx lc = {0};
+	size_t line_str_len = 0, str_len = 0;
+	ut8 *line_str = NULL, *str = NULL;
 
 	if (!binfile || !obuf) {
 		return false;
 	}
+	lc.hdr = &hdr;
+	lc.mode = mode;
 	if (mode == R_CORE_BIN_PRINT) {
-		f = stdout;
+		lc.f = stdout;
+	}
+	lc.lt = R_NEW0 (RBinDwarfLines);
+	if (!lc.lt || !(lc.lt->files = r_list_newf ((RListFree)r_strpool_intern_release))) {
+		free (lc.lt);
+		return false;
 	}
+	lc.line_str = line_str = get_section_bytes ((RBin *)a, "debug_line_str", &line_str_len);
+	lc.line_str_len = line_str_len;
+	lc.str = str = get_section_bytes ((RBin *)a, "debug_str", &str_len);
+	lc.str_len = str_len;
 	buf = obuf;
 	buf_end = obuf + len;
-	while (buf + 1 < buf_end) {
-		buf_tmp = buf;
-		buf = r_bin_dwarf_parse_lnp_header (a->cur, buf, buf_end, &hdr, f, mode);
-		if (!buf) {
-			return false;
-		}
-		r_bin_dwarf_set_regs_default (&hdr, &regs);
-		tmplen = (int)(buf_end - buf);
-		tmplen = R_MIN (tmplen, 4 + hdr.unit_length.part1);
-		if (tmplen < 1) {
-			break;
-		}
-		if (!r_bin_dwarf_parse_opcodes (a, buf, tmplen, &hdr, &regs, f, mode)) {
+	while (buf + 4 < buf_end) {
+		ut64 unit_len, off = buf - obuf;
+		const char *comp_dir;
+		const ut8 *p = buf;
+		unit_len = dwarf_read (&p, buf_end, 4);
+		if (unit_len == DWARF_INIT_LEN_64) {
+			unit_len = dwarf_read (&p, buf_end, 8);
+		}
+		if (!unit_len || unit_len > (ut64)(buf_end - p)) {
 			break;
 		}
-		buf = buf_tmp + tmplen;
-		len = (int)(buf_end - buf);
-	}
+		unit_end = p + unit_len;
+		comp_dir = sdb_const_get (binfile->sdb_addrinfo,
+			sdb_fmt (0, "DW_AT_comp_dir.0x%"PFMT64x, off), 0);
+		if (!comp_dir) {
+			comp_dir = sdb_const_get (binfile->sdb_addrinfo, "DW_AT_comp_dir", 0);
+		}
+		memset (&hdr, 0, sizeof (hdr));
+		program = r_bin_dwarf_parse_lnp_header (&lc, buf, unit_end, comp_dir);
+		if (program) {
+			r_bin_dwarf_parse_opcodes (&lc, program, unit_end - program);
+		}
+		line_header_fini (&hdr);
+		buf = unit_end;
+	}
+	free (line_str);
+	free (str);
+	tmp = lc.lt->count? malloc (lc.lt->count * sizeof (RBinDwarfLine)): NULL;
+	if (tmp) {
+		lines_sort (lc.lt->rows, tmp, lc.lt->count);
+		free (tmp);
+	}
+	r_bin_dwarf_lines_free (binfile->dwarf_lines);
+	binfile->dwarf_lines = lc.lt;
 	return true;
 }
 
@@ -802,88 +1021,6 @@ R_API int r_bin_dwarf_parse_aranges_raw(const ut8 *obuf, int len, FILE *f) {
 	return 0;
 }
 
-static int r_bin_dwarf_init_debug_info(RBinDwarfDebugInfo *inf) {
-	if (!inf) {
-		return -1;
-	}
-	inf->comp_units = calloc (sizeof (RBinDwarfCompUnit), DEBUG_INFO_CAPACITY);
-
-	// XXX - should we be using error codes?
-	if (!inf->comp_units) {
-		return -ENOMEM;
-	}
-
-	inf->capacity = DEBUG_INFO_CAPACITY;
-	inf->length = 0;
-
-	return true;
-}
-
-static int r_bin_dwarf_init_die(RBinDwarfDIE *die) {
-	if (!die) {
-		return -EINVAL;
-	}
-	die->attr_values = calloc (sizeof (RBinDwarfAttrValue), 8);
-	if (!die->attr_values) {
-		return -ENOMEM;
-	}
-	die->capacity = 8;
-	die->length = 0;
-	return 0;
-}
-
-static int r_bin_dwarf_expand_die(RBinDwarfDIE* die) {
-	RBinDwarfAttrValue *tmp = NULL;
-	if (!die || die->capacity == 0) {
-		return -EINVAL;
-	}
-	if (die->capacity != die->length) {
-		return -EINVAL;
-	}
-	tmp = (RBinDwarfAttrValue*)realloc (die->attr_values,
-			die->capacity * 2 * sizeof (RBinDwarfAttrValue));
-	if (!tmp) {
-		return -ENOMEM;
-	}
-	memset ((ut8*)tmp + die->capacity, 0, die->capacity);
-	die->attr_values = tmp;
-	die->capacity *= 2;
-	return 0;
-}
-
-static int r_bin_dwarf_init_comp_unit(RBinDwarfCompUnit *cu) {
-	if (!cu) {
-		return -EINVAL;
-	}
-	cu->dies = calloc (sizeof (RBinDwarfDIE), COMP_UNIT_CAPACITY);
-	if (!cu->dies) {
-		return -ENOMEM;
-	}
-	cu->capacity = COMP_UNIT_CAPACITY;
-	cu->length = 0;
-	return 0;
-}
-
-static int r_bin_dwarf_expand_cu(RBinDwarfCompUnit *cu) {
-	RBinDwarfDIE *tmp;
-
-	if (!cu || cu->capacity == 0 || cu->capacity != cu->length) {
-		return -EINVAL;
-	}
-
-	tmp = (RBinDwarfDIE*)realloc(cu->dies,
-			cu->capacity * 2 * sizeof(RBinDwarfDIE));
-	if (!tmp) {
-		return -ENOMEM;
-	}
-
-	memset ((ut8*)tmp + cu->capacity, 0, cu->capacity);
-	cu->dies = tmp;
-	cu->capacity *= 2;
-
-	return 0;
-}
-
 static int r_bin_dwarf_init_abbrev_decl(RBinDwarfAbbrevDecl *ad) {
 	if (!ad) {
 		return -EINVAL;
@@ -914,7 +1051,7 @@ static int r_bin_dwarf_expand_abbrev_decl(RBinDwarfAbbrevDecl *ad) {
 		return -ENOMEM;
 	}
 
-	memset ((ut8*)tmp + ad->capacity, 0, ad->capacity);
+	memset (tmp + ad->capacity, 0, ad->capacity * sizeof (RBinDwarfAttrSpec));
 	ad->specs = tmp;
 	ad->capacity *= 2;
 
@@ -948,7 +1085,7 @@ static int r_bin_dwarf_expand_debug_abbrev(RBinDwarfDebugAbbrev *da) {
 	if (!tmp) {
 		return -ENOMEM;
 	}
-	memset ((ut8*)tmp + da->capacity, 0, da->capacity);
+	memset (tmp + da->capacity, 0, da->capacity * sizeof (RBinDwarfAbbrevDecl));
 
 	da->decls = tmp;
 	da->capacity *= 2;
@@ -994,6 +1131,40 @@ R_API void r_bin_dwarf_free_debug_abbrev(RBinDwarfDebugAbbrev *da) {
 		R_FREE (da->decls[i].specs);
 	}
 	R_FREE (da->decls);
+	R_FREE (da->tables);
+	da->tables_count = 0;
+}
+
+/* the decl with the given code in the table of a unit */
+R_API RBinDwarfAbbrevDecl *r_bin_dwarf_abbrev_get(const RBinDwarfDebugAbbrev *da, size_t table, ut64 code) {
+	const RBinDwarfAbbrevTable *t;
+	size_t i;
+	if (!da || table >= da->tables_count) {
+		return NULL;
+	}
+	t = &da->tables[table];
+	if (t->sequential) {
+		return (code >= 1 && code <= t->count)? &da->decls[t->first + code - 1]: NULL;
+	}
+	for (i = t->first; i < t->first + t->count; i++) {
+		if (da->decls[i].code == code) {
+			return &da->decls[i];
+		}
+	}
+	return NULL;
+}
+
+static size_t abbrev_table_find(const RBinDwarfDebugAbbrev *da, ut64 offset) {
+	size_t lo = 0, hi = da? da->tables_count: 0;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (da->tables[mid].offset < offset) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return (da && lo < da->tables_count && da->tables[lo].offset == offset)? lo: SIZE_MAX;
 }
 
 static void r_bin_dwarf_free_attr_value(RBinDwarfAttrValue *val) {
@@ -1003,12 +1174,21 @@ static void r_bin_dwarf_free_attr_value(RBinDwarfAttrValue *val) {
 	switch (val->form) {
 	case DW_FORM_strp:
 	case DW_FORM_string:
+	case DW_FORM_line_strp:
+	case DW_FORM_strx:
+	case DW_FORM_strx1:
+	case DW_FORM_strx2:
+	case DW_FORM_strx3:
+	case DW_FORM_strx4:
+	case DW_FORM_GNU_str_index:
 		R_FREE (val->encoding.str_struct.string);
 		break;
 	case DW_FORM_block:
 	case DW_FORM_block1:
 	case DW_FORM_block2:
 	case DW_FORM_block4:
+	case DW_FORM_exprloc:
+	case DW_FORM_data16:
 		R_FREE (val->encoding.block.data);
 		break;
 	default:
@@ -1038,6 +1218,8 @@ static void r_bin_dwarf_free_comp_unit(RBinDwarfCompUnit *cu) {
 		}
 	}
 	R_FREE (cu->dies);
+	cu->length = cu->capacity = 0;
+	cu->parsed = false;
 }
 
 static void r_bin_dwarf_free_debug_info (RBinDwarfDebugInfo *inf) {
@@ -1049,6 +1231,14 @@ static void r_bin_dwarf_free_debug_info (RBinDwarfDebugInfo *inf) {
 		r_bin_dwarf_free_comp_unit (&inf->comp_units[i]);
 	}
 	R_FREE (inf->comp_units);
+	for (i = 0; i < R_ARRAY_SIZE (inf->owned); i++) {
+		R_FREE (inf->owned[i]);
+	}
+}
+
+R_API void r_bin_dwarf_info_free(RBinDwarfDebugInfo *inf) {
+	r_bin_dwarf_free_debug_info (inf);
+	free (inf);
 }
 
 static void r_bin_dwarf_dump_attr_value(const RBinDwarfAttrValue *val, FILE *f) {
@@ -1058,12 +1248,20 @@ static void r_bin_dwarf_dump_attr_value(const RBinDwarfAttrValue *val, FILE *f)
 	}
 	switch (val->form) {
 	case DW_FORM_addr:
+	case DW_FORM_addrx:
+	case DW_FORM_addrx1:
+	case DW_FORM_addrx2:
+	case DW_FORM_addrx3:
+	case DW_FORM_addrx4:
+	case DW_FORM_GNU_addr_index:
 		fprintf (f, "0x%"PFMT64x"", val->encoding.address);
 		break;
 	case DW_FORM_block:
 	case DW_FORM_block1:
 	case DW_FORM_block2:
 	case DW_FORM_block4:
+	case DW_FORM_exprloc:
+	case DW_FORM_data16:
 		fprintf (f, "%"PFMT64u" byte block:", val->encoding.block.length);
 		for (i = 0; i < val->encoding.block.length; i++) {
 			fprintf (f, "%02x", val->encoding.block.data[i]);
@@ -1074,14 +1272,22 @@ static void r_bin_dwarf_dump_attr_value(const RBinDwarfAttrValue *val, FILE *f)
 	case DW_FORM_data4:
 	case DW_FORM_data8:
 		fprintf (f, "%"PFMT64u"", val->encoding.data);
-		if (val->name == DW_AT_language) {
+		if (val->name == DW_AT_language && val->encoding.data < R_ARRAY_SIZE (dwarf_langs)
+				&& dwarf_langs[val->encoding.data]) {
 			fprintf (f, "   (%s)", dwarf_langs[val->encoding.data]);
 		}
 		break;
 	case DW_FORM_strp:
+	case DW_FORM_line_strp:
 		fprintf (f, "(indirect string, offset: 0x%"PFMT64x"): ",
 				val->encoding.str_struct.offset);
 	case DW_FORM_string:
+	case DW_FORM_strx:
+	case DW_FORM_strx1:
+	case DW_FORM_strx2:
+	case DW_FORM_strx3:
+	case DW_FORM_strx4:
+	case DW_FORM_GNU_str_index:
 		if (val->encoding.str_struct.string) {
 			fprintf (f, "%s", val->encoding.str_struct.string);
 		} else {
@@ -1089,21 +1295,33 @@ static void r_bin_dwarf_dump_attr_value(const RBinDwarfAttrValue *val, FILE *f)
 		}
 		break;
 	case DW_FORM_flag:
+	case DW_FORM_flag_present:
 		fprintf (f, "%u", val->encoding.flag);
 		break;
 	case DW_FORM_sdata:
+	case DW_FORM_implicit_const:
 		fprintf (f, "%"PFMT64d"", val->encoding.sdata);
 		break;
 	case DW_FORM_udata:
+	case DW_FORM_loclistx:
+	case DW_FORM_rnglistx:
 		fprintf (f, "%"PFMT64u"", val->encoding.data);
 		break;
-	case DW_FORM_ref_addr:
-		fprintf (f, "<0x%"PFMT64x">", val->encoding.reference);
+	case DW_FORM_sec_offset:
+	case DW_FORM_strp_sup:
+	case DW_FORM_GNU_strp_alt:
+		fprintf (f, "0x%"PFMT64x"", val->encoding.data);
 		break;
+	case DW_FORM_ref_addr:
 	case DW_FORM_ref1:
 	case DW_FORM_ref2:
 	case DW_FORM_ref4:
 	case DW_FORM_ref8:
+	case DW_FORM_ref_udata:
+	case DW_FORM_ref_sig8:
+	case DW_FORM_ref_sup4:
+	case DW_FORM_ref_sup8:
+	case DW_FORM_GNU_ref_alt:
 		fprintf (f, "<0x%"PFMT64x">", val->encoding.reference);
 		break;
 	default:
@@ -1111,65 +1329,77 @@ static void r_bin_dwarf_dump_attr_value(const RBinDwarfAttrValue *val, FILE *f)
 	};
 }
 
-static void r_bin_dwarf_dump_debug_info(FILE *f, const RBinDwarfDebugInfo *inf) {
-	size_t i, j, k;
+static void r_bin_dwarf_dump_comp_unit(FILE *f, const RBinDwarfCompUnit *cu) {
+	size_t j, k;
 	RBinDwarfDIE *dies;
 	RBinDwarfAttrValue *values;
-	if (!inf || !f) {
-		return;
-	}
 
-	for (i = 0; i < inf->length; i++) {
-		fprintf (f, "  Compilation Unit @ offset 0x%"PFMT64x":\n", inf->comp_units [i].offset);
-		fprintf (f, "   Length:        0x%x\n", inf->comp_units [i].hdr.length);
-		fprintf (f, "   Version:       %d\n", inf->comp_units [i].hdr.version);
-		fprintf (f, "   Abbrev Offset: 0x%x\n", inf->comp_units [i].hdr.abbrev_offset);
-		fprintf (f, "   Pointer Size:  %d\n", inf->comp_units [i].hdr.pointer_size);
+	fprintf (f, "  Compilation Unit @ offset 0x%"PFMT64x":\n", cu->offset);
+	fprintf (f, "   Length:        0x%"PFMT64x"\n", cu->hdr.length);
+	fprintf (f, "   Version:       %d\n", cu->hdr.version);
+	fprintf (f, "   Abbrev Offset: 0x%"PFMT64x"\n", cu->hdr.abbrev_offset);
+	fprintf (f, "   Pointer Size:  %d\n", cu->hdr.pointer_size);
 
-		dies = inf->comp_units[i].dies;
+	dies = cu->dies;
 
-		for (j = 0; j < inf->comp_units[i].length; j++) {
-			fprintf (f, "    Abbrev Number: %"PFMT64u" ", dies[j].abbrev_code);
+	for (j = 0; j < cu->length; j++) {
+		fprintf (f, "    Abbrev Number: %"PFMT64u" ", dies[j].abbrev_code);
 
-			if (dies[j].tag && dies[j].tag <= DW_TAG_volatile_type &&
-				       dwarf_tag_name_encodings[dies[j].tag]) {
-				fprintf (f, "(%s)\n", dwarf_tag_name_encodings[dies[j].tag]);
-			} else {
-				fprintf (f, "(Unknown abbrev tag)\n");
-			}
+		if (dies[j].tag && dies[j].tag <= DW_TAG_volatile_type &&
+			       dwarf_tag_name_encodings[dies[j].tag]) {
+			fprintf (f, "(%s)\n", dwarf_tag_name_encodings[dies[j].tag]);
+		} else {
+			fprintf (f, "(Unknown abbrev tag)\n");
+		}
+
+		if (!dies[j].abbrev_code) {
+			continue;
+		}
+		values = dies[j].attr_values;
 
-			if (!dies[j].abbrev_code) {
+		for (k = 0; k < dies[j].length; k++) {
+			if (!values[k].name) {
 				continue;
 			}
-			values = dies[j].attr_values;
 
-			for (k = 0; k < dies[j].length; k++) {
-				if (!values[k].name) {
-					continue;
-				}
-
-				if (values[k].name < DW_AT_vtable_elem_location &&
-						dwarf_attr_encodings[values[k].name]) {
-					fprintf (f, "     %-18s : ", dwarf_attr_encodings[values[k].name]);
-				} else {
-					fprintf (f, "     TODO\t");
-				}
-				r_bin_dwarf_dump_attr_value (&values[k], f);
-				fprintf (f, "\n");
+			if (values[k].name < DW_AT_vtable_elem_location &&
+					dwarf_attr_encodings[values[k].name]) {
+				fprintf (f, "     %-18s : ", dwarf_attr_encodings[values[k].name]);
+			} else {
+				fprintf (f, "     TODO\t");
 			}
+			r_bin_dwarf_dump_attr_value (&values[k], f);
+			fprintf (f, "\n");
+		}
+	}
+}
+
+static const ut8 *read_block(const ut8 *buf, const ut8 *buf_end, RBinDwarfBlock *block, ut64 length) {
+	block->length = 0;
+	block->data = NULL;
+	if (length > (ut64)(buf_end - buf)) {
+		return NULL;
+	}
+	if (length > 0) {
+		block->data = malloc (length);
+		if (!block->data) {
+			return NULL;
 		}
+		memcpy (block->data, buf, length);
+		block->length = length;
 	}
+	return buf + length;
 }
 
 static const ut8 *r_bin_dwarf_parse_attr_value(const ut8 *obuf, int obuf_len,
-		RBinDwarfAttrSpec *spec, RBinDwarfAttrValue *value,
-		const RBinDwarfCompUnitHdr *hdr,
-		const ut8 *debug_str, size_t debug_str_len) {
+		const RBinDwarfAttrSpec *spec, RBinDwarfAttrValue *value,
+		const RBinDwarfCompUnitHdr *hdr, const RBinDwarfDebugInfo *inf) {
 	const ut8 *buf = obuf;
 	const ut8 *buf_end = obuf + obuf_len;
-	size_t j;
+	const char *str;
+	RBinDwarfAttrSpec ispec;
 
-	if (!spec || !value || !hdr || !obuf || obuf_len < 1) {
+	if (!spec || !value || !hdr || !obuf || obuf_len < 0) {
 		return NULL;
 	}
 
@@ -1183,325 +1413,473 @@ static const ut8 *r_bin_dwarf_parse_attr_value(const ut8 *obuf, int obuf_len,
 	case DW_FORM_addr:
 		switch (hdr->pointer_size) {
 		case 1:
-			value->encoding.address = READ (buf, ut8);
-			break;
 		case 2:
-			value->encoding.address = READ (buf, ut16);
-			break;
 		case 4:
-			value->encoding.address = READ (buf, ut32);
-			break;
 		case 8:
-			value->encoding.address = READ (buf, ut64);
+			value->encoding.address = dwarf_read (&buf, buf_end, hdr->pointer_size);
 			break;
 		default:
 			eprintf ("DWARF: Unexpected pointer size: %u\n", (unsigned)hdr->pointer_size);
 			return NULL;
 		}
 		break;
+	case DW_FORM_block1:
+		buf = read_block (buf, buf_end, &value->encoding.block, dwarf_read (&buf, buf_end, 1));
+		break;
 	case DW_FORM_block2:
-		value->encoding.block.length = READ (buf, ut16);
-		if (value->encoding.block.length > 0) {
-			value->encoding.block.data = calloc (sizeof(ut8), value->encoding.block.length);
-			for (j = 0; j < value->encoding.block.length; j++) {
-				value->encoding.block.data[j] = READ (buf, ut8);
-			}
-		}
+		buf = read_block (buf, buf_end, &value->encoding.block, dwarf_read (&buf, buf_end, 2));
 		break;
 	case DW_FORM_block4:
-		value->encoding.block.length = READ (buf, ut32);
-		if (value->encoding.block.length > 0) {
-			ut8 *data = calloc (sizeof (ut8), value->encoding.block.length);
-			if (data) {
-				for (j = 0; j < value->encoding.block.length; j++) {
-					data[j] = READ (buf, ut8);
-				}
-			}
-			value->encoding.block.data = data;
-		}
+		buf = read_block (buf, buf_end, &value->encoding.block, dwarf_read (&buf, buf_end, 4));
+		break;
+	case DW_FORM_block:
+	case DW_FORM_exprloc:
+		buf = read_block (buf, buf_end, &value->encoding.block, dwarf_uleb (&buf, buf_end));
+		break;
+	case DW_FORM_data16:
+		buf = read_block (buf, buf_end, &value->encoding.block, 16);
+		break;
+	case DW_FORM_data1:
+		value->encoding.data = dwarf_read (&buf, buf_end, 1);
 		break;
-#if 0
-// This causes segfaults to happen
 	case DW_FORM_data2:
-		value->encoding.data = READ (buf, ut16);
+		value->encoding.data = dwarf_read (&buf, buf_end, 2);
 		break;
 	case DW_FORM_data4:
-		value->encoding.data = READ (buf, ut32);
+		value->encoding.data = dwarf_read (&buf, buf_end, 4);
 		break;
 	case DW_FORM_data8:
-		value->encoding.data = READ (buf, ut64);
+		value->encoding.data = dwarf_read (&buf, buf_end, 8);
 		break;
-#endif
 	case DW_FORM_string:
-		value->encoding.str_struct.string = *buf? strdup ((const char*)buf) : NULL;
-		buf += (strlen ((const char*)buf) + 1);
-		break;
-	case DW_FORM_block:
-		buf = r_uleb128 (buf, buf_end - buf, &value->encoding.block.length);
-		if (!buf) {
+		str = dwarf_string (obuf, obuf_len, 0);
+		if (!str) {
 			return NULL;
 		}
-		value->encoding.block.data = calloc (sizeof (ut8), value->encoding.block.length);
-		if (value->encoding.block.data) {
-			for (j = 0; j < value->encoding.block.length; j++) {
-				value->encoding.block.data[j] = READ (buf, ut8);
-			}
-		}
-		break;
-	case DW_FORM_block1:
-		value->encoding.block.length = READ (buf, ut8);
-		value->encoding.block.data = calloc (sizeof (ut8), value->encoding.block.length + 1);
-		if (value->encoding.block.data) {
-			for (j = 0; j < value->encoding.block.length; j++) {
-				value->encoding.block.data[j] = READ (buf, ut8);
-			}
-		}
+		value->encoding.str_struct.string = *str? strdup (str): NULL;
+		buf += strlen (str) + 1;
 		break;
 	case DW_FORM_flag:
-		value->encoding.flag = READ (buf, ut8);
+		value->encoding.flag = dwarf_read (&buf, buf_end, 1);
+		break;
+	case DW_FORM_flag_present:
+		value->encoding.flag = 1;
 		break;
 	case DW_FORM_sdata:
-		buf = r_leb128 (buf, &value->encoding.sdata);
+		value->encoding.sdata = dwarf_sleb (&buf, buf_end);
+		break;
+	case DW_FORM_implicit_const:
+		value->encoding.sdata = spec->implicit_const;
 		break;
 	case DW_FORM_strp:
-		value->encoding.str_struct.offset = READ (buf, ut32);
-		if (debug_str && value->encoding.str_struct.offset < debug_str_len) {
-			value->encoding.str_struct.string = strdup (
-				(const char *)(debug_str +
-					value->encoding.str_struct.offset));
-		} else {
-			value->encoding.str_struct.string = NULL;
-		}
+	case DW_FORM_line_strp:
+		value->encoding.str_struct.offset = dwarf_read (&buf, buf_end, hdr->offset_size);
+		str = spec->attr_form == DW_FORM_strp
+			? dwarf_string (inf->str, inf->str_len, value->encoding.str_struct.offset)
+			: dwarf_string (inf->line_str, inf->line_str_len, value->encoding.str_struct.offset);
+		value->encoding.str_struct.string = str? strdup (str): NULL;
+		break;
+	/* indexes into .debug_str_offsets and .debug_addr, they are resolved
+	 * once the bases in the unit DIE are known */
+	case DW_FORM_strx:
+	case DW_FORM_GNU_str_index:
+		value->encoding.str_struct.offset = dwarf_uleb (&buf, buf_end);
+		break;
+	case DW_FORM_strx1:
+	case DW_FORM_strx2:
+	case DW_FORM_strx3:
+	case DW_FORM_strx4:
+		value->encoding.str_struct.offset = dwarf_read (&buf, buf_end,
+			spec->attr_form - DW_FORM_strx1 + 1);
+		break;
+	case DW_FORM_addrx:
+	case DW_FORM_GNU_addr_index:
+		value->encoding.address = dwarf_uleb (&buf, buf_end);
+		break;
+	case DW_FORM_addrx1:
+	case DW_FORM_addrx2:
+	case DW_FORM_addrx3:
+	case DW_FORM_addrx4:
+		value->encoding.address = dwarf_read (&buf, buf_end,
+			spec->attr_form - DW_FORM_addrx1 + 1);
 		break;
 	case DW_FORM_udata:
-		{
-			ut64 ndata = 0;
-			const ut8 *data = (const ut8*)&ndata;
-			buf = r_uleb128 (buf, R_MIN (sizeof (data), (size_t)(buf_end - buf)), &ndata);
-			memcpy (&value->encoding.data, data, sizeof (value->encoding.data));
-			value->encoding.str_struct.string = NULL;
-		}
+	case DW_FORM_loclistx:
+	case DW_FORM_rnglistx:
+		value->encoding.data = dwarf_uleb (&buf, buf_end);
+		break;
+	case DW_FORM_sec_offset:
+	case DW_FORM_strp_sup:
+	case DW_FORM_GNU_strp_alt:
+		value->encoding.data = dwarf_read (&buf, buf_end, hdr->offset_size);
 		break;
 	case DW_FORM_ref_addr:
-		value->encoding.reference = READ (buf, ut64); // addr size of machine
+		/* an address sized offset in DWARF2 */
+		value->encoding.reference = dwarf_read (&buf, buf_end,
+			hdr->version == 2? hdr->pointer_size: hdr->offset_size);
+		break;
+	case DW_FORM_GNU_ref_alt:
+		value->encoding.reference = dwarf_read (&buf, buf_end, hdr->offset_size);
 		break;
 	case DW_FORM_ref1:
-		value->encoding.reference = READ (buf, ut8);
+		value->encoding.reference = dwarf_read (&buf, buf_end, 1);
 		break;
 	case DW_FORM_ref2:
-		value->encoding.reference = READ (buf, ut16);
+		value->encoding.reference = dwarf_read (&buf, buf_end, 2);
 		break;
 	case DW_FORM_ref4:
-		value->encoding.reference = READ (buf, ut32);
+	case DW_FORM_ref_sup4:
+		value->encoding.reference = dwarf_read (&buf, buf_end, 4);
 		break;
 	case DW_FORM_ref8:
-		value->encoding.reference = READ (buf, ut64);
+	case DW_FORM_ref_sig8:
+	case DW_FORM_ref_sup8:
+		value->encoding.reference = dwarf_read (&buf, buf_end, 8);
 		break;
-	case DW_FORM_data1:
-		value->encoding.data = READ (buf, ut8);
+	case DW_FORM_ref_udata:
+		value->encoding.reference = dwarf_uleb (&buf, buf_end);
 		break;
+	case DW_FORM_indirect:
+		ispec = *spec;
+		ispec.attr_form = dwarf_uleb (&buf, buf_end);
+		if (ispec.attr_form == DW_FORM_indirect || buf >= buf_end) {
+			return NULL;
+		}
+		return r_bin_dwarf_parse_attr_value (buf, buf_end - buf, &ispec, value, hdr, inf);
 	default:
 		eprintf ("Unknown DW_FORM 0x%02"PFMT64x"\n", spec->attr_form);
 		value->encoding.data = 0;
 		return NULL;
 	}
-	return buf;
+	return (buf && buf <= buf_end)? buf: NULL;
 }
 
-static const ut8 *r_bin_dwarf_parse_comp_unit(Sdb *s, const ut8 *obuf,
-		RBinDwarfCompUnit *cu, const RBinDwarfDebugAbbrev *da,
-		size_t offset, const ut8 *debug_str, size_t debug_str_len) {
-	const ut8 *buf = obuf, *buf_end = obuf + (cu->hdr.length - 7);
-	ut64 abbr_code;
+static void r_bin_dwarf_resolve_die(const RBinDwarfDebugInfo *inf, const RBinDwarfCompUnit *cu, RBinDwarfDIE *die) {
 	size_t i;
-	
-	if (cu->hdr.length > debug_str_len) {
-		//avoid oob read
-		return NULL;
-	}
-	while (buf && buf < buf_end && buf >= obuf) {
-		if (cu->length && cu->capacity == cu->length) {
-			r_bin_dwarf_expand_cu (cu);
-		}
-		buf = r_uleb128 (buf, buf_end - buf, &abbr_code);
-		if (abbr_code > da->length || !buf) {
-			return NULL;
+	for (i = 0; i < die->length; i++) {
+		RBinDwarfAttrValue *val = &die->attr_values[i];
+		const ut8 *p, *end;
+		const char *str;
+		ut64 off;
+		switch (val->form) {
+		case DW_FORM_strx:
+		case DW_FORM_strx1:
+		case DW_FORM_strx2:
+		case DW_FORM_strx3:
+		case DW_FORM_strx4:
+		case DW_FORM_GNU_str_index:
+			off = cu->str_offsets_base + val->encoding.str_struct.offset * cu->hdr.offset_size;
+			if (!inf->str_offsets || off >= inf->str_offsets_len) {
+				break;
+			}
+			p = inf->str_offsets + off;
+			end = inf->str_offsets + inf->str_offsets_len;
+			off = dwarf_read (&p, end, cu->hdr.offset_size);
+			val->encoding.str_struct.offset = off;
+			str = dwarf_string (inf->str, inf->str_len, off);
+			val->encoding.str_struct.string = str? strdup (str): NULL;
+			break;
+		case DW_FORM_addrx:
+		case DW_FORM_addrx1:
+		case DW_FORM_addrx2:
+		case DW_FORM_addrx3:
+		case DW_FORM_addrx4:
+		case DW_FORM_GNU_addr_index:
+			off = cu->addr_base + val->encoding.address * cu->hdr.pointer_size;
+			if (!inf->addr || off >= inf->addr_len) {
+				break;
+			}
+			p = inf->addr + off;
+			end = inf->addr + inf->addr_len;
+			val->encoding.address = dwarf_read (&p, end, cu->hdr.pointer_size);
+			break;
 		}
+	}
+}
+
+/* reads up to max DIEs of the unit, all of them when max is 0 */
+static bool r_bin_dwarf_parse_comp_unit(const RBinDwarfDebugInfo *inf, RBinDwarfCompUnit *cu, size_t max) {
+	const ut8 *buf, *buf_end;
+	ut64 abbr_code, end;
+	size_t i;
 
-		r_bin_dwarf_init_die (&cu->dies[cu->length]);
+	end = cu->offset + (cu->hdr.offset_size == 8? 12: 4) + cu->hdr.length;
+	if (cu->abbrevs == SIZE_MAX || end > inf->info_len) {
+		return false;
+	}
+	buf = inf->info + cu->offset + cu->hdr.header_size;
+	buf_end = inf->info + end;
+	while (buf && buf < buf_end && (!max || cu->length < max)) {
+		RBinDwarfAbbrevDecl *decl;
+		RBinDwarfDIE *die;
+		if (cu->length == cu->capacity) {
+			size_t n = cu->capacity? cu->capacity * 2: COMP_UNIT_CAPACITY;
+			RBinDwarfDIE *dies = realloc (cu->dies, n * sizeof (RBinDwarfDIE));
+			if (!dies) {
+				return false;
+			}
+			cu->dies = dies;
+			cu->capacity = n;
+		}
+		die = &cu->dies[cu->length];
+		memset (die, 0, sizeof (RBinDwarfDIE));
+		abbr_code = dwarf_uleb (&buf, buf_end);
 		if (!abbr_code) {
-			cu->dies[cu->length].abbrev_code = 0;
 			cu->length++;
-			buf++;
 			continue;
 		}
-
-		cu->dies[cu->length].abbrev_code = abbr_code;
-		cu->dies[cu->length].tag = da->decls[abbr_code - 1].tag;
-		abbr_code += offset;
-
-		if (da->capacity < abbr_code) {
-			return NULL;
+		decl = r_bin_dwarf_abbrev_get (inf->da, cu->abbrevs, abbr_code);
+		if (!decl) {
+			return false;
 		}
-
-		for (i = 0; i < da->decls[abbr_code - 1].length; i++) {
-			if (cu->dies[cu->length].length == cu->dies[cu->length].capacity) {
-				r_bin_dwarf_expand_die (&cu->dies[cu->length]);
-			}
-			if (i >= cu->dies[cu->length].capacity || i >= da->decls[abbr_code - 1].capacity) {
-				eprintf ("Warning: malformed dwarf attribute capacity doesn't match length\n");
-				break;
-			}
-			memset (&cu->dies[cu->length].attr_values[i], 0, sizeof (cu->dies[cu->length].attr_values[i]));
+		die->abbrev_code = abbr_code;
+		die->tag = decl->tag;
+		die->attr_values = calloc (R_MAX (decl->length, 1), sizeof (RBinDwarfAttrValue));
+		if (!die->attr_values) {
+			return false;
+		}
+		die->capacity = R_MAX (decl->length, 1);
+		cu->length++;
+		for (i = 0; i < decl->length; i++) {
 			buf = r_bin_dwarf_parse_attr_value (buf, buf_end - buf,
-					&da->decls[abbr_code - 1].specs[i],
-					&cu->dies[cu->length].attr_values[i],
-					&cu->hdr, debug_str, debug_str_len);
-			if (cu->dies[cu->length].attr_values[i].name == DW_AT_comp_dir) {
-				const char *name = cu->dies[cu->length].attr_values[i].encoding.str_struct.string;
-				sdb_set (s, "DW_AT_comp_dir", name, 0);
+					&decl->specs[i], &die->attr_values[i], &cu->hdr, inf);
+			if (!buf) {
+				return false;
+			}
+			die->length++;
+		}
+		if (cu->length == 1) {
+			for (i = 0; i < die->length; i++) {
+				if (die->attr_values[i].name == DW_AT_str_offsets_base) {
+					cu->str_offsets_base = die->attr_values[i].encoding.data;
+				} else if (die->attr_values[i].name == DW_AT_addr_base) {
+					cu->addr_base = die->attr_values[i].encoding.data;
+				}
 			}
-			cu->dies[cu->length].length++;
 		}
-		cu->length++;
+		r_bin_dwarf_resolve_die (inf, cu, die);
 	}
-	return buf;
+	return true;
 }
 
-R_API int r_bin_dwarf_parse_info_raw(Sdb *s, RBinDwarfDebugAbbrev *da,
-		const ut8 *obuf, size_t len,
-		const ut8 *debug_str, size_t debug_str_len, int mode) {
-	const ut8 *buf = obuf, *buf_end = obuf + len;
-	size_t k, offset = 0;
-	int curr_unit = 0;
-	RBinDwarfDebugInfo di = {0};
-	RBinDwarfDebugInfo *inf = &di;
-	bool ret = true;
-
-	if (!da || !s || !obuf) {
-		return false;
+/* the DIEs of a unit are only read when asked for */
+R_API RBinDwarfCompUnit *r_bin_dwarf_info_unit(RBinDwarfDebugInfo *inf, size_t idx) {
+	RBinDwarfCompUnit *cu;
+	if (!inf || idx >= inf->length) {
+		return NULL;
 	}
-
-	if (r_bin_dwarf_init_debug_info (inf) < 0) {
-		ret = false;
-		goto out;
+	cu = &inf->comp_units[idx];
+	if (!cu->parsed) {
+		r_bin_dwarf_free_comp_unit (cu);
+		r_bin_dwarf_parse_comp_unit (inf, cu, 0);
+		cu->parsed = true;
 	}
-	while (buf < buf_end) {
-		if (inf->length >= inf->capacity)
-			break;
+	return cu;
+}
 
-		if (r_bin_dwarf_init_comp_unit (&inf->comp_units[curr_unit]) < 0) {
-			ret = false;
-			curr_unit--;
-			goto out_debug_info;
-		}
+/* walks the unit headers of .debug_info */
+static bool r_bin_dwarf_index_units(RBinDwarfDebugInfo *inf) {
+	const ut8 *buf = inf->info, *buf_end = inf->info + inf->info_len;
 
-		inf->comp_units[curr_unit].offset = buf - obuf;
-		inf->comp_units[curr_unit].hdr.pointer_size = 0;
-		inf->comp_units[curr_unit].hdr.abbrev_offset = 0;
-		inf->comp_units[curr_unit].hdr.length = READ (buf, ut32);
-		inf->comp_units[curr_unit].hdr.version = READ (buf, ut16);
+	while (buf && buf + 4 < buf_end) {
+		RBinDwarfCompUnitHdr hdr = {0};
+		const ut8 *start = buf, *unit_end;
+		RBinDwarfCompUnit *cu;
 
-		if (inf->comp_units[curr_unit].hdr.version != 2) {
-//			eprintf ("DWARF: version %d is not yet supported.\n",
-//					inf->comp_units[curr_unit].hdr.version);
-			ret = false;
-			goto out_debug_info;
+		hdr.offset_size = 4;
+		hdr.length = dwarf_read (&buf, buf_end, 4);
+		if (hdr.length == DWARF_INIT_LEN_64) {
+			hdr.length = dwarf_read (&buf, buf_end, 8);
+			hdr.offset_size = 8;
 		}
-		if (inf->comp_units[curr_unit].hdr.length > len) {
-			ret = false;
-			goto out_debug_info;
+		if (!hdr.length || hdr.length > (ut64)(buf_end - buf)) {
+			break;
 		}
-
-		inf->comp_units[curr_unit].hdr.abbrev_offset = READ (buf, ut32);
-		inf->comp_units[curr_unit].hdr.pointer_size = READ (buf, ut8);
-		inf->length++;
-
-		/* Linear search FIXME */
-		if (da->decls->length >= da->capacity) {
-			eprintf ("WARNING: malformed dwarf have not enough buckets for decls.\n");
+		unit_end = buf + hdr.length;
+		hdr.version = dwarf_read (&buf, buf_end, 2);
+		if (hdr.version < 2 || hdr.version > 5) {
+			buf = unit_end;
+			continue;
 		}
-		const int k_max = R_MIN (da->capacity, da->decls->length);
-		for (k = 0; k < k_max; k++) {
-			if (da->decls[k].offset ==
-				inf->comp_units[curr_unit].hdr.abbrev_offset) {
-				offset = k;
+		if (hdr.version >= 5) {
+			hdr.unit_type = dwarf_read (&buf, unit_end, 1);
+			hdr.pointer_size = dwarf_read (&buf, unit_end, 1);
+			hdr.abbrev_offset = dwarf_read (&buf, unit_end, hdr.offset_size);
+			switch (hdr.unit_type) {
+			case DW_UT_type:
+			case DW_UT_split_type:
+				buf += 8 + hdr.offset_size;
 				break;
+			case DW_UT_skeleton:
+			case DW_UT_split_compile:
+				buf += 8;
+				break;
+			}
+		} else {
+			hdr.unit_type = DW_UT_compile;
+			hdr.abbrev_offset = dwarf_read (&buf, unit_end, hdr.offset_size);
+			hdr.pointer_size = dwarf_read (&buf, unit_end, 1);
+		}
+		if (buf > unit_end) {
+			break;
+		}
+		hdr.header_size = buf - start;
+		if (inf->length == inf->capacity) {
+			size_t n = inf->capacity? inf->capacity * 2: DEBUG_INFO_CAPACITY;
+			RBinDwarfCompUnit *units = realloc (inf->comp_units, n * sizeof (RBinDwarfCompUnit));
+			if (!units) {
+				return false;
 			}
+			inf->comp_units = units;
+			inf->capacity = n;
 		}
+		cu = &inf->comp_units[inf->length++];
+		memset (cu, 0, sizeof (RBinDwarfCompUnit));
+		cu->hdr = hdr;
+		cu->offset = start - inf->info;
+		cu->abbrevs = abbrev_table_find (inf->da, hdr.abbrev_offset);
+		buf = unit_end;
+	}
+	return true;
+}
 
-		buf = r_bin_dwarf_parse_comp_unit (s, buf, &inf->comp_units[curr_unit],
-			da, offset, debug_str, debug_str_len);
+/* the unit DIE tells where the sources are, the line programs are
+ * decoded relative to it */
+static void r_bin_dwarf_unit_dirs(Sdb *s, const RBinDwarfDebugInfo *inf, RBinDwarfCompUnit *cu) {
+	const char *comp_dir = NULL;
+	ut64 stmt_list = UT64_MAX;
+	size_t i;
 
-		if (!buf) {
-			ret = false;
-			goto out_debug_info;
+	if (!r_bin_dwarf_parse_comp_unit (inf, cu, 1) || !cu->length) {
+		r_bin_dwarf_free_comp_unit (cu);
+		return;
+	}
+	for (i = 0; i < cu->dies[0].length; i++) {
+		const RBinDwarfAttrValue *val = &cu->dies[0].attr_values[i];
+		if (val->name == DW_AT_comp_dir) {
+			comp_dir = val->encoding.str_struct.string;
+		} else if (val->name == DW_AT_stmt_list) {
+			stmt_list = val->encoding.data;
+		}
+	}
+	if (comp_dir) {
+		sdb_set (s, "DW_AT_comp_dir", comp_dir, 0);
+		if (stmt_list != UT64_MAX) {
+			sdb_set (s, sdb_fmt (0, "DW_AT_comp_dir.0x%"PFMT64x, stmt_list), comp_dir, 0);
 		}
-
-		curr_unit++;
 	}
+	r_bin_dwarf_free_comp_unit (cu);
+}
 
-	if (mode == R_CORE_BIN_PRINT) {
-		r_bin_dwarf_dump_debug_info (NULL, inf);
+static void r_bin_dwarf_walk_units(Sdb *s, RBinDwarfDebugInfo *inf, int mode) {
+	size_t i;
+	for (i = 0; i < inf->length; i++) {
+		if (mode == R_CORE_BIN_PRINT && DBGFD) {
+			RBinDwarfCompUnit *cu = r_bin_dwarf_info_unit (inf, i);
+			r_bin_dwarf_dump_comp_unit (DBGFD, cu);
+			r_bin_dwarf_free_comp_unit (cu);
+		}
+		r_bin_dwarf_unit_dirs (s, inf, &inf->comp_units[i]);
 	}
+}
+
+R_API int r_bin_dwarf_parse_info_raw(Sdb *s, RBinDwarfDebugAbbrev *da,
+		const ut8 *obuf, size_t len,
+		const ut8 *debug_str, size_t debug_str_len, int mode) {
+	RBinDwarfDebugInfo inf = {0};
+	int ret;
 
-out_debug_info:
-	for (; curr_unit >= 0; curr_unit--) {
-		r_bin_dwarf_free_comp_unit (&inf->comp_units[curr_unit]);
+	if (!da || !s || !obuf) {
+		return false;
 	}
-	r_bin_dwarf_free_debug_info (inf);
-out:
+	inf.da = da;
+	inf.info = obuf;
+	inf.info_len = len;
+	inf.str = debug_str;
+	inf.str_len = debug_str_len;
+	ret = r_bin_dwarf_index_units (&inf);
+	if (ret) {
+		r_bin_dwarf_walk_units (s, &inf, mode);
+	}
+	r_bin_dwarf_free_debug_info (&inf);
 	return ret;
 }
 
 static RBinDwarfDebugAbbrev *r_bin_dwarf_parse_abbrev_raw(const ut8 *obuf, size_t len, int mode) {
 	const ut8 *buf = obuf, *buf_end = obuf + len;
 	ut64 tmp, spec1, spec2, offset;
-	ut8 has_children;
 	RBinDwarfAbbrevDecl *tmpdecl;
+	RBinDwarfAbbrevTable *table = NULL;
+	size_t tables_size = 0;
 
 	// XXX - Set a suitable value here.
 	if (!obuf || len < 3) {
 		return NULL;
 	}
 	RBinDwarfDebugAbbrev *da = R_NEW0 (RBinDwarfDebugAbbrev);
+	if (!da || r_bin_dwarf_init_debug_abbrev (da) < 0) {
+		free (da);
+		return NULL;
+	}
 
-	r_bin_dwarf_init_debug_abbrev (da);
-
-	while (buf && buf+1 < buf_end) {
+	while (buf && buf < buf_end) {
 		offset = buf - obuf;
-		buf = r_uleb128 (buf, (size_t)(buf_end-buf), &tmp);
-		if (!buf || !tmp) {
+		tmp = dwarf_uleb (&buf, buf_end);
+		if (!tmp) {
+			/* end of the decls of a unit */
+			table = NULL;
 			continue;
 		}
-		if (da->length == da->capacity) {
-			r_bin_dwarf_expand_debug_abbrev(da);
+		if (!table) {
+			if (da->tables_count == tables_size) {
+				size_t n = tables_size? tables_size * 2: 16;
+				RBinDwarfAbbrevTable *tables = realloc (da->tables, n * sizeof (RBinDwarfAbbrevTable));
+				if (!tables) {
+					break;
+				}
+				da->tables = tables;
+				tables_size = n;
+			}
+			table = &da->tables[da->tables_count++];
+			table->offset = offset;
+			table->first = da->length;
+			table->count = 0;
+			table->sequential = true;
+		}
+		if (da->length == da->capacity && r_bin_dwarf_expand_debug_abbrev (da) < 0) {
+			break;
 		}
 		tmpdecl = &da->decls[da->length];
-		r_bin_dwarf_init_abbrev_decl (tmpdecl);
+		if (r_bin_dwarf_init_abbrev_decl (tmpdecl) < 0) {
+			break;
+		}
 
 		tmpdecl->code = tmp;
-		buf = r_uleb128 (buf, (size_t)(buf_end-buf), &tmp);
-		tmpdecl->tag = tmp;
-
+		tmpdecl->tag = dwarf_uleb (&buf, buf_end);
 		tmpdecl->offset = offset;
-		if (buf >= buf_end) {
-			break;
-		}
-		has_children = READ (buf, ut8);
-		tmpdecl->has_children = has_children;
-		do {
-			if (tmpdecl->length == tmpdecl->capacity) {
-				r_bin_dwarf_expand_abbrev_decl (tmpdecl);
+		tmpdecl->has_children = dwarf_read (&buf, buf_end, 1);
+		while (buf < buf_end) {
+			spec1 = dwarf_uleb (&buf, buf_end);
+			spec2 = dwarf_uleb (&buf, buf_end);
+			if (!spec1 && !spec2) {
+				break;
+			}
+			if (tmpdecl->length == tmpdecl->capacity && r_bin_dwarf_expand_abbrev_decl (tmpdecl) < 0) {
+				break;
 			}
-			buf = r_uleb128 (buf, (size_t)(buf_end - buf), &spec1);
-			buf = r_uleb128 (buf, (size_t)(buf_end - buf), &spec2);
 			tmpdecl->specs[tmpdecl->length].attr_name = spec1;
 			tmpdecl->specs[tmpdecl->length].attr_form = spec2;
+			tmpdecl->specs[tmpdecl->length].implicit_const = 0;
+			if (spec2 == DW_FORM_implicit_const) {
+				tmpdecl->specs[tmpdecl->length].implicit_const = dwarf_sleb (&buf, buf_end);
+			}
 			tmpdecl->length++;
-		} while (spec1 && spec2);
-
+		}
 		da->length++;
+		table->count++;
+		if (tmpdecl->code != table->count) {
+			table->sequential = false;
+		}
 	}
 
 	if (mode == R_CORE_BIN_PRINT) {
@@ -1515,8 +1893,16 @@ RBinSection *getsection(RBin *a, const char *sn) {
 	RBinSection *section = NULL;
 	RBinFile *binfile = a ? a->cur: NULL;
 	RBinObject *o = binfile ? binfile->o : NULL;
+	size_t sn_len = strlen (sn);
 
 	if ( o && o->sections) {
+		/* debug_str must not be found as debug_str_offsets */
+		r_list_foreach (o->sections, iter, section) {
+			size_t len = strlen (section->name);
+			if (len >= sn_len && !strcmp (section->name + len - sn_len, sn)) {
+				return section;
+			}
+		}
 		r_list_foreach (o->sections, iter, section) {
 			if (strstr (section->name, sn)) {
 				return section;
@@ -1526,48 +1912,66 @@ RBinSection *getsection(RBin *a, const char *sn) {
 	return NULL;
 }
 
-R_API int r_bin_dwarf_parse_info(RBinDwarfDebugAbbrev *da, RBin *a, int mode) {
-	ut8 *buf, *debug_str_buf = 0;
-	int len, debug_str_len = 0, ret;
-	RBinSection *debug_str;
-	RBinSection *section = getsection (a, "debug_info");
+static ut8 *get_section_bytes(RBin *a, const char *sn, size_t *len) {
+	RBinSection *section = getsection (a, sn);
 	RBinFile *binfile = a ? a->cur: NULL;
+	ut8 *buf;
 
-	if (binfile && section) {
-		debug_str = getsection (a, "debug_str");
-		if (debug_str) {
-			debug_str_len = debug_str->size;
-			debug_str_buf = calloc (1, debug_str_len + 1);
-			ret = r_buf_read_at (binfile->buf, debug_str->paddr,
-					     debug_str_buf, debug_str_len);
-			if (!ret) {
-				free (debug_str_buf);
-				return false;
-			}
-		}
-
-		len = section->size;
-		if (len > (UT32_MAX >> 1) || len < 1) {
-			free (debug_str_buf);
-			return false;
-		}
-		buf = calloc (1, len);
-		if (!buf) {
-			free (debug_str_buf);
-			return false;
-		}
-		if (!r_buf_read_at (binfile->buf, section->paddr, buf, len)) {
-			free (debug_str_buf);
-			free (buf);
-			return false;
-		}
-		ret = r_bin_dwarf_parse_info_raw (binfile->sdb_addrinfo, da, buf, len,
-				debug_str_buf, debug_str_len, mode);
-		R_FREE (debug_str_buf);
+	*len = 0;
+	if (!binfile || !section || section->size < 1 || section->size > binfile->size) {
+		return NULL;
+	}
+	buf = calloc (1, section->size + 1);
+	if (!buf) {
+		return NULL;
+	}
+	if (r_buf_read_at (binfile->buf, section->paddr, buf, section->size) < 1) {
 		free (buf);
-		return ret;
+		return NULL;
+	}
+	*len = section->size;
+	return buf;
+}
+
+/* indexes the units of .debug_info, their DIEs are read by
+ * r_bin_dwarf_info_unit. da must outlive the returned object */
+R_API RBinDwarfDebugInfo *r_bin_dwarf_info_new(RBin *a, const RBinDwarfDebugAbbrev *da) {
+	RBinDwarfDebugInfo *inf;
+	ut8 *info;
+	size_t len;
+
+	if (!da || !(info = get_section_bytes (a, "debug_info", &len))) {
+		return NULL;
+	}
+	inf = R_NEW0 (RBinDwarfDebugInfo);
+	if (!inf) {
+		free (info);
+		return NULL;
+	}
+	inf->da = da;
+	inf->info = inf->owned[0] = info;
+	inf->info_len = len;
+	inf->str = inf->owned[1] = get_section_bytes (a, "debug_str", &inf->str_len);
+	inf->line_str = inf->owned[2] = get_section_bytes (a, "debug_line_str", &inf->line_str_len);
+	inf->str_offsets = inf->owned[3] = get_section_bytes (a, "debug_str_offsets", &inf->str_offsets_len);
+	inf->addr = inf->owned[4] = get_section_bytes (a, "debug_addr", &inf->addr_len);
+	if (!r_bin_dwarf_index_units (inf)) {
+		r_bin_dwarf_info_free (inf);
+		return NULL;
+	}
+	return inf;
+}
+
+R_API int r_bin_dwarf_parse_info(RBinDwarfDebugAbbrev *da, RBin *a, int mode) {
+	RBinDwarfDebugInfo *inf;
+	RBinFile *binfile = a ? a->cur: NULL;
+
+	if (!binfile || !(inf = r_bin_dwarf_info_new (a, da))) {
+		return false;
 	}
-	return false;
+	r_bin_dwarf_walk_units (binfile->sdb_addrinfo, inf, mode);
+	r_bin_dwarf_info_free (inf);
+	return true;
 }
 
 static RBinDwarfRow *r_bin_dwarf_row_new (ut64 addr, const char *file, int line, int col) {
@@ -1578,7 +1982,7 @@ static RBinDwarfRow *r_bin_dwarf_row_new (ut64 addr, const char *file, int line,
 	row->file = strdup (file);
 	row->address = addr;
 	row->line = line;
-	row->column = 0;
+	row->column = col;
 	return row;
 }
 
@@ -1591,59 +1995,28 @@ static void r_bin_dwarf_row_free(void *p) {
 R_API RList *r_bin_dwarf_parse_line(RBin *a, int mode) {
 	ut8 *buf;
 	RList *list = NULL;
-	int len, ret;
-	RBinSection *section = getsection (a, "debug_line");
+	RBinDwarfLines *lt;
+	size_t i, len;
 	RBinFile *binfile = a ? a->cur: NULL;
-	if (binfile && section) {
-		len = section->size;
-		if (len < 1) {
-			return NULL;
-		}
-		buf = calloc (1, len + 1);
-		if (!buf) {
-			return NULL;
-		}
-		ret = r_buf_read_at (binfile->buf, section->paddr, buf, len);
-		if (ret != len) {
-			free (buf);
-			return NULL;
-		}
-		list = r_list_new (); // always return empty list wtf
-		if (!list) {
-			free (buf);
-			return NULL;
-		}
-		list->free = r_bin_dwarf_row_free;
-		r_bin_dwarf_parse_line_raw2 (a, buf, len, mode);
-		// k bin/cur/addrinfo/*
-		SdbListIter *iter;
-		SdbKv *kv;
-		SdbList *ls = sdb_foreach_list (binfile->sdb_addrinfo, false);
-		ls_foreach (ls, iter, kv) {
-			if (!strncmp (kv->key, "0x", 2)) {
-				ut64 addr;
-				RBinDwarfRow *row;
-				int line;
-				char *file = strdup (kv->value);
-				if (!file) {
-					free (buf);
-					ls_free (ls);
-					r_list_free (list);
-					return NULL;
-				}
-				char *tok = strchr (file, '|');
-				if (tok) {
-					*tok++ = 0;
-					line = atoi (tok);
-					addr = r_num_math (NULL, kv->key);
-					row = r_bin_dwarf_row_new (addr, file, line, 0);
-					r_list_append (list, row);
-				}
-				free (file);
-			}
-		}
-		ls_free (ls);
+
+	if (!binfile || !(buf = get_section_bytes (a, "debug_line", &len))) {
+		return NULL;
+	}
+	list = r_list_newf (r_bin_dwarf_row_free);
+	if (!list) {
 		free (buf);
+		return NULL;
+	}
+	r_bin_dwarf_parse_line_raw2 (a, buf, len, mode);
+	free (buf);
+	/* one row per address, the first one decoded for it */
+	lt = binfile->dwarf_lines;
+	for (i = 0; lt && i < lt->count; i++) {
+		const RBinDwarfLine *l = &lt->rows[i];
+		if (i && l->address == lt->rows[i - 1].address) {
+			continue;
+		}
+		r_list_append (list, r_bin_dwarf_row_new (l->address, l->file, l->line, l->column));
 	}
 	return list;
 }
@@ -5,6 +5,7 @@
 
 // TODO: use proper dwarf api here.. or deprecate
 static int get_line(RBinFile *bf, ut64 addr, char *file, int len, int *line) {
+	const RBinDwarfLine *row;
 	if (bf->sdb_addrinfo) {
 		char offset[64];
 		char *offset_ptr = sdb_itoa (addr, offset, 16);
@@ -15,10 +16,20 @@ static int get_line(RBinFile *bf, ut64 addr, char *file, int len, int *line) {
 				*p = '\0';
 				strncpy (file, ret, len);
 				*line = atoi (p + 1);
+				free (ret);
 				return true;
 			}
+			free (ret);
 		}
 	}
+	/* rows decoded from .debug_line */
+	row = r_bin_dwarf_lines_get (bf->dwarf_lines, addr);
+	if (row && len > 0) {
+		strncpy (file, row->file, len - 1);
+		file[len - 1] = 0;
+		*line = row->line;
+		return true;
+	}
 	return false;
 }
 
@@ -27,6 +27,10 @@ typedef struct {
 	void *stream;
 	EStream type;
 	free_func free;
+	// where the stream is, it is parsed on the first pdb_stream_get
+	R_STREAM_FILE stream_file;
+	bool has_data;
+	bool parsed;
 } SStreamParseFunc;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -321,10 +325,38 @@ static void find_indx_in_list(RList *l, int index, SStreamParseFunc **res) {
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+static void *pdb_stream_get(SStreamParseFunc *stream_parse_func) {
+	if (!stream_parse_func || !stream_parse_func->has_data || !stream_parse_func->stream) {
+		return NULL;
+	}
+	if (!stream_parse_func->parsed) {
+		stream_parse_func->parse_stream (stream_parse_func->stream, &stream_parse_func->stream_file);
+		stream_parse_func->parsed = true;
+		if (stream_parse_func->stream_file.error) {
+			eprintf ("Warning: stream %d was not parsed correctly.\n", stream_parse_func->indx);
+		}
+	}
+	return stream_parse_func->stream;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static STpiStream *pdb_tpi_stream(R_PDB *pdb) {
+	STpiStream *tpi_stream = ePDB_STREAM_TPI < pdb->pdb_streams->len
+		? pdb->pdb_streams->a[ePDB_STREAM_TPI]: NULL;
+	if (tpi_stream && !tpi_stream->parsed) {
+		tpi_stream->parsed = true;
+		if (!parse_tpi_stream (tpi_stream, &tpi_stream->stream_file)) {
+			eprintf ("Warning: the tpi stream was not parsed correctly.\n");
+		}
+	}
+	return tpi_stream;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 static int pdb_read_root(R_PDB *pdb) {
 	int i = 0;
-	RList *pList = pdb->pdb_streams;
+	RVector *pList = pdb->pdb_streams;
 	R_PDB7_ROOT_STREAM *root_stream = pdb->root_stream;
 	R_PDB_STREAM *pdb_stream = 0;
 	SPDBInfoStream *pdb_info_stream = 0;
@@ -337,8 +369,10 @@ static int pdb_read_root(R_PDB *pdb) {
 	it = r_list_iterator (root_stream->streams_list);
 	while (r_list_iter_next (it)) {
 		page = (SPage *) r_list_iter_get (it);
+		// pdb_streams is indexed by the stream number
 		if (page->stream_pages == 0) {
 			//eprintf ("Warning: no stream pages. Skipping.\n");
+			r_vector_push (pList, NULL);
 			i++;
 			continue;
 		}
@@ -356,7 +390,7 @@ static int pdb_read_root(R_PDB *pdb) {
 			}
 			pdb_info_stream->free_ = free_info_stream;
 			parse_pdb_info_stream (pdb_info_stream, &stream_file);
-			r_list_append (pList, pdb_info_stream);
+			r_vector_push (pList, pdb_info_stream);
 			break;
 		case ePDB_STREAM_TPI:
 			tpi_stream = R_NEW0 (STpiStream);
@@ -364,11 +398,9 @@ static int pdb_read_root(R_PDB *pdb) {
 				return 0;
 			}
 			init_tpi_stream (tpi_stream);
-			if (!parse_tpi_stream (tpi_stream, &stream_file)) {
-				free (tpi_stream);
-				return 0;
-			}
-			r_list_append (pList, tpi_stream);
+			// the types are the bulk of the file, parsed when printed
+			tpi_stream->stream_file = stream_file;
+			r_vector_push (pList, tpi_stream);
 			break;
 		case ePDB_STREAM_DBI:
 		{
@@ -378,7 +410,7 @@ static int pdb_read_root(R_PDB *pdb) {
 			}
 			init_dbi_stream (dbi_stream);
 			parse_dbi_stream (dbi_stream, &stream_file);
-			r_list_append (pList, dbi_stream);
+			r_vector_push (pList, dbi_stream);
 			pdb->pdb_streams2 = r_list_new ();
 			fill_list_for_stream_parsing (pdb->pdb_streams2, dbi_stream);
 			break;
@@ -386,7 +418,9 @@ static int pdb_read_root(R_PDB *pdb) {
 		default:
 			find_indx_in_list (pdb->pdb_streams2, i, &stream_parse_func);
 			if (stream_parse_func && stream_parse_func->parse_stream) {
-				stream_parse_func->parse_stream (stream_parse_func->stream, &stream_file);
+				stream_parse_func->stream_file = stream_file;
+				stream_parse_func->has_data = true;
+				r_vector_push (pList, NULL);
 				break;
 			}
 
@@ -397,7 +431,7 @@ static int pdb_read_root(R_PDB *pdb) {
 			init_r_pdb_stream (pdb_stream, pdb->buf, (int *) page->stream_pages,
 				root_stream->pdb_stream.pages_amount, i,
 				page->stream_size, root_stream->pdb_stream.page_size);
-			r_list_append (pList, pdb_stream);
+			r_vector_push (pList, pdb_stream);
 			break;
 		}
 		if (stream_file.error) {
@@ -542,45 +576,38 @@ static void finish_pdb_parse(R_PDB *pdb) {
 	SDbiStream *dbi_stream = 0;
 	SStreamParseFunc *stream_parse_func;
 	R_PDB_STREAM *pdb_stream = 0;
-	int i = 0;
-#if 1
-/* r_list_free should be enough, all the items in a list should be freeable using a generic destructor
-   hacking up things like that may only produce problems. so it is better to not assume that a specific
-   element in a list is of a specific type and just store this info in the type struct or so.
-*/
-// XXX: this loop is fucked up. i prefer to leak than crash
-	it = r_list_iterator (pdb->pdb_streams);
-	while (r_list_iter_next (it)) {
+	void *stream;
+	int i;
+
+	for (i = 0; i < pdb->pdb_streams->len; i++) {
+		stream = pdb->pdb_streams->a[i];
+		if (!stream) {
+			continue;
+		}
 		switch (i) {
-		case 1:
-			pdb_info_stream = (SPDBInfoStream *) r_list_iter_get (it);
+		case ePDB_STREAM_PDB:
+			pdb_info_stream = (SPDBInfoStream *) stream;
 			pdb_info_stream->free_(pdb_info_stream);
 			free (pdb_info_stream);
 			break;
-		case 2:
-			tpi_stream = (STpiStream *) r_list_iter_get (it);
+		case ePDB_STREAM_TPI:
+			tpi_stream = (STpiStream *) stream;
 			tpi_stream->free_(tpi_stream);
 			free (tpi_stream);
 			break;
-		case 3:
-			dbi_stream = (SDbiStream *) r_list_iter_get (it);
+		case ePDB_STREAM_DBI:
+			dbi_stream = (SDbiStream *) stream;
 			dbi_stream->free_(dbi_stream);
 			free (dbi_stream);
 			break;
 		default:
-			find_indx_in_list (pdb->pdb_streams2, i, &stream_parse_func);
-			if (stream_parse_func) {
-				break;
-			}
-			pdb_stream = (R_PDB_STREAM *) r_list_iter_get (it);
+			pdb_stream = (R_PDB_STREAM *) stream;
 			pdb_stream->free_(pdb_stream);
 			free (pdb_stream);
 			break;
 		}
-		i++;
 	}
-#endif
-	r_list_free (pdb->pdb_streams);
+	r_vector_free (pdb->pdb_streams, NULL);
 	// enf of free of pdb->pdb_streams
 
 #if 1
@@ -588,10 +615,10 @@ static void finish_pdb_parse(R_PDB *pdb) {
 	it = r_list_iterator (pdb->pdb_streams2);
 	while (r_list_iter_next (it)) {
 		stream_parse_func = (SStreamParseFunc *) r_list_iter_get (it);
-		if (stream_parse_func->free) {
+		if (stream_parse_func->free && stream_parse_func->parsed) {
 			stream_parse_func->free (stream_parse_func->stream);
-			free (stream_parse_func->stream);
 		}
+		free (stream_parse_func->stream);
 		free (stream_parse_func);
 	}
 #endif
@@ -900,8 +927,8 @@ static void print_types(R_PDB *pdb, int mode) {
 	SType *t = 0;
 	STypeInfo *tf = 0;
 	RListIter *it = 0, *it2 = 0;
-	RList *plist = pdb->pdb_streams, *ptmp = NULL;
-	STpiStream *tpi_stream = r_list_get_n (plist, ePDB_STREAM_TPI);
+	RList *ptmp = NULL;
+	STpiStream *tpi_stream = pdb_tpi_stream (pdb);
 
 	if (!tpi_stream) {
 		eprintf ("There is no tpi stream in current pdb\n");
@@ -1063,19 +1090,22 @@ err:
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-static void print_gvars(R_PDB *pdb, ut64 img_base, int format) {
+/// only the streams needed for the globals are parsed, returns how many
+/// globals were found or -1 when there are none in the pdb
+static int foreach_gvar(R_PDB *pdb, ut64 img_base, RPdbGvarCallback cb, void *user) {
 	SStreamParseFunc *omap = 0, *sctns = 0, *sctns_orig = 0, *gsym = 0, *tmp = 0;
 	SIMAGE_SECTION_HEADER *sctn_header = 0;
 	SGDATAStream *gsym_data_stream = 0;
 	SPEStream *pe_stream = 0;
 	SGlobal *gdata = 0;
+	void *omap_stream = 0;
 	RListIter *it = 0;
-	RList *l = 0;
+	char sctn_name[sizeof (sctn_header->name) + 1];
 	char *name;
-	int is_first = 1;
+	ut64 addr;
+	int count = 0;
 
-	l = pdb->pdb_streams2;
-	it = r_list_iterator (l);
+	it = r_list_iterator (pdb->pdb_streams2);
 	while (r_list_iter_next (it)) {
 		tmp = (SStreamParseFunc *) r_list_iter_get (it);
 		switch (tmp->type) {
@@ -1095,71 +1125,89 @@ static void print_gvars(R_PDB *pdb, ut64 img_base, int format) {
 			break;
 		}
 	}
-	if (!gsym) {
-		eprintf ("There is no global symbols in current PDB.\n");
-		return;
+	gsym_data_stream = pdb_stream_get (gsym);
+	if (!gsym_data_stream) {
+		return -1;
 	}
-	if (format == 'j') {
-		pdb->cb_printf ("{\"%s\":[", "gvars");
+	omap_stream = pdb_stream_get (omap);
+	if (omap_stream) {
+		pe_stream = pdb_stream_get (sctns_orig);
 	}
-	gsym_data_stream = (SGDATAStream *) gsym->stream;
-	if ((omap != 0) && (sctns_orig != 0)) {
-		pe_stream = (SPEStream *) sctns_orig->stream;
-	} else {
-		if (sctns) {
-			pe_stream = (SPEStream *) sctns->stream;
-		}
+	if (!pe_stream) {
+		pe_stream = pdb_stream_get (sctns);
 	}
 	if (!pe_stream) {
-		return;
+		return 0;
 	}
 	it = r_list_iterator (gsym_data_stream->globals_list);
 	while (r_list_iter_next (it)) {
 		gdata = (SGlobal *) r_list_iter_get (it);
 		sctn_header = r_list_get_n (pe_stream->sections_hdrs, (gdata->segment - 1));
-		if (sctn_header) {
-			name = r_bin_demangle_msvc (gdata->name.name);
-			name = (name)? name: strdup (gdata->name.name);
-			if (name && format != 'd') {
-				char *_name = name;
-				name = r_name_filter2 (_name);
-				free (_name);
-			}
-			switch (format) {
-			case 2:
-			case 'j':	// JSON
-				if (!is_first) {
-					pdb->cb_printf (",");
-				}
-				pdb->cb_printf ("{\"%s\":%d,\"%s\":%d,\"%s\":\"%s\",\"%s\":\"%s\"}",
-					"address", (ut64) (img_base + omap_remap ((omap)? (omap->stream): 0, gdata->offset + sctn_header->virtual_address)),
-					"symtype", gdata->symtype,
-					"section_name", sctn_header->name,
-					"gdata_name", name);
-				break;
-			case 1:
-			case '*':
-			case 'r':
-				pdb->cb_printf ("f pdb.%s = 0x%"PFMT64x " # %d %s\n",
-					name,
-					(ut64) (img_base + omap_remap ((omap)? (omap->stream): 0,
-							gdata->offset + sctn_header->virtual_address)),
-					gdata->symtype, sctn_header->name);
-				break;
-			case 'd':
-			default:
-				pdb->cb_printf ("0x%08"PFMT64x "  %d  %s  %s\n",
-					(ut64) (img_base + omap_remap ((omap)? (omap->stream): 0,
-							gdata->offset + sctn_header->virtual_address)),
-					gdata->symtype, sctn_header->name, name);
-				break;
-			}
-			free (name);
-		} else {
-			//eprintf ("Skipping %s, segment %d does not exist\n",
-				//gdata->name.name, (gdata->segment - 1));
+		if (!sctn_header) {
+			continue;
+		}
+		name = r_bin_demangle_msvc (gdata->name.name);
+		name = (name)? name: strdup (gdata->name.name);
+		if (!name) {
+			continue;
+		}
+		r_str_ncpy (sctn_name, sctn_header->name, sizeof (sctn_name));
+		addr = img_base + omap_remap (omap_stream, gdata->offset + sctn_header->virtual_address);
+		cb (user, name, addr, gdata->symtype, sctn_name);
+		free (name);
+		count++;
+	}
+	return count;
+}
+
+typedef struct {
+	R_PDB *pdb;
+	int format;
+	int count;
+} SGvarPrint;
+
+static void print_gvar(void *user, const char *name, ut64 addr, int symtype, const char *section) {
+	SGvarPrint *p = (SGvarPrint *) user;
+	char *filtered = NULL;
+
+	if (p->format != 'd') {
+		name = filtered = r_name_filter2 (name);
+	}
+	switch (p->format) {
+	case 2:
+	case 'j':	// JSON
+		if (p->count) {
+			p->pdb->cb_printf (",");
 		}
-		is_first = 0;
+		p->pdb->cb_printf ("{\"%s\":%"PFMT64d",\"%s\":%d,\"%s\":\"%s\",\"%s\":\"%s\"}",
+			"address", addr, "symtype", symtype,
+			"section_name", section, "gdata_name", name);
+		break;
+	case 1:
+	case '*':
+	case 'r':
+		p->pdb->cb_printf ("f pdb.%s = 0x%"PFMT64x " # %d %s\n",
+			name, addr, symtype, section);
+		break;
+	case 'd':
+	default:
+		p->pdb->cb_printf ("0x%08"PFMT64x "  %d  %s  %s\n",
+			addr, symtype, section, name);
+		break;
+	}
+	free (filtered);
+	p->count++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static void print_gvars(R_PDB *pdb, ut64 img_base, int format) {
+	SGvarPrint p = { pdb, format, 0 };
+
+	if (format == 'j') {
+		pdb->cb_printf ("{\"%s\":[", "gvars");
+	}
+	if (foreach_gvar (pdb, img_base, print_gvar, &p) < 0) {
+		eprintf ("There is no global symbols in current PDB.\n");
 	}
 	if (format == 'j') {
 		pdb->cb_printf ("]}");
@@ -1178,7 +1226,11 @@ R_API bool init_pdb_parser(R_PDB *pdb, const char *filename) {
 	if (!pdb->cb_printf) {
 		pdb->cb_printf = (PrintfCallback) printf;
 	}
-	pdb->buf = r_buf_new_slurp (filename);
+	// the pages are read from the mapped file when a stream needs them
+	pdb->buf = r_buf_mmap (filename, 0);
+	if (!pdb->buf) {
+		pdb->buf = r_buf_new_slurp (filename);
+	}
 // pdb->fp = r_sandbox_fopen (filename, "rb");
 // if (!pdb->fp) {
 // eprintf ("file %s can not be open\n", filename);
@@ -1206,11 +1258,12 @@ R_API bool init_pdb_parser(R_PDB *pdb, const char *filename) {
 
 	R_FREE (signature);
 
-	pdb->pdb_streams = r_list_new ();
+	pdb->pdb_streams = r_vector_new ();
 	pdb->stream_map = 0;
 	pdb->finish_pdb_parse = finish_pdb_parse;
 	pdb->print_types = print_types;
 	pdb->print_gvars = print_gvars;
+	pdb->foreach_gvar = foreach_gvar;
 // printf("init_pdb_parser() finish with success\n");
 	return true;
 error:
@@ -26,30 +26,30 @@ int init_r_stream_file(R_STREAM_FILE *stream_file, RBuffer *buf, int *pages,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-static void stream_file_read_pages(R_STREAM_FILE *stream_file, int start_indx, int end_indx, char *res) {
-	int i;
-	int page_offset;
-//	int tmp;
-//	char buffer[1024];
+/// copies the bytes straight from the pages of the (mapped) file, the bytes
+/// after the last page or after a page that is not there read as zeroes
+static void stream_file_read_at(R_STREAM_FILE *stream_file, int pos, int size, char *res) {
+	int pn, off, len, page_offset;
 
-	if ((end_indx - start_indx) > stream_file->end) {
-		stream_file->error = READ_PAGE_FAIL;
-		return;
+	while (size > 0) {
+		GET_PAGE (pn, off, pos, stream_file->page_size);
+		len = R_MIN (size, stream_file->page_size - off);
+		if (pn >= stream_file->pages_amount) {
+			break;
+		}
+		page_offset = stream_file->pages[pn] * stream_file->page_size;
+		if (page_offset < 1) {
+			break;
+		}
+		if (r_buf_read_at (stream_file->buf, page_offset + off, (ut8 *)res, len) < len) {
+			break;
+		}
+		res += len;
+		pos += len;
+		size -= len;
 	}
-	end_indx = R_MIN (end_indx, stream_file->pages_amount);
-
-	for (i = start_indx; i < end_indx; i++) {
-//		tmp = stream_file->pages[i];
-		page_offset = stream_file->pages[i] * stream_file->page_size;
-		if (page_offset<1)
-			return;
-		stream_file->buf->cur = page_offset;
-		r_buf_read_at (stream_file->buf, page_offset,
-			(ut8*)res, stream_file->page_size);
-//		fseek(stream_file->fp, page_offset, SEEK_SET);
-//		curr_pos = ftell(stream_file->fp);
-//		fread(res, stream_file->page_size, 1, stream_file->fp);
-		res += stream_file->page_size;
+	if (size > 0) {
+		memset (res, 0, size);
 	}
 }
 
@@ -57,31 +57,20 @@ static void stream_file_read_pages(R_STREAM_FILE *stream_file, int start_indx, i
 ///////////////////////////////////////////////////////////////////////////////
 void stream_file_read(R_STREAM_FILE *stream_file, int size, char *res)
 {
-	int pn_start, off_start, pn_end, off_end;
-	char *pdata = 0;
-	char *tmp;
+	int pn_start, off_start;
 
+	if (stream_file->page_size < 1) {
+		stream_file->error = READ_PAGE_FAIL;
+		return;
+	}
 	if (size == -1) {
-		pdata = (char *) malloc(stream_file->pages_amount * stream_file->page_size);
-		GET_PAGE(pn_start, off_start, stream_file->pos, stream_file->page_size);
-		(void)off_end; // hack to remove unused warning
-		tmp = pdata;
-		stream_file_read_pages(stream_file, 0, stream_file->pages_amount, tmp);
+		GET_PAGE (pn_start, off_start, stream_file->pos, stream_file->page_size);
+		(void)pn_start; // hack to remove unused warning
+		stream_file_read_at (stream_file, off_start, stream_file->end - off_start, res);
 		stream_file->pos = stream_file->end;
-		memcpy(res, pdata + off_start, stream_file->end - off_start);
-		free(pdata);
 	} else {
-		GET_PAGE(pn_start, off_start, stream_file->pos, stream_file->page_size);
-		GET_PAGE(pn_end, off_end, stream_file->pos + size, stream_file->page_size);
-		(void)off_end; // hack to remove unused warning
-		pdata = (char *) calloc(stream_file->page_size * (pn_end + 1 - pn_start), 1);
-		if (!pdata)
-			return;
-		tmp = pdata;
-		stream_file_read_pages(stream_file, pn_start, pn_end + 1, tmp);
+		stream_file_read_at (stream_file, stream_file->pos, size, res);
 		stream_file->pos += size;
-		memcpy(res, pdata + off_start, size);
-		free (pdata);
 	}
 }
 
@@ -4,6 +4,13 @@
 
 static unsigned int base_idx = 0;
 static RList *p_types_list;
+/* the same records by type index - base_idx */
+static SType **p_types = NULL;
+static unsigned int p_types_count = 0;
+
+static SType *type_at(unsigned int indx) {
+	return indx < p_types_count? p_types[indx]: NULL;
+}
 
 static void print_base_type(EBASE_TYPES base_type, char **name) {
 	switch (base_type) {
@@ -216,7 +223,7 @@ static int get_array_element_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -232,7 +239,7 @@ static int get_array_index_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -248,7 +255,7 @@ static int get_bitfield_base_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -264,7 +271,7 @@ static int get_class_struct_derived(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -280,7 +287,7 @@ static int get_class_struct_vshape(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -296,7 +303,7 @@ static int get_mfunction_return_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -312,7 +319,7 @@ static int get_mfunction_class_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -328,7 +335,7 @@ static int get_mfunction_this_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -344,7 +351,7 @@ static int get_mfunction_arglist(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -360,7 +367,7 @@ static int get_modifier_modified_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -376,7 +383,7 @@ static int get_pointer_utype(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -392,7 +399,7 @@ static int get_procedure_return_type(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -408,7 +415,7 @@ static int get_procedure_arglist(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -424,7 +431,7 @@ static int get_member_index(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -440,7 +447,7 @@ static int get_nesttype_index(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -456,7 +463,7 @@ static int get_onemethod_index(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -471,7 +478,7 @@ static int get_method_mlist(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -486,7 +493,7 @@ static int get_enum_utype(void *type, void **ret_type) {
 		*ret_type = 0;
 	} else {
 		curr_idx -= base_idx;
-		*ret_type = r_list_get_n(p_types_list, curr_idx);
+		*ret_type = type_at (curr_idx);
 	}
 
 	return curr_idx;
@@ -509,8 +516,8 @@ static void get_union_members(void *type, RList **l) {
 	} else {
 		SType *tmp = 0;
 		indx = lf_union->field_list - base_idx;
-		tmp = (SType *)r_list_get_n(p_types_list, indx);
-		*l = ((SLF_FIELDLIST *) tmp->type_data.type_info)->substructs;
+		tmp = type_at (indx);
+		*l = tmp? ((SLF_FIELDLIST *) tmp->type_data.type_info)->substructs: 0;
 	}
 }
 
@@ -525,7 +532,11 @@ static void get_struct_class_members(void *type, RList **l) {
 	} else {
 		SType *tmp = 0;
 		indx = lf->field_list - base_idx;
-		tmp = (SType *)r_list_get_n(p_types_list, indx);
+		tmp = type_at (indx);
+		if (!tmp) {
+			*l = 0;
+			return;
+		}
 		lf_fieldlist = (SLF_FIELDLIST *) tmp->type_data.type_info;
 		*l = lf_fieldlist->substructs;
 	}
@@ -541,8 +552,8 @@ static void get_enum_members(void *type, RList **l) {
 	} else {
 		SType *tmp = 0;
 		indx = lf->field_list - base_idx;
-		tmp = (SType *)r_list_get_n(p_types_list, indx);
-		*l = ((SLF_FIELDLIST *) tmp->type_data.type_info)->substructs;
+		tmp = type_at (indx);
+		*l = tmp? ((SLF_FIELDLIST *) tmp->type_data.type_info)->substructs: 0;
 	}
 }
 
@@ -948,6 +959,9 @@ static void free_tpi_stream(void *stream) {
 		type = NULL;
 	}
 	r_list_free (tpi_stream->types);
+	tpi_stream->types = NULL;
+	R_FREE (p_types);
+	p_types_count = 0;
 }
 
 static void get_array_print_type(void *type, char **name) {
@@ -2232,6 +2246,17 @@ int parse_tpi_stream(void *parsed_pdb_stream, R_STREAM_FILE *stream) {
 
 	base_idx = tpi_stream->header.ti_min;
 
+	// every record takes 4 bytes at least
+	if (tpi_stream->header.ti_max < tpi_stream->header.ti_min
+			|| tpi_stream->header.ti_max - tpi_stream->header.ti_min > stream->end / 4) {
+		return 0;
+	}
+	free (p_types);
+	p_types_count = 0;
+	p_types = calloc (tpi_stream->header.ti_max - tpi_stream->header.ti_min + 1, sizeof (SType *));
+	if (!p_types) {
+		return 0;
+	}
 	for (i = tpi_stream->header.ti_min; i < tpi_stream->header.ti_max; i++) {
 		type = (SType *) malloc (sizeof (SType));
 		if (!type) return 0;
@@ -2244,6 +2269,7 @@ int parse_tpi_stream(void *parsed_pdb_stream, R_STREAM_FILE *stream) {
 			return 0;
 		}
 		r_list_append(tpi_stream->types, type);
+		p_types[p_types_count++] = type;
 	}
 	return 1;
 }
@@ -1015,6 +1015,9 @@ typedef struct {
 typedef struct {
 	STPIHeader header;
 	RList *types;
+	// the types are parsed from here when they are first needed
+	R_STREAM_FILE stream_file;
+	bool parsed;
 
 	free_func free_;
 } STpiStream;
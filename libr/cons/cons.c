@@ -71,6 +71,64 @@ static inline void r_cons_write(const char *buf, int len) {
 #endif
 }
 
+static void cons_tee(const char *buf, int len) {
+	const char *tee = I.teefile;
+	if (tee && *tee && len > 0) {
+		FILE *d = r_sandbox_fopen (tee, "a+");
+		if (d) {
+			if (len != fwrite (buf, 1, len, d)) {
+				eprintf ("r_cons_flush: fwrite: error (%s)\n", tee);
+			}
+			fclose (d);
+		} else {
+			eprintf ("Cannot write on '%s'\n", tee);
+		}
+	}
+}
+
+/* output can only be streamed when nobody is going to look at the whole
+ * buffer later: no capturing push, pager, html, highlight or complex grep.
+ * interactive sessions keep buffering for the pager and the big-output
+ * confirmation in r_cons_flush */
+static bool cons_can_stream() {
+	if (!I.stream || I.stream_hold || I.null || I.noflush || I.is_html || I.highlight || I.linesleep) {
+		return false;
+	}
+	if (I.is_interactive && I.fdout == 1) {
+		return false;
+	}
+	if (I.cons_stack && !r_stack_is_empty (I.cons_stack)) {
+		return false;
+	}
+	return r_cons_grep_is_streamable ();
+}
+
+/* write all the complete lines but the last one, the tail is kept in the
+ * buffer to let r_cons_lastline, r_cons_chop and r_cons_drop work */
+static void cons_stream() {
+	int cut, len, nl = 0;
+	for (cut = I.buffer_len - 1; cut > 0; cut--) {
+		if (I.buffer[cut - 1] == '\n' && ++nl == 2) {
+			break;
+		}
+	}
+	if (cut < 1) {
+		return;
+	}
+	len = r_cons_grep_lines (I.buffer, cut);
+	cons_tee (I.buffer, len);
+	r_cons_write (I.buffer, len);
+	I.buffer_len -= cut;
+	memmove (I.buffer, I.buffer + cut, I.buffer_len);
+	I.buffer[I.buffer_len] = 0;
+}
+
+static inline void cons_stream_check() {
+	if (I.buffer_len > CONS_STREAM_CHUNK && cons_can_stream ()) {
+		cons_stream ();
+	}
+}
+
 R_API char *r_cons_color_random_string(int bg) {
 	int r, g, b;
 	if (I.truecolor > 0) {
@@ -336,6 +394,7 @@ R_API RCons *r_cons_new() {
 	I.buffer = NULL;
 	I.buffer_sz = 0;
 	I.buffer_len = 0;
+	I.stream = true;
 	r_cons_get_size (&I.pagesize);
 	I.num = NULL;
 	I.null = 0;
@@ -594,7 +653,6 @@ R_API void r_cons_pop() {
 }
 
 R_API void r_cons_flush() {
-	const char *tee = I.teefile;
 	if (I.noflush) {
 		return;
 	}
@@ -635,17 +693,7 @@ R_API void r_cons_flush() {
 			r_cons_set_raw (true);
 		}
 	}
-	if (tee && *tee) {
-		FILE *d = r_sandbox_fopen (tee, "a+");
-		if (d) {
-			if (I.buffer_len != fwrite (I.buffer, 1, I.buffer_len, d)) {
-				eprintf ("r_cons_flush: fwrite: error (%s)\n", tee);
-			}
-			fclose (d);
-		} else {
-			eprintf ("Cannot write on '%s'\n", tee);
-		}
-	}
+	cons_tee (I.buffer, I.buffer_len);
 	r_cons_highlight (I.highlight);
 	// is_html must be a filter, not a write endpoint
 	if (I.is_interactive && !r_sandbox_enable (false)) {
@@ -827,6 +875,7 @@ club:
 		}
 		I.buffer_len += written;
 		I.buffer[I.buffer_len] = 0;
+		cons_stream_check ();
 	} else {
 		r_cons_strcat (format);
 	}
@@ -834,6 +883,15 @@ club:
 	va_end (ap3);
 }
 
+static void cons_pj_flush(void *user, const char *buf, int len) {
+	r_cons_memcat (buf, len);
+}
+
+/* json writer draining into the cons buffer, pj_free flushes the tail */
+R_API PJ *r_cons_pj_new() {
+	return pj_new_stream (cons_pj_flush, NULL, CONS_STREAM_CHUNK);
+}
+
 R_API void r_cons_printf(const char *format, ...) {
 	va_list ap;
 	if (!format || !*format) {
@@ -866,6 +924,7 @@ R_API int r_cons_memcat(const char *str, int len) {
 			memcpy (I.buffer + I.buffer_len, str, len);
 			I.buffer_len += len;
 			I.buffer[I.buffer_len] = 0;
+			cons_stream_check ();
 		}
 	}
 	if (I.flush) {
@@ -885,6 +944,7 @@ R_API void r_cons_memset(char ch, int len) {
 		memset (I.buffer + I.buffer_len, ch, len);
 		I.buffer_len += len;
 		I.buffer[I.buffer_len] = 0;
+		cons_stream_check ();
 	}
 }
 
@@ -640,6 +640,123 @@ R_API int r_cons_grepbuf(char *buf, int len) {
 	return cons->lines;
 }
 
+static inline bool grep_is_active(RConsGrep *grep) {
+	return grep->nstrings > 0 || grep->tokens_used;
+}
+
+/* the grep of the running command is only parsed after it finishes, so the
+ * expression is parsed ahead here to filter the chunks streamed meanwhile.
+ * nested commands keep the outer grep, which is what the buffered path
+ * ends up applying, returns the previous one for r_cons_grep_stream_end.
+ *
+ * at flush time the last grep is applied to everything in the buffer, so
+ * a command is not streamed when the output of a previous command is still
+ * there or when more commands of the same line follow (last is false) */
+R_API RConsGrep *r_cons_grep_stream_begin(const char *str, bool last) {
+	RCons *cons = r_cons_singleton ();
+	RConsGrep *prev = cons->stream_grep;
+	RConsGrep saved;
+	if (cons->stream_level++ > 0) {
+		return prev;
+	}
+	cons->stream_hold = !last || cons->buffer_len > 0;
+	if (!str || cons->stream_hold) {
+		return prev;
+	}
+	cons->stream_grep = R_NEW0 (RConsGrep);
+	if (!cons->stream_grep) {
+		return prev;
+	}
+	memcpy (&saved, &cons->grep, sizeof (RConsGrep));
+	if (strchr (str, '?')) {
+		/* counters and help can't be streamed */
+		cons->stream_grep->counter = 1;
+		cons->stream_grep->nstrings = 1;
+		return prev;
+	}
+	cons->grep.str = NULL;
+	cons->grep.json_path = NULL;
+	parse_grep_expression (str);
+	memcpy (cons->stream_grep, &cons->grep, sizeof (RConsGrep));
+	memcpy (&cons->grep, &saved, sizeof (RConsGrep));
+	return prev;
+}
+
+R_API void r_cons_grep_stream_end(RConsGrep *prev) {
+	RCons *cons = r_cons_singleton ();
+	RConsGrep *grep = cons->stream_grep;
+	if (cons->stream_level > 0 && !--cons->stream_level) {
+		cons->stream_hold = false;
+	}
+	if (grep && grep != prev) {
+		free (grep->str);
+		free (grep->json_path);
+		free (grep);
+	}
+	cons->stream_grep = prev;
+}
+
+/* true if the grep that will be applied to the output can work one line
+ * at a time, without seeing the whole buffer (no sort, count, json or
+ * line ranges) */
+R_API bool r_cons_grep_is_streamable(void) {
+	RCons *cons = r_cons_singleton ();
+	RConsGrep *grep = cons->stream_grep? cons->stream_grep: &cons->grep;
+	if (cons->filter || grep->json || grep->less) {
+		return false;
+	}
+	if (!grep_is_active (grep)) {
+		return true;
+	}
+	return !grep->counter && grep->sort == -1 && grep->range_line == 2;
+}
+
+/* filter the complete lines of buf in place, returns the new length */
+R_API int r_cons_grep_lines(char *buf, int len) {
+	RCons *cons = r_cons_singleton ();
+	char *in, *tline, *end = buf + len;
+	int l, tl, ret, out = 0;
+	RConsGrep saved;
+	if (cons->stream_grep) {
+		if (!grep_is_active (cons->stream_grep)) {
+			return len;
+		}
+		memcpy (&saved, &cons->grep, sizeof (RConsGrep));
+		memcpy (&cons->grep, cons->stream_grep, sizeof (RConsGrep));
+	} else if (!grep_is_active (&cons->grep)) {
+		return len;
+	}
+	tline = malloc (len + 1);
+	if (!tline) {
+		out = len;
+		goto beach;
+	}
+	for (in = buf; in < end; in += l + 1) {
+		char *p = memchr (in, '\n', end - in);
+		if (!p) {
+			break;
+		}
+		l = p - in;
+		if (l < 1) {
+			continue;
+		}
+		memcpy (tline, in, l);
+		tl = r_str_ansi_filter (tline, NULL, NULL, l);
+		ret = (tl < 0)? -1: r_cons_grep_line (tline, tl);
+		if (ret > 0) {
+			memcpy (buf + out, tline, ret);
+			buf[out + ret] = '\n';
+			out += ret + 1;
+		}
+	}
+	free (tline);
+beach:
+	if (cons->stream_grep) {
+		memcpy (&cons->grep, &saved, sizeof (RConsGrep));
+	}
+	return out;
+}
+
 R_API int r_cons_grep_line(char *buf, int len) {
 	RCons *cons = r_cons_singleton ();
 	const char *delims = " |,;=\t";
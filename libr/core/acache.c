@@ -0,0 +1,733 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+#include <r_core.h>
+
+/* persistent analysis cache
+ *
+ * after aa/aaa the analysis is saved in dir.cache, in a slot named after
+ * the sha256 of the file contents and a hash of the anal.* config. the
+ * slot keeps the functions with their basic blocks and references, the
+ * xrefs and metadata databases (strings, comments, data), the types and
+ * the function flags, one record per line, so the same file restores
+ * exactly what aa left. every record with an address is tagged with the
+ * section it belongs to; when a file with the same name and config was
+ * rebuilt, only the records of sections whose contents did not change
+ * are restored and aa only has to analyze what is missing */
+
+#define ACACHE_MAGIC "# r2 anal cache v2"
+#define ACACHE_CHUNK (1024 * 1024)
+/* records without an address, always restored */
+#define ACACHE_ANY -2
+
+typedef struct {
+	char *name;
+	ut64 vaddr;
+	ut64 vsize;
+	char hash[R_HASH_SIZE_SHA256 * 2 + 1];
+} ACacheSection;
+
+typedef struct {
+	RList *lines;
+	RList *sections;
+	char kind;
+} ACacheDump;
+
+static void acache_section_free(void *p) {
+	ACacheSection *s = p;
+	if (s) {
+		free (s->name);
+		free (s);
+	}
+}
+
+static bool buf_hash(RBuffer *b, ut64 from, ut64 len, char *out) {
+	RHash *ctx = r_hash_new (false, R_HASH_SHA256);
+	ut8 *chunk = malloc (ACACHE_CHUNK);
+	ut64 at;
+	if (!ctx || !chunk) {
+		r_hash_free (ctx);
+		free (chunk);
+		return false;
+	}
+	r_hash_do_begin (ctx, R_HASH_SHA256);
+	for (at = 0; at < len; at += ACACHE_CHUNK) {
+		int n = (int)R_MIN (len - at, ACACHE_CHUNK);
+		n = r_buf_read_at (b, from + at, chunk, n);
+		if (n < 1) {
+			break;
+		}
+		r_hash_do_sha256 (ctx, chunk, n);
+	}
+	r_hash_do_end (ctx, R_HASH_SHA256);
+	r_hex_bin2str (ctx->digest, R_HASH_SIZE_SHA256, out);
+	r_hash_free (ctx);
+	free (chunk);
+	return true;
+}
+
+static RList *acache_sections(RCore *core, RBuffer *b) {
+	RList *list = r_list_newf (acache_section_free);
+	RList *sections = r_bin_get_sections (core->bin);
+	ut64 bsz = r_buf_size (b);
+	RBinSection *s;
+	RListIter *iter;
+	if (!list) {
+		return NULL;
+	}
+	r_list_foreach (sections, iter, s) {
+		ACacheSection *as = R_NEW0 (ACacheSection);
+		if (!as) {
+			break;
+		}
+		as->name = strdup (s->name);
+		as->vaddr = r_bin_get_vaddr (core->bin, s->paddr, s->vaddr);
+		as->vsize = s->vsize;
+		if (s->size > 0 && s->paddr < bsz && s->size <= bsz - s->paddr) {
+			buf_hash (b, s->paddr, s->size, as->hash);
+		} else {
+			strcpy (as->hash, "-");
+		}
+		r_list_append (list, as);
+	}
+	return list;
+}
+
+/* index of the first section holding addr, -1 if there is none */
+static int acache_section_at(RList *sections, ut64 addr) {
+	ACacheSection *s;
+	RListIter *iter;
+	int i = 0;
+	r_list_foreach (sections, iter, s) {
+		if (s->vsize && addr >= s->vaddr && addr < s->vaddr + s->vsize) {
+			return i;
+		}
+		i++;
+	}
+	return -1;
+}
+
+/* the address of a meta.* or ref.* key is its first hex number */
+static int acache_key_section(RList *sections, const char *k) {
+	const char *p = strstr (k, ".0x");
+	return p? acache_section_at (sections, r_num_get (NULL, p + 1)): ACACHE_ANY;
+}
+
+static char *acache_config_key(RCore *core) {
+	RListIter *iter;
+	RConfigNode *node;
+	RStrBuf *sb = r_strbuf_new (R2_VERSION);
+	char *key;
+	r_list_foreach (core->config->nodes, iter, node) {
+		if (!strcmp (node->name, "anal.cache")) {
+			continue;
+		}
+		if (!strncmp (node->name, "anal.", 5) || !strcmp (node->name, "asm.arch")
+				|| !strcmp (node->name, "asm.bits") || !strcmp (node->name, "asm.cpu")) {
+			r_strbuf_appendf (sb, "\n%s=%s", node->name, node->value);
+		}
+	}
+	key = r_hash_to_string (NULL, "sha1", (const ut8 *)r_strbuf_get (sb), sb->len);
+	r_strbuf_free (sb);
+	return key;
+}
+
+/* the slot of the last save of a file with this name and config, used to
+ * restore the sections that did not change when the file is rebuilt */
+static char *acache_last_path(RCore *core, const char *dir, const char *cfg) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	const char *name = r_file_basename (bf->file);
+	char *key = r_hash_to_string (NULL, "sha1", (const ut8 *)name, strlen (name));
+	char *path = key? r_str_newf ("%s" R_SYS_DIR "last" R_SYS_DIR "%s.%s", dir, key, cfg): NULL;
+	free (key);
+	return path;
+}
+
+static char *acache_slot_path(RCore *core, const char *hash) {
+	char *dir = r_file_abspath (r_config_get (core->config, "dir.cache"));
+	char *cfg = acache_config_key (core);
+	char *path = cfg? r_str_newf ("%s" R_SYS_DIR "%s.%s", dir, hash, cfg): NULL;
+	free (dir);
+	free (cfg);
+	return path;
+}
+
+R_API char *r_core_anal_cache_path(RCore *core) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	char hash[R_HASH_SIZE_SHA256 * 2 + 1];
+	if (!bf || !bf->buf || !bf->file || !buf_hash (bf->buf, 0, r_buf_size (bf->buf), hash)) {
+		return NULL;
+	}
+	return acache_slot_path (core, hash);
+}
+
+static int acache_dump_kv(void *user, const char *k, const char *v) {
+	ACacheDump *d = user;
+	char *ek, *ev;
+	if (!v || !*v) {
+		return 1;
+	}
+	ek = sdb_encode ((const ut8 *)k, strlen (k));
+	ev = sdb_encode ((const ut8 *)v, strlen (v));
+	if (ek && ev) {
+		int sect = d->sections? acache_key_section (d->sections, k): ACACHE_ANY;
+		r_list_prepend (d->lines, r_str_newf ("%c %d %s %s\n", d->kind, sect, ek, ev));
+	}
+	free (ek);
+	free (ev);
+	return 1;
+}
+
+/* the keys are written in the reverse order sdb_foreach gives them, the
+ * hash table prepends, so setting them back lists them in the same order */
+static void acache_dump_sdb(RStrBuf *sb, RList *sections, Sdb *db, char kind) {
+	ACacheDump d = { r_list_newf (free), sections, kind };
+	RListIter *iter;
+	char *line;
+	if (!d.lines) {
+		return;
+	}
+	sdb_foreach (db, acache_dump_kv, &d);
+	r_list_foreach (d.lines, iter, line) {
+		r_strbuf_append (sb, line);
+	}
+	r_list_free (d.lines);
+}
+
+static void acache_dump_refs(RStrBuf *sb, char kind, RList *refs) {
+	RAnalRef *ref;
+	RListIter *iter;
+	r_list_foreach (refs, iter, ref) {
+		r_strbuf_appendf (sb, "%c 0x%"PFMT64x" 0x%"PFMT64x" %d\n", kind, ref->at, ref->addr, ref->type);
+	}
+}
+
+static void acache_dump_bb(RStrBuf *sb, RAnalBlock *bb) {
+	RAnalCaseOp *cop;
+	RListIter *iter;
+	int i;
+	r_strbuf_appendf (sb, "b 0x%"PFMT64x" %d 0x%"PFMT64x" 0x%"PFMT64x" %d %d 0x%"PFMT64x" %d %d %d %d %d ",
+		bb->addr, bb->size, bb->jump, bb->fail, bb->type, bb->type_ex, bb->type2,
+		bb->ninstr, bb->conditional, bb->returnbb, bb->stackptr, bb->parent_stackptr);
+	for (i = 0; i < bb->op_pos_size; i++) {
+		r_strbuf_appendf (sb, i? ",%d": "%d", bb->op_pos[i]);
+	}
+	r_strbuf_append (sb, bb->op_pos_size > 0? "\n": "-\n");
+	if (bb->switch_op) {
+		RAnalSwitchOp *sop = bb->switch_op;
+		r_strbuf_appendf (sb, "s 0x%"PFMT64x" 0x%"PFMT64x" 0x%"PFMT64x" 0x%"PFMT64x"\n",
+			sop->addr, sop->min_val, sop->def_val, sop->max_val);
+		r_list_foreach (sop->cases, iter, cop) {
+			r_strbuf_appendf (sb, "k 0x%"PFMT64x" 0x%"PFMT64x" 0x%"PFMT64x"\n",
+				cop->addr, cop->value, cop->jump);
+		}
+	}
+}
+
+static void acache_dump_fcn(RCore *core, RStrBuf *sb, RList *sections, RAnalFunction *fcn) {
+	static const char *varcmds[] = { "afvb*", "afvr*", "afvs*", NULL };
+	RAnalBlock *bb;
+	RListIter *iter;
+	int i;
+	r_strbuf_appendf (sb, "f %d 0x%"PFMT64x" %u %d %d %d %d %d %d %d %d %s %s\n",
+		acache_section_at (sections, fcn->addr), fcn->addr, r_anal_fcn_size (fcn),
+		fcn->type, fcn->bits, fcn->diff->type, fcn->stack, fcn->maxstack,
+		fcn->ninstr, fcn->nargs, fcn->folded, fcn->cc? fcn->cc: "-", fcn->name);
+	r_list_foreach (fcn->bbs, iter, bb) {
+		acache_dump_bb (sb, bb);
+	}
+	acache_dump_refs (sb, 'r', fcn->refs);
+	acache_dump_refs (sb, 'x', fcn->xrefs);
+	/* split functions can be missing from the lookup, afv can't see them */
+	if (!r_anal_get_fcn_in (core->anal, fcn->addr, 0)) {
+		return;
+	}
+	for (i = 0; varcmds[i]; i++) {
+		char *line, *next, *out = r_core_cmd_strf (core, "%s @ 0x%"PFMT64x, varcmds[i], fcn->addr);
+		for (line = out; line && *line; line = next) {
+			next = strchr (line, '\n');
+			if (next) {
+				*next++ = 0;
+			}
+			if (*line) {
+				r_strbuf_appendf (sb, "c %s\n", line);
+			}
+		}
+		free (out);
+	}
+}
+
+R_API bool r_core_anal_cache_save(RCore *core, int level) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	char hash[R_HASH_SIZE_SHA256 * 2 + 1];
+	char *path, *file, *last, *dir, *cfg, *lastdir;
+	RList *sections;
+	RAnalFunction *fcn;
+	ACacheSection *s;
+	RFlagItem *fi;
+	RListIter *iter;
+	RStrBuf *sb;
+	bool ret;
+
+	if (!bf || !bf->buf || !bf->file) {
+		return false;
+	}
+	buf_hash (bf->buf, 0, r_buf_size (bf->buf), hash);
+	if (!(path = acache_slot_path (core, hash))) {
+		return false;
+	}
+	if (!r_sys_mkdirp (path)) {
+		eprintf ("Cannot mkdir %s\n", path);
+		free (path);
+		return false;
+	}
+	if (!(sections = acache_sections (core, bf->buf))) {
+		free (path);
+		return false;
+	}
+	sb = r_strbuf_new (ACACHE_MAGIC "\n");
+	acache_dump_sdb (sb, NULL, core->anal->sdb_types, 't');
+	acache_dump_sdb (sb, sections, core->anal->sdb_meta, 'm');
+	acache_dump_sdb (sb, sections, core->anal->sdb_xrefs, 'a');
+	r_list_foreach (core->anal->fcns, iter, fcn) {
+		acache_dump_fcn (core, sb, sections, fcn);
+	}
+	/* aa adds flags and resizes the ones of the symbols it turns into
+	 * functions, restoring all of them keeps the order of the list */
+	r_list_foreach (core->flags->flags, iter, fi) {
+		const char *space = (fi->space >= 0 && fi->space < R_FLAG_SPACES_MAX)
+			? core->flags->spaces[fi->space]: NULL;
+		r_strbuf_appendf (sb, "l %d 0x%"PFMT64x" %"PFMT64d" %s %s\n",
+			acache_section_at (sections, fi->offset), fi->offset, fi->size,
+			space? space: "*", fi->name);
+	}
+	file = r_str_newf ("%s" R_SYS_DIR "rc", path);
+	ret = r_file_dump (file, (const ut8 *)r_strbuf_get (sb), sb->len, false);
+	free (file);
+
+	r_strbuf_set (sb, ACACHE_MAGIC "\n");
+	r_strbuf_appendf (sb, "sha256 %s\nlevel %d\n", hash, level);
+	r_list_foreach (sections, iter, s) {
+		r_strbuf_appendf (sb, "section 0x%"PFMT64x" 0x%"PFMT64x" %s %s\n",
+			s->vaddr, s->vsize, s->hash, s->name);
+	}
+	file = r_str_newf ("%s" R_SYS_DIR "info", path);
+	ret = ret && r_file_dump (file, (const ut8 *)r_strbuf_get (sb), sb->len, false);
+	free (file);
+
+	dir = r_file_abspath (r_config_get (core->config, "dir.cache"));
+	cfg = acache_config_key (core);
+	last = cfg? acache_last_path (core, dir, cfg): NULL;
+	lastdir = last? r_file_dirname (last): NULL;
+	if (ret && lastdir && r_sys_mkdirp (lastdir)) {
+		const char *slot = r_file_basename (path);
+		r_file_dump (last, (const ut8 *)slot, strlen (slot), false);
+	}
+	free (lastdir);
+	free (last);
+	free (cfg);
+	free (dir);
+	r_strbuf_free (sb);
+	r_list_free (sections);
+	free (path);
+	return ret;
+}
+
+static bool acache_section_valid(RList *cur, ACacheSection *s) {
+	ACacheSection *c;
+	RListIter *iter;
+	r_list_foreach (cur, iter, c) {
+		if (c->vaddr == s->vaddr && c->vsize == s->vsize
+				&& !strcmp (c->hash, s->hash) && !strcmp (c->name, s->name)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static int acache_ref_type(const char *k) {
+	static const struct {
+		const char *name;
+		int type;
+	} types[] = {
+		{ "code.jmp", R_ANAL_REF_TYPE_CODE },
+		{ "code.call", R_ANAL_REF_TYPE_CALL },
+		{ "data.mem", R_ANAL_REF_TYPE_DATA },
+		{ "data.string", R_ANAL_REF_TYPE_STRING },
+		{ NULL, 0 }
+	};
+	int i;
+	for (i = 0; types[i].name; i++) {
+		int len = strlen (types[i].name);
+		if (!strncmp (k, types[i].name, len) && k[len] == '.') {
+			return types[i].type;
+		}
+	}
+	return R_ANAL_REF_TYPE_NULL;
+}
+
+/* when only some sections are restored the xrefs are added through the
+ * api from the ref.* keys, so both directions only hold restored refs */
+static void acache_restore_ref(RAnal *anal, const char *k, const char *v) {
+	const char *p = strstr (k, ".0x");
+	ut64 from;
+	char *str, *ptr, *next;
+	int type;
+	if (strncmp (k, "ref.", 4) || !p) {
+		return;
+	}
+	type = acache_ref_type (k + 4);
+	from = r_num_get (NULL, p + 1);
+	str = strdup (v);
+	for (next = ptr = str; next; ptr = next) {
+		r_anal_xrefs_set (anal, type, from, r_num_get (NULL, sdb_anext (ptr, &next)));
+	}
+	free (str);
+}
+
+typedef struct {
+	RCore *core;
+	RList *cmds;
+	bool full;
+	bool *valid;
+	int nvalid;
+	RAnalFunction *fcn;
+	RAnalBlock *bb;
+} ACacheLoad;
+
+static bool acache_run(ACacheLoad *l, int sect) {
+	if (sect == ACACHE_ANY || l->full) {
+		return true;
+	}
+	return sect >= 0 && sect < l->nvalid && l->valid[sect];
+}
+
+static void acache_fcn_done(ACacheLoad *l) {
+	if (l->fcn) {
+		r_anal_fcn_update_tinyrange_bbs (l->fcn);
+	}
+	l->fcn = NULL;
+	l->bb = NULL;
+}
+
+static RAnalFunction *acache_load_fcn(ACacheLoad *l, const char *line) {
+	RAnalFunction *fcn;
+	char cc[64], name[1024];
+	int sect, type, bits, diff, stack, maxstack, ninstr, nargs, folded;
+	ut64 addr;
+	ut32 size;
+	if (sscanf (line, "%d 0x%"PFMT64x" %u %d %d %d %d %d %d %d %d %63s %1023s", &sect, &addr, &size,
+			&type, &bits, &diff, &stack, &maxstack, &ninstr, &nargs, &folded, cc, name) != 13) {
+		return NULL;
+	}
+	if (!acache_run (l, sect) || r_anal_get_fcn_at (l->core->anal, addr, R_ANAL_FCN_TYPE_ROOT)) {
+		return NULL;
+	}
+	if (!(fcn = r_anal_fcn_new ())) {
+		return NULL;
+	}
+	fcn->addr = addr;
+	fcn->type = type;
+	fcn->bits = bits;
+	fcn->diff->type = diff;
+	fcn->stack = stack;
+	fcn->maxstack = maxstack;
+	fcn->ninstr = ninstr;
+	fcn->nargs = nargs;
+	fcn->folded = folded;
+	fcn->cc = strcmp (cc, "-")? r_str_const (cc): NULL;
+	r_anal_fcn_set_size (fcn, size);
+	r_anal_fcn_set_name (fcn, name);
+	if (!r_anal_fcn_insert (l->core->anal, fcn)) {
+		r_anal_fcn_free (fcn);
+		return NULL;
+	}
+	return fcn;
+}
+
+static RAnalBlock *acache_load_bb(RAnalFunction *fcn, const char *line) {
+	RAnalBlock *bb = r_anal_bb_new ();
+	char *pos = NULL;
+	int n = 0;
+	if (!bb) {
+		return NULL;
+	}
+	if (sscanf (line, "0x%"PFMT64x" %d 0x%"PFMT64x" 0x%"PFMT64x" %d %d 0x%"PFMT64x" %d %d %d %d %d %n",
+			&bb->addr, &bb->size, &bb->jump, &bb->fail, &bb->type, &bb->type_ex, &bb->type2,
+			&bb->ninstr, &bb->conditional, &bb->returnbb, &bb->stackptr, &bb->parent_stackptr, &n) < 12 || !n) {
+		r_anal_bb_free (bb);
+		return NULL;
+	}
+	pos = (char *)line + n;
+	if (*pos != '-') {
+		int i, count = r_str_char_count (pos, ',') + 1;
+		bb->op_pos = R_NEWS0 (ut16, count);
+		if (bb->op_pos) {
+			for (i = 0; i < count && pos; i++) {
+				bb->op_pos[i] = (ut16)atoi (pos);
+				pos = strchr (pos, ',');
+				pos = pos? pos + 1: NULL;
+			}
+			bb->op_pos_size = i;
+		}
+	}
+	r_anal_fcn_bbadd (fcn, bb);
+	return bb;
+}
+
+static void acache_load_ref(RList *refs, const char *line) {
+	RAnalRef *ref = r_anal_ref_new ();
+	if (ref && sscanf (line, "0x%"PFMT64x" 0x%"PFMT64x" %d", &ref->at, &ref->addr, &ref->type) == 3) {
+		r_list_append (refs, ref);
+	} else {
+		r_anal_ref_free (ref);
+	}
+}
+
+static void acache_load_kv(ACacheLoad *l, char kind, char *line) {
+	RAnal *anal = l->core->anal;
+	char *ek = strchr (line, ' ');
+	char *ev = ek? strchr (ek + 1, ' '): NULL;
+	char *k, *v;
+	if (!ev || !acache_run (l, atoi (line))) {
+		return;
+	}
+	*ev++ = 0;
+	k = (char *)sdb_decode (ek + 1, NULL);
+	v = (char *)sdb_decode (ev, NULL);
+	if (k && v) {
+		switch (kind) {
+		case 't':
+			sdb_set (anal->sdb_types, k, v, 0);
+			break;
+		case 'm':
+			sdb_set (anal->sdb_meta, k, v, 0);
+			break;
+		case 'a':
+			if (l->full) {
+				sdb_set (anal->sdb_xrefs, k, v, 0);
+			} else {
+				acache_restore_ref (anal, k, v);
+			}
+			break;
+		}
+	}
+	free (k);
+	free (v);
+}
+
+static void acache_load_flag(ACacheLoad *l, const char *line) {
+	RFlag *flags = l->core->flags;
+	RListIter *iter;
+	RFlagItem *fi;
+	char name[1024], space[R_FLAG_NAME_SIZE];
+	ut64 addr, size;
+	int sect;
+	if (sscanf (line, "%d 0x%"PFMT64x" %"PFMT64d" %255s %1023s", &sect, &addr, &size, space, name) != 5
+			|| !acache_run (l, sect)) {
+		return;
+	}
+	r_flag_space_set (flags, space);
+	/* names can be repeated, r_flag_set would move the first one */
+	r_list_foreach (r_flag_get_list (flags, addr), iter, fi) {
+		if (!strcmp (fi->name, name)) {
+			fi->size = size;
+			fi->space = flags->space_idx;
+			return;
+		}
+	}
+	fi = r_flag_set (flags, name, addr, size);
+	if (fi) {
+		fi->space = flags->space_idx;
+	}
+}
+
+static void acache_load_rc(ACacheLoad *l, char *rc) {
+	RAnalSwitchOp *sop = NULL;
+	RListIter *iter;
+	char *line, *next;
+	r_flag_space_push (l->core->flags, "functions");
+	for (line = rc; line && *line; line = next) {
+		next = strchr (line, '\n');
+		if (next) {
+			*next++ = 0;
+		}
+		if (!line[0] || line[1] != ' ') {
+			continue;
+		}
+		switch (*line) {
+		case 't':
+		case 'm':
+		case 'a':
+			acache_load_kv (l, *line, line + 2);
+			break;
+		case 'f':
+			acache_fcn_done (l);
+			l->fcn = acache_load_fcn (l, line + 2);
+			break;
+		case 'b':
+			if (l->fcn) {
+				l->bb = acache_load_bb (l->fcn, line + 2);
+				sop = NULL;
+			}
+			break;
+		case 's':
+			if (l->fcn && l->bb && !l->bb->switch_op) {
+				ut64 addr = 0, min = 0, def = 0, max = 0;
+				sscanf (line + 2, "0x%"PFMT64x" 0x%"PFMT64x" 0x%"PFMT64x" 0x%"PFMT64x,
+					&addr, &min, &def, &max);
+				sop = l->bb->switch_op = r_anal_switch_op_new (addr, min, max);
+				if (sop) {
+					sop->def_val = def;
+				}
+			}
+			break;
+		case 'k':
+			if (l->fcn && sop) {
+				ut64 addr = 0, value = 0, jump = 0;
+				sscanf (line + 2, "0x%"PFMT64x" 0x%"PFMT64x" 0x%"PFMT64x, &addr, &value, &jump);
+				r_anal_switch_op_add_case (sop, addr, value, jump);
+			}
+			break;
+		case 'r':
+			if (l->fcn) {
+				acache_load_ref (l->fcn->refs, line + 2);
+			}
+			break;
+		case 'x':
+			if (l->fcn) {
+				acache_load_ref (l->fcn->xrefs, line + 2);
+			}
+			break;
+		case 'c':
+			/* the variables of a function can be listed with
+			 * another one that shares its blocks */
+			if (l->fcn) {
+				r_list_append (l->cmds, line + 2);
+			}
+			break;
+		case 'l':
+			acache_fcn_done (l);
+			acache_load_flag (l, line + 2);
+			break;
+		}
+	}
+	acache_fcn_done (l);
+	r_flag_space_pop (l->core->flags);
+	r_list_foreach (l->cmds, iter, line) {
+		/* on partial restores the function can be in a dropped section */
+		char *at = strstr (line, " @ ");
+		if (at && !r_anal_get_fcn_in (l->core->anal, r_num_get (NULL, at + 3), 0)) {
+			continue;
+		}
+		r_core_cmd0 (l->core, line);
+	}
+}
+
+static char *acache_slurp(const char *path, const char *name) {
+	char *file = r_str_newf ("%s" R_SYS_DIR "%s", path, name);
+	char *data = r_file_slurp (file, NULL);
+	free (file);
+	if (data && strncmp (data, ACACHE_MAGIC "\n", strlen (ACACHE_MAGIC) + 1)) {
+		R_FREE (data);
+	}
+	return data;
+}
+
+/* returns the aa level (0 aa, 1 aaa, 2 aaaa) when the whole analysis was
+ * restored, or -1 when there was no cache or only some sections matched */
+R_API int r_core_anal_cache_load(RCore *core) {
+	RBinFile *bf = r_bin_cur (core->bin);
+	char hash[R_HASH_SIZE_SHA256 * 2 + 1];
+	char *path, *data = NULL, *rc = NULL, *line;
+	RList *old = NULL, *cur = NULL;
+	ACacheLoad l = { core };
+	ACacheSection *s;
+	RListIter *iter;
+	int i, level = 0, nvalid = 0;
+
+	if (!bf || !bf->buf || !bf->file) {
+		return -1;
+	}
+	buf_hash (bf->buf, 0, r_buf_size (bf->buf), hash);
+	if (!(path = acache_slot_path (core, hash))) {
+		return -1;
+	}
+	if (r_file_is_directory (path)) {
+		data = acache_slurp (path, "info");
+		rc = acache_slurp (path, "rc");
+		l.full = true;
+	} else {
+		/* not seen with these contents, try the last build */
+		char *dir = r_file_abspath (r_config_get (core->config, "dir.cache"));
+		char *cfg = acache_config_key (core);
+		char *last = cfg? acache_last_path (core, dir, cfg): NULL;
+		char *slot = last? r_file_slurp (last, NULL): NULL;
+		if (slot && *slot && !strchr (slot, '/') && !strchr (slot, '\\')) {
+			free (path);
+			path = r_str_newf ("%s" R_SYS_DIR "%s", dir, slot);
+			data = acache_slurp (path, "info");
+			rc = acache_slurp (path, "rc");
+		}
+		free (slot);
+		free (last);
+		free (cfg);
+		free (dir);
+	}
+	free (path);
+	if (!data || !rc) {
+		free (data);
+		free (rc);
+		return -1;
+	}
+	line = strstr (data, "\nlevel ");
+	if (line) {
+		level = atoi (line + 7);
+	}
+	if (!l.full) {
+		old = r_list_newf (acache_section_free);
+		for (line = strstr (data, "\nsection "); line; line = strstr (line + 1, "\nsection ")) {
+			char name[R_BIN_SIZEOF_STRINGS] = {0};
+			s = R_NEW0 (ACacheSection);
+			if (!s) {
+				break;
+			}
+			if (sscanf (line + 9, "0x%"PFMT64x" 0x%"PFMT64x" %64s %511[^\n]",
+					&s->vaddr, &s->vsize, s->hash, name) < 3) {
+				free (s);
+				continue;
+			}
+			s->name = strdup (name);
+			r_list_append (old, s);
+		}
+		cur = acache_sections (core, bf->buf);
+		l.nvalid = r_list_length (old);
+		l.valid = R_NEWS0 (bool, l.nvalid + 1);
+		if (!cur || !l.valid) {
+			r_list_free (old);
+			r_list_free (cur);
+			free (l.valid);
+			free (data);
+			free (rc);
+			return -1;
+		}
+		i = 0;
+		r_list_foreach (old, iter, s) {
+			l.valid[i] = strcmp (s->hash, "-") && acache_section_valid (cur, s);
+			nvalid += l.valid[i++];
+		}
+	}
+	l.cmds = r_list_new ();
+	acache_load_rc (&l, rc);
+	r_list_free (l.cmds);
+	if (l.full) {
+		eprintf ("anal.cache: restored analysis (level %d)\n", level);
+	} else {
+		eprintf ("anal.cache: file changed, restored %d/%d sections\n", nvalid, l.nvalid);
+	}
+	r_list_free (old);
+	r_list_free (cur);
+	free (l.valid);
+	free (data);
+	free (rc);
+	return l.full? level: -1;
+}
@@ -61,20 +61,25 @@ R_API char* r_core_asm_search(RCore *core, const char *input) {
 }
 
 #define OPSZ 8
+#define SWEEP_OPS 64
 // TODO: add support for byte-per-byte opcode search
 R_API RList *r_core_asm_strsearch(RCore *core, const char *input, ut64 from, ut64 to, int maxhits, int regexp, int everyByte, int mode) {
 	RCoreAsmHit *hit;
-	RAsmOp op;
+	RAsmBatch *ab = NULL;
 	RList *hits;
 	ut64 at, toff = core->offset;
 	ut8 *buf;
 	int align = core->search->align;
-	RRegex* rx = NULL;
+	RRegex *rx[1024] = {0};
 	char *tok, *tokens[1024], *code = NULL, *ptr;
-	int idx, tidx = 0, len;
+	int idx, tidx = 0, len = 0, bi = 0, want = SWEEP_OPS;
 	int tokcount, matchcount, count = 0;
 	int matches = 0;
 	const int addrbytes = core->io->addrbytes;
+	/* linear sweeps decode a window of ops at once, it is redone when a
+	 * hit or a partial match makes the search go back, so the window
+	 * shrinks after a jump and grows again while the sweep is linear */
+	bool sweep = mode != 'e' && !everyByte && addrbytes == 1;
 
 	if (!*input) {
 		return NULL;
@@ -102,9 +107,18 @@ R_API RList *r_core_asm_strsearch(RCore *core, const char *input, ut64 from, ut6
 		tokens[tokcount] = r_str_trim_head_tail (tok);
 	}
 	tokens[tokcount] = NULL;
+	if (regexp) {
+		for (idx = 0; idx < tokcount; idx++) {
+			rx[idx] = r_regex_new (tokens[idx], "");
+		}
+	}
+	if (sweep && !(ab = r_asm_batch_new ())) {
+		sweep = false;
+	}
 	r_cons_break_push (NULL, NULL);
 	// int opsz = 0;
 	char *opst = NULL;
+	const char *opstr = NULL;
 	for (at = from, matchcount = 0; at < to; at += core->blocksize) {
 		matches = 0;
 		if (r_cons_is_breaked ()) {
@@ -115,9 +129,12 @@ R_API RList *r_core_asm_strsearch(RCore *core, const char *input, ut64 from, ut6
 		}
 		(void)r_io_read_at (core->io, at, buf, core->blocksize);
 		idx = 0, matchcount = 0;
+		if (sweep) {
+			r_asm_batch_reset (ab);
+			bi = 0;
+		}
 		while (addrbytes * (idx + 1) <= core->blocksize) {
 			ut64 addr = at + idx;
-			r_asm_set_pc (core->assembler, addr);
 			if (mode == 'e') {
 				RAnalOp analop = {0};
 				if (r_anal_op (core->anal, &analop, addr, buf + idx, 15) < 1) {
@@ -125,9 +142,33 @@ R_API RList *r_core_asm_strsearch(RCore *core, const char *input, ut64 from, ut6
 					continue;
 				}
 				//opsz = analop.size;
-				opst = strdup (r_strbuf_get (&analop.esil));
+				opstr = opst = strdup (r_strbuf_get (&analop.esil));
 				r_anal_op_fini (&analop);
+			} else if (sweep) {
+				if (bi >= ab->count || ab->ops[bi].addr != addr) {
+					want = (bi >= ab->count)
+						? R_MIN (want * 2, SWEEP_OPS): 1;
+					r_asm_batch_reset (ab);
+					bi = 0;
+					r_asm_set_pc (core->assembler, addr);
+					r_asm_disassemble_batch (core->assembler, ab, buf + idx,
+						core->blocksize - idx, want);
+					if (!ab->count) {
+						break;
+					}
+				}
+				if (ab->ops[bi].type == R_ASM_BATCH_INVALID) {
+					bi++;
+					idx = (matchcount)? tidx + 1: idx + 1;
+					matchcount = 0;
+					continue;
+				}
+				len = ab->ops[bi].size;
+				opstr = r_asm_batch_text (ab, bi);
+				bi++;
 			} else {
+				RAsmOp op;
+				r_asm_set_pc (core->assembler, addr);
 				if (!(len = r_asm_disassemble (
 					      core->assembler, &op,
 					      buf + addrbytes * idx,
@@ -137,16 +178,14 @@ R_API RList *r_core_asm_strsearch(RCore *core, const char *input, ut64 from, ut6
 					continue;
 				}
 				//opsz = op.size;
-				opst = strdup (op.buf_asm);
+				opstr = opst = strdup (op.buf_asm);
 			}
-			matches = strcmp (opst, "invalid") && strcmp (opst, "unaligned");
+			matches = strcmp (opstr, "invalid") && strcmp (opstr, "unaligned");
 			if (matches && tokens[matchcount]) {
 				if (!regexp) {
-					matches = strstr (opst, tokens[matchcount]) != NULL;
+					matches = strstr (opstr, tokens[matchcount]) != NULL;
 				} else {
-					rx = r_regex_new (tokens[matchcount], "");
-					matches = r_regex_exec (rx, opst, 0, 0, 0) == 0;
-					r_regex_free (rx);
+					matches = rx[matchcount] && r_regex_exec (rx[matchcount], opstr, 0, 0, 0) == 0;
 				}
 			}
 			if (align && align > 1) {
@@ -155,7 +194,7 @@ R_API RList *r_core_asm_strsearch(RCore *core, const char *input, ut64 from, ut6
 				}
 			}
 			if (matches) {
-				code = r_str_appendf (code, "%s; ", opst);
+				code = r_str_appendf (code, "%s; ", opstr);
 				if (matchcount == tokcount - 1) {
 					if (tokcount == 1) {
 						tidx = idx;
@@ -208,6 +247,10 @@ R_API RList *r_core_asm_strsearch(RCore *core, const char *input, ut64 from, ut6
 	r_cons_break_pop ();
 	r_asm_set_pc (core->assembler, toff);
 beach:
+	for (idx = 0; idx < tokcount; idx++) {
+		r_regex_free (rx[idx]);
+	}
+	r_asm_batch_free (ab);
 	free (buf);
 	free (ptr);
 	free (code);
@@ -186,7 +186,13 @@ static void createFunction(RCore *core, fcn_t* fcn, const char *name) {
 		return;
 	}
 
-	f->name = name? strdup (name): r_str_newf ("%s.%" PFMT64x, pfx, fcn->addr);
+	if (name) {
+		r_anal_fcn_set_name (f, name);
+	} else {
+		char *s = r_str_newf ("%s.%" PFMT64x, pfx, fcn->addr);
+		r_anal_fcn_set_name (f, s);
+		free (s);
+	}
 	f->addr = fcn->addr;
 	f->bits = core->anal->bits;
 	f->cc = r_str_const (r_anal_cc_default (core->anal));
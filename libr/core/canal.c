@@ -49,6 +49,13 @@ static char *getFunctionName(RCore *core, ut64 addr) {
 	return NULL;
 }
 
+/* function names are interned, see r_anal_fcn_set_name */
+static void fcn_set_autoname(RAnalFunction *fcn, const char *pfx, ut64 addr) {
+	char *name = r_str_newf ("%s.%08"PFMT64x, pfx, addr);
+	r_anal_fcn_set_name (fcn, name);
+	free (name);
+}
+
 static RCore *mycore = NULL;
 
 // XXX: copypaste from anal/data.c
@@ -274,8 +281,8 @@ R_API void r_core_anal_autoname_all_fcns(RCore *core) {
 		if (name && (!strncmp (fcn->name, "fcn.", 4) || \
 				!strncmp (fcn->name, "sym.func.", 9))) {
 			r_flag_rename (core->flags, r_flag_get (core->flags, fcn->name), name);
-			free (fcn->name);
-			fcn->name = name;
+			r_anal_fcn_set_name (fcn, name);
+			free (name);
 		} else {
 			free (name);
 		}
@@ -485,6 +492,7 @@ static int core_anal_fcn(RCore *core, ut64 at, ut64 from, int reftype, int depth
 	int i, nexti = 0;
 	ut64 *next = NULL;
 	int buflen, fcnlen;
+	char *name;
 	RAnalFunction *fcn = r_anal_fcn_new ();
 	const char *fcnpfx = r_config_get (core->config, "anal.fcnprefix");
 	if (!fcnpfx) {
@@ -504,10 +512,12 @@ static int core_anal_fcn(RCore *core, ut64 at, ut64 from, int reftype, int depth
 	}
 	fcn->addr = at;
 	r_anal_fcn_set_size (fcn, 0);
-	fcn->name = getFunctionName (core, at);
-
-	if (!fcn->name) {
-		fcn->name = r_str_newf ("%s.%08"PFMT64x, fcnpfx, at);
+	name = getFunctionName (core, at);
+	if (name) {
+		r_anal_fcn_set_name (fcn, name);
+		free (name);
+	} else {
+		fcn_set_autoname (fcn, fcnpfx, at);
 	}
 	buflen = core->anal->opt.bb_max_size;
 	buf = calloc (1, buflen);
@@ -557,10 +567,10 @@ static int core_anal_fcn(RCore *core, ut64 at, ut64 from, int reftype, int depth
 		//XXX fcn's API should handle this for us
 		f = r_flag_get_at (core->flags, fcn->addr, true);
 		if (f && f->name && strncmp (f->name, "sect", 4) &&
-		R_FREE (fcn->name);
+		r_anal_fcn_set_name (fcn, NULL);
 		    strncmp (f->name, "sym.func.", 9) &&
 		    strncmp (f->name, "loc", 3)) {
-			fcn->name = strdup (f->name);
+			r_anal_fcn_set_name (fcn, f->name);
 		} else {
 			f = r_flag_get_i2 (core->flags, fcn->addr);
 			if (f && f->name && strncmp (f->name, "sect", 4) &&
@@ -568,22 +578,19 @@ static int core_anal_fcn(RCore *core, ut64 at, ut64 from, int reftype, int depth
 #else
 		if (f && f->name && strncmp (f->name, "sect", 4)) {
 			if (!strncmp (fcn->name, "loc.", 4)) {
-				R_FREE (fcn->name);
-				fcn->name = strdup (f->name);
+				r_anal_fcn_set_name (fcn, f->name);
 			}
 			if (!strncmp (fcn->name, "fcn.", 4)) {
-				R_FREE (fcn->name);
-				fcn->name = strdup (f->name);
+				r_anal_fcn_set_name (fcn, f->name);
 			}
 		} else {
-			R_FREE (fcn->name);
+			r_anal_fcn_set_name (fcn, NULL);
 			f = r_flag_get_i (core->flags, fcn->addr);
 			if (f && *f->name && strncmp (f->name, "sect", 4)) {
 #endif
-				fcn->name = strdup (f->name);
+				r_anal_fcn_set_name (fcn, f->name);
 			} else {
-
-				fcn->name = r_str_newf ("%s.%08"PFMT64x, fcnpfx, fcn->addr);
+				fcn_set_autoname (fcn, fcnpfx, fcn->addr);
 			}
 		}
 		if (fcnlen == R_ANAL_RET_ERROR ||
@@ -594,19 +601,19 @@ static int core_anal_fcn(RCore *core, ut64 at, ut64 from, int reftype, int depth
 			goto error;
 		} else if (fcnlen == R_ANAL_RET_END) { /* Function analysis complete */
 			f = r_flag_get_i2 (core->flags, fcn->addr);
-			R_FREE (fcn->name);
+			r_anal_fcn_set_name (fcn, NULL);
 			if (f && f->name) { /* Check if it's already flagged */
-				fcn->name = strdup (f->name);
+				r_anal_fcn_set_name (fcn, f->name);
 			} else {
 				f = r_flag_get_i (core->flags, fcn->addr);
 				if (f && *f->name && strncmp (f->name, "sect", 4)) {
-					fcn->name = strdup (f->name);
+					r_anal_fcn_set_name (fcn, f->name);
 				} else {
 					const char *fcnpfx = r_anal_fcn_type_tostring (fcn->type);
 					if (!fcnpfx || !*fcnpfx || !strcmp (fcnpfx, "fcn")) {
 						fcnpfx = r_config_get (core->config, "anal.fcnprefix");
 					}
-					fcn->name = r_str_newf ("%s.%08"PFMT64x, fcnpfx, fcn->addr);
+					fcn_set_autoname (fcn, fcnpfx, fcn->addr);
 				}
 				/* Add flag */
 				r_flag_space_push (core->flags, "functions");
@@ -708,10 +715,7 @@ error:
 			// TODO: mark this function as not properly analyzed
 			if (!fcn->name) {
 				// XXX dupped code.
-				fcn->name = r_str_newf (
-					"%s.%08" PFMT64x,
-					r_anal_fcn_type_tostring (fcn->type),
-					at);
+				fcn_set_autoname (fcn, r_anal_fcn_type_tostring (fcn->type), at);
 				/* Add flag */
 				r_flag_space_push (core->flags, "functions");
 				r_flag_set (core->flags, fcn->name, at, r_anal_fcn_size (fcn));
@@ -1584,8 +1588,9 @@ repeat:
 			if (!fr) {
 				fr = &fakefr;
 				if (fr) {
-					free (fr->name);
-					fr->name = r_str_newf ("unk.0x%"PFMT64x, fcnr->addr);
+					char *name = r_str_newf ("unk.0x%"PFMT64x, fcnr->addr);
+					r_anal_fcn_set_name (fr, name);
+					free (name);
 				}
 			}
 			if (!is_html && !showhdr) {
@@ -1711,6 +1716,7 @@ repeat:
 	if (fmt == 2) {
 		r_cons_printf ("]\n");
 	}
+	r_anal_fcn_set_name (&fakefr, NULL);
 }
 
 static void fcn_list_bbs(RAnalFunction *fcn) {
@@ -1920,107 +1926,102 @@ static int fcn_list_default(RCore *core, RList *fcns, bool quiet) {
 	return 0;
 }
 
-static int fcn_print_json(RCore *core, RAnalFunction *fcn) {
+static int fcn_print_json(RCore *core, RAnalFunction *fcn, PJ *pj) {
 	RListIter *iter;
 	RAnalRef *refi;
-	bool first = true;
 	int ebbs = 0;
 	char *name = get_fcn_name (core, fcn);
-	r_cons_printf ("{\"offset\":%"PFMT64d",\"name\":\"%s\",\"size\":%d",
-			fcn->addr, name, r_anal_fcn_size (fcn));
-	r_cons_printf (",\"realsz\":%d", r_anal_fcn_realsize (fcn));
-	r_cons_printf (",\"cc\":%d", r_anal_fcn_cc (fcn));
-	r_cons_printf (",\"cost\":%d", r_anal_fcn_cost (core->anal, fcn));
-	r_cons_printf (",\"nbbs\":%d", r_list_length (fcn->bbs));
-	r_cons_printf (",\"edges\":%d", r_anal_fcn_count_edges (fcn, &ebbs));
-	r_cons_printf (",\"ebbs\":%d", ebbs);
-	r_cons_printf (",\"calltype\":\"%s\"", fcn->cc);
-	r_cons_printf (",\"type\":\"%s\"", r_anal_fcn_type_tostring (fcn->type));
+	pj_o (pj);
+	pj_kn (pj, "offset", fcn->addr);
+	pj_ks (pj, "name", name);
+	pj_ki (pj, "size", r_anal_fcn_size (fcn));
+	pj_ki (pj, "realsz", r_anal_fcn_realsize (fcn));
+	pj_ki (pj, "cc", r_anal_fcn_cc (fcn));
+	pj_ki (pj, "cost", r_anal_fcn_cost (core->anal, fcn));
+	pj_ki (pj, "nbbs", r_list_length (fcn->bbs));
+	pj_ki (pj, "edges", r_anal_fcn_count_edges (fcn, &ebbs));
+	pj_ki (pj, "ebbs", ebbs);
+	pj_ks (pj, "calltype", fcn->cc);
+	pj_ks (pj, "type", r_anal_fcn_type_tostring (fcn->type));
 	if (fcn->type == R_ANAL_FCN_TYPE_FCN || fcn->type == R_ANAL_FCN_TYPE_SYM) {
-		r_cons_printf (",\"diff\":\"%s\"",
+		pj_ks (pj, "diff",
 				fcn->diff->type == R_ANAL_DIFF_TYPE_MATCH?"MATCH":
 				fcn->diff->type == R_ANAL_DIFF_TYPE_UNMATCH?"UNMATCH":"NEW");
 	}
 	int outdegree = 0;
 	if (!r_list_empty (fcn->refs)) {
-		r_cons_printf (",\"callrefs\":[");
+		pj_ka (pj, "callrefs");
 		r_list_foreach (fcn->refs, iter, refi) {
 			if (refi->type == R_ANAL_REF_TYPE_CALL) {
 				outdegree++;
 			}
 			if (refi->type == R_ANAL_REF_TYPE_CODE ||
 			    refi->type == R_ANAL_REF_TYPE_CALL) {
-				r_cons_printf ("%s{\"addr\":%"PFMT64d",\"type\":\"%c\",\"at\":%"PFMT64d"}",
-						first? "": ",",
-						refi->addr,
-						refi->type == R_ANAL_REF_TYPE_CALL?'C':'J',
-						refi->at);
-				first = false;
+				pj_o (pj);
+				pj_kn (pj, "addr", refi->addr);
+				pj_ks (pj, "type", refi->type == R_ANAL_REF_TYPE_CALL? "C": "J");
+				pj_kn (pj, "at", refi->at);
+				pj_end (pj);
 			}
 		}
-		r_cons_printf ("]");
+		pj_end (pj);
 
-		first = true;
-		r_cons_printf (",\"datarefs\":[");
+		pj_ka (pj, "datarefs");
 		r_list_foreach (fcn->refs, iter, refi) {
 			if (refi->type == R_ANAL_REF_TYPE_DATA) {
-				r_cons_printf ("%s%"PFMT64d, first?"":",", refi->addr);
-				first = false;
+				pj_n (pj, refi->addr);
 			}
 		}
-		r_cons_printf ("]");
+		pj_end (pj);
 	}
 
 	int indegree = 0;
 	if (!r_list_empty (fcn->xrefs)) {
-		first = true;
-		r_cons_printf (",\"codexrefs\":[");
+		pj_ka (pj, "codexrefs");
 		r_list_foreach (fcn->xrefs, iter, refi) {
 			if (refi->type == R_ANAL_REF_TYPE_CODE ||
 			    refi->type == R_ANAL_REF_TYPE_CALL) {
 				indegree++;
-				r_cons_printf ("%s{\"addr\":%"PFMT64d",\"type\":\"%c\",\"at\":%"PFMT64d"}",
-						first?"":",",
-						refi->addr,
-						refi->type==R_ANAL_REF_TYPE_CALL?'C':'J',
-						refi->at);
-				first = 0;
+				pj_o (pj);
+				pj_kn (pj, "addr", refi->addr);
+				pj_ks (pj, "type", refi->type == R_ANAL_REF_TYPE_CALL? "C": "J");
+				pj_kn (pj, "at", refi->at);
+				pj_end (pj);
 			}
 		}
+		pj_end (pj);
 
-		first = 1;
-		r_cons_printf ("],\"dataxrefs\":[");
+		pj_ka (pj, "dataxrefs");
 		r_list_foreach (fcn->xrefs, iter, refi) {
 			if (refi->type == R_ANAL_REF_TYPE_DATA) {
-				r_cons_printf ("%s%"PFMT64d, first?"":",", refi->addr);
-				first = 0;
+				pj_n (pj, refi->addr);
 			}
 		}
-		r_cons_printf ("]");
+		pj_end (pj);
 	}
 
 	if (fcn->type == R_ANAL_FCN_TYPE_FCN || fcn->type == R_ANAL_FCN_TYPE_SYM) {
-		r_cons_printf (",\"difftype\":\"%s\"",
+		pj_ks (pj, "difftype",
 				fcn->diff->type == R_ANAL_DIFF_TYPE_MATCH?"match":
 				fcn->diff->type == R_ANAL_DIFF_TYPE_UNMATCH?"unmatch":"new");
 		if (fcn->diff->addr != -1) {
-			r_cons_printf (",\"diffaddr\":%"PFMT64d, fcn->diff->addr);
+			pj_kN (pj, "diffaddr", fcn->diff->addr);
 		}
 		if (fcn->diff->name) {
-			r_cons_printf (",\"diffname\":\"%s\"", fcn->diff->name);
+			pj_ks (pj, "diffname", fcn->diff->name);
 		}
 	}
-	r_cons_printf (",\"indegree\":%d", indegree);
-	r_cons_printf (",\"outdegree\":%d", outdegree);
-	r_cons_printf (",\"nargs\":%d",
+	pj_ki (pj, "indegree", indegree);
+	pj_ki (pj, "outdegree", outdegree);
+	pj_ki (pj, "nargs",
 		r_anal_var_count (core->anal, fcn, 'b', 1) +
 		r_anal_var_count (core->anal, fcn, 'r', 1) +
 		r_anal_var_count (core->anal, fcn, 's', 1));
-	r_cons_printf (",\"nlocals\":%d",
+	pj_ki (pj, "nlocals",
 		r_anal_var_count (core->anal, fcn, 'b', 0) +
 		r_anal_var_count (core->anal, fcn, 'r', 0) +
 		r_anal_var_count (core->anal, fcn, 's', 0));
-	r_cons_printf ("}");
+	pj_end (pj);
 	free (name);
 	return 0;
 }
@@ -2028,21 +2029,21 @@ static int fcn_print_json(RCore *core, RAnalFunction *fcn) {
 static int fcn_list_json(RCore *core, RList *fcns, bool quiet) {
 	RListIter *iter;
 	RAnalFunction *fcn;
-	bool first = true;
-	r_cons_printf ("[");
+	PJ *pj = r_cons_pj_new ();
+	if (!pj) {
+		return -1;
+	}
+	pj_a (pj);
 	r_list_foreach (fcns, iter, fcn) {
-		if (first) {
-			first = false;
-		} else {
-			r_cons_printf (",");
-		}
 		if (quiet) {
-			r_cons_printf ("\"0x%08"PFMT64x"\"", fcn->addr);
+			pj_s (pj, sdb_fmt (0, "0x%08"PFMT64x, fcn->addr));
 		} else {
-			fcn_print_json (core, fcn);
+			fcn_print_json (core, fcn, pj);
 		}
 	}
-	r_cons_printf ("]\n");
+	pj_end (pj);
+	pj_raw (pj, "\n");
+	pj_free (pj);
 	return 0;
 }
 
@@ -2058,7 +2059,9 @@ static int fcn_print_detail(RCore *core, RAnalFunction *fcn) {
 			fcn->diff->type == R_ANAL_DIFF_TYPE_MATCH?'m':
 			fcn->diff->type == R_ANAL_DIFF_TYPE_UNMATCH?'u':'n');
 	// FIXME: this command prints something annoying. Does it have important side-effects?
-	r_cons_printf ("afc %s @ 0x%08"PFMT64x"\n", fcn->cc?fcn->cc: defaultCC, fcn->addr);
+	if (fcn->cc || defaultCC) {
+		r_cons_printf ("afc %s @ 0x%08"PFMT64x"\n", fcn->cc? fcn->cc: defaultCC, fcn->addr);
+	}
 	if (fcn->folded) {
 		r_cons_printf ("afF @ 0x%08"PFMT64x"\n", fcn->addr);
 	}
@@ -2174,6 +2177,10 @@ static int fcn_print_legacy(RCore *core, RAnalFunction *fcn) {
 	return 0;
 }
 
+R_API void r_core_anal_fcn_print_rad(RCore *core, RAnalFunction *fcn) {
+	fcn_print_detail (core, fcn);
+}
+
 static int fcn_list_detail(RCore *core, RList *fcns) {
 	RListIter *iter;
 	RAnalFunction *fcn;
@@ -2665,14 +2672,132 @@ R_API int r_core_anal_search(RCore *core, ut64 from, ut64 to, ut64 ref, int mode
 	return count;
 }
 
+/* aar and aae don't decode runs of fill bytes (padding, zeroed or
+ * uninitialized memory), and with anal.fcnskip aar also leaves alone the
+ * basic blocks that function analysis already walked. each block is split
+ * in the ranges worth decoding before the linear sweep */
+#define FILL_MIN 16
+
+typedef struct {
+	int from;
+	int to;
+} AarRange;
+
+typedef struct {
+	bool fill[256];
+	RAddrInterval *cov;	// sorted and merged basic blocks
+	int ncov;
+	int cur;
+	ut64 fill_bytes;
+	ut64 fcn_bytes;
+} AarSkip;
+
+static void fill_init(RCore *core, bool *fill) {
+	const char *arch = core->anal->cur? core->anal->cur->arch: NULL;
+	memset (fill, 0, 256);
+	if (!r_config_get_i (core->config, "anal.fillskip")) {
+		return;
+	}
+	fill[0x00] = fill[0xff] = true;
+	if (arch && !strncmp (arch, "x86", 3)) {
+		fill[0xcc] = fill[0x90] = true; // int3 and nop
+	}
+}
+
+static int fill_span(const bool *fill, const ut8 *buf, int len) {
+	int n;
+	if (!fill[*buf]) {
+		return 0;
+	}
+	n = r_mem_span (buf, len, *buf);
+	return n < FILL_MIN? 0: n;
+}
+
+static int itvcmp(const void *a, const void *b) {
+	const RAddrInterval *x = a, *y = b;
+	return x->addr < y->addr? -1: x->addr > y->addr;
+}
+
+static void aar_skip_init(RCore *core, AarSkip *s) {
+	RAnalFunction *fcn;
+	RAnalBlock *bb;
+	RListIter *iter, *iter2;
+	int n = 0, i, j;
+	memset (s, 0, sizeof (AarSkip));
+	fill_init (core, s->fill);
+	if (!r_config_get_i (core->config, "anal.fcnskip")) {
+		return;
+	}
+	r_list_foreach (core->anal->fcns, iter, fcn) {
+		n += r_list_length (fcn->bbs);
+	}
+	if (!n || !(s->cov = calloc (n, sizeof (RAddrInterval)))) {
+		return;
+	}
+	r_list_foreach (core->anal->fcns, iter, fcn) {
+		r_list_foreach (fcn->bbs, iter2, bb) {
+			if (bb->size > 0) {
+				s->cov[s->ncov].addr = bb->addr;
+				s->cov[s->ncov].size = bb->size;
+				s->ncov++;
+			}
+		}
+	}
+	qsort (s->cov, s->ncov, sizeof (RAddrInterval), itvcmp);
+	for (i = j = 0; i < s->ncov; i++) {
+		if (j && s->cov[i].addr <= r_itv_end (s->cov[j - 1])) {
+			ut64 end = R_MAX (r_itv_end (s->cov[j - 1]), r_itv_end (s->cov[i]));
+			s->cov[j - 1].size = end - s->cov[j - 1].addr;
+		} else {
+			s->cov[j++] = s->cov[i];
+		}
+	}
+	s->ncov = j;
+}
+
+/* fills r with the ranges of buf to decode, returns how many */
+static int aar_ranges(AarSkip *s, const ut8 *buf, int len, ut64 at, AarRange *r) {
+	int i = 0, n = 0, from = 0;
+	while (i < len) {
+		int skip = 0;
+		ut64 addr = at + i;
+		while (s->cur < s->ncov && r_itv_end (s->cov[s->cur]) <= addr) {
+			s->cur++;
+		}
+		if (s->cur < s->ncov && s->cov[s->cur].addr <= addr) {
+			skip = (int)R_MIN (r_itv_end (s->cov[s->cur]) - addr, len - i);
+			s->fcn_bytes += skip;
+		} else if ((skip = fill_span (s->fill, buf + i, len - i))) {
+			s->fill_bytes += skip;
+		} else {
+			i++;
+			continue;
+		}
+		if (i > from) {
+			r[n].from = from;
+			r[n].to = i;
+			n++;
+		}
+		i += skip;
+		from = i;
+	}
+	if (from < len) {
+		r[n].from = from;
+		r[n].to = len;
+		n++;
+	}
+	return n;
+}
+
 R_API int r_core_anal_search_xrefs(RCore *core, ut64 from, ut64 to, int rad) {
 	int cfg_debug = r_config_get_i (core->config, "cfg.debug");
 	bool cfg_anal_strings = r_config_get_i (core->config, "anal.strings");
 	ut8 *buf;
 	ut64 at;
-	ut8 *block;
 	int count = 0;
 	RAnalOp op = { 0 };
+	AarRange *ranges;
+	AarSkip skip;
 	if (from == to) {
 		return -1;
 	}
@@ -2687,17 +2812,14 @@ R_API int r_core_anal_search_xrefs(RCore *core, ut64 from, ut64 to, int rad) {
 		return -1;
 	}
 	buf = (ut8 *)malloc (core->blocksize);
-	block = malloc (core->blocksize);
-	if (!buf) {
+	ranges = calloc (core->blocksize / 2 + 2, sizeof (AarRange));
+	if (!buf || !ranges) {
 		eprintf ("Error: cannot allocate a block\n");
-		free (block);
-		return -1;
-	}
-	if (!block) {
-		eprintf ("Error: cannot allocate a temp block\n");
 		free (buf);
+		free (ranges);
 		return -1;
-	}	
+	}
+	aar_skip_init (core, &skip);
 	if (rad == 'j') {
 		r_cons_printf ("{");
 	}
@@ -2705,33 +2827,50 @@ R_API int r_core_anal_search_xrefs(RCore *core, ut64 from, ut64 to, int rad) {
 	r_cons_break_push (NULL, NULL);
 	at = from;
 	while (at < to && !r_cons_is_breaked ()) {
-		int i = 0, ret = core->blocksize;
+		int i = 0, r = 0, nranges, ret;
 		if (!r_io_is_valid_offset (core->io, at, R_IO_EXEC)) {
 			break;
 		}
 		(void)r_io_read_at (core->io, at, buf, core->blocksize);
-		memset (block, -1, core->blocksize);
-		if (!memcmp (buf, block, core->blocksize)) {
-			//eprintf ("Error: skipping uninitialized block \n");
+		if ((*buf == 0x00 || *buf == 0xff) && r_mem_span (buf, core->blocksize, *buf) == core->blocksize) {
+			/* uninitialized block */
+			skip.fill_bytes += core->blocksize;
 			at += core->blocksize;
 			continue;
 		}
-		memset (block, 0, core->blocksize);
-		if (!memcmp (buf, block, core->blocksize)) {
-			//eprintf ("Error: skipping uninitialized block \n");
+		nranges = aar_ranges (&skip, buf, core->blocksize, at, ranges);
+		if (!nranges) {
 			at += core->blocksize;
 			continue;
-		}		
-		while (at + i < to && i < ret - OPSZ && !r_cons_is_breaked ()) {
+		}
+		i = ranges[0].from;
+		while (at + i < to && i < core->blocksize - OPSZ && !r_cons_is_breaked ()) {
 			RAnalRefType type;
 			ut64 xref_from, xref_to;
-			xref_from = at + i;	
+			if (i >= ranges[r].to) {
+				while (r < nranges && i >= ranges[r].to) {
+					r++;
+				}
+				if (r == nranges) {
+					/* the tail of the block is not code */
+					i = core->blocksize;
+					break;
+				}
+				if (i < ranges[r].from) {
+					i = ranges[r].from;
+					continue;
+				}
+			}
+			xref_from = at + i;
 			r_anal_op_fini (&op);
 			ret = r_anal_op (core->anal, &op, at + i, buf + i, core->blocksize - i);
 			i += ret > 0 ? ret : 1;
-			if (ret <= 0 || at + i > to) {
+			if (at + i > to) {
 				break;
 			}
+			if (ret <= 0) {
+				continue;
+			}
 			// Get reference type and target address
 			type = R_ANAL_REF_TYPE_NULL;
 			switch (op.type) {
@@ -2845,8 +2984,13 @@ R_API int r_core_anal_search_xrefs(RCore *core, ut64 from, ut64 to, int rad) {
 		at += i;
 	}
 	r_cons_break_pop ();
+	if ((skip.fill_bytes || skip.fcn_bytes) && r_config_get_i (core->config, "scr.interactive")) {
+		eprintf ("Skipped %"PFMT64d" bytes of fill and %"PFMT64d" bytes of analyzed code out of %"PFMT64d"\n",
+			skip.fill_bytes, skip.fcn_bytes, to - from);
+	}
 	free (buf);
-	free (block);
+	free (ranges);
+	free (skip.cov);
 	r_anal_op_fini (&op);
 	if (rad == 'j') {
 		r_cons_printf ("}\n");
@@ -3025,14 +3169,148 @@ R_API int r_core_anal_data (RCore *core, ut64 addr, int count, int depth, int wo
 }
 
 /* core analysis stats */
+static int addrcmp(const void *a, const void *b) {
+	ut64 x = *(const ut64 *)a, y = *(const ut64 *)b;
+	return (x > y) - (x < y);
+}
+
+static void stats_index_sort(RCoreStatsIndex *si, ut64 stamp) {
+	qsort (si->addrs, si->count, sizeof (ut64), addrcmp);
+	si->stamp = stamp;
+	si->dirty = false;
+}
+
+static bool stats_index_reserve(RCoreStatsIndex *si, int count) {
+	ut64 *addrs = realloc (si->addrs, (count + 1) * sizeof (ut64));
+	if (!addrs) {
+		return false;
+	}
+	si->addrs = addrs;
+	si->count = 0;
+	return true;
+}
+
+/* rebuilds the indexes whose source changed since they were built. flags,
+ * functions and symbols are checked through a cheap stamp of their
+ * containers, the meta indexes are marked dirty by a hook on sdb_meta */
+static void stats_index_update(RCore *core) {
+	RCoreStatsIndex *si;
+	RListIter *iter;
+	ut64 stamp;
+
+	si = &core->stats[R_CORE_STATS_FLAGS];
+	stamp = core->flags->changes;
+	if (si->dirty || !si->addrs || si->stamp != stamp) {
+		RFlagItem *f;
+		if (stats_index_reserve (si, r_list_length (core->flags->flags))) {
+			r_list_foreach (core->flags->flags, iter, f) {
+				si->addrs[si->count++] = f->offset;
+			}
+			stats_index_sort (si, stamp);
+		}
+	}
+	si = &core->stats[R_CORE_STATS_FUNCTIONS];
+	stamp = (ut64)(size_t)core->anal->fcns ^ r_list_length (core->anal->fcns) ^ (core->fcn_changes << 32);
+	if (si->dirty || !si->addrs || si->stamp != stamp) {
+		RAnalFunction *F;
+		if (stats_index_reserve (si, r_list_length (core->anal->fcns))) {
+			r_list_foreach (core->anal->fcns, iter, F) {
+				si->addrs[si->count++] = F->addr;
+			}
+			stats_index_sort (si, stamp);
+		}
+	}
+	si = &core->stats[R_CORE_STATS_SYMBOLS];
+	RList *symbols = r_bin_get_symbols (core->bin);
+	stamp = (ut64)(size_t)symbols ^ r_list_length (symbols);
+	if (si->dirty || !si->addrs || si->stamp != stamp) {
+		RBinSymbol *S;
+		if (stats_index_reserve (si, r_list_length (symbols))) {
+			r_list_foreach (symbols, iter, S) {
+				si->addrs[si->count++] = S->vaddr;
+			}
+			stats_index_sort (si, stamp);
+		}
+	}
+	RCoreStatsIndex *ss = &core->stats[R_CORE_STATS_STRINGS];
+	RCoreStatsIndex *sc = &core->stats[R_CORE_STATS_COMMENTS];
+	/* r_anal_purge resets sdb_meta without calling the hooks, but it
+	 * also replaces the function list */
+	stamp = (ut64)(size_t)core->anal->fcns;
+	if (ss->dirty || sc->dirty || !ss->addrs || !sc->addrs || ss->stamp != stamp) {
+		RList *metas = r_meta_enumerate (core->anal, -1);
+		int n = r_list_length (metas);
+		if (stats_index_reserve (ss, n) && stats_index_reserve (sc, n)) {
+			RAnalMetaItem *M;
+			r_list_foreach (metas, iter, M) {
+				switch (M->type) {
+				case R_META_TYPE_STRING:
+					ss->addrs[ss->count++] = M->from;
+					break;
+				case R_META_TYPE_COMMENT:
+					sc->addrs[sc->count++] = M->from;
+					break;
+				}
+			}
+			stats_index_sort (ss, stamp);
+			stats_index_sort (sc, stamp);
+		}
+		r_list_free (metas);
+	}
+}
+
+/* number of addresses lower than addr */
+static int stats_index_rank(RCoreStatsIndex *si, ut64 addr) {
+	int lo = 0, hi = si->count;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (si->addrs[mid] < addr) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+static void stats_index_count(RCoreStatsIndex *si, RCoreAnalStats *as, int kind, ut64 from, ut64 to, ut64 step, int blocks) {
+	int i, lo = stats_index_rank (si, from);
+	for (i = 0; i <= blocks; i++) {
+		ut64 end = from + (ut64)(i + 1) * step;
+		int hi;
+		if (end > to || end < from) {
+			/* the last block includes the end address */
+			hi = (to == UT64_MAX)? si->count: stats_index_rank (si, to + 1);
+		} else {
+			hi = stats_index_rank (si, end);
+		}
+		if (hi < lo) {
+			hi = lo;
+		}
+		switch (kind) {
+		case R_CORE_STATS_FLAGS: as->block[i].flags = hi - lo; break;
+		case R_CORE_STATS_FUNCTIONS: as->block[i].functions = hi - lo; break;
+		case R_CORE_STATS_SYMBOLS: as->block[i].symbols = hi - lo; break;
+		case R_CORE_STATS_STRINGS: as->block[i].strings = hi - lo; break;
+		case R_CORE_STATS_COMMENTS: as->block[i].comments = hi - lo; break;
+		}
+		lo = hi;
+	}
+}
+
+R_API void r_core_anal_stats_fini(RCore *core) {
+	int i;
+	for (i = 0; i < R_CORE_STATS_LAST; i++) {
+		R_FREE (core->stats[i].addrs);
+		core->stats[i].count = 0;
+		core->stats[i].dirty = true;
+	}
+}
+
 /* stats --- colorful bar */
 R_API RCoreAnalStats* r_core_anal_get_stats(RCore *core, ut64 from, ut64 to, ut64 step) {
-	RFlagItem *f;
-	RAnalFunction *F;
-	RBinSymbol *S;
-	RListIter *iter;
 	RCoreAnalStats *as = NULL;
-	int piece, as_size, blocks;
+	int i, piece, as_size, blocks;
 	ut64 at;
 
 	if (from == to || from == UT64_MAX || to == UT64_MAX) {
@@ -3060,54 +3338,20 @@ R_API RCoreAnalStats* r_core_anal_get_stats(RCore *core, ut64 from, ut64 to, ut6
 		as->block[piece].rwx = sec ? sec->flags :
 				(core->io->desc ? core->io->desc->flags: 0);
 	}
-	// iter all flags
-	r_list_foreach (core->flags->flags, iter, f) {
-		//if (f->offset+f->size < from) continue;
-		if (f->offset < from || f->offset > to) {
-			continue;
-		}
-		piece = (f->offset - from) / step;
-		as->block[piece].flags++;
+	/* each bucket is a difference of two ranks in the sorted indexes, so
+	 * the cost depends on the number of blocks and not on the items */
+	stats_index_update (core);
+	for (i = 0; i < R_CORE_STATS_LAST; i++) {
+		stats_index_count (&core->stats[i], as, i, from, to, step, blocks);
 	}
-	// iter all functions
-	r_list_foreach (core->anal->fcns, iter, F) {
-		if (F->addr < from || F->addr > to) {
-			continue;
-		}
-		piece = (F->addr - from) / step;
-		as->block[piece].functions++;
-	}
-	// iter all symbols
-	r_list_foreach (r_bin_get_symbols (core->bin), iter, S) {
-		if (S->vaddr < from || S->vaddr > to) {
-			continue;
-		}
-		piece = (S->vaddr - from) / step;
-		as->block[piece].symbols++;
-	}
-	RList *metas = r_meta_enumerate (core->anal, -1);
-	RAnalMetaItem *M;
-	r_list_foreach (metas, iter, M) {
-		if (M->from < from || M->to > to) {
-			continue;
-		}
-		piece = (M->from - from) / step;
-		switch (M->type) {
-		case R_META_TYPE_STRING:
-			as->block[piece].strings++;
-			break;
-		case R_META_TYPE_COMMENT:
-			as->block[piece].comments++;
-			break;
-		}
-	}
-	// iter all comments
-	// iter all strings
 	return as;
 }
 
 R_API void r_core_anal_stats_free (RCoreAnalStats *s) {
-	free (s);
+	if (s) {
+		free (s->block);
+		free (s);
+	}
 }
 
 R_API RList* r_core_anal_cycles(RCore *core, int ccl) {
@@ -3704,6 +3948,8 @@ R_API void r_core_anal_esil(RCore *core, const char *str, const char *target) {
 
 	int opalign = r_anal_archinfo (core->anal, R_ANAL_ARCHINFO_ALIGN);
 	int in = r_syscall_get_swi (core->anal->syscall);
+	bool fill[256];
+	fill_init (core, fill);
 	const char *sn = r_reg_get_name (core->anal->reg, R_REG_NAME_SN);
 	r_reg_arena_push (core->anal->reg);
 	for (i = 0; i < iend; i++) {
@@ -3715,6 +3961,13 @@ R_API void r_core_anal_esil(RCore *core, const char *str, const char *target) {
 		if (opalign > 0) {
 			cur -= (cur % opalign);
 		}
+		if (cur == addr + i) {
+			int n = fill_span (fill, buf + i, iend - i);
+			if (n > 0) {
+				i += n - 1;
+				continue;
+			}
+		}
 		r_anal_op_fini (&op);
 		if (!r_anal_op (core->anal, &op, cur, buf + i, iend - i)) {
 			i += minopsize - 1;
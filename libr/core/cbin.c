@@ -20,49 +20,43 @@
 // dup from cmd_info
 #define PAIR_WIDTH 9
 
-static void pair(const char *a, const char *b, int mode, bool last) {
+static void pair(const char *a, const char *b) {
+	char ws[16];
+	int al = strlen (a);
 	if (!b || !*b) {
 		return;
 	}
-	if (IS_MODE_JSON (mode)) {
-		const char *lst = last ? "" : ",";
-		r_cons_printf ("\"%s\":%s%s", a, b, lst);
+	if (al > PAIR_WIDTH) {
+		al = 0;
 	} else {
-		char ws[16];
-		int al = strlen (a);
-		if (al > PAIR_WIDTH) {
-			al = 0;
-		} else {
-			al = PAIR_WIDTH - al;
-		}
-		memset (ws, ' ', al);
-		ws[al] = 0;
-		r_cons_printf ("%s%s%s\n", a, ws, b);
+		al = PAIR_WIDTH - al;
 	}
+	memset (ws, ' ', al);
+	ws[al] = 0;
+	r_cons_printf ("%s%s%s\n", a, ws, b);
 }
 
-static void pair_bool(const char *a, bool t, int mode, bool last) {
-	pair (a, r_str_bool (t), mode, last);
+static void pair_bool(PJ *pj, const char *a, bool t) {
+	if (pj) {
+		pj_kb (pj, a, t);
+	} else {
+		pair (a, r_str_bool (t));
+	}
 }
 
-static void pair_int(const char *a, int n, int mode, bool last) {
-	pair (a, sdb_fmt (0, "%d", n), mode, last);
+static void pair_int(PJ *pj, const char *a, int n) {
+	if (pj) {
+		pj_ki (pj, a, n);
+	} else {
+		pair (a, sdb_fmt (0, "%d", n));
+	}
 }
 
-static void pair_str(const char *a, const char *b, int mode, int last) {
-	if (IS_MODE_JSON (mode)) {
-		if (!b) {
-			b = "";
-		}
-		char *eb = r_str_utf16_encode (b, -1);
-		if (eb) {
-			char *qs = r_str_newf ("\"%s\"", eb);
-			pair (a, qs, mode, last);
-			free (eb);
-			free (qs);
-		}
+static void pair_str(PJ *pj, const char *a, const char *b) {
+	if (pj) {
+		pj_ks (pj, a, b);
 	} else {
-		pair (a, b, mode, last);
+		pair (a, b);
 	}
 }
 
@@ -79,6 +73,51 @@ static ut64 rva(RBin *bin, ut64 paddr, ut64 vaddr, int va) {
 	return paddr;
 }
 
+/* the flags of symbols and strings are set together, in the current
+ * flag space, when the batch is flushed */
+typedef struct {
+	RFlagEntry *entries;
+	int count;
+	int size;
+} FlagBatch;
+
+/* takes the name and the realname */
+static void flag_batch_add(FlagBatch *b, char *name, char *realname, ut64 addr, ut64 size) {
+	RFlagEntry *e;
+	if (b->count == b->size) {
+		int n = b->size? b->size * 2: 1024;
+		RFlagEntry *entries = realloc (b->entries, n * sizeof (RFlagEntry));
+		if (!entries) {
+			free (name);
+			free (realname);
+			return;
+		}
+		b->entries = entries;
+		b->size = n;
+	}
+	e = &b->entries[b->count++];
+	e->name = name;
+	e->realname = realname;
+	e->offset = addr;
+	e->size = size;
+}
+
+static void flag_batch_flush(RCore *r, FlagBatch *b) {
+	int i;
+	r_flag_set_batch (r->flags, b->entries, b->count);
+	for (i = 0; i < b->count; i++) {
+		free ((char *)b->entries[i].name);
+		free ((char *)b->entries[i].realname);
+	}
+	b->count = 0;
+}
+
+static void flag_batch_fini(RCore *r, FlagBatch *b) {
+	flag_batch_flush (r, b);
+	R_FREE (b->entries);
+	b->size = 0;
+}
+
 R_API int r_core_bin_set_by_fd(RCore *core, ut64 bin_fd) {
 	if (r_bin_file_set_cur_by_fd (core->bin, bin_fd)) {
 		r_core_bin_set_cur (core, r_core_bin_cur (core));
@@ -323,12 +362,17 @@ static void _print_strings(RCore *r, RList *list, int mode, int va) {
 	RListIter *iter;
 	RBinString *string;
 	RBinSection *section;
+	PJ *pj = NULL;
 	char *q;
 
 	bin->minstrlen = minstr;
 	bin->maxstrlen = maxstr;
 	if (IS_MODE_JSON (mode)) {
-		r_cons_printf ("[");
+		pj = r_cons_pj_new ();
+		if (!pj) {
+			return;
+		}
+		pj_a (pj);
 	}
 	if (IS_MODE_RAD (mode)) {
 		r_cons_printf ("fs strings");
@@ -338,6 +382,7 @@ static void _print_strings(RCore *r, RList *list, int mode, int va) {
 		r_cons_break_push (NULL, NULL);
 	}
 	RBinString b64 = {0};
+	FlagBatch fb = {0};
 	r_list_foreach (list, iter, string) {
 		const char *section_name, *type_string;
 		ut64 paddr, vaddr, addr;
@@ -381,8 +426,7 @@ static void _print_strings(RCore *r, RList *list, int mode, int va) {
 			} else {
 				str = r_str_newf ("str.%s", f_name);
 			}
-			r_flag_set (r->flags, str, addr, string->size);
-			free (str);
+			flag_batch_add (&fb, str, NULL, addr, string->size);
 			free (f_name);
 		} else if (IS_MODE_SIMPLE (mode)) {
 			r_cons_printf ("0x%"PFMT64x" %d %d %s\n", addr,
@@ -392,13 +436,15 @@ static void _print_strings(RCore *r, RList *list, int mode, int va) {
 		} else if (IS_MODE_JSON (mode)) {
 			int *block_list;
 			q = r_base64_encode_dyn (string->string, -1);
-			r_cons_printf ("%s{\"vaddr\":%"PFMT64d
-				",\"paddr\":%"PFMT64d",\"ordinal\":%d"
-				",\"size\":%d,\"length\":%d,\"section\":\"%s\","
-				"\"type\":\"%s\",\"string\":\"%s\"",
-				iter->p ? ",": "",
-				vaddr, paddr, string->ordinal, string->size,
-				string->length, section_name, type_string, q);
+			pj_o (pj);
+			pj_kn (pj, "vaddr", vaddr);
+			pj_kn (pj, "paddr", paddr);
+			pj_ki (pj, "ordinal", string->ordinal);
+			pj_ki (pj, "size", string->size);
+			pj_ki (pj, "length", string->length);
+			pj_ks (pj, "section", section_name);
+			pj_ks (pj, "type", type_string);
+			pj_ks (pj, "string", q);
 			switch (string->type) {
 			case R_STRING_TYPE_UTF8:
 			case R_STRING_TYPE_WIDE:
@@ -408,22 +454,19 @@ static void _print_strings(RCore *r, RList *list, int mode, int va) {
 					if (block_list[0] == 0 && block_list[1] == -1) {
 						/* Don't include block list if
 						   just Basic Latin (0x00 - 0x7F) */
+						R_FREE (block_list);
 						break;
 					}
 					int *block_ptr = block_list;
-					r_cons_printf (",\"blocks\":[");
+					pj_ka (pj, "blocks");
 					for (; *block_ptr != -1; block_ptr++) {
-						if (block_ptr != block_list) {
-							r_cons_printf (",");
-						}
-						const char *utfName = r_utf_block_name (*block_ptr);
-						r_cons_printf ("\"%s\"", utfName? utfName: "");
+						pj_s (pj, r_utf_block_name (*block_ptr));
 					}
-					r_cons_printf ("]");
+					pj_end (pj);
 					R_FREE (block_list);
 				}
 			}
-			r_cons_printf ("}");
+			pj_end (pj);
 			free (q);
 		} else if (IS_MODE_RAD (mode)) {
 			char *f_name, *str;
@@ -505,8 +548,10 @@ static void _print_strings(RCore *r, RList *list, int mode, int va) {
 		}
 	}
 	R_FREE (b64.string);
+	flag_batch_fini (r, &fb);
 	if (IS_MODE_JSON (mode)) {
-		r_cons_printf ("]");
+		pj_end (pj);
+		pj_free (pj);
 	}
 	if (IS_MODE_SET (mode)) {
 		r_cons_break_pop ();
@@ -704,6 +749,7 @@ static int bin_info(RCore *r, int mode) {
 	RBinFile *binfile = r_core_bin_cur (r);
 	RBinObject *obj = r_bin_cur_object (r->bin);
 	const char *compiled = NULL;
+	PJ *pj = NULL;
 	bool havecode;
 
 	if (!binfile || !info || !obj) {
@@ -786,81 +832,86 @@ static int bin_info(RCore *r, int mode) {
 		// XXX: if type is 'fs' show something different?
 		char *tmp_buf;
 		if (IS_MODE_JSON (mode)) {
-			r_cons_printf ("{");
-		}
-		pair_str ("arch", info->arch, mode, false);
-		pair_int ("binsz", r_bin_get_size (r->bin), mode, false);
-		pair_str ("bintype", info->rclass, mode, false);
-		pair_int ("bits", info->bits, mode, false);
-		pair_bool ("canary", info->has_canary, mode, false);
-		pair_str ("class", info->bclass, mode, false);
+			pj = r_cons_pj_new ();
+			if (!pj) {
+				return false;
+			}
+			pj_o (pj);
+		}
+		pair_str (pj, "arch", info->arch);
+		pair_int (pj, "binsz", r_bin_get_size (r->bin));
+		pair_str (pj, "bintype", info->rclass);
+		pair_int (pj, "bits", info->bits);
+		pair_bool (pj, "canary", info->has_canary);
+		pair_str (pj, "class", info->bclass);
 		if (info->actual_checksum) {
 			/* computed checksum */
-			pair_str ("cmp.csum", info->actual_checksum, mode, false);
+			pair_str (pj, "cmp.csum", info->actual_checksum);
 		}
-		pair_str ("compiled", compiled, mode, false);
-		pair_bool ("crypto", info->has_crypto, mode, false);
-		pair_str ("dbg_file", info->debug_file_name, mode, false);
-		pair_str ("endian", info->big_endian ? "big" : "little", mode, false);
+		pair_str (pj, "compiled", compiled);
+		pair_bool (pj, "crypto", info->has_crypto);
+		pair_str (pj, "dbg_file", info->debug_file_name);
+		pair_str (pj, "endian", info->big_endian ? "big" : "little");
 		if (info->rclass && !strcmp (info->rclass, "mdmp")) {
 			tmp_buf = sdb_get (binfile->sdb, "mdmp.flags", 0);
 			if (tmp_buf) {
-				pair_str ("flags", tmp_buf, mode, false);
+				pair_str (pj, "flags", tmp_buf);
 				free (tmp_buf);
 			}
 		}
-		pair_bool ("havecode", havecode, mode, false);
+		pair_bool (pj, "havecode", havecode);
 		if (info->claimed_checksum) {
 			/* checksum specified in header */
-			pair_str ("hdr.csum", info->claimed_checksum, mode, false);
-		}
-		pair_str ("guid", info->guid, mode, false);
-		pair_str ("intrp", info->intrp, mode, false);
-		pair_str ("lang", info->lang, mode, false);
-		pair_bool ("linenum", R_BIN_DBG_LINENUMS & info->dbg_info, mode, false);
-		pair_bool ("lsyms", R_BIN_DBG_SYMS & info->dbg_info, mode, false);
-		pair_str ("machine", info->machine, mode, false);
+			pair_str (pj, "hdr.csum", info->claimed_checksum);
+		}
+		pair_str (pj, "guid", info->guid);
+		pair_str (pj, "intrp", info->intrp);
+		pair_str (pj, "lang", info->lang);
+		pair_bool (pj, "linenum", R_BIN_DBG_LINENUMS & info->dbg_info);
+		pair_bool (pj, "lsyms", R_BIN_DBG_SYMS & info->dbg_info);
+		pair_str (pj, "machine", info->machine);
 		v = r_anal_archinfo (r->anal, R_ANAL_ARCHINFO_MAX_OP_SIZE);
 		if (v != -1) {
-			pair_int ("maxopsz", v, mode, false);
+			pair_int (pj, "maxopsz", v);
 		}
 		v = r_anal_archinfo (r->anal, R_ANAL_ARCHINFO_MIN_OP_SIZE);
 		if (v != -1) {
-			pair_int ("minopsz", v, mode, false);
+			pair_int (pj, "minopsz", v);
 		}
-		pair_bool ("nx", info->has_nx, mode, false);
-		pair_str ("os", info->os, mode, false);
+		pair_bool (pj, "nx", info->has_nx);
+		pair_str (pj, "os", info->os);
 		if (info->rclass && !strcmp (info->rclass, "pe")) {
-			pair_bool ("overlay", info->pe_overlay, mode, false);
+			pair_bool (pj, "overlay", info->pe_overlay);
 		}
 		v = r_anal_archinfo (r->anal, R_ANAL_ARCHINFO_ALIGN);
 		if (v != -1) {
-			pair_int ("pcalign", v, mode, false);
+			pair_int (pj, "pcalign", v);
 		}
-		pair_bool ("pic", info->has_pi, mode, false);
-		pair_bool ("relocs", R_BIN_DBG_RELOCS & info->dbg_info, mode, false);
+		pair_bool (pj, "pic", info->has_pi);
+		pair_bool (pj, "relocs", R_BIN_DBG_RELOCS & info->dbg_info);
 		tmp_buf = sdb_get (obj->kv, "elf.relro", 0);
 		if (tmp_buf) {
-			pair_str ("relro", tmp_buf, mode, false);
+			pair_str (pj, "relro", tmp_buf);
 			free (tmp_buf);
 		}
-		pair_str ("rpath", info->rpath, mode, false);
+		pair_str (pj, "rpath", info->rpath);
 		if (info->rclass && !strcmp (info->rclass, "pe")) {
 			//this should be moved if added to mach0 (or others)
-			pair_bool ("signed", info->signature, mode, false);
+			pair_bool (pj, "signed", info->signature);
 		}
-		pair_bool ("static", r_bin_is_static (r->bin), mode, false);
+		pair_bool (pj, "static", r_bin_is_static (r->bin));
 		if (info->rclass && !strcmp (info->rclass, "mdmp")) {
 			v = sdb_num_get (binfile->sdb, "mdmp.streams", 0);
 			if (v != -1) {
-				pair_int ("streams", v, mode, false);
+				pair_int (pj, "streams", v);
 			}
 		}
-		pair_bool ("stripped", R_BIN_DBG_STRIPPED & info->dbg_info, mode, false);
-		pair_str ("subsys", info->subsystem, mode, false);
-		pair_bool ("va", info->has_va, mode, true);
+		pair_bool (pj, "stripped", R_BIN_DBG_STRIPPED & info->dbg_info);
+		pair_str (pj, "subsys", info->subsystem);
+		pair_bool (pj, "va", info->has_va);
 		if (IS_MODE_JSON (mode)) {
-			r_cons_printf (",\"checksums\":{");
+			char hex[sizeof (info->sum[0].buf) * 2 + 1];
+			pj_ko (pj, "checksums");
 			for (i = 0; info->sum[i].type; i++) {
 				RBinHash *h = &info->sum[i];
 				ut64 hash = r_hash_name_to_bits (h->type);
@@ -871,14 +922,12 @@ static int bin_info(RCore *r, int mode) {
 					eprintf ("Invaild checksum length\n");
 				}
 				r_hash_free (rh);
-				r_cons_printf ("%s\"%s\":{\"hex\":\"", i?",": "", h->type);
-				// r_cons_printf ("%s\t%d-%dc\t", h->type, h->from, h->to+h->from);
-				for (j = 0; j < h->len; j++) {
-					r_cons_printf ("%02x", h->buf[j]);
-				}
-				r_cons_printf ("\"}");
+				r_hex_bin2str (h->buf, R_MIN (h->len, (int)sizeof (h->buf)), hex);
+				pj_ko (pj, h->type);
+				pj_ks (pj, "hex", hex);
+				pj_end (pj);
 			}
-			r_cons_printf ("}");
+			pj_end (pj);
 		} else {
 			for (i = 0; info->sum[i].type; i++) {
 				RBinHash *h = &info->sum[i];
@@ -897,7 +946,10 @@ static int bin_info(RCore *r, int mode) {
 				r_cons_newline ();
 			}
 		}
-		if (IS_MODE_JSON (mode)) r_cons_printf ("}");
+		if (IS_MODE_JSON (mode)) {
+			pj_end (pj);
+			pj_free (pj);
+		}
 	}
 	r_core_anal_type_init (r);
 	r_core_anal_cc_init (r);
@@ -1043,9 +1095,19 @@ static int bin_dwarf(RCore *core, int mode) {
 	return true;
 }
 
+static void pdb_gvar_flag(void *user, const char *name, ut64 addr, int symtype, const char *section) {
+	char *fname = r_name_filter2 (name);
+	if (fname) {
+		flag_batch_add ((FlagBatch *)user, r_str_newf ("pdb.%s", fname), NULL, addr, 1);
+		free (fname);
+	}
+}
+
 static int bin_pdb(RCore *core, int mode) {
 	R_PDB pdb = R_EMPTY;
+	FlagBatch batch = { 0 };
 	ut64 baddr = r_bin_get_baddr (core->bin);
+	char *cmds;
 
 	pdb.cb_printf = r_cons_printf;
 	if (!init_pdb_parser (&pdb, core->bin->file)) {
@@ -1062,8 +1124,17 @@ static int bin_pdb(RCore *core, int mode) {
 
 	switch (mode) {
 	case R_CORE_BIN_SET:
-		mode = 's';
-		r_core_cmd0 (core, ".iP*");
+		/* the types are defined by running their commands, the
+		 * globals go straight to the flags */
+		r_cons_push ();
+		pdb.print_types (&pdb, 'r');
+		cmds = r_cons_get_buffer ()? strdup (r_cons_get_buffer ()): NULL;
+		r_cons_pop ();
+		r_core_cmd_lines (core, cmds);
+		free (cmds);
+		pdb.foreach_gvar (&pdb, baddr, pdb_gvar_flag, &batch);
+		flag_batch_fini (core, &batch);
+		pdb.finish_pdb_parse (&pdb);
 		return true;
 	case R_CORE_BIN_JSON:
 		mode = 'j';
@@ -1797,6 +1868,8 @@ static int bin_symbols_internal(RCore *r, int mode, ut64 laddr, int va, ut64 at,
 	bool printHere = false;
 	int i = 0, is_arm, lastfs = 's';
 	bool bin_demangle = r_config_get_i (r->config, "bin.demangle");
+	FlagBatch fb = {0};
+	PJ *pj = NULL;
 	if (!info) {
 		return 0;
 	}
@@ -1811,8 +1884,14 @@ static int bin_symbols_internal(RCore *r, int mode, ut64 laddr, int va, ut64 at,
 	symbols = r_bin_get_symbols (r->bin);
 	r_space_set (&r->anal->meta_spaces, "bin");
 
-	if (IS_MODE_JSON (mode) && !printHere) {
-		r_cons_printf ("[");
+	if (IS_MODE_JSON (mode)) {
+		pj = r_cons_pj_new ();
+		if (!pj) {
+			return 0;
+		}
+		if (!printHere) {
+			pj_a (pj);
+		}
 	} else if (IS_MODE_SET (mode)) {
 		r_flag_space_set (r->flags, "symbols");
 	} else if (!at && exponly) {
@@ -1864,11 +1943,13 @@ static int bin_symbols_internal(RCore *r, int mode, ut64 laddr, int va, ut64 at,
 			}
 			if (!strncmp (symbol->name, "imp.", 4)) {
 				if (lastfs != 'i') {
+					flag_batch_flush (r, &fb);
 					r_flag_space_set (r->flags, "imports");
 				}
 				lastfs = 'i';
 			} else {
 				if (lastfs != 's') {
+					flag_batch_flush (r, &fb);
 					r_flag_space_set (r->flags, "symbols");
 				}
 				lastfs = 's';
@@ -1877,6 +1958,7 @@ static int bin_symbols_internal(RCore *r, int mode, ut64 laddr, int va, ut64 at,
 			if (sn.classname) {
 				RFlagItem *fi = NULL;
 				char *comment = NULL;
+				flag_batch_flush (r, &fb);
 				fi = r_flag_get (r->flags, sn.methflag);
 				if (r->bin->prefix) {
 					char *prname;
@@ -1901,47 +1983,29 @@ static int bin_symbols_internal(RCore *r, int mode, ut64 laddr, int va, ut64 at,
 				}
 			} else {
 				const char *fn, *n;
-				RFlagItem *fi;
 				n = sn.demname ? sn.demname : sn.name;
 				fn = sn.demflag ? sn.demflag : sn.nameflag;
 				char *fnp = (r->bin->prefix) ?
 					r_str_newf ("%s.%s", r->bin->prefix, fn):
 					strdup (fn);
-				fi = r_flag_set (r->flags, fnp, addr, symbol->size);
-				if (fi) {
-					r_flag_item_set_realname (fi, n);
-				} else {
-					if (fn) {
-						eprintf ("[Warning] Can't find flag (%s)\n", fn);
-					}
-				}
-				free (fnp);
+				flag_batch_add (&fb, fnp, n? strdup (n): NULL, addr, symbol->size);
 			}
 			if (sn.demname) {
 				r_meta_add (r->anal, R_META_TYPE_COMMENT,
 					addr, symbol->size, sn.demname);
 			}
 		} else if (IS_MODE_JSON (mode)) {
-			char *str = r_str_utf16_encode (symbol->name, -1);
-			str = r_str_replace (str, "\"", "\\\"", 1);
-			r_cons_printf ("%s{\"name\":\"%s\","
-				"\"demname\":\"%s\","
-				"\"flagname\":\"%s\","
-				"\"ordinal\":%d,"
-				"\"bind\":\"%s\","
-				"\"size\":%d,"
-				"\"type\":\"%s\","
-				"\"vaddr\":%"PFMT64d","
-				"\"paddr\":%"PFMT64d"}",
-				((exponly && firstexp) || printHere) ? "" : (iter->p ? "," : ""), str,
-				sn.demname? sn.demname: "",
-				sn.nameflag,
-				symbol->ordinal,
-				symbol->bind,
-				(int)symbol->size,
-				symbol->type,
-				(ut64)addr, (ut64)symbol->paddr);
-			free (str);
+			pj_o (pj);
+			pj_ks (pj, "name", symbol->name);
+			pj_ks (pj, "demname", sn.demname);
+			pj_ks (pj, "flagname", sn.nameflag);
+			pj_ki (pj, "ordinal", symbol->ordinal);
+			pj_ks (pj, "bind", symbol->bind);
+			pj_ki (pj, "size", (int)symbol->size);
+			pj_ks (pj, "type", symbol->type);
+			pj_kn (pj, "vaddr", addr);
+			pj_kn (pj, "paddr", symbol->paddr);
+			pj_end (pj);
 		} else if (IS_MODE_SIMPLE (mode)) {
 			const char *name = sn.demname? sn.demname: symbol->name;
 			r_cons_printf ("0x%08"PFMT64x" %d %s\n",
@@ -2026,6 +2090,7 @@ static int bin_symbols_internal(RCore *r, int mode, ut64 laddr, int va, ut64 at,
 			break;
 		}
 	}
+	flag_batch_fini (r, &fb);
 
 	//handle thumb and arm for entry point since they are not present in symbols
 	if (is_arm) {
@@ -2048,7 +2113,12 @@ static int bin_symbols_internal(RCore *r, int mode, ut64 laddr, int va, ut64 at,
 			}
 		}
 	}
-	if (IS_MODE_JSON (mode) && !printHere) r_cons_printf ("]");
+	if (IS_MODE_JSON (mode)) {
+		if (!printHere) {
+			pj_end (pj);
+		}
+		pj_free (pj);
+	}
 #if 0
 	if (IS_MODE_NORMAL (mode) && !at) {
 		r_cons_printf ("\n%i %s\n", i, exponly ? "exports" : "symbols");
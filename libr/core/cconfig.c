@@ -1638,6 +1638,12 @@ static int cb_scrflush(void *user, void *data) {
 	return true;
 }
 
+static int cb_scrstream(void *user, void *data) {
+	RConfigNode *node = (RConfigNode *) data;
+	r_cons_singleton ()->stream = node->i_value;
+	return true;
+}
+
 static int cb_exectrap(void *user, void *data) {
 	RConfigNode *node = (RConfigNode *) data;
 	RCore *core = (RCore*) user;
@@ -2167,6 +2173,7 @@ R_API int r_core_config_init(RCore *core) {
 	SETI ("anal.depth", 16, "Max depth at code analysis"); // XXX: warn if depth is > 50 .. can be problematic
 	SETICB ("anal.sleep", 0, &cb_analsleep, "Sleep N usecs every so often during analysis. Avoid 100% CPU usage");
 	SETPREF ("anal.calls", "false", "Make basic af analysis walk into calls");
+	SETPREF ("anal.cache", "false", "Save the analysis in dir.cache after aa/aaa and restore it when the file is opened again");
 	SETPREF ("anal.autoname", "true", "Automatically set a name for the functions, may result in some false positives");
 	SETPREF ("anal.hasnext", "false", "Continue analysis after each function");
 	SETPREF ("anal.esil", "false", "Use the new ESIL code analysis");
@@ -2175,6 +2182,8 @@ R_API int r_core_config_init(RCore *core) {
 	SETPREF ("anal.vinfun", "true",  "Search values in functions (aav) (false by default to only find on non-code)");
 	SETPREF ("anal.vinfunrange", "false",  "Search values outside function ranges (requires anal.vinfun=false)\n");
 	SETCB ("anal.nopskip", "true", &cb_analnopskip, "Skip nops at the beginning of functions");
+	SETPREF ("anal.fillskip", "true", "Skip runs of fill bytes (padding, zeroed memory) in aar and aae");
+	SETPREF ("anal.fcnskip", "false", "Skip the basic blocks of already analyzed functions in aar");
 	SETCB ("anal.hpskip", "false", &cb_analhpskip, "Skip `mov reg, reg` and `lea reg, [reg] at the beginning of functions");
 	SETCB ("anal.noncode", "false", &cb_analnoncode, "Analyze data as code");
 	n = NODECB ("anal.arch", R_SYS_ARCH, &cb_analarch);
@@ -2442,6 +2451,7 @@ R_API int r_core_config_init(RCore *core) {
 #else
 	SETPREF ("dir.projects", "~/"R2_HOMEDIR"/projects", "Default path for projects");
 #endif
+	SETPREF ("dir.cache", "~/"R2_HOMEDIR"/cache", "Default path for the analysis cache (see anal.cache)");
 	SETCB ("dir.zigns", "~/"R2_HOMEDIR"/zigns", &cb_dirzigns, "Default path for zignatures (see zo command)");
 	SETPREF ("stack.bytes", "true", "Show bytes instead of words in stack");
 	SETPREF ("stack.anotated", "false", "Show anotated hexdump in visual debug");
@@ -2529,6 +2539,7 @@ R_API int r_core_config_init(RCore *core) {
 	r_config_desc (cfg, "cmd.graph", "Command executed by 'agv' command to view graphs");
 	SETPREF ("cmd.xterm", "xterm -bg black -fg gray -e", "xterm command to spawn with V@");
 	SETICB ("cmd.depth", 10, &cb_cmddepth, "Maximum command depth");
+	SETI ("cmd.jobs", 0, "Workers used by the @@! iterators, p=e and /m (0 = one per cpu)");
 	SETPREF ("cmd.bp", "", "Run when a breakpoint is hit");
 	SETICB ("cmd.hitinfo", 1, &cb_debug_hitinfo, "Show info when a tracepoint/breakpoint is hit");
 	SETPREF ("cmd.times", "", "Run when a command is repeated (number prefix)");
@@ -2608,6 +2619,7 @@ R_API int r_core_config_init(RCore *core) {
 	SETPREF ("http.ui", "m", "Default webui (enyo, m, p, t)");
 	SETPREF ("http.sandbox", "true", "Sandbox the HTTP server");
 	SETI ("http.timeout", 3, "Disconnect clients after N seconds of inactivity");
+	SETI ("http.workers", 0, "Run read-only /cmd/ requests in up to N forked snapshots and keep connections alive");
 	SETI ("http.dietime", 0, "Kill server after N seconds with no client");
 	SETPREF ("http.verbose", "true", "Output server logs to stdout");
 	SETPREF ("http.upget", "false", "/up/ answers GET requests, in addition to POST");
@@ -2661,6 +2673,7 @@ R_API int r_core_config_init(RCore *core) {
 	SETICB ("scr.linesleep", 0, &cb_scrlinesleep, "Flush sleeping some ms in every line");
 	SETICB ("scr.pagesize", 1, &cb_scrpagesize, "Flush in pages when scr.linesleep is != 0");
 	SETCB ("scr.flush", "false", &cb_scrflush, "Force flush to console in realtime (breaks scripting)");
+	SETCB ("scr.stream", "true", &cb_scrstream, "Write big non-interactive outputs in chunks while the command runs");
 	/* TODO: rename to asm.color.ops ? */
 	SETPREF ("scr.zoneflags", "true", "Show zoneflags in visual mode before the title (see fz?)");
 	SETPREF ("scr.color.ops", "true", "Colorize numbers and registers in opcodes");
@@ -25,6 +25,9 @@
 #include <stdarg.h>
 #if __UNIX__
 #include <sys/utsname.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <signal.h>
 #endif
 
 #define DEFINE_CMD_DESCRIPTOR(core, cmd_) \
@@ -71,6 +74,11 @@
 	}
 
 static void cmd_debug_reg(RCore *core, const char *str);
+
+/* runs the slice k of n, in a forked worker or in r2 itself */
+typedef void (*CoreJobCallback)(RCore *core, int k, int n, void *user);
+static void core_jobs_run(RCore *core, int nproc, CoreJobCallback cb, void *user);
+static void core_jobs_yield(void);
 #include "cmd_quit.c"
 #include "cmd_hash.c"
 #include "cmd_debug.c"
@@ -1693,6 +1701,7 @@ static int r_core_cmd_subst_i(RCore *core, char *cmd, char *colon) {
 	char *ptr, *ptr2, *str;
 	char *arroba = NULL;
 	char *grep = NULL;
+	RConsGrep *stream_grep = r_cons_singleton ()->stream_grep;
 	int i, ret = 0, pipefd;
 	bool usemyblock = false;
 	int scr_html = -1;
@@ -2182,6 +2191,7 @@ next2:
 	if (*cmd != '.') {
 		grep = r_cons_grep_strip (cmd, quotestr);
 	}
+	stream_grep = r_cons_grep_stream_begin (grep, !colon || !colon[1]);
 
 	/* temporary seek commands */
 	// if (*cmd != '(' && *cmd != '"') {
@@ -2197,7 +2207,8 @@ next2:
 	core->tmpseek = ptr? true: false;
 	int rc = 0;
 	if (ptr) {
-		char *f, *ptr2 = strchr (ptr + 1, '!');
+		/* "@addr!blocksize", but "@@!" is the forked foreach */
+		char *f, *ptr2 = strchr ((ptr[1] == '@' && ptr[2] == '!')? ptr + 3: ptr + 1, '!');
 		ut64 addr = core->offset;
 		bool addr_is_set = false;
 		char *tmpbits = NULL;
@@ -2516,6 +2527,7 @@ next_arroba:
 fuji:
 	rc = cmd? r_cmd_call (core->rcmd, r_str_trim_head (cmd)): false;
 beach:
+	r_cons_grep_stream_end (stream_grep);
 	r_cons_grep_process (grep);
 	if (scr_html != -1) {
 		r_cons_flush ();
@@ -2689,6 +2701,73 @@ R_API int r_core_cmd_foreach3(RCore *core, const char *cmd, char *each) {
 	return 0;
 }
 
+static const char *cmd_batch_template(RCore *core, const char *tpl);
+
+/* where an @@! iteration runs, see foreach_jobs */
+typedef struct {
+	ut64 addr;
+	int bsize;
+	bool isolate;
+} ForeachJob;
+
+typedef struct {
+	const char *cmd;
+	ForeachJob *jobs;
+	int count;
+	int size;
+} ForeachJobs;
+
+/* set while the iterator of an @@! is walked, foreach_cmd only records
+ * the steps instead of running the command */
+static ForeachJobs *foreach_collect = NULL;
+
+static int foreach_job_add(ForeachJobs *fj, RCore *core, bool isolate) {
+	if (fj->count == fj->size) {
+		int size = fj->size? fj->size * 2: 256;
+		ForeachJob *jobs = realloc (fj->jobs, size * sizeof (ForeachJob));
+		if (!jobs) {
+			return false;
+		}
+		fj->jobs = jobs;
+		fj->size = size;
+	}
+	fj->jobs[fj->count].addr = core->offset;
+	fj->jobs[fj->count].bsize = core->blocksize;
+	fj->jobs[fj->count].isolate = isolate;
+	fj->count++;
+	return true;
+}
+
+/* one step of the @@ iterators at the current seek. plain commands reuse
+ * the cached parse and print in place, so big listings can be streamed.
+ * the rest get their own cons frame if isolate is set, since things like
+ * pipes reset the cons buffer */
+static int foreach_cmd(RCore *core, const char *cmd, bool isolate) {
+	const char *fast;
+	const char *tmp;
+	char *buf;
+	int ret;
+	if (foreach_collect && !strcmp (cmd, foreach_collect->cmd)) {
+		return foreach_job_add (foreach_collect, core, isolate);
+	}
+	fast = cmd_batch_template (core, cmd);
+	if (fast) {
+		core->tmpseek = false;
+		return r_cmd_call (core->rcmd, fast);
+	}
+	if (!isolate) {
+		return r_core_cmd (core, cmd, 0);
+	}
+	r_cons_push ();
+	ret = r_core_cmd (core, cmd, 0);
+	tmp = r_cons_get_buffer ();
+	buf = tmp? strdup (tmp): NULL;
+	r_cons_pop ();
+	r_cons_strcat (buf);
+	free (buf);
+	return ret;
+}
+
 static void foreachOffset (RCore *core, const char *_cmd, const char *each) {
 	char *cmd = strdup (_cmd);
 	char *str = cmd;
@@ -2735,7 +2814,7 @@ static void foreachOffset (RCore *core, const char *_cmd, const char *each) {
 				each = NULL;
 			}
 			r_core_seek (core, addr, 1);
-			r_core_cmd (core, cmd, 0);
+			foreach_cmd (core, cmd, false);
 			r_cons_flush ();
 		}
 		each = nextLine;
@@ -2743,6 +2822,230 @@ static void foreachOffset (RCore *core, const char *_cmd, const char *each) {
 	free (cmd);
 }
 
+static void foreach_jobs_seek(RCore *core, ForeachJob *job) {
+	if (job->bsize != core->blocksize) {
+		r_core_block_size (core, job->bsize);
+	}
+	r_core_seek (core, job->addr, 1);
+}
+
+#if __UNIX__
+/* pipe of the forked worker running a slice, -1 in r2 itself */
+static int core_jobs_fd = -1;
+
+static bool core_jobs_write(int fd, const char *buf, int len) {
+	while (len > 0) {
+		int n = write (fd, buf, len);
+		if (n < 1) {
+			return false;
+		}
+		buf += n;
+		len -= n;
+	}
+	return true;
+}
+#endif
+
+/* called by the slices between steps, a worker sends what it printed so
+ * far once it is big enough */
+static void core_jobs_yield(void) {
+#if __UNIX__
+	RCons *cons = r_cons_singleton ();
+	if (core_jobs_fd != -1 && cons->buffer_len > CONS_STREAM_CHUNK) {
+		if (!core_jobs_write (core_jobs_fd, cons->buffer, cons->buffer_len)) {
+			/* r2 stopped reading */
+			_exit (0);
+		}
+		r_cons_reset ();
+	}
+#endif
+}
+
+#if __UNIX__
+/* runs in a forked child, what the slice prints goes to fd */
+static void core_jobs_child(RCore *core, CoreJobCallback cb, void *user, int k, int n, int fd) {
+	RCons *cons = r_cons_singleton ();
+	r_cons_reset ();
+	cons->stream = false;
+	cons->noflush = true;
+	cons->is_interactive = false;
+	core_jobs_fd = fd;
+	cb (core, k, n, user);
+	(void)core_jobs_write (fd, cons->buffer, cons->buffer_len);
+	close (fd);
+	_exit (0);
+}
+
+/* runs the nproc slices of a job in forked copies of the core. the output
+ * of the first unfinished slice is printed as it comes and the others are
+ * kept until it is their turn, so it reads as if they ran one after the
+ * other. a slice whose fork fails runs here */
+static bool core_jobs_fork(RCore *core, int nproc, CoreJobCallback cb, void *user) {
+	struct pollfd *pfd = calloc (nproc, sizeof (struct pollfd));
+	RStrBuf **out = calloc (nproc, sizeof (RStrBuf *));
+	int *pids = calloc (nproc, sizeof (int));
+	int *fds = calloc (nproc, sizeof (int));
+	int i, k, cur, np;
+	char buf[8192];
+	bool ret = false;
+	if (!pfd || !out || !pids || !fds) {
+		goto beach;
+	}
+	ret = true;
+	for (k = 0; k < nproc; k++) {
+		int p[2];
+		pids[k] = -1;
+		fds[k] = -1;
+		out[k] = r_strbuf_new (NULL);
+		if (pipe (p)) {
+			continue;
+		}
+		r_cons_flush ();
+		pids[k] = r_sys_fork ();
+		if (!pids[k]) {
+			for (i = 0; i < k; i++) {
+				if (fds[i] != -1) {
+					close (fds[i]);
+				}
+			}
+			close (p[0]);
+			core_jobs_child (core, cb, user, k, nproc, p[1]);
+		}
+		close (p[1]);
+		if (pids[k] < 0) {
+			close (p[0]);
+			continue;
+		}
+		fds[k] = p[0];
+	}
+	for (cur = 0; cur < nproc; ) {
+		if (pids[cur] < 0 && !r_cons_is_breaked ()) {
+			/* no child for this slice, run it here */
+			cb (core, cur, nproc, user);
+		}
+		if (fds[cur] == -1) {
+			if (++cur < nproc) {
+				r_cons_memcat (r_strbuf_get (out[cur]), out[cur]->len);
+				r_strbuf_fini (out[cur]);
+			}
+			continue;
+		}
+		if (r_cons_is_breaked ()) {
+			break;
+		}
+		for (np = 0, k = cur; k < nproc; k++) {
+			if (fds[k] != -1) {
+				pfd[np].fd = fds[k];
+				pfd[np].events = POLLIN;
+				pfd[np].revents = 0;
+				np++;
+			}
+		}
+		if (poll (pfd, np, 100) < 1) {
+			continue;
+		}
+		for (i = 0, k = cur; k < nproc; k++) {
+			int n;
+			if (fds[k] == -1) {
+				continue;
+			}
+			if (!pfd[i++].revents) {
+				continue;
+			}
+			n = read (fds[k], buf, sizeof (buf));
+			if (n < 1) {
+				close (fds[k]);
+				fds[k] = -1;
+			} else if (k == cur) {
+				r_cons_memcat (buf, n);
+			} else {
+				r_strbuf_append_n (out[k], buf, n);
+			}
+		}
+	}
+	for (k = 0; k < nproc; k++) {
+		if (fds[k] != -1) {
+			close (fds[k]);
+		}
+		if (pids[k] > 0) {
+			if (cur < nproc) {
+				kill (pids[k], SIGKILL);
+			}
+			waitpid (pids[k], NULL, 0);
+		}
+		r_strbuf_free (out[k]);
+	}
+beach:
+	free (pfd);
+	free (out);
+	free (pids);
+	free (fds);
+	return ret;
+}
+#endif
+
+static void core_jobs_run(RCore *core, int nproc, CoreJobCallback cb, void *user) {
+	int k;
+#if __UNIX__
+	if (nproc > 1 && core_jobs_fork (core, nproc, cb, user)) {
+		return;
+	}
+#endif
+	for (k = 0; k < nproc && !r_cons_is_breaked (); k++) {
+		cb (core, k, nproc, user);
+	}
+}
+
+static void foreach_jobs_slice(RCore *core, int k, int n, void *user) {
+	ForeachJobs *fj = user;
+	int from = (int)((st64)fj->count * k / n);
+	int to = (int)((st64)fj->count * (k + 1) / n);
+	int i;
+	for (i = from; i < to && !r_cons_is_breaked (); i++) {
+		foreach_jobs_seek (core, &fj->jobs[i]);
+		foreach_cmd (core, fj->cmd, fj->jobs[i].isolate);
+		core_jobs_yield ();
+	}
+}
+
+/* "@@!" runs the steps of any @@ iterator that goes through foreach_cmd
+ * in cmd.jobs forked copies of the core, the outputs are printed in the
+ * original order. it is meant for commands that only read, whatever they
+ * change is lost with the child */
+static int foreach_jobs(RCore *core, const char *cmd, const char *each) {
+	ForeachJobs fj = { cmd, NULL, 0, 0 };
+	ut64 oseek = core->offset;
+	int obsize = core->blocksize;
+	int nproc = r_config_get_i (core->config, "cmd.jobs");
+	char *iter = strdup (each);
+	if (!iter) {
+		return false;
+	}
+	if (foreach_collect || !*iter || strchr ("/?td.", *iter)) {
+		/* nested, or not an iterator of addresses */
+		int ret = r_core_cmd_foreach (core, cmd, iter);
+		free (iter);
+		return ret;
+	}
+	foreach_collect = &fj;
+	r_core_cmd_foreach (core, cmd, iter);
+	foreach_collect = NULL;
+	free (iter);
+	if (nproc < 1) {
+		nproc = r_th_ncpus ();
+	}
+	nproc = R_MAX (R_MIN (nproc, fj.count), 1);
+	r_cons_break_push (NULL, NULL);
+	core_jobs_run (core, nproc, foreach_jobs_slice, &fj);
+	r_cons_break_pop ();
+	if (core->blocksize != obsize) {
+		r_core_block_size (core, obsize);
+	}
+	r_core_seek (core, oseek, 1);
+	free (fj.jobs);
+	return true;
+}
+
 R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 	int i, j;
 	char ch;
@@ -2753,6 +3056,9 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 	ut64 oseek, addr;
 
 	for (; *cmd == ' '; cmd++);
+	if (*each == '!') {
+		return foreach_jobs (core, cmd, each + 1);
+	}
 
 	oseek = core->offset;
 	ostr = str = strdup (each);
@@ -2781,7 +3087,7 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 				r_list_foreach (fcn->bbs, iter, bb) {
 					r_core_block_size (core, bb->size);
 					r_core_seek (core, bb->addr, 1);
-					r_core_cmd (core, cmd, 0);
+					foreach_cmd (core, cmd, false);
 					if (r_cons_is_breaked ()) {
 						break;
 					}
@@ -2805,7 +3111,7 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 				ut64 step = r_num_math (core->num, r_str_word_get0 (str, 2));
 				for (cur = from; cur < to; cur += step) {
 					(void)r_core_seek (core, cur, 1);
-					r_core_cmd (core, cmd, 0);
+					foreach_cmd (core, cmd, false);
 					if (r_cons_is_breaked ()) {
 						break;
 					}
@@ -2828,7 +3134,7 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 					for (i = 0; i < bb->op_pos_size; i++) {
 						ut64 addr = bb->addr + bb->op_pos[i];
 						r_core_seek (core, addr, 1);
-						r_core_cmd (core, cmd, 0);
+						foreach_cmd (core, cmd, false);
 						if (r_cons_is_breaked ()) {
 							break;
 						}
@@ -2846,7 +3152,7 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 				r_list_foreach (core->anal->fcns, iter, fcn) {
 					if (each[2] && strstr (fcn->name, each + 2)) {
 						r_core_seek (core, fcn->addr, 1);
-						r_core_cmd (core, cmd, 0);
+						foreach_cmd (core, cmd, false);
 						if (r_cons_is_breaked ()) {
 							break;
 						}
@@ -2860,17 +3166,8 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 			if (core->anal) {
 				RConsGrep grep = core->cons->grep;
 				r_list_foreach (core->anal->fcns, iter, fcn) {
-					char *buf;
 					r_core_seek (core, fcn->addr, 1);
-					r_cons_push ();
-					r_core_cmd (core, cmd, 0);
-					buf = (char *)r_cons_get_buffer ();
-					if (buf) {
-						buf = strdup (buf);
-					}
-					r_cons_pop ();
-					r_cons_strcat (buf);
-					free (buf);
+					foreach_cmd (core, cmd, true);
 					if (r_cons_is_breaked ()) {
 						break;
 					}
@@ -2962,7 +3259,7 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 				//eprintf ("; 0x%08"PFMT64x":\n", addr);
 				each = str + 1;
 				r_core_seek (core, addr, 1);
-				r_core_cmd (core, cmd, 0);
+				foreach_cmd (core, cmd, false);
 				r_cons_flush ();
 			} while (str != NULL);
 			free (out);
@@ -3041,16 +3338,8 @@ R_API int r_core_cmd_foreach(RCore *core, const char *cmd, char *each) {
 						continue;
 					}
 					if (r_str_glob (flag->name, word)) {
-						char *buf = NULL;
-						const char *tmp = NULL;
 						r_core_seek (core, flag->offset, 1);
-						r_cons_push ();
-						r_core_cmd (core, cmd, 0);
-						tmp = r_cons_get_buffer ();
-						buf = tmp? strdup (tmp): NULL;
-						r_cons_pop ();
-						r_cons_strcat (buf);
-						free (buf);
+						foreach_cmd (core, cmd, true);
 					}
 				}
 				core->flags->space_idx = flagspace;
@@ -3073,8 +3362,154 @@ out_finish:
 	return false;
 }
 
+/* batched commands */
+
+#define CMD_BATCH_CACHE_MAX 4096
+
+static void cmdcache_free_kv(HtKv *kv) {
+	free (kv->key);
+	free (kv->value);
+	free (kv);
+}
+
+static bool is_batch_char(char ch) {
+	return IS_DIGIT (ch) || isalpha ((ut8)ch) || strchr (" .-+*_,:/=?", ch);
+}
+
+/* cached parse of the part before the '@'. returns the command to give
+ * to r_cmd_call when nothing in it needs the full parser, else NULL */
+static const char *cmd_batch_template(RCore *core, const char *tpl) {
+	bool found = false;
+	const char *p;
+	char *cmd;
+	if (!core->cmdcache) {
+		core->cmdcache = ht_new (NULL, cmdcache_free_kv, NULL);
+		if (!core->cmdcache) {
+			return NULL;
+		}
+	}
+	cmd = ht_find (core->cmdcache, tpl, &found);
+	if (found) {
+		return *cmd? cmd: NULL;
+	}
+	if (core->cmdcache->count >= CMD_BATCH_CACHE_MAX) {
+		ht_free (core->cmdcache);
+		core->cmdcache = ht_new (NULL, cmdcache_free_kv, NULL);
+		if (!core->cmdcache) {
+			return NULL;
+		}
+	}
+	for (p = tpl; *p == ' '; p++) {
+		;
+	}
+	cmd = strdup (p);
+	if (!cmd) {
+		return NULL;
+	}
+	r_str_trim_tail (cmd);
+	if (!isalpha ((ut8)*cmd) || *cmd == 'q') {
+		*cmd = 0;
+	}
+	for (p = cmd; *p; p++) {
+		if (!is_batch_char (*p)) {
+			*cmd = 0;
+			break;
+		}
+	}
+	ht_insert (core->cmdcache, tpl, cmd);
+	return *cmd? cmd: NULL;
+}
+
+/* only plain numbers take the fast path, anything else (flags, relative
+ * seeks, @a: @b: ...) keeps the full semantics of r_core_cmd_subst */
+static bool cmd_batch_addr(RCore *core, const char *s, ut64 *addr) {
+	const char *p;
+	s = r_str_trim_const (s);
+	if (!IS_DIGIT (*s)) {
+		return false;
+	}
+	for (p = s; *p; p++) {
+		if (!isxdigit ((ut8)*p) && *p != 'x' && *p != ' ') {
+			return false;
+		}
+	}
+	*addr = r_num_math (core->num, s);
+	return true;
+}
+
+/* same test r_cons_filter does before touching the buffer */
+static bool cmd_batch_filtered(RCons *cons) {
+	return cons->filter || cons->grep.nstrings > 0 || cons->grep.tokens_used
+		|| cons->grep.less || cons->grep.json || cons->is_html;
+}
+
+/* run r_cons_filter on the output of the last command only, what r_core_cmd_str
+ * does for the commands that go through the full parser */
+static void cmd_batch_filter(RCons *cons, int pos) {
+	int len = cons->buffer_len - pos;
+	char *out = r_mem_dup (cons->buffer + pos, len);
+	if (!out) {
+		return;
+	}
+	cons->buffer_len = pos;
+	r_cons_push ();
+	r_cons_memcat (out, len);
+	r_cons_filter ();
+	free (out);
+	len = cons->buffer_len;
+	out = len > 0? r_mem_dup (cons->buffer, len): NULL;
+	r_cons_pop ();
+	if (out) {
+		r_cons_memcat (out, len);
+		free (out);
+	}
+}
+
+static void cmd_batch_run(RCore *core, const char *cstr) {
+	RCons *cons = r_cons_singleton ();
+	const char *at = strchr (cstr, '@');
+	char *tpl = at? r_str_ndup (cstr, at - cstr): strdup (cstr);
+	const char *cmd = tpl? cmd_batch_template (core, tpl): NULL;
+	ut64 addr = core->offset;
+	char hdr[16];
+
+	if (cmd && (!at || cmd_batch_addr (core, at + 1, &addr))) {
+		/* output goes straight after a placeholder length which is
+		 * patched once the command is done */
+		ut64 orig = core->offset;
+		bool otmpseek = core->tmpseek;
+		int pos = cons->buffer_len;
+		r_cons_memcat ("00000000\n", 9);
+		core->tmpseek = at? true: false;
+		if (at) {
+			r_core_seek (core, addr, 1);
+			r_core_block_read (core);
+		}
+		r_cmd_call (core->rcmd, cmd);
+		if (at) {
+			r_core_seek (core, orig, 1);
+		}
+		core->tmpseek = otmpseek;
+		if (cmd_batch_filtered (cons) && cons->buffer && cons->buffer_len > pos + 9) {
+			cmd_batch_filter (cons, pos + 9);
+		}
+		if (cons->buffer && cons->buffer_len >= pos + 9) {
+			snprintf (hdr, sizeof (hdr), "%08x", cons->buffer_len - pos - 9);
+			memcpy (cons->buffer + pos, hdr, 8);
+		}
+	} else {
+		char *res = r_core_cmd_str (core, cstr);
+		int len = res? strlen (res): 0;
+		r_cons_printf ("%08x\n", len);
+		r_cons_memcat (res, len);
+		free (res);
+	}
+	free (tpl);
+}
+
 R_API int r_core_cmd(RCore *core, const char *cstr, int log) {
 	char *cmd, *ocmd, *ptr, *rcmd;
+	bool multiline;
 	int ret = false, i;
 
 	r_th_lock_enter (core->lock);
@@ -3119,6 +3554,14 @@ R_API int r_core_cmd(RCore *core, const char *cstr, int log) {
 	if (core->incomment) {
 		goto beach; // false
 	}
+	if (*cstr == '[') {
+		RList *cmds = r_core_cmd_batch_parse (cstr);
+		if (cmds) {
+			ret = r_core_cmd_batch (core, cmds);
+			r_list_free (cmds);
+			goto beach;
+		}
+	}
 	if (log && (*cstr && (*cstr != '.' || !strncmp (cstr, ".(", 2)))) {
 		free (core->lastcmd);
 		core->lastcmd = strdup (cstr);
@@ -3142,6 +3585,11 @@ R_API int r_core_cmd(RCore *core, const char *cstr, int log) {
 		goto beach;
 	}
 	core->cmd_depth--;
+	/* later lines may grep what the first ones print, see r_cons_grep_stream_begin */
+	multiline = strchr (cmd, '\n') != NULL;
+	if (multiline) {
+		(void)r_cons_grep_stream_begin (NULL, false);
+	}
 	for (rcmd = cmd;;) {
 		ptr = strchr (rcmd, '\n');
 		if (ptr) {
@@ -3157,6 +3605,9 @@ R_API int r_core_cmd(RCore *core, const char *cstr, int log) {
 		}
 		rcmd = ptr + 1;
 	}
+	if (multiline) {
+		r_cons_grep_stream_end (r_cons_singleton ()->stream_grep);
+	}
 	r_th_lock_leave (core->lock);
 	/* run pending analysis commands */
 	if (core && core->anal && core->anal->cmdtail) {
@@ -3401,6 +3852,7 @@ R_API char *r_core_cmd_str(RCore *core, const char *cmd) {
 	r_cons_push ();
 	if (r_core_cmd (core, cmd, 0) == -1) {
 		//eprintf ("Invalid command: %s\n", cmd);
+		r_cons_pop ();
 		return NULL;
 	}
 	r_cons_filter ();
@@ -3410,6 +3862,127 @@ R_API char *r_core_cmd_str(RCore *core, const char *cmd) {
 	return retstr;
 }
 
+/* run every command of the list capturing its output separately. the
+ * reply is "<length>\n<output>" for each command, in order, so r2pipe
+ * clients can pay one round-trip for many small queries */
+R_API int r_core_cmd_batch(RCore *core, RList *cmds) {
+	RCons *cons = r_cons_singleton ();
+	RListIter *iter;
+	char *cmd, *res;
+	int len;
+
+	r_cons_push ();
+	r_list_foreach (cmds, iter, cmd) {
+		cmd_batch_run (core, cmd);
+	}
+	len = cons->buffer_len;
+	res = len > 0? r_mem_dup (cons->buffer, len): NULL;
+	r_cons_pop ();
+	if (res) {
+		r_cons_memcat (res, len);
+		free (res);
+	}
+	return true;
+}
+
+/* in place, the string can only shrink */
+static bool json_unescape(char *s) {
+	char *d = s;
+	for (; *s; s++) {
+		if (*s != '\\') {
+			*d++ = *s;
+			continue;
+		}
+		switch (*++s) {
+		case 'n': *d++ = '\n'; break;
+		case 't': *d++ = '\t'; break;
+		case 'r': *d++ = '\r'; break;
+		case 'b': *d++ = '\b'; break;
+		case 'f': *d++ = '\f'; break;
+		case 'u': {
+			RRune ch = 0;
+			ut8 nib;
+			int i;
+			for (i = 1; i < 5; i++) {
+				nib = 0;
+				if (!s[i] || r_hex_to_byte (&nib, s[i])) {
+					return false;
+				}
+				ch = (ch << 4) | nib;
+			}
+			/* \u0000 would cut the command, utf-8 is never longer
+			 * than the 6 chars of the escape */
+			if (!ch) {
+				return false;
+			}
+			d += r_utf8_encode ((ut8 *)d, ch);
+			s += 4;
+			break;
+		}
+		case 0:
+			return false;
+		default:
+			*d++ = *s;
+			break;
+		}
+	}
+	*d = 0;
+	return true;
+}
+
+/* parses a json array of strings: ["pdj 1 @ 0x100","axtj @ 0x200"].
+ * returns NULL when the line is anything else, which r_core_cmd then
+ * runs as a regular command */
+R_API RList *r_core_cmd_batch_parse(const char *json) {
+	RList *cmds = r_list_newf (free);
+	const char *p = r_str_trim_const (json);
+	const char *q;
+	char *cmd;
+
+	if (!cmds || *p++ != '[') {
+		goto fail;
+	}
+	p = r_str_trim_const (p);
+	if (*p == ']') {
+		goto end;
+	}
+	for (;;) {
+		if (*p++ != '"') {
+			goto fail;
+		}
+		for (q = p; *q && *q != '"'; q++) {
+			if (*q == '\\' && q[1]) {
+				q++;
+			}
+		}
+		if (*q != '"') {
+			goto fail;
+		}
+		cmd = r_str_ndup (p, q - p);
+		if (!cmd || !json_unescape (cmd)) {
+			free (cmd);
+			goto fail;
+		}
+		r_list_append (cmds, cmd);
+		p = r_str_trim_const (q + 1);
+		if (*p == ']') {
+			break;
+		}
+		if (*p++ != ',') {
+			goto fail;
+		}
+		p = r_str_trim_const (p);
+	}
+end:
+	/* nothing but blanks can follow the array */
+	if (!*r_str_trim_const (p + 1)) {
+		return cmds;
+	}
+fail:
+	r_list_free (cmds);
+	return NULL;
+}
+
 R_API void r_core_cmd_repeat(RCore *core, int next) {
 	// Fix for backtickbug px`~`
 	if (!core->lastcmd || core->cmd_depth < 1) {
@@ -1948,7 +1948,7 @@ static bool fcnNeedsPrefix(const char *name) {
 
 /* TODO: move into r_anal_fcn_rename(); */
 static bool setFunctionName(RCore *core, ut64 off, const char *_name, bool prefix) {
-	char *name, *oname, *nname = NULL;
+	char *name, *nname = NULL;
 	RAnalFunction *fcn;
 	if (!core || !_name) {
 		return false;
@@ -1972,14 +1972,12 @@ static bool setFunctionName(RCore *core, ut64 off, const char *_name, bool prefi
 	} else {
 		nname = strdup (name);
 	}
-	oname = fcn->name;
 	r_flag_rename (core->flags, r_flag_get (core->flags, fcn->name), nname);
-	fcn->name = strdup (nname);
+	r_anal_fcn_set_name (fcn, nname);
 	if (core->anal->cb.on_fcn_rename) {
 		core->anal->cb.on_fcn_rename (core->anal,
 					core->anal->user, fcn, nname);
 	}
-	free (oname);
 	free (nname);
 	free (name);
 	return true;
@@ -6090,6 +6088,14 @@ static int cmd_anal_all(RCore *core, const char *input) {
 			r_cons_println ("Usage: See aa? for more help");
 		} else {
 			ut64 curseek = core->offset;
+			int level = *input? (input[1] == 'a'? 2: 1): 0;
+			bool acache = r_config_get_i (core->config, "anal.cache");
+			const char *cached = sdb_const_get (core->sdb, "anal.cache.level", 0);
+			if (acache && cached && *cached && r_num_get (NULL, cached) >= level) {
+				rowlog (core, "Analysis restored from anal.cache");
+				rowlog_done (core);
+				break;
+			}
 			rowlog (core, "Analyze all flags starting with sym. and entry0 (aa)");
 			r_cons_break_push (NULL, NULL);
 			r_cons_break_timeout (r_config_get_i (core->config, "anal.timeout"));
@@ -6175,6 +6181,9 @@ static int cmd_anal_all(RCore *core, const char *input) {
 			r_core_seek (core, curseek, 1);
 		jacuzzi:
 			flag_every_function (core);
+			if (acache && !r_cons_is_breaked () && r_core_anal_cache_save (core, level)) {
+				sdb_num_set (core->sdb, "anal.cache.level", level, 0);
+			}
 			r_cons_break_pop ();
 			R_FREE (dh_orig);
 		}
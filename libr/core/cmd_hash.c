@@ -6,183 +6,78 @@
 #include "r_hash.h"
 #include "r_types_base.h"
 
-typedef void (*HashHandler)(const ut8 *block, int len);
-
-static void handle_md4 (const ut8 *block, int len);
-static void handle_md5 (const ut8 *block, int len);
-static void handle_sha1 (const ut8 *block, int len);
-static void handle_sha256 (const ut8 *block, int len);
-static void handle_sha512 (const ut8 *block, int len);
-static void handle_adler32 (const ut8 *block, int len);
-static void handle_xor (const ut8 *block, int len);
-static void handle_entropy (const ut8 *block, int len);
-static void handle_hamdist (const ut8 *block, int len);
-static void handle_parity (const ut8 *block, int len);
-static void handle_pcprint (const ut8 *input, int len);
-static void handle_mod255 (const ut8 *input, int len);
-static void handle_luhn (const ut8 *input, int len);
-static void handle_crc8_smbus (const ut8 *block, int len);
-static void handle_crc15_can (const ut8 *block, int len);
-static void handle_crc16 (const ut8 *block, int len);
-static void handle_crc16_hdlc (const ut8 *block, int len);
-static void handle_crc16_usb (const ut8 *block, int len);
-static void handle_crc16_citt (const ut8 *block, int len);
-static void handle_crc24 (const ut8 *block, int len);
-static void handle_crc32 (const ut8 *block, int len);
-static void handle_crc32c (const ut8 *block, int len);
-static void handle_crc32_ecma_267 (const ut8 *block, int len);
-
-typedef struct {
-	const char *name;
-	HashHandler handler;
-} RHashHashHandlers;
-
-static RHashHashHandlers hash_handlers[] = {
-	{"md4", handle_md4},
-	{"md5", handle_md5},
-	{"sha1", handle_sha1},
-	{"sha256", handle_sha256},
-	{"sha512", handle_sha512},
-	{"adler32", handle_adler32},
-	{"xor", handle_xor},
-	{"entropy", handle_entropy},
-	{"parity", handle_parity},
-	{"hamdist", handle_hamdist},
-	{"pcprint", handle_pcprint},
-	{"mod255", handle_mod255},
-	{"luhn", handle_luhn},
-	{"crc8smbus", handle_crc8_smbus},
-	{"crc15can", handle_crc15_can},
-	{"crc16", handle_crc16},
-	{"crc16hdlc", handle_crc16_hdlc},
-	{"crc16usb", handle_crc16_usb},
-	{"crc16citt", handle_crc16_citt},
-	{"crc24", handle_crc24},
-	{"crc32", handle_crc32},
-	{"crc32c", handle_crc32c},
-	{"crc32ecma267", handle_crc32_ecma_267},
-	{NULL, NULL},
-};
-
-static void handle_md4 (const ut8 *block, int len) {
-	int i = 0;
-	RHash *ctx = r_hash_new (true, R_HASH_MD4);
-	const ut8 *c = r_hash_do_md4 (ctx, block, len);
-	for (i=0; i<R_HASH_SIZE_MD4; i++) r_cons_printf ("%02x", c[i]);
-	r_cons_newline ();
-	r_hash_free (ctx);
-}
-
-static void handle_md5 (const ut8 *block, int len) {
-	int i = 0;
-	RHash *ctx = r_hash_new (true, R_HASH_MD5);
-	const ut8 *c = r_hash_do_md5 (ctx, block, len);
-	for (i=0; i<R_HASH_SIZE_MD5; i++) r_cons_printf ("%02x", c[i]);
-	r_cons_newline ();
-	r_hash_free (ctx);
-}
-
-static void handle_sha1 (const ut8 *block, int len) {
-	int i = 0;
-	RHash *ctx = r_hash_new (true, R_HASH_SHA1);
-	const ut8 *c = r_hash_do_sha1 (ctx, block, len);
-	for (i=0; i<R_HASH_SIZE_SHA1; i++) r_cons_printf ("%02x", c[i]);
-	r_cons_newline ();
-	r_hash_free (ctx);
-}
-
-static void handle_sha256 (const ut8 *block, int len) {
-	int i = 0;
-	RHash *ctx = r_hash_new (true, R_HASH_SHA256);
-	const ut8 *c = r_hash_do_sha256 (ctx, block, len);
-	for (i=0; i<R_HASH_SIZE_SHA256; i++) r_cons_printf ("%02x", c[i]);
-	r_cons_newline ();
-	r_hash_free (ctx);
-}
-
-static void handle_sha512 (const ut8 *block, int len) {
-	int i = 0;
-	RHash *ctx = r_hash_new (true, R_HASH_SHA512);
-	const ut8 *c = r_hash_do_sha512 (ctx, block, len);
-	for (i = 0; i < R_HASH_SIZE_SHA512; i++) r_cons_printf ("%02x", c[i]);
-	r_cons_newline ();
-	r_hash_free (ctx);
-}
-
-static void handle_adler32 (const ut8 *block, int len) {
-	ut32 hn = r_hash_adler32 (block, len);
-	ut8 *b = (ut8*)&hn;
-	r_cons_printf ("%02x%02x%02x%02x\n", b[0], b[1], b[2], b[3]);
-}
-
-static void handle_xor (const ut8 *block, int len) {
-	r_cons_printf ("%02x\n", r_hash_xor (block, len));
-}
-
-static void handle_entropy (const ut8 *block, int len) {
-	r_cons_printf ("%f\n", r_hash_entropy (block, len));
-}
-
-static void handle_parity (const ut8 *block, int len) {
-	r_cons_printf ("%d\n", r_hash_parity (block, len)?1:0);
-}
-
-static void handle_hamdist (const ut8 *block, int len) {
-	r_cons_printf ("%02x\n", r_hash_hamdist (block, len));
-}
-
-static void handle_pcprint (const ut8 *block, int len) {
-	r_cons_printf ("%d\n", r_hash_pcprint (block, len));
-	//r_cons_printf ("%02x\n", r_hash_pcprint (block, len));
-}
-
-static void handle_mod255 (const ut8 *block, int len) {
-	r_cons_printf ("%d\n", r_hash_mod255 (block, len));
-	//r_cons_printf ("%02x\n", r_hash_pcprint (block, len));
-}
-
-static void handle_luhn (const ut8 *block, int len) {
-	r_cons_printf ("%d\n", r_hash_luhn (block, len));
-}
-
-static void handle_crc8_smbus (const ut8 *block, int len) {
-	r_cons_printf ("%02x\n", r_hash_crc_preset (block, len, CRC_PRESET_8_SMBUS));
-}
-
-static void handle_crc15_can (const ut8 *block, int len) {
-	r_cons_printf ("%04x\n", r_hash_crc_preset (block, len, CRC_PRESET_15_CAN));
-}
-
-static void handle_crc16 (const ut8 *block, int len) {
-	r_cons_printf ("%04x\n", r_hash_crc_preset (block, len, CRC_PRESET_16));
-}
-
-static void handle_crc16_hdlc (const ut8 *block, int len) {
-	r_cons_printf ("%04x\n", r_hash_crc_preset (block, len, CRC_PRESET_16_HDLC));
-}
-
-static void handle_crc16_usb (const ut8 *block, int len) {
-	r_cons_printf ("%04x\n", r_hash_crc_preset (block, len, CRC_PRESET_16_USB));
-}
-
-static void handle_crc16_citt (const ut8 *block, int len) {
-	r_cons_printf ("%04x\n", r_hash_crc_preset (block, len, CRC_PRESET_16_CITT));
-}
-
-static void handle_crc24 (const ut8 *block, int len) {
-	r_cons_printf ("%06x\n", r_hash_crc_preset (block, len, CRC_PRESET_24));
-}
-
-static void handle_crc32 (const ut8 *block, int len) {
-	r_cons_printf ("%08x\n", r_hash_crc_preset (block, len, CRC_PRESET_32));
-}
-
-static void handle_crc32c (const ut8 *block, int len) {
-	r_cons_printf ("%08x\n", r_hash_crc_preset (block, len, CRC_PRESET_32C));
+/* print one result of a RHashMulti */
+static void handle_multi_algo (RHashMultiAlgo *a, bool show_name) {
+	int i;
+	if (show_name) {
+		r_cons_printf ("%s ", r_hash_name (a->bit));
+	}
+	switch (a->bit) {
+	case R_HASH_MD4:
+	case R_HASH_MD5:
+	case R_HASH_SHA1:
+	case R_HASH_SHA256:
+	case R_HASH_SHA384:
+	case R_HASH_SHA512:
+		for (i = 0; i < a->dlen; i++) {
+			r_cons_printf ("%02x", a->ctx->digest[i]);
+		}
+		r_cons_newline ();
+		break;
+	case R_HASH_ENTROPY:
+		r_cons_printf ("%f\n", a->entropy);
+		break;
+	case R_HASH_PARITY:
+	case R_HASH_PCPRINT:
+	case R_HASH_MOD255:
+	case R_HASH_LUHN:
+		r_cons_printf ("%d\n", (int)a->value);
+		break;
+	case R_HASH_ADLER32:
+		{
+			ut32 hn = (ut32)a->value;
+			ut8 *b = (ut8*)&hn;
+			r_cons_printf ("%02x%02x%02x%02x\n", b[0], b[1], b[2], b[3]);
+		}
+		break;
+	default:
+		r_cons_printf ("%0*"PFMT64x"\n", a->dlen * 2, a->value);
+		break;
+	}
 }
 
-static void handle_crc32_ecma_267 (const ut8 *block, int len) {
-	r_cons_printf ("%08x\n", r_hash_crc_preset (block, len, CRC_PRESET_32_ECMA_267));
+/* hash len bytes at addr with all the given algorithms, reading the
+ * data once in blocksize chunks instead of growing the block */
+static bool cmd_hash_multi (RCore *core, ut64 algobits, ut64 addr, ut64 len, bool show_name) {
+	RHashMulti *hm = r_hash_multi_new (algobits);
+	int i, bs = core->blocksize;
+	ut8 *buf;
+	ut64 at;
+	if (!hm) {
+		return false;
+	}
+	buf = malloc (bs);
+	if (!buf) {
+		r_hash_multi_free (hm);
+		return false;
+	}
+	r_cons_break_push (NULL, NULL);
+	for (at = 0; at < len; at += bs) {
+		int n = (int)R_MIN (len - at, bs);
+		if (r_cons_is_breaked ()) {
+			break;
+		}
+		r_io_read_at (core->io, addr + at, buf, n);
+		r_hash_multi_update (hm, buf, n);
+	}
+	r_cons_break_pop ();
+	r_hash_multi_end (hm);
+	for (i = 0; i < hm->count; i++) {
+		handle_multi_algo (&hm->algos[i], show_name);
+	}
+	r_hash_multi_free (hm);
+	free (buf);
+	return true;
 }
 
 static int cmd_hash_bang (RCore *core, const char *input) {
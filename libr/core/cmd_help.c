@@ -24,6 +24,7 @@ static const char *help_msg_root[] = {
 	"%var", "=value", "Alias for 'env' command",
 	"*", "[?] off[=[0x]value]", "Pointer read/write data/values (see ?v, wx, wv)",
 	"(macro arg0 arg1)",  "", "Manage scripting macros",
+	"[\"cmd\",..]", "", "Run a batch of commands, each output prefixed by its %08x length",
 	".", "[?] [-|(m)|f|!sh|cmd]", "Define macro or load r2, cparse or rlang file",
 	"=","[?] [cmd]", "Send/Listen for Remote Commands (rap://, http://, <fd>)",
 	"/","[?]", "Search for bytes, regexps, patterns, ..",
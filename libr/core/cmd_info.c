@@ -532,13 +532,6 @@ static int cmd_info(void *data, const char *input) {
 				char *filename;
 
 				switch (input[2]) {
-				case ' ':
-					r_core_cmdf (core, ".idpi* %s", input + 3);
-					while (input[2]) input++;
-					break;
-				case '\0':
-					r_core_cmd0 (core, ".idpi*");
-					break;
 				case 'd':
 					pdbopts.user_agent = (char*) r_config_get (core->config, "pdb.useragent");
 					pdbopts.symbol_server = (char*) r_config_get (core->config, "pdb.server");
@@ -549,6 +542,11 @@ static int cmd_info(void *data, const char *input) {
 					}
 					input++;
 					break;
+				case ' ':
+				case '\0':
+					// same as ".idpi*", without going through the commands
+					mode = R_CORE_BIN_SET;
+					/* fallthrough */
 				case 'i':
 					info = r_bin_get_info (core->bin);
 					file_found = false;
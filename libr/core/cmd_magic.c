@@ -169,6 +169,126 @@ seek_exit:
 	return ret;
 }
 
+#if !USE_LIB_MAGIC
+#define CARVE_CHUNK (1024 * 1024)
+/* smallest part of the range worth a worker of its own */
+#define CARVE_SLICE_MIN (64 * 1024)
+
+typedef struct {
+	const char *file;
+	RMagic *ms;
+	RMagicFilter *f;
+	ut8 *buf;
+	ut8 *hits;
+	int look;
+	ut64 from;
+	ut64 to;
+	ut64 marked;
+	int ret;
+} MagicCarve;
+
+/* scans the slice k of n of the range. the workers are forked copies of
+ * r2, so each one has its own RMagic and buffers */
+static void magic_carve_slice(RCore *core, int k, int n, void *user) {
+	MagicCarve *mc = user;
+	ut64 slice = (mc->to - mc->from) / n;
+	ut64 from = mc->from + slice * k;
+	ut64 to = (k + 1 == n)? mc->to: from + slice;
+	int i, len, align = core->search->align;
+	ut64 at;
+	for (at = from; at < to && !r_cons_is_breaked (); at += len) {
+		len = (int)R_MIN (CARVE_CHUNK, to - at);
+		eprintf ("0x%08"PFMT64x"\r", at);
+		(void)r_io_read_at (core->io, at, mc->buf, len + mc->look);
+		mc->marked += r_magic_filter_scan (mc->f, mc->buf, len + mc->look, mc->hits, len);
+		for (i = 0; i < len; i++) {
+			const char *str;
+			if (align > 1 && (at + i) % align) {
+				continue;
+			}
+			str = mc->hits[i]
+				? r_magic_buffer (mc->ms, mc->buf + i, core->blocksize)
+				: r_magic_filter_buffer (mc->f, mc->buf + i, core->blocksize);
+			if (!str || !strcmp (str, "data")) {
+				continue;
+			}
+			if (r_core_magic_at (core, mc->file, at + i, 99, false) == -1) {
+				mc->ret = -1;
+				return;
+			}
+			core_jobs_yield ();
+		}
+	}
+}
+
+/* /m reads the range in chunks and marks the offsets where a rule with
+ * a fixed signature can match, the rest only go through the rules that
+ * have none. the offsets that give something are then handled by
+ * r_core_magic_at like before. the range is split among cmd.jobs workers
+ * and the hits are printed in address order */
+static int r_core_magic_carve(RCore *core, const char *file, ut64 from, ut64 to) {
+	MagicCarve mc = { file, NULL, NULL, NULL, NULL, 0, from, to, 0, 0 };
+	const char *path = file;
+	int nproc = r_config_get_i (core->config, "cmd.jobs");
+
+	if (path && *path == ' ') {
+		path++;
+	}
+	if (!path || !*path) {
+		path = r_config_get (core->config, "dir.magic");
+	}
+	mc.ms = r_magic_new (0);
+	if (!mc.ms || r_magic_load (mc.ms, path) == -1) {
+		eprintf ("failed r_magic_load (\"%s\") %s\n", path, r_magic_error (mc.ms));
+		r_magic_free (mc.ms);
+		return -1;
+	}
+	mc.f = r_magic_filter_new (mc.ms);
+	mc.look = mc.f? R_MAX ((int)mc.f->lookahead, core->blocksize): 0;
+	mc.buf = malloc (CARVE_CHUNK + mc.look);
+	mc.hits = malloc (CARVE_CHUNK);
+	if (!mc.f || !mc.buf || !mc.hits) {
+		mc.ret = -1;
+		goto beach;
+	}
+	if (nproc < 1) {
+		nproc = r_th_ncpus ();
+	}
+	nproc = (int)R_MAX (R_MIN ((ut64)nproc, (to - from) / CARVE_SLICE_MIN), 1);
+	core_jobs_run (core, nproc, magic_carve_slice, &mc);
+	if (r_config_get_i (core->config, "scr.interactive")) {
+		eprintf ("%d signatures, %d rules without one", mc.f->nsigs, mc.f->nrest);
+		if (nproc == 1) {
+			eprintf (", %"PFMT64d" of %"PFMT64d" offsets tried with all the rules",
+				mc.marked, to - from);
+		}
+		eprintf ("\n");
+	}
+beach:
+	r_magic_filter_free (mc.f);
+	r_magic_free (mc.ms);
+	free (mc.buf);
+	free (mc.hits);
+	return mc.ret;
+}
+#else
+static int r_core_magic_carve(RCore *core, const char *file, ut64 from, ut64 to) {
+	ut64 addr;
+	for (addr = from; addr < to; addr++) {
+		int ret;
+		if (r_cons_is_breaked ()) {
+			break;
+		}
+		ret = r_core_magic_at (core, file, addr, 99, false);
+		if (ret == -1) {
+			return -1;
+		}
+		addr += ret - 1;
+	}
+	return 0;
+}
+#endif
+
 static void r_core_magic(RCore *core, const char *file, int v) {
 	ut64 addr = core->offset;
 	magicdepth = r_config_get_i (core->config, "magic.depth"); // TODO: do not use global var here
@@ -170,11 +170,25 @@ static int remove_meta_fileline(RCore *core, const char *file_line) {
 
 static int print_meta_fileline(RCore *core, const char *file_line) {
 	char *meta_info = sdb_get (core->bin->cur->sdb_addrinfo, file_line, 0);
+	const RBinDwarfLines *lt = core->bin->cur->dwarf_lines;
+	const char *sep = strchr (file_line, '|');
 	if (meta_info) {
 		r_cons_printf ("Meta info %s\n", meta_info);
-	} else {
-		r_cons_printf ("No meta info for %s found\n", file_line);
+		free (meta_info);
+		return 0;
+	}
+	if (lt && sep) {
+		int line = atoi (sep + 1);
+		size_t i, len = sep - file_line;
+		for (i = 0; i < lt->count; i++) {
+			const RBinDwarfLine *row = &lt->rows[i];
+			if (row->line == line && !strncmp (row->file, file_line, len) && !row->file[len]) {
+				r_cons_printf ("Meta info 0x%"PFMT64x"\n", row->address);
+				return 0;
+			}
+		}
 	}
+	r_cons_printf ("No meta info for %s found\n", file_line);
 	return 0;
 }
 
@@ -197,6 +211,18 @@ static int print_addrinfo (void *user, const char *k, const char *v) {
 	return true;
 }
 
+/* the rows of .debug_line are kept apart from the ones added with CL */
+static void print_dwarf_lines(const RBinDwarfLines *lt) {
+	size_t i;
+	for (i = 0; lt && i < lt->count; i++) {
+		const RBinDwarfLine *row = &lt->rows[i];
+		if (!row->address || (i && row->address == lt->rows[i - 1].address)) {
+			continue;
+		}
+		r_cons_printf ("CL %s:%d 0x%"PFMT64x"\n", row->file, row->line, row->address);
+	}
+}
+
 static int cmd_meta_add_fileline(Sdb *s, char *fileline, ut64 offset) {
 	char aoffset[64];
 	char *aoffsetptr = sdb_itoa (offset, aoffset, 16);
@@ -239,8 +265,11 @@ static int cmd_meta_lineinfo(RCore *core, const char *input) {
 	if (all) {
 		if (remove) {
 			sdb_reset (core->bin->cur->sdb_addrinfo);
+			r_bin_dwarf_lines_free (core->bin->cur->dwarf_lines);
+			core->bin->cur->dwarf_lines = NULL;
 		} else {
 			sdb_foreach (core->bin->cur->sdb_addrinfo, print_addrinfo, NULL);
+			print_dwarf_lines (core->bin->cur->dwarf_lines);
 		}
 		return 0;
 	}
@@ -93,6 +93,7 @@ static const char *help_msg_at_at[] = {
 	"x", " @@s:from to step", "run 'x' on all offsets from, to incrementing by step",
 	"x", " @@c:cmd", "the same as @@=`` without the backticks",
 	"x", " @@=`pdf~call[0]`", "run 'x' at every call offset of the current function",
+	"x", " @@!f", "run the 'x' of any of the above in cmd.jobs forked processes",
 	// TODO: Add @@k sdb-query-expression-here
 	NULL
 };
@@ -114,7 +115,7 @@ static const char *help_msg_p[] = {
 	"pC", "[d] [rows]", "print disassembly in columns (see hex.cols and pdi)",
 	"pd", "[?] [sz] [a] [b]", "disassemble N opcodes (pd) or N bytes (pD)",
 	"pf", "[?][.nam] [fmt]", "print formatted data (pf.name, pf.name $<expr>)",
-	"ph", "[?][=|hash] ([len])", "calculate hash for a block",
+	"ph", "[?][=|hash,..] ([len])", "calculate hashes for a block or a range",
 	"pj", "[?] [len]", "print as indented JSON",
 	"p", "[iI][df] [len]", "print N ops/bytes (f=func) (see pi? and pdi)",
 	"p", "[kK] [len]", "print key in randomart (K is for mosaic)",
@@ -2231,9 +2232,9 @@ static void algolist(int mode) {
 
 static bool cmd_print_ph(RCore *core, const char *input) {
 	char algo[128];
-	ut32 osize = 0, len = core->blocksize;
+	ut32 len = core->blocksize;
 	const char *ptr;
-	int pos = 0, handled_cmd = false;
+	ut64 bits;
 
 	if (!*input || *input == '?') {
 		algolist (1);
@@ -2245,38 +2246,17 @@ static bool cmd_print_ph(RCore *core, const char *input) {
 	}
 	input = r_str_chop_ro (input);
 	ptr = strchr (input, ' ');
-	sscanf (input, "%31s", algo);
+	sscanf (input, "%127s", algo);
 	if (ptr && ptr[1]) { // && r_num_is_valid_input (core->num, ptr + 1)) {
 		int nlen = r_num_math (core->num, ptr + 1);
 		if (nlen > 0) {
 			len = nlen;
 		}
-		osize = core->blocksize;
-		if (nlen > core->blocksize) {
-			r_core_block_size (core, nlen);
-			if (nlen != core->blocksize) {
-				eprintf ("Invalid block size\n");
-				r_core_block_size (core, osize);
-				return false;
-			}
-			r_core_block_read (core);
-		}
-	} else if (!ptr || !*(ptr + 1)) {
-		osize = len;
-	}
-	/* TODO: Simplify this spaguetti monster */
-	while (osize > 0 && hash_handlers[pos].name) {
-		if (!r_str_ccmp (hash_handlers[pos].name, input, ' ')) {
-			hash_handlers[pos].handler (core->block, len);
-			handled_cmd = true;
-			break;
-		}
-		pos++;
 	}
-	if (osize) {
-		r_core_block_size (core, osize);
-	}
-	return handled_cmd;
+	/* every algorithm goes through r_hash_multi, which reads the io
+	 * once in blocksize chunks instead of resizing the block */
+	bits = r_hash_name_to_bits (algo);
+	return bits && cmd_hash_multi (core, bits, core->offset, len, (bits & (bits - 1)) != 0);
 }
 
 static void cmd_print_pv(RCore *core, const char *input) {
@@ -2481,6 +2461,42 @@ static ut8 *analBars(RCore *core, int type, int nblocks, int blocksize, int skip
 	return ptr;
 }
 
+typedef struct {
+	ut8 *bars;
+	int n;
+} EntropyBars;
+
+static void entropy_bar(RHashBlockMap *bm, void *user) {
+	EntropyBars *eb = user;
+	eb->bars[eb->n++] = (ut8) (256 * bm->fraction);
+}
+
+/* entropy of nblocks consecutive blocks, the range is read in big chunks
+ * instead of one read per block */
+static ut8 *entropy_bars(RCore *core, ut64 from, ut64 blocksize, int nblocks) {
+	EntropyBars eb = { calloc (1, nblocks), 0 };
+	RHashBlockMap *bm = r_hash_blockmap_new (R_HASH_ENTROPY, blocksize, 0, from, entropy_bar, &eb);
+	ut64 chunk = R_MAX (blocksize, 1024 * 1024) / blocksize * blocksize;
+	ut64 at, total = blocksize * nblocks;
+	ut8 *buf = malloc (chunk);
+	int jobs = r_config_get_i (core->config, "cmd.jobs");
+	if (!eb.bars || !bm || !buf) {
+		r_hash_blockmap_free (bm);
+		free (eb.bars);
+		free (buf);
+		return NULL;
+	}
+	bm->threads = jobs > 0? jobs: r_th_ncpus ();
+	for (at = 0; at < total; at += chunk) {
+		ut64 n = R_MIN (chunk, total - at);
+		r_core_read_at (core, from + at, buf, n);
+		r_hash_blockmap_update (bm, buf, n);
+	}
+	r_hash_blockmap_free (bm);
+	free (buf);
+	return eb.bars;
+}
+
 static void cmd_print_bars(RCore *core, const char *input) {
 	bool print_bars = false;
 	ut8 *ptr = NULL;
@@ -2627,25 +2643,11 @@ static void cmd_print_bars(RCore *core, const char *input) {
 			break;
 		case 'e': // "p=e"
 		{
-			ut8 *p;
-			int i = 0;
-			ptr = calloc (1, nblocks);
+			ptr = entropy_bars (core, from + blocksize * skipblocks, blocksize, nblocks);
 			if (!ptr) {
 				eprintf ("Error: failed to malloc memory");
 				goto beach;
 			}
-			p = malloc (blocksize);
-			if (!p) {
-				R_FREE (ptr);
-				eprintf ("Error: failed to malloc memory");
-				goto beach;
-			}
-			for (i = 0; i < nblocks; i++) {
-				ut64 off = from + (blocksize * (i + skipblocks));
-				r_core_read_at (core, off, p, blocksize);
-				ptr[i] = (ut8) (256 * r_hash_entropy_fraction (p, blocksize));
-			}
-			free (p);
 			r_print_columns (core->print, ptr, nblocks, 14);
 		}
 			break;
@@ -2723,25 +2725,11 @@ static void cmd_print_bars(RCore *core, const char *input) {
 		break;
 	case 'e': // "p=e" entropy
 	{
-		ut8 *p;
-		int i = 0;
-		ptr = calloc (1, nblocks);
+		ptr = entropy_bars (core, from + blocksize * skipblocks, blocksize, nblocks);
 		if (!ptr) {
 			eprintf ("Error: failed to malloc memory");
 			goto beach;
 		}
-		p = malloc (blocksize);
-		if (!p) {
-			R_FREE (ptr);
-			eprintf ("Error: failed to malloc memory");
-			goto beach;
-		}
-		for (i = 0; i < nblocks; i++) {
-			ut64 off = from + (blocksize * (i + skipblocks));
-			r_core_read_at (core, off, p, blocksize);
-			ptr[i] = (ut8) (256 * r_hash_entropy_fraction (p, blocksize));
-		}
-		free (p);
 		print_bars = true;
 	}
 	break;
@@ -3418,8 +3406,9 @@ static int cmd_print(void *data, const char *input) {
 		const char *p = off? strchr (input + idx, ' '): NULL;
 		if (p) {
 			l = (int) r_num_math (core->num, p + 1);
-			/* except disasm and memoryfmt (pd, pm) */
-			if (input[0] != 'd' && input[0] != 'D' && input[0] != 'm' &&
+			/* except disasm and memoryfmt (pd, pm) and hashes (ph),
+			 * which read ranges bigger than the block by themselves */
+			if (input[0] != 'd' && input[0] != 'D' && input[0] != 'm' && input[0] != 'h' &&
 				input[0] != 'a' && input[0] != 'f' && input[0] != 'i' && input[0] != 'I') {
 				int n = (st32) l; // r_num_math (core->num, input+1);
 				if (l < 0) {
@@ -3452,7 +3441,7 @@ static int cmd_print(void *data, const char *input) {
 		len = core->blocksize;
 	}
 
-	if (input[0] != 'd' && input[0] != 'm' && input[0] != 'a' && input[0] != 'f') {
+	if (input[0] != 'd' && input[0] != 'm' && input[0] != 'a' && input[0] != 'f' && input[0] != 'h') {
 		n = core->blocksize_max;
 		i = (int) n;
 		if (i != n) {
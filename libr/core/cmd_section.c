@@ -262,11 +262,7 @@ static void update_section_flag_at_with_oldname(RIOSection *s, RFlag *flags, ut6
 			continue;
 		}
 		if (!strncmp (item->name, secname, R_MIN (strlen (item->name), len))) {
-			free (item->realname);
-			item->name = strdup (sdb_fmt (-1, "section.%s", s->name));
-			r_str_chop (item->name);
-			r_name_filter (item->name, 0);
-			item->realname = item->name;
+			r_flag_rename (flags, item, sdb_fmt (-1, "section.%s", s->name));
 			break;
 		}
 	}
@@ -278,11 +274,7 @@ static void update_section_flag_at_with_oldname(RIOSection *s, RFlag *flags, ut6
 			continue;
 		}
 		if (!strncmp (item->name, secname, R_MIN (strlen (item->name), len))) {
-			free (item->realname);
-			item->name = strdup (sdb_fmt (-1, "section_end.%s", s->name));
-			r_str_chop (item->name);
-			r_name_filter (item->name, 0);
-			item->realname = item->name;
+			r_flag_rename (flags, item, sdb_fmt (-1, "section_end.%s", s->name));
 			break;
 		}
 	}
@@ -118,6 +118,7 @@ static const char *help_msg_wop[] = {
 // TODO
 static const char *help_msg_wp[] = {
 	"Usage:", "wp", "[-|r2patch-file]",
+	"wpb", " [file]", "apply a binary delta patch made with radiff2 -P",
 	"^#", "", "comments",
 	".", "", "execute command",
 	"!", "", "execute command",
@@ -844,7 +845,16 @@ static int cmd_write(void *data, const char *input) {
 		}
 		break;
 	case 'p':
-		if (input[1]=='-' || (input[1]==' ' && input[2]=='-')) {
+		if (input[1] == 'b') { // "wpb"
+			int len = 0;
+			char *data = (input[2] == ' ')? r_file_slurp (input + 3, &len): NULL;
+			if (data) {
+				r_core_patch_binary (core, (const ut8 *)data, len);
+				free (data);
+			} else {
+				eprintf ("Usage: wpb [file]\n");
+			}
+		} else if (input[1]=='-' || (input[1]==' ' && input[2]=='-')) {
 			char *out = r_core_editor (core, NULL, NULL);
 			if (out) {
 				r_core_patch (core, out);
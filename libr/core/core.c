@@ -48,6 +48,7 @@ static void r_core_free_autocomplete(RCore *core) {
 
 static int on_fcn_new(void *_anal, void* _user, RAnalFunction *fcn) {
 	RCore *core = (RCore*)_user;
+	core->fcn_changes++;
 	const char *cmd = r_config_get (core->config, "cmd.fcn.new");
 	if (cmd && *cmd) {
 		ut64 oaddr = core->offset;
@@ -61,6 +62,7 @@ static int on_fcn_new(void *_anal, void* _user, RAnalFunction *fcn) {
 
 static int on_fcn_delete (void *_anal, void* _user, RAnalFunction *fcn) {
 	RCore *core = (RCore*)_user;
+	core->fcn_changes++;
 	const char *cmd = r_config_get (core->config, "cmd.fcn.delete");
 	if (cmd && *cmd) {
 		ut64 oaddr = core->offset;
@@ -72,6 +74,12 @@ static int on_fcn_delete (void *_anal, void* _user, RAnalFunction *fcn) {
 	return 0;
 }
 
+static void on_meta_change(Sdb *s, void *user, const char *k, const char *v) {
+	RCore *core = (RCore*)user;
+	core->stats[R_CORE_STATS_STRINGS].dirty = true;
+	core->stats[R_CORE_STATS_COMMENTS].dirty = true;
+}
+
 static int on_fcn_rename(void *_anal, void* _user, RAnalFunction *fcn, const char *oname) {
 	RCore *core = (RCore*)_user;
 	const char *cmd = r_config_get (core->config, "cmd.fcn.rename");
@@ -1755,6 +1763,7 @@ R_API bool r_core_init(RCore *core) {
 	core->anal->cb.on_fcn_new = on_fcn_new;
 	core->anal->cb.on_fcn_delete = on_fcn_delete;
 	core->anal->cb.on_fcn_rename = on_fcn_rename;
+	sdb_hook (core->anal->sdb_meta, on_meta_change, core);
 	core->assembler->syscall = core->anal->syscall; // BIND syscall anal/asm
 	r_anal_set_user_ptr (core->anal, core);
 	core->anal->cb_printf = (void *) r_cons_printf;
@@ -1852,8 +1861,10 @@ R_API RCore *r_core_fini(RCore *c) {
 	r_core_task_join (c, NULL);
 	free (c->cmdqueue);
 	free (c->lastcmd);
+	ht_free (c->cmdcache);
 	free (c->block);
 	r_io_free (c->io);
+	r_core_anal_stats_fini (c);
 
 	// Check if the old num is saved. If yes, we restore it.
 	if (c->cons && c->old_num) {
@@ -2169,12 +2180,24 @@ static void rap_break (void *u) {
 	}
 }
 
+/* v2 requests go to the opened file, not to the mapped address space */
+static int rap_read_at(void *user, ut64 addr, ut8 *buf, int len) {
+	RCore *core = (RCore *)user;
+	return core->file? r_io_fd_read_at (core->io, core->file->fd, addr, buf, len): -1;
+}
+
+static int rap_write_at(void *user, ut64 addr, const ut8 *buf, int len) {
+	RCore *core = (RCore *)user;
+	return core->file? r_io_fd_write_at (core->io, core->file->fd, addr, buf, len): -1;
+}
+
 // TODO: PLEASE move into core/io/rap? */
 // TODO: use static buffer instead of mallocs all the time. it's network!
 R_API bool r_core_serve(RCore *core, RIODesc *file) {
 	ut8 cmd, flg, *ptr = NULL, buf[1024];
 	int i, pipefd = -1;
 	ut64 x;
+	RSocketRapV2 v2 = { .read_at = rap_read_at, .write_at = rap_write_at, .user = core };
 
 	RIORap *rior = (RIORap *)file->data;
 	if (!rior|| !rior->fd) {
@@ -2246,13 +2269,29 @@ reaccept:
 						goto out_of_function; //XXX: Close conection and goto accept
 					}
 				}
-				buf[0] = RMT_OPEN | RMT_REPLY;
-				r_write_be32 (buf + 1, pipefd);
-				r_socket_write (c, buf, 5);
+				if (flg & RAP_V2) {
+					r_socket_rap_v2_open_reply (buf, pipefd);
+					r_socket_write (c, buf, RAP_V2_OPEN_REPLY);
+				} else {
+					buf[0] = RMT_OPEN | RMT_REPLY;
+					r_write_be32 (buf + 1, pipefd);
+					r_socket_write (c, buf, 5);
+				}
 				r_socket_flush (c);
 				free (ptr);
 				ptr = NULL;
 				break;
+			case RAP_RMT_READ2:
+			case RAP_RMT_WRITE2:
+				if (!r_socket_rap_v2_serve (&v2, c, cmd)) {
+					eprintf ("rap: broken v2 request\n");
+					r_socket_free (c);
+					if (r_config_get_i (core->config, "rap.loop")) {
+						goto reaccept;
+					}
+					goto out_of_function;
+				}
+				break;
 			case RMT_READ:
 				r_socket_read_block (c, (ut8*)&buf, 4);
 				i = r_read_be32 (buf);
@@ -2411,6 +2450,7 @@ reaccept:
 		r_socket_free (c);
 	}
 out_of_function:
+	r_socket_rap_v2_fini (&v2);
 	r_cons_break_pop ();
 	return false;
 }
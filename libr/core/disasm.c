@@ -1803,30 +1803,21 @@ static void ds_update_ref_lines(RDisasmState *ds) {
 
 static int ds_disassemble(RDisasmState *ds, ut8 *buf, int len) {
 	RCore *core = ds->core;
-	int ret;
-	const char *info;
-	Sdb *s = core->anal->sdb_meta;
-	char key[100];
+	RAnalMetaItem *mi;
 	ut64 mt_sz = UT64_MAX;
+	int ret;
 
 	//handle meta info to fix ds->oplen
-	snprintf (key, sizeof (key) - 1, "meta.0x%"PFMT64x, ds->at);
-	info = sdb_const_get (s, key, 0);
-	if (info) {
-		for (;*info; info++) {
-			switch (*info) {
-			case R_META_TYPE_DATA:
-			case R_META_TYPE_STRING:
-			case R_META_TYPE_FORMAT:
-			case R_META_TYPE_MAGIC:
-			case R_META_TYPE_HIDE:
-				snprintf (key, sizeof (key) - 1,
-						"meta.%c.0x%"PFMT64x, *info, ds->at);
-				sdb_const_get (s, key, 0);
-				mt_sz = sdb_array_get_num (s, key, 0, 0);
-				//if (mt_sz) { break; }
-				break;
-			}
+	mi = r_meta_find (core->anal, ds->at, R_META_TYPE_ANY, R_META_WHERE_HERE);
+	if (mi) {
+		switch (mi->type) {
+		case R_META_TYPE_DATA:
+		case R_META_TYPE_STRING:
+		case R_META_TYPE_FORMAT:
+		case R_META_TYPE_MAGIC:
+		case R_META_TYPE_HIDE:
+			mt_sz = mi->size;
+			break;
 		}
 	}
 
@@ -1899,7 +1890,7 @@ static int ds_disassemble(RDisasmState *ds, ut8 *buf, int len) {
 	} else if (ds->capitalize) {
 		ds->asmop.buf_asm[0] = toupper (ds->asmop.buf_asm[0]);
 	}
-	if (info && mt_sz != UT64_MAX) {
+	if (mt_sz != UT64_MAX) {
 		ds->oplen = mt_sz;
 	}
 	return ret;
@@ -2287,30 +2278,18 @@ static bool ds_print_data_type(RDisasmState *ds, const ut8 *buf, int ib, int siz
 
 static int ds_print_meta_infos(RDisasmState *ds, ut8* buf, int len, int idx) {
 	int ret = 0;
-	const char *infos, *metas;
-	char key[100];
-	RAnalMetaItem MI, *mi = &MI;
+	RAnalMetaItem *mi;
+	RListIter *iter;
 	RCore *core = ds->core;
-	Sdb *s = core->anal->sdb_meta;
-
-	snprintf (key, sizeof (key), "meta.0x%" PFMT64x, ds->at);
-	infos = sdb_const_get (s, key, 0);
+	RList *metas = r_meta_find_list_in (core->anal, ds->at, ds->at + 1, R_META_TYPE_ANY);
 
 	ds->mi_found = false;
-	if (infos) {
-		for (; *infos; infos++) {
-			if (*infos == ',') {
+	if (metas) {
+		r_list_foreach (metas, iter, mi) {
+			// TODO: show the metas that start before ds->at too
+			if (mi->from != ds->at) {
 				continue;
 			}
-			snprintf (key, sizeof (key), "meta.%c.0x%" PFMT64x, *infos, ds->at);
-			metas = sdb_const_get (s, key, 0);
-			if (!metas) {
-				continue;
-			}
-			if (!r_meta_deserialize_val (mi, *infos, ds->at, metas)) {
-				continue;
-			}
-			// TODO: implement ranged meta find (if not at the begging of function..
 			char *out = NULL;
 			int hexlen;
 			int delta;
@@ -2366,11 +2345,13 @@ static int ds_print_meta_infos(RDisasmState *ds, ut8* buf, int len, int idx) {
 					ds->mi_found = true;
 					break;
 				case R_META_TYPE_RUN:
-					r_core_cmdf (core, "%s @ 0x%"PFMT64x, mi->str, ds->at);
+					/* the command can change the metas here */
 					ds->asmop.size = mi->size;
 					ds->oplen = mi->size;
 					ds->mi_found = true;
-					break;
+					r_core_cmdf (core, "%s @ 0x%"PFMT64x, mi->str, ds->at);
+					r_list_free (metas);
+					return ret;
 				case R_META_TYPE_DATA:
 					hexlen = len - idx;
 					delta = ds->at - mi->from;
@@ -2403,11 +2384,8 @@ static int ds_print_meta_infos(RDisasmState *ds, ut8* buf, int len, int idx) {
 					break;
 				}
 			}
-			if (MI.str) {
-				free (MI.str);
-				MI.str = NULL;
-			}
 		}
+		r_list_free (metas);
 	}
 	return ret;
 }
@@ -3637,22 +3615,13 @@ static char * resolve_fcn_name(RAnal *anal, const char * func_name) {
 }
 
 static bool can_emulate_metadata(RCore * core, ut64 at) {
-	const char *infos;
 	const char *emuskipmeta = r_config_get (core->config, "asm.emuskip");
-	char key[32];
-	Sdb *s = core->anal->sdb_meta;
-	snprintf (key, sizeof (key)-1, "meta.0x%"PFMT64x, at);
-	infos = sdb_const_get (s, key, 0);
-	if (!infos) {
-		/* no metadata: let's emulate this */
-		return true;
-	}
-	for (; *infos; infos++) {
-		/*
-		 * don't emulate if at least one metadata type
-		 * can't be emulated
-		 */
-		if (*infos != ',' && strchr(emuskipmeta, *infos)) {
+	/*
+	 * don't emulate if at least one metadata type
+	 * can't be emulated
+	 */
+	for (; emuskipmeta && *emuskipmeta; emuskipmeta++) {
+		if (r_meta_find (core->anal, at, *emuskipmeta, R_META_WHERE_HERE)) {
 			return false;
 		}
 	}
@@ -4401,8 +4370,43 @@ toro:
 /* Disassemble either `nb_opcodes` instructions, or
  * `nb_bytes` bytes; both can be negative.
  * Set to 0 the parameter you don't use */
+/* pi decodes ahead with r_asm_disassemble_batch, the ops are handed out
+ * while the loop walks them in order and nothing changed the decoder */
+typedef struct {
+	RAsmBatch *ab;
+	int idx;
+	RAsmPlugin *cur;
+	int bits;
+	int syntax;
+} DisasmSweep;
+
+static int ds_sweep_disassemble(RDisasmState *ds, DisasmSweep *sw, const ut8 *buf, int len, int max) {
+	RAsm *a = ds->core->assembler;
+	RAsmBatchOp *op;
+	if (!sw->ab || ds->hint) {
+		return r_asm_disassemble (a, &ds->asmop, buf, len);
+	}
+	if (sw->idx >= sw->ab->count || sw->ab->ops[sw->idx].addr != ds->at
+			|| sw->cur != a->cur || sw->bits != a->bits || sw->syntax != a->syntax) {
+		r_asm_batch_reset (sw->ab);
+		sw->idx = 0;
+		sw->cur = a->cur;
+		sw->bits = a->bits;
+		sw->syntax = a->syntax;
+		r_asm_disassemble_batch (a, sw->ab, buf, len, max);
+		if (!sw->ab->count) {
+			return r_asm_disassemble (a, &ds->asmop, buf, len);
+		}
+	}
+	op = &sw->ab->ops[sw->idx++];
+	r_str_ncpy (ds->asmop.buf_asm, r_asm_batch_text (sw->ab, sw->idx - 1), sizeof (ds->asmop.buf_asm));
+	ds->asmop.size = op->size;
+	return op->type == R_ASM_BATCH_INVALID? 0: op->size;
+}
+
 R_API int r_core_print_disasm_instructions(RCore *core, int nb_bytes, int nb_opcodes) {
 	RDisasmState *ds = NULL;
+	DisasmSweep sw = {0};
 	int i, j, ret, len = 0;
 	char *tmpopstr;
 	const ut64 old_offset = core->offset;
@@ -4478,6 +4482,9 @@ R_API int r_core_print_disasm_instructions(RCore *core, int nb_bytes, int nb_opc
 		ds->l = ds->len;
 	}
 
+	if (addrbytes == 1) {
+		sw.ab = r_asm_batch_new ();
+	}
 	r_cons_break_push (NULL, NULL);
 	//build ranges to map addr with bits
 	r_anal_build_range_on_hints (core->anal);
@@ -4495,8 +4502,8 @@ R_API int r_core_print_disasm_instructions(RCore *core, int nb_bytes, int nb_opc
 		r_asm_set_pc (core->assembler, ds->at);
 		// XXX copypasta from main disassembler function
 		// r_anal_get_fcn_in (core->anal, ds->at, R_ANAL_FCN_TYPE_NULL);
-		ret = r_asm_disassemble (core->assembler, &ds->asmop,
-			core->block + addrbytes * i, core->blocksize - addrbytes * i);
+		ret = ds_sweep_disassemble (ds, &sw, core->block + addrbytes * i,
+			core->blocksize - addrbytes * i, nb_opcodes? nb_opcodes - j: 0);
 		ds->oplen = ret;
 		if (ds->midflags) {
 			int skip_bytes = handleMidFlags (core, ds, true);
@@ -4596,6 +4603,7 @@ R_API int r_core_print_disasm_instructions(RCore *core, int nb_bytes, int nb_opc
 		}
 	}
 	r_cons_break_pop ();
+	r_asm_batch_free (sw.ab);
 	ds_free (ds);
 	core->offset = old_offset;
 	r_reg_arena_pop (core->anal->reg);
@@ -4614,6 +4622,7 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 	//r_cons_printf ("[");
 	int limit_by = 'b';
 	char str[512];
+	PJ *pj;
 
 	if (nb_opcodes != 0) {
 		limit_by = 'o';
@@ -4689,6 +4698,11 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 	// i = number of bytes
 	// j = number of instructions
 	// k = delta from addr
+	pj = r_cons_pj_new ();
+	if (!pj) {
+		core->offset = old_offset;
+		return false;
+	}
 	ds = ds_init (core);
 	for (;;) {
 		bool end_nbopcodes, end_nbbytes;
@@ -4713,9 +4727,14 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 		}
 		ret = r_asm_disassemble (core->assembler, &asmop, buf + i, nb_bytes - i);
 		if (ret < 1) {
-			r_cons_printf (j > 0 ? ",{" : "{");
-			r_cons_printf ("\"offset\":%"PFMT64d, at);
-			r_cons_printf (",\"size\":1,\"type\":\"invalid\"}");
+			if (j > 0) {
+				pj_raw (pj, ",");
+			}
+			pj_o (pj);
+			pj_kn (pj, "offset", at);
+			pj_ki (pj, "size", 1);
+			pj_ks (pj, "type", "invalid");
+			pj_end (pj);
 			i++;
 			k++;
 			j++;
@@ -4757,44 +4776,35 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 		r_parse_filter (core->parser, core->flags, asmop.buf_asm, str,
 			sizeof (str), core->print->big_endian);
 
-		r_cons_printf (j > 0 ? ",{" : "{");
-		r_cons_printf ("\"offset\":%"PFMT64d, at);
+		if (j > 0) {
+			pj_raw (pj, ",");
+		}
+		pj_o (pj);
+		pj_kn (pj, "offset", at);
 		if (ds->analop.ptr != UT64_MAX) {
-			r_cons_printf (",\"ptr\":%"PFMT64d, ds->analop.ptr);
+			pj_kn (pj, "ptr", ds->analop.ptr);
 		}
 		if (ds->analop.val != UT64_MAX) {
-			r_cons_printf (",\"val\":%"PFMT64d, ds->analop.val);
+			pj_kn (pj, "val", ds->analop.val);
 		}
-		r_cons_printf (",\"esil\":\"%s\"", R_STRBUF_SAFEGET (&ds->analop.esil));
-		r_cons_printf (",\"refptr\":%s", r_str_bool (ds->analop.refptr));
+		pj_ks (pj, "esil", R_STRBUF_SAFEGET (&ds->analop.esil));
+		pj_kb (pj, "refptr", ds->analop.refptr);
 		if (f) {
-			r_cons_printf (",\"fcn_addr\":%"PFMT64d, f->addr);
-			r_cons_printf (",\"fcn_last\":%"PFMT64d, f->addr + r_anal_fcn_size (f) - oplen);
+			pj_kn (pj, "fcn_addr", f->addr);
+			pj_kn (pj, "fcn_last", f->addr + r_anal_fcn_size (f) - oplen);
 		} else {
-			r_cons_printf (",\"fcn_addr\":0");
-			r_cons_printf (",\"fcn_last\":0");
-		}
-		r_cons_printf (",\"size\":%d", ds->analop.size);
-		{
-			char *escaped_str = r_str_utf16_encode (opstr, -1);
-			if (escaped_str) {
-				r_cons_printf (",\"opcode\":\"%s\"", escaped_str);
-			}
-			free (escaped_str);
-
-			escaped_str = r_str_utf16_encode (str, -1);
-			if (escaped_str) {
-				r_cons_printf (",\"disasm\":\"%s\"", escaped_str);
-			}
-			free (escaped_str);
-		}
-		r_cons_printf (",\"bytes\":\"%s\"", asmop.buf_hex);
-		r_cons_printf (",\"family\":\"%s\"",
-				r_anal_op_family_to_string (ds->analop.family));
-		r_cons_printf (",\"type\":\"%s\"", r_anal_optype_to_string (ds->analop.type));
+			pj_kn (pj, "fcn_addr", 0);
+			pj_kn (pj, "fcn_last", 0);
+		}
+		pj_ki (pj, "size", ds->analop.size);
+		pj_ks (pj, "opcode", opstr);
+		pj_ks (pj, "disasm", str);
+		pj_ks (pj, "bytes", asmop.buf_hex);
+		pj_ks (pj, "family", r_anal_op_family_to_string (ds->analop.family));
+		pj_ks (pj, "type", r_anal_optype_to_string (ds->analop.type));
 		// wanted the numerical values of the type information
-		r_cons_printf (",\"type_num\":%"PFMT64d, ds->analop.type);
-		r_cons_printf (",\"type2_num\":%"PFMT64d, ds->analop.type2);
+		pj_kn (pj, "type_num", ds->analop.type);
+		pj_kn (pj, "type2_num", ds->analop.type2);
 		// handle switch statements
 		if (ds->analop.switch_op && r_list_length (ds->analop.switch_op->cases) > 0) {
 			// XXX - the java caseop will still be reported in the assembly,
@@ -4802,25 +4812,20 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 			// represented during the analysis
 			RListIter *iter;
 			RAnalCaseOp *caseop;
-			int cnt = r_list_length (ds->analop.switch_op->cases);
-			r_cons_printf (", \"switch\":[");
+			pj_ka (pj, "switch");
 			r_list_foreach (ds->analop.switch_op->cases, iter, caseop ) {
-				cnt--;
-				r_cons_printf ("{");
-				r_cons_printf ("\"addr\":%"PFMT64d, caseop->addr);
-				r_cons_printf (", \"value\":%"PFMT64d, (st64) caseop->value);
-				r_cons_printf (", \"jump\":%"PFMT64d, caseop->jump);
-				r_cons_printf ("}");
-				if (cnt > 0) {
-					r_cons_printf (",");
-				}
+				pj_o (pj);
+				pj_kn (pj, "addr", caseop->addr);
+				pj_kN (pj, "value", (st64) caseop->value);
+				pj_kn (pj, "jump", caseop->jump);
+				pj_end (pj);
 			}
-			r_cons_printf ("]");
+			pj_end (pj);
 		}
 		if (ds->analop.jump != UT64_MAX ) {
-			r_cons_printf (",\"jump\":%"PFMT64d, ds->analop.jump);
+			pj_kn (pj, "jump", ds->analop.jump);
 			if (ds->analop.fail != UT64_MAX) {
-				r_cons_printf (",\"fail\":%"PFMT64d, ds->analop.fail);
+				pj_kn (pj, "fail", ds->analop.fail);
 			}
 		}
 		/* add flags */
@@ -4829,11 +4834,11 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 			RFlagItem *flag;
 			RListIter *iter;
 			if (flags && !r_list_empty (flags)) {
-				r_cons_printf (",\"flags\":[");
+				pj_ka (pj, "flags");
 				r_list_foreach (flags, iter, flag) {
-					r_cons_printf ("%s\"%s\"", iter->p?",":"",flag->name);
+					pj_s (pj, flag->name);
 				}
-				r_cons_printf ("]");
+				pj_end (pj);
 			}
 		}
 		/* add comments */
@@ -4842,7 +4847,7 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 			char *comment = r_meta_get_string (core->anal, R_META_TYPE_COMMENT, at);
 			if (comment) {
 				char *b64comment = sdb_encode ((const ut8*)comment, -1);
-				r_cons_printf (",\"comment\":\"%s\"", b64comment);
+				pj_ks (pj, "comment", b64comment);
 				free (comment);
 				free (b64comment);
 			}
@@ -4853,18 +4858,19 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 			RListIter *iter;
 			RList *xrefs = r_anal_xref_get (core->anal, at);
 			if (xrefs && !r_list_empty (xrefs)) {
-				r_cons_printf (",\"xrefs\":[");
+				pj_ka (pj, "xrefs");
 				r_list_foreach (xrefs, iter, ref) {
-					r_cons_printf ("%s{\"addr\":%"PFMT64d",\"type\":\"%s\"}",
-							iter->p?",":"", ref->addr,
-						r_anal_xrefs_type_tostring (ref->type));
+					pj_o (pj);
+					pj_kn (pj, "addr", ref->addr);
+					pj_ks (pj, "type", r_anal_xrefs_type_tostring (ref->type));
+					pj_end (pj);
 				}
-				r_cons_printf ("]");
+				pj_end (pj);
 			}
 			r_list_free (xrefs);
 		}
 
-		r_cons_printf ("}");
+		pj_end (pj);
 		i += oplen + asmop.payload + (ds->asmop.payload % ds->core->assembler->dataalign); // bytes
 		k += oplen + asmop.payload + (ds->asmop.payload % ds->core->assembler->dataalign); // delta from addr
 		j++; // instructions
@@ -4878,6 +4884,7 @@ R_API int r_core_print_disasm_json(RCore *core, ut64 addr, ut8 *buf, int nb_byte
 		}
 	}
 	// r_cons_printf ("]");
+	pj_free (pj);
 	core->offset = old_offset;
 	r_anal_op_fini (&ds->analop);
 	ds_free (ds);
@@ -648,6 +648,13 @@ R_API bool r_core_bin_load(RCore *r, const char *filenameuri, ut64 baddr) {
 	if (!plugin || !strcmp (plugin->name, "any") || r_io_desc_is_dbg (desc) || (obj && (!obj->sections || !va))) {
 		r_io_map_new (r->io, desc->fd, desc->flags, 0LL, laddr, r_io_desc_size (desc), true);
 	}
+	sdb_unset (r->sdb, "anal.cache.level", 0);
+	if (r_config_get_i (r->config, "anal.cache") && !r_config_get_i (r->config, "cfg.debug")) {
+		int level = r_core_anal_cache_load (r);
+		if (level >= 0) {
+			sdb_num_set (r->sdb, "anal.cache.level", level, 0);
+		}
+	}
 	return true;
 }
 
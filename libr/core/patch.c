@@ -143,3 +143,57 @@ R_API int r_core_patch (RCore *core, const char *patch) {
 	free (p0);
 	return 0;
 }
+
+#define PATCH_CHUNK (1024 * 1024)
+
+/* applies a radiff2 -P patch to the whole current file, which is read and
+ * written through its descriptor so the maps and io.va do not matter */
+R_API bool r_core_patch_binary(RCore *core, const ut8 *patch, ut64 len) {
+	RIODesc *desc = core->file? r_io_desc_get (core->io, core->file->fd): NULL;
+	ut64 at, size, newsize = 0;
+	ut8 *a, *b;
+	int n;
+
+	if (!desc) {
+		eprintf ("No file opened\n");
+		return false;
+	}
+	if (!(desc->flags & R_IO_WRITE)) {
+		eprintf ("File is not writable, reopen it with oo+\n");
+		return false;
+	}
+	size = r_io_desc_size (desc);
+	if (!r_diff_patch_info (patch, len, NULL, NULL) || !(a = malloc (size + 1))) {
+		eprintf ("Invalid patch\n");
+		return false;
+	}
+	for (at = 0; at < size; at += n) {
+		n = (int)R_MIN (size - at, PATCH_CHUNK);
+		if (r_io_desc_read_at (desc, at, a + at, n) != n) {
+			eprintf ("Cannot read 0x%"PFMT64x"\n", at);
+			free (a);
+			return false;
+		}
+	}
+	b = r_diff_patch_apply (a, size, patch, len, &newsize);
+	free (a);
+	if (!b) {
+		return false;
+	}
+	if (newsize != size && !r_io_desc_resize (desc, newsize)) {
+		eprintf ("Cannot resize the file to %"PFMT64d" bytes\n", newsize);
+		free (b);
+		return false;
+	}
+	for (at = 0; at < newsize; at += n) {
+		n = (int)R_MIN (newsize - at, PATCH_CHUNK);
+		if (r_io_desc_write_at (desc, at, b + at, n) != n) {
+			eprintf ("Cannot write 0x%"PFMT64x"\n", at);
+			free (b);
+			return false;
+		}
+	}
+	free (b);
+	r_core_block_read (core);
+	return true;
+}
@@ -4,6 +4,9 @@
 #include "r_socket.h"
 #include "gdb/include/libgdbr.h"
 #include "gdb/include/gdbserver/core.h"
+#if __UNIX__
+#include <fcntl.h>
+#endif
 
 #if 0
 SECURITY IMPLICATIONS
@@ -392,11 +395,275 @@ static void activateDieTime (RCore *core) {
 	}
 }
 
+/* http.workers: read-only commands are answered by a forked copy of the
+ * server, which is a consistent snapshot of the core that can take as
+ * long as it needs while the server goes on. everything else still runs
+ * in the server, one request after the other, in the order they come.
+ * connections asking for it are kept alive and polled for more requests */
+typedef struct {
+	RSocket *s;
+	int pid;	// worker answering on it, 0 when it is idle
+	ut64 since;	// idle since
+} HttpConn;
+
+typedef struct {
+	HttpConn *conns;
+	int count;
+	int size;
+	int workers;
+	int busy;
+	int done[2];	// workers write their pid here when they are about to exit
+} HttpPool;
+
+/* the whole first word must be here, some commands that look like
+ * listings load or write stuff (idp, iO, pf.) */
+static const char *rtr_readonly_cmds[] = {
+	"p8", "pc", "pd", "pdf", "pdj", "pdr", "pi", "pif", "pij", "ph",
+	"ps", "psj", "psz", "pv", "pvj", "px", "pxa", "pxj", "pxq", "pxr", "pxw",
+	"i", "ij", "ic", "icj", "ie", "iej", "iE", "iEj", "ih", "ihj", "ii", "iij",
+	"iI", "iIj", "il", "ilj", "ir", "irj", "is", "isj", "iS", "iSj",
+	"iz", "izj", "izz", "izzj",
+	"?", "?e", "?v", "?vi", "?x",
+	"afl", "aflj", "afi", "afij", "axt", "axtj", "axf", "axfj", "ag", "agj",
+	"f", "fj", "f*", "s", "sj", "s*", NULL
+};
+
+/* only commands that do not change the core can run in a worker, what
+ * they do there is lost when it exits */
+static bool rtr_cmd_readonly(const char *cmd) {
+	char *str, *c, *next;
+	bool ret = true;
+	if (strpbrk (cmd, "!`>$")) {
+		return false;
+	}
+	str = strdup (cmd);
+	if (!str) {
+		return false;
+	}
+	for (c = str; c && ret; c = next) {
+		const char **r;
+		int len;
+		if ((next = strchr (c, ';'))) {
+			*next++ = 0;
+		}
+		c = (char *)r_str_trim_head (c);
+		if (!*c) {
+			continue;
+		}
+		len = strcspn (c, " @|~");
+		ret = false;
+		for (r = rtr_readonly_cmds; *r; r++) {
+			if (len == strlen (*r) && !strncmp (c, *r, len)) {
+				/* "f" and "s" are only listings without arguments */
+				ret = c[len] != ' ' || (**r != 'f' && **r != 's');
+				break;
+			}
+		}
+	}
+	free (str);
+	return ret;
+}
+
+#if __UNIX__
+static bool rtr_pool_grow(HttpPool *pool) {
+	if (pool->count == pool->size) {
+		int n = pool->size? pool->size * 2: 16;
+		HttpConn *conns = realloc (pool->conns, n * sizeof (HttpConn));
+		if (!conns) {
+			return false;
+		}
+		pool->conns = conns;
+		pool->size = n;
+	}
+	return true;
+}
+
+static bool rtr_pool_add(HttpPool *pool, RSocket *s, int pid) {
+	if (!rtr_pool_grow (pool)) {
+		return false;
+	}
+	pool->conns[pool->count].s = s;
+	pool->conns[pool->count].pid = pid;
+	pool->conns[pool->count].since = r_sys_now ();
+	pool->count++;
+	return true;
+}
+
+static void rtr_pool_del(HttpPool *pool, int i, bool close) {
+	if (close) {
+		r_socket_free (pool->conns[i].s);
+	}
+	pool->conns[i] = pool->conns[--pool->count];
+}
+
+/* collects the workers that are done, the connections they answered
+ * on become idle or are closed, as the worker said */
+static void rtr_pool_reap(HttpPool *pool, int timeout) {
+	ut64 now = r_sys_now ();
+	int i, st, pid;
+	while (read (pool->done[0], &pid, sizeof (pid)) == sizeof (pid)) {
+		/* it is exiting, this does not block for long */
+		waitpid (pid, &st, 0);
+		for (i = 0; i < pool->count; i++) {
+			HttpConn *c = &pool->conns[i];
+			if (c->pid == pid) {
+				pool->busy--;
+				c->pid = 0;
+				c->since = now;
+				if (!WIFEXITED (st) || WEXITSTATUS (st)) {
+					rtr_pool_del (pool, i, true);
+				}
+				break;
+			}
+		}
+	}
+	for (i = 0; i < pool->count; i++) {
+		HttpConn *c = &pool->conns[i];
+		if (c->pid > 0) {
+			/* killed before telling */
+			if (waitpid (c->pid, &st, WNOHANG) == c->pid) {
+				pool->busy--;
+				rtr_pool_del (pool, i--, true);
+			}
+		} else if (now - c->since > (ut64)R_MAX (timeout, 1) * 1000000) {
+			rtr_pool_del (pool, i--, true);
+		}
+	}
+}
+
+static bool rtr_pool_init(HttpPool *pool, int workers) {
+	if (workers < 1 || pipe (pool->done)) {
+		return false;
+	}
+	fcntl (pool->done[0], F_SETFL, O_NONBLOCK);
+	pool->workers = workers;
+	return true;
+}
+
+static void rtr_pool_fini(HttpPool *pool) {
+	while (pool->count > 0) {
+		if (pool->conns[0].pid > 0) {
+			waitpid (pool->conns[0].pid, NULL, 0);
+		}
+		rtr_pool_del (pool, 0, true);
+	}
+	R_FREE (pool->conns);
+	pool->size = 0;
+	pool->busy = 0;
+	if (pool->workers) {
+		close (pool->done[0]);
+		close (pool->done[1]);
+		pool->workers = 0;
+	}
+}
+
+/* the next request from a new client or from an idle connection, NULL
+ * when there is nothing after a while */
+static RSocketHTTPRequest *rtr_pool_next(HttpPool *pool, RSocket *s, int timeout) {
+	struct pollfd *fds;
+	RSocketHTTPRequest *rs = NULL;
+	int i, n = 1;
+	rtr_pool_reap (pool, timeout);
+	if (!(fds = calloc (pool->count + 2, sizeof (struct pollfd)))) {
+		return NULL;
+	}
+	fds[0].fd = s->fd;
+	fds[0].events = POLLIN;
+	fds[n].fd = pool->done[0];
+	fds[n++].events = POLLIN;
+	for (i = 0; i < pool->count; i++) {
+		if (!pool->conns[i].pid) {
+			fds[n].fd = pool->conns[i].s->fd;
+			fds[n].events = POLLIN;
+			n++;
+		}
+	}
+	if (poll (fds, n, 100) > 0) {
+		if (fds[1].revents) {
+			/* the connection can be polled now */
+			rtr_pool_reap (pool, timeout);
+		} else if (fds[0].revents & POLLIN) {
+			RSocket *c = r_socket_accept (s);
+			rs = c? r_socket_http_request (c, timeout): NULL;
+		} else {
+			for (i = 0; i < pool->count; i++) {
+				HttpConn *c = &pool->conns[i];
+				int j;
+				if (c->pid) {
+					continue;
+				}
+				for (j = 2; j < n && fds[j].fd != c->s->fd; j++) {
+				}
+				if (j < n && fds[j].revents) {
+					RSocket *cs = c->s;
+					rtr_pool_del (pool, i, false);
+					rs = r_socket_http_request (cs, timeout);
+					break;
+				}
+			}
+		}
+	}
+	free (fds);
+	return rs;
+}
+
+/* gives the request to a worker when it can go there, the connection
+ * is not usable by the caller after that */
+static bool rtr_pool_run(HttpPool *pool, RCore *core, RSocketHTTPRequest *rs, const char *cmd, const char *headers) {
+	int pid;
+	if (!pool->workers || !rtr_cmd_readonly (cmd)) {
+		return false;
+	}
+	while (pool->busy >= pool->workers) {
+		r_sys_usleep (1000);
+		rtr_pool_reap (pool, INT_MAX);
+	}
+	/* the slot is taken before forking, once the worker runs the
+	 * connection belongs to it */
+	if (!rtr_pool_grow (pool)) {
+		return false;
+	}
+	r_cons_flush ();
+	pid = r_sys_fork ();
+	if (pid < 0) {
+		return false;
+	}
+	if (!pid) {
+		char *out = r_core_cmd_str_pipe (core, cmd);
+		char *hdr = r_str_newf ("Content-Type: text/plain\n%s", headers);
+		r_socket_http_response (rs, 200, out? out: "", 0, hdr);
+		if (!rs->keepalive) {
+			r_socket_close (rs->s);
+		}
+		pid = getpid ();
+		(void)write (pool->done[1], &pid, sizeof (pid));
+		_exit (rs->keepalive? 0: 1);
+	}
+	(void)rtr_pool_add (pool, rs->s, pid);
+	rs->s = NULL;
+	pool->busy++;
+	return true;
+}
+
+/* keeps the connection of an answered request for the next ones */
+static void rtr_pool_keep(HttpPool *pool, RSocketHTTPRequest *rs) {
+	if (pool->workers && rs->s && rs->keepalive && rtr_pool_add (pool, rs->s, 0)) {
+		rs->s = NULL;
+	}
+}
+#else
+#define rtr_pool_next(p, s, t) r_socket_http_accept (s, t)
+#define rtr_pool_run(p, c, r, m, h) false
+#define rtr_pool_keep(p, r)
+#define rtr_pool_fini(p)
+#endif
+
 // return 1 on error
 static int r_core_rtr_http_run(RCore *core, int launch, const char *path) {
 	RConfig *newcfg = NULL, *origcfg = NULL;
 	char headers[128] = R_EMPTY;
 	RSocketHTTPRequest *rs;
+	HttpPool pool = {0};
 	char buf[32];
 	int ret = 0;
 	RSocket *s;
@@ -472,6 +739,9 @@ static int r_core_rtr_http_run(RCore *core, int launch, const char *path) {
 			browser, host, atoi (port), path? path:"");
 	}
 
+#if __UNIX__
+	rtr_pool_init (&pool, r_config_get_i (core->config, "http.workers"));
+#endif
 	origcfg = core->config;
 	newcfg = r_config_clone (core->config);
 	core->config = newcfg;
@@ -525,7 +795,7 @@ static int r_core_rtr_http_run(RCore *core, int launch, const char *path) {
 
 		/* this is blocking */
 		activateDieTime (core);
-		rs = r_socket_http_accept (s, timeout);
+		rs = pool.workers? rtr_pool_next (&pool, s, timeout): r_socket_http_accept (s, timeout);
 
 		origoff = core->offset;
 		origblk = core->block;
@@ -676,11 +946,15 @@ static int r_core_rtr_http_run(RCore *core, int launch, const char *path) {
 							/* commands in /cmd/: starting with : do not show any output */
 							r_core_cmd0 (core, cmd + 1);
 							out = NULL;
+						} else if (rtr_pool_run (&pool, core, rs, cmd, headers)) {
+							out = NULL;
 						} else {
 							out = r_core_cmd_str_pipe (core, cmd);
 						}
 
-						if (out) {
+						if (!rs->s) {
+							/* a worker is answering */
+						} else if (out) {
 							char *res = r_str_uri_encode (out);
 							char *newheaders = r_str_newf (
 								"Content-Type: text/plain\n%s", headers);
@@ -808,10 +1082,12 @@ static int r_core_rtr_http_run(RCore *core, int launch, const char *path) {
 		} else {
 			r_socket_http_response (rs, 404, "Invalid protocol", 0, headers);
 		}
+		rtr_pool_keep (&pool, rs);
 		r_socket_http_close (rs);
 		free (dir);
 	}
 the_end:
+	rtr_pool_fini (&pool);
 	{
 		int timeout = r_config_get_i (core->config, "http.timeout");
 		const char *host = r_config_get (core->config, "http.bind");
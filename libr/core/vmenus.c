@@ -2159,8 +2159,7 @@ static void function_rename(RCore *core, ut64 addr, const char *name) {
 	r_list_foreach (core->anal->fcns, iter, fcn) {
 		if (fcn->addr == addr) {
 			r_flag_unset_name (core->flags, fcn->name);
-			free (fcn->name);
-			fcn->name = strdup (name);
+			r_anal_fcn_set_name (fcn, name);
 			r_flag_set (core->flags, name, addr, r_anal_fcn_size (fcn));
 			break;
 		}
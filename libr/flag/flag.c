@@ -36,6 +36,86 @@ static void flag_free_kv(HtKv *kv) {
 	free (kv);
 }
 
+/* the names are interned, the table keeps a reference of each key and
+ * compares them by pointer using the hash computed when interning */
+static void flag_name_free_kv(HtKv *kv) {
+	r_strpool_intern_release (kv->key);
+	free (kv);
+}
+
+static char *flag_name_dup(void *name) {
+	return (char *)r_strpool_intern_ref (name);
+}
+
+static int flag_name_cmp(const char *a, const char *b) {
+	return a != b;
+}
+
+static size_t flag_name_size(void *name) {
+	return 0;
+}
+
+static SdbHash *flag_ht_name_new(void) {
+	SdbHash *ht = ht_new (NULL, flag_name_free_kv, NULL);
+	if (ht) {
+		ht->hashfn = (HashFunction)r_strpool_intern_hash;
+		ht->cmp = flag_name_cmp;
+		ht->dupkey = flag_name_dup;
+		ht->calcsizeK = flag_name_size;
+	}
+	return ht;
+}
+
+static RFlagItem *flag_find(RFlag *f, const char *name) {
+	const char *key = r_strpool_intern_find (name);
+	return key? ht_find (f->ht_name, key, NULL): NULL;
+}
+
+/* moves the pairs into a table of size buckets, so pointers to them
+ * stay valid. sdb has no way to resize a hashtable, this only touches
+ * the bucket array */
+static bool flag_ht_resize(SdbHash *ht, ut32 size) {
+	SdbList **table = calloc (size, sizeof (SdbList *));
+	SdbListIter *iter;
+	HtKv *kv;
+	ut32 i;
+	if (!table) {
+		return false;
+	}
+	for (i = 0; i < ht->size; i++) {
+		SdbList *list = ht->table[i];
+		if (!list) {
+			continue;
+		}
+		ls_foreach (list, iter, kv) {
+			ut32 bucket = ht->hashfn (kv->key) % size;
+			if (!table[bucket]) {
+				table[bucket] = ls_newf ((SdbListFree)ht->freefn);
+			}
+			ls_prepend (table[bucket], kv);
+		}
+		list->free = NULL;
+		ls_free (list);
+	}
+	free (ht->table);
+	ht->table = table;
+	ht->size = size;
+	return true;
+}
+
+/* the sdb hashtable has a fixed number of buckets, binaries with lots
+ * of symbols need more of them to keep the lookups short */
+static void flag_ht_fit(SdbHash *ht, ut32 count) {
+	ut32 size = ht->size;
+	if (count <= size * 2) {
+		return;
+	}
+	while (size < count) {
+		size *= 2;
+	}
+	(void)flag_ht_resize (ht, size);
+}
+
 static void flag_skiplist_free(void *data) {
 	RFlagsAtOffset *item = (RFlagsAtOffset *)data;
 	r_list_free (item->flags);
@@ -56,7 +136,7 @@ static ut64 num_callback(RNum *user, const char *name, int *ok) {
 	if (ok) {
 		*ok = 0;
 	}
-	item = ht_find (f->ht_name, name, NULL);
+	item = flag_find (f, name);
 	if (item) {
 		// NOTE: to avoid warning infinite loop here we avoid recursivity
 		if (item->alias) {
@@ -100,17 +180,22 @@ static void remove_offsetmap(RFlag *f, RFlagItem *item) {
 }
 
 static int set_name(RFlagItem *item, const char *name) {
-	if (item->name != item->realname) {
-		free (item->name);
+	const char *s;
+	char *n = strdup (name);
+	if (!n) {
+		return false;
 	}
-	item->name = strdup (name);
-	if (!item->name) {
+	r_str_chop (n);
+	r_name_filter (n, 0); // TODO: name_filter should be chopping already
+	s = r_strpool_intern (n);
+	free (n);
+	if (!s) {
 		return false;
 	}
-	r_str_chop (item->name);
-	r_name_filter (item->name, 0); // TODO: name_filter should be chopping already
-	free (item->realname);
-	item->realname = item->name;
+	r_strpool_intern_release (item->name);
+	r_strpool_intern_release (item->realname);
+	item->name = (char *)s;
+	item->realname = (char *)r_strpool_intern_ref (s);
 	return true;
 }
 
@@ -142,7 +227,8 @@ R_API RFlag * r_flag_new() {
 		r_flag_free (f);
 		return NULL;
 	}
-	f->ht_name = ht_new (NULL, flag_free_kv, NULL);
+	f->ht_name = flag_ht_name_new ();
+	f->ht_next = ht_new (NULL, flag_free_kv, NULL);
 	f->by_off = r_skiplist_new (flag_skiplist_free, flag_skiplist_cmp);
 #if R_FLAG_ZONE_USE_SDB
 	sdb_free (f->zones);
@@ -160,11 +246,8 @@ R_API void r_flag_item_free(RFlagItem *item) {
 		free (item->color);
 		free (item->comment);
 		free (item->alias);
-		/* release only one of the two pointers if they are the same */
-		if (item->name != item->realname) {
-			free (item->name);
-		}
-		free (item->realname);
+		r_strpool_intern_release (item->name);
+		r_strpool_intern_release (item->realname);
 		free (item);
 	}
 }
@@ -176,6 +259,7 @@ R_API RFlag *r_flag_free(RFlag *f) {
 	}
 	r_skiplist_free (f->by_off);
 	ht_free (f->ht_name);
+	ht_free (f->ht_next);
 
 	r_list_free (f->flags);
 	r_list_free (f->spacestack);
@@ -349,7 +433,7 @@ R_API RFlagItem *r_flag_get(RFlag *f, const char *name) {
 	if (!f) {
 		return NULL;
 	}
-	r = ht_find (f->ht_name, name, NULL);
+	r = flag_find (f, name);
 	return evalFlag (f, r);
 }
 
@@ -478,22 +562,57 @@ R_API char *r_flag_get_liststr(RFlag *f, ut64 off) {
 	return p;
 }
 
+/* a removed name.N is free again, r_flag_set_next must try it first as
+ * it did when it always started probing from name.0 */
+static void flag_next_rewind(RFlag *f, const char *name) {
+	const char *dot = strrchr (name, '.');
+	char *base;
+	int n;
+	if (!dot || dot == name || !IS_DIGIT (dot[1]) || f->ht_next->count < 1) {
+		return;
+	}
+	n = atoi (dot + 1);
+	if (n < 0 || strspn (dot + 1, "0123456789") != strlen (dot + 1)) {
+		return;
+	}
+	base = r_str_ndup (name, dot - name);
+	if (base) {
+		int next = (int)(size_t)ht_find (f->ht_next, base, NULL);
+		if (next - 1 > n) {
+			ht_update (f->ht_next, base, (void *)(size_t)(n + 1));
+		}
+		free (base);
+	}
+}
+
+/* sets name, or name.N with the first N that is not taken. the next N
+ * to try is remembered for every name, so adding the same name again
+ * and again does not probe all the ones before */
 R_API RFlagItem *r_flag_set_next(RFlag *f, const char *name, ut64 off, ut32 size) {
+	RFlagItem *fi;
+	char *newName;
+	int i, newNameSize;
 	if (!r_flag_get (f, name)) {
 		return r_flag_set (f, name, off, size);
 	}
-	int i, newNameSize = strlen (name);
-	char *newName = malloc (newNameSize + 16);
+	newNameSize = strlen (name);
+	newName = malloc (newNameSize + 16);
+	if (!newName) {
+		return NULL;
+	}
 	strcpy (newName, name);
-	for (i = 0; ; i++) {
+	i = (int)(size_t)ht_find (f->ht_next, name, NULL);
+	for (i = R_MAX (i - 1, 0); ; i++) {
 		snprintf (newName + newNameSize, 15, ".%d", i);
 		if (!r_flag_get (f, newName)) {
-			RFlagItem *fi = r_flag_set (f, newName, off, size);
-			free (newName);
-			return fi;
+			break;
 		}
 	}
-	return NULL;
+	fi = r_flag_set (f, newName, off, size);
+	flag_ht_fit (f->ht_next, f->ht_next->count + 1);
+	ht_update (f->ht_next, name, (void *)(size_t)(i + 2));
+	free (newName);
+	return fi;
 }
 
 /* create or modify an existing flag item with the given name and parameters.
@@ -527,6 +646,7 @@ R_API RFlagItem *r_flag_set(RFlag *f, const char *name, ut64 off, ut32 size) {
 		}
 		//item share ownership prone to uaf, that is why only
 		//f->flags has set up free pointer
+		flag_ht_fit (f->ht_name, f->ht_name->count + 1);
 		ht_insert (f->ht_name, item->name, item);
 		r_list_append (f->flags, item);
 	}
@@ -534,6 +654,7 @@ R_API RFlagItem *r_flag_set(RFlag *f, const char *name, ut64 off, ut32 size) {
 	item->space = f->space_idx;
 	item->offset = off + f->base;
 	item->size = size;
+	f->changes++;
 
 	list = (RList *)r_flag_get_list (f, off);
 	if (!list) {
@@ -549,6 +670,109 @@ R_API RFlagItem *r_flag_set(RFlag *f, const char *name, ut64 off, ut32 size) {
 	return item;
 }
 
+typedef struct {
+	RFlagItem *item;
+	ut64 off;
+	int idx;
+} FlagPending;
+
+static int flag_pending_cmp(const void *a, const void *b) {
+	const FlagPending *pa = a, *pb = b;
+	if (pa->off != pb->off) {
+		return pa->off < pb->off? -1: 1;
+	}
+	return pa->idx - pb->idx;
+}
+
+static int flag_pending_item_cmp(const void *a, const void *b) {
+	const FlagPending *pa = a, *pb = b;
+	if (pa->item != pb->item) {
+		return pa->item < pb->item? -1: 1;
+	}
+	return pa->idx - pb->idx;
+}
+
+/* does the same as r_flag_set and r_flag_item_set_realname for all the
+ * entries, in order, but the hashtable is sized once and the flags are
+ * put in the offset map together, one lookup per offset. entries sorted
+ * by offset are the cheapest. returns how many were set */
+R_API int r_flag_set_batch(RFlag *f, const RFlagEntry *entries, int count) {
+	FlagPending *pending;
+	int i, j, n = 0, set = 0;
+	if (!f || !entries || count < 1) {
+		return 0;
+	}
+	if (!(pending = calloc (count, sizeof (FlagPending)))) {
+		return 0;
+	}
+	flag_ht_fit (f->ht_name, f->ht_name->count + count);
+	for (i = 0; i < count; i++) {
+		const RFlagEntry *e = &entries[i];
+		RFlagItem *item;
+		if (!e->name || !*e->name) {
+			continue;
+		}
+		item = flag_find (f, e->name);
+		if (item) {
+			if (item->offset == e->offset) {
+				item->size = e->size;
+				goto realname;
+			}
+			remove_offsetmap (f, item);
+		} else {
+			if (!(item = R_NEW0 (RFlagItem))) {
+				break;
+			}
+			if (!set_name (item, e->name)) {
+				eprintf ("Invalid flag name '%s'.\n", e->name);
+				r_flag_item_free (item);
+				continue;
+			}
+			ht_insert (f->ht_name, item->name, item);
+			r_list_append (f->flags, item);
+		}
+		item->space = f->space_idx;
+		item->offset = e->offset + f->base;
+		item->size = e->size;
+		pending[n].item = item;
+		pending[n].off = e->offset;
+		pending[n].idx = i;
+		n++;
+	realname:
+		if (e->realname) {
+			r_flag_item_set_realname (item, e->realname);
+		}
+		set++;
+	}
+	f->changes += set;
+	/* a flag moved twice goes where the last one says */
+	qsort (pending, n, sizeof (FlagPending), flag_pending_item_cmp);
+	for (i = j = 0; i < n; i++) {
+		if (i + 1 < n && pending[i + 1].item == pending[i].item) {
+			continue;
+		}
+		pending[j++] = pending[i];
+	}
+	n = j;
+	qsort (pending, n, sizeof (FlagPending), flag_pending_cmp);
+	for (i = 0; i < n; i = j) {
+		RFlagsAtOffset *flags = r_flag_get_nearest_list (f, pending[i].off, 0);
+		if (!flags) {
+			if (!(flags = R_NEW (RFlagsAtOffset))) {
+				break;
+			}
+			flags->off = pending[i].off;
+			flags->flags = r_list_new ();
+			r_skiplist_insert (f->by_off, flags);
+		}
+		for (j = i; j < n && pending[j].off == pending[i].off; j++) {
+			r_list_append (flags->flags, pending[j].item);
+		}
+	}
+	free (pending);
+	return set;
+}
+
 /* add/replace/remove the alias of a flag item */
 R_API void r_flag_item_set_alias(RFlagItem *item, const char *alias) {
 	if (item) {
@@ -568,10 +792,8 @@ R_API void r_flag_item_set_comment(RFlagItem *item, const char *comment) {
 /* add/replace/remove the realname of a flag item */
 R_API void r_flag_item_set_realname(RFlagItem *item, const char *realname) {
 	if (item) {
-		if (item->name != item->realname) {
-			free (item->realname);
-		}
-		item->realname = ISNULLSTR (realname) ? NULL : strdup (realname);
+		r_strpool_intern_release (item->realname);
+		item->realname = ISNULLSTR (realname)? NULL: (char *)r_strpool_intern (realname);
 	}
 }
 
@@ -588,6 +810,7 @@ R_API int r_flag_rename(RFlag *f, RFlagItem *item, const char *name) {
 	r_flag_set (f, name, off, size);
 	return true;
 #else
+	flag_next_rewind (f, item->name);
 	ht_delete (f->ht_name, item->name);
 	if (!set_name (item, name)) {
 		return false;
@@ -602,7 +825,9 @@ R_API int r_flag_rename(RFlag *f, RFlagItem *item, const char *name) {
  *
  * NOTE: the item is freed. */
 R_API int r_flag_unset(RFlag *f, RFlagItem *item) {
+	f->changes++;
 	remove_offsetmap (f, item);
+	flag_next_rewind (f, item->name);
 	ht_delete (f->ht_name, item->name);
 	r_list_delete_data (f->flags, item);
 	return true;
@@ -641,13 +866,14 @@ R_API int r_flag_unset_glob(RFlag *f, const char *glob) {
 /* unset the flag item with the given name.
  * returns true if the item is found and unset, false otherwise. */
 R_API int r_flag_unset_name(RFlag *f, const char *name) {
-	RFlagItem *item = ht_find (f->ht_name, name, NULL);
+	RFlagItem *item = flag_find (f, name);
 	return item && r_flag_unset (f, item);
 }
 
 /* unset all flag items in the RFlag f */
 R_API void r_flag_unset_all(RFlag *f) {
 	f->space_idx = -1;
+	f->changes++;
 	r_list_free (f->flags);
 	f->flags = r_list_newf ((RListFree)r_flag_item_free);
 	if (!f->flags) {
@@ -655,7 +881,9 @@ R_API void r_flag_unset_all(RFlag *f) {
 	}
 	ht_free (f->ht_name);
 	//don't set free since f->flags will free up items when needed avoiding uaf
-	f->ht_name = ht_new (NULL, flag_free_kv, NULL);
+	f->ht_name = flag_ht_name_new ();
+	ht_free (f->ht_next);
+	f->ht_next = ht_new (NULL, flag_free_kv, NULL);
 	r_skiplist_purge (f->by_off);
 	r_flag_space_unset (f, NULL);
 }
@@ -673,6 +901,7 @@ R_API int r_flag_relocate(RFlag *f, ut64 off, ut64 off_mask, ut64 to) {
 			ut64 fm = item->offset & off_mask;
 			ut64 om = to & off_mask;
 			item->offset = (to&neg_mask) + fm + om;
+			f->changes++;
 			n++;
 		}
 	}
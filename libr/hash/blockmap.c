@@ -0,0 +1,315 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+#include <r_hash.h>
+#include <r_th.h>
+
+/* block maps: the input is fed in chunks of any size and split into
+ * blocks of bsize bytes, every block gets its digests (through a
+ * RHashMulti) and its entropy computed and is handed to the callback,
+ * so callers can read big chunks once instead of one read per block.
+ *
+ * when step is smaller than bsize the blocks overlap, then the window
+ * is kept in a ring and the histogram is updated by adding the bytes
+ * that enter and removing the ones that leave, instead of counting the
+ * whole window again for every block.
+ *
+ * with threads > 1 the whole blocks of every chunk are split in runs
+ * hashed at the same time by private maps, and their results are handed
+ * to the callback in address order from the thread calling update. the
+ * overlapping maps stay on one thread, each window depends on the last */
+
+/* the R_HASH_ bits are not parenthesized */
+#define ENTROPY_BIT ((ut64)(R_HASH_ENTROPY))
+
+R_API RHashBlockMap *r_hash_blockmap_new(ut64 algobits, ut64 bsize, ut64 step, ut64 addr, RHashBlockCallback cb, void *user) {
+	RHashBlockMap *bm;
+	if (!bsize || !cb) {
+		return NULL;
+	}
+	if (!step || step > bsize) {
+		step = bsize;
+	}
+	bm = R_NEW0 (RHashBlockMap);
+	if (!bm) {
+		return NULL;
+	}
+	bm->algobits = algobits;
+	bm->bsize = bsize;
+	bm->step = step;
+	bm->from = addr;
+	bm->addr = addr;
+	bm->cb = cb;
+	bm->user = user;
+	bm->threads = 1;
+	if (algobits & ~ENTROPY_BIT) {
+		bm->hm = r_hash_multi_new (algobits & ~ENTROPY_BIT);
+		if (!bm->hm) {
+			free (bm);
+			return NULL;
+		}
+	}
+	if (step < bsize) {
+		bm->ring = malloc (bsize);
+		if (!bm->ring) {
+			r_hash_blockmap_free (bm);
+			return NULL;
+		}
+	}
+	r_hash_entropy_init (&bm->ent);
+	return bm;
+}
+
+R_API void r_hash_blockmap_free(RHashBlockMap *bm) {
+	if (bm) {
+		r_hash_multi_free (bm->hm);
+		free (bm->ring);
+		free (bm);
+	}
+}
+
+static void blockmap_emit(RHashBlockMap *bm) {
+	if (bm->hm) {
+		r_hash_multi_end (bm->hm);
+	}
+	if (bm->algobits & ENTROPY_BIT) {
+		bm->entropy = r_hash_entropy_get (&bm->ent);
+		bm->fraction = r_hash_entropy_get_fraction (&bm->ent);
+	}
+	bm->cb (bm, bm->user);
+}
+
+/* emits the window ending at the last byte seen */
+static void blockmap_emit_window(RHashBlockMap *bm) {
+	ut64 len = R_MIN (bm->seen, bm->bsize);
+	ut64 pos = bm->seen % bm->bsize;
+	bm->addr = bm->from + bm->seen - len;
+	bm->len = len;
+	if (bm->hm) {
+		r_hash_multi_begin (bm->hm);
+		if (len == bm->bsize) {
+			r_hash_multi_update (bm->hm, bm->ring + pos, bm->bsize - pos);
+			r_hash_multi_update (bm->hm, bm->ring, pos);
+		} else {
+			r_hash_multi_update (bm->hm, bm->ring, len);
+		}
+	}
+	blockmap_emit (bm);
+}
+
+static void blockmap_slide(RHashBlockMap *bm, const ut8 *buf, ut64 len) {
+	bool ent = bm->algobits & ENTROPY_BIT;
+	while (len > 0) {
+		ut64 pos = bm->seen % bm->bsize;
+		ut64 next = bm->bsize;
+		ut64 n;
+		if (bm->seen >= bm->bsize) {
+			next += ((bm->seen - bm->bsize) / bm->step + 1) * bm->step;
+		}
+		n = R_MIN (len, R_MIN (bm->bsize - pos, next - bm->seen));
+		if (ent) {
+			if (bm->seen >= bm->bsize) {
+				r_hash_entropy_del (&bm->ent, bm->ring + pos, n);
+			}
+			r_hash_entropy_add (&bm->ent, buf, n);
+		}
+		memcpy (bm->ring + pos, buf, n);
+		bm->seen += n;
+		buf += n;
+		len -= n;
+		if (bm->seen == next) {
+			blockmap_emit_window (bm);
+		}
+	}
+}
+
+static bool blockmap_feed(RHashBlockMap *bm, const ut8 *buf, ut64 len) {
+	bool ent = bm->algobits & ENTROPY_BIT;
+	while (len > 0) {
+		ut64 n = R_MIN (len, bm->bsize - bm->len);
+		if (bm->hm && !r_hash_multi_update (bm->hm, buf, (int)n)) {
+			return false;
+		}
+		if (ent) {
+			r_hash_entropy_add (&bm->ent, buf, n);
+		}
+		bm->len += n;
+		bm->seen += n;
+		buf += n;
+		len -= n;
+		if (bm->len == bm->bsize) {
+			blockmap_emit (bm);
+			bm->addr += bm->bsize;
+			bm->len = 0;
+			r_hash_entropy_init (&bm->ent);
+			if (bm->hm) {
+				r_hash_multi_begin (bm->hm);
+			}
+		}
+	}
+	return true;
+}
+
+/* a run of whole blocks hashed by one worker. every block leaves a
+ * record with its address, length, entropy and fraction followed by the
+ * value and digest of each algorithm */
+typedef struct {
+	RHashBlockMap *bm;
+	const ut8 *buf;
+	ut64 len;
+	ut8 *res;
+	ut64 nres;
+	int recsize;
+} BlockWorker;
+
+#define BLOCK_HEAD (2 * sizeof (ut64) + 2 * sizeof (double))
+
+static void blockmap_collect(RHashBlockMap *bm, void *user) {
+	BlockWorker *w = user;
+	ut8 *r = w->res + w->nres++ * w->recsize;
+	int i;
+	memcpy (r, &bm->addr, sizeof (ut64));
+	memcpy (r + 8, &bm->len, sizeof (ut64));
+	memcpy (r + 16, &bm->entropy, sizeof (double));
+	memcpy (r + 24, &bm->fraction, sizeof (double));
+	r += BLOCK_HEAD;
+	for (i = 0; bm->hm && i < bm->hm->count; i++) {
+		RHashMultiAlgo *a = &bm->hm->algos[i];
+		memcpy (r, &a->value, sizeof (ut64));
+		memcpy (r + 8, a->ctx->digest, a->dlen);
+		r += sizeof (ut64) + a->dlen;
+	}
+}
+
+static void blockmap_replay(RHashBlockMap *bm, const ut8 *r) {
+	int i;
+	memcpy (&bm->addr, r, sizeof (ut64));
+	memcpy (&bm->len, r + 8, sizeof (ut64));
+	memcpy (&bm->entropy, r + 16, sizeof (double));
+	memcpy (&bm->fraction, r + 24, sizeof (double));
+	r += BLOCK_HEAD;
+	for (i = 0; bm->hm && i < bm->hm->count; i++) {
+		RHashMultiAlgo *a = &bm->hm->algos[i];
+		memcpy (&a->value, r, sizeof (ut64));
+		memcpy (a->ctx->digest, r + 8, a->dlen);
+		r += sizeof (ut64) + a->dlen;
+	}
+	bm->cb (bm, bm->user);
+}
+
+static int blockmap_worker(RThread *th) {
+	BlockWorker *w = th->user;
+	r_hash_blockmap_update (w->bm, w->buf, w->len);
+	return false;
+}
+
+/* a worker is only started for this many bytes, below that creating
+ * the thread costs more than hashing the run on the calling one */
+#define BLOCKMAP_WORKER_MIN (256 * 1024)
+
+/* hashes the whole blocks at the start of buf on bm->threads workers,
+ * the calling thread takes the first run. returns the bytes consumed,
+ * 0 when the chunk is too small or there is no memory to split it */
+static ut64 blockmap_parallel(RHashBlockMap *bm, const ut8 *buf, ut64 len) {
+	ut64 nblocks = len / bm->bsize;
+	int i, n = (int)R_MIN (R_MIN ((ut64)bm->threads, nblocks), len / BLOCKMAP_WORKER_MIN);
+	int recsize = BLOCK_HEAD;
+	BlockWorker *w;
+	RThread **th;
+	RThread self = {0};
+	ut64 start = bm->addr, done = 0, k;
+	if (n < 2) {
+		return 0;
+	}
+	for (i = 0; bm->hm && i < bm->hm->count; i++) {
+		recsize += sizeof (ut64) + bm->hm->algos[i].dlen;
+	}
+	w = R_NEWS0 (BlockWorker, n);
+	th = R_NEWS0 (RThread *, n);
+	if (!w || !th) {
+		goto beach;
+	}
+	for (i = 0; i < n; i++) {
+		ut64 first = nblocks * i / n;
+		ut64 last = nblocks * (i + 1) / n;
+		w[i].buf = buf + first * bm->bsize;
+		w[i].len = (last - first) * bm->bsize;
+		w[i].recsize = recsize;
+		w[i].res = malloc ((last - first) * recsize);
+		w[i].bm = r_hash_blockmap_new (bm->algobits, bm->bsize, 0,
+			start + first * bm->bsize, blockmap_collect, &w[i]);
+		if (!w[i].res || !w[i].bm) {
+			goto beach;
+		}
+	}
+	for (i = 1; i < n; i++) {
+		th[i] = r_th_new (blockmap_worker, &w[i], 0);
+	}
+	self.user = &w[0];
+	blockmap_worker (&self);
+	for (i = 1; i < n; i++) {
+		if (th[i]) {
+			r_th_wait (th[i]);
+			r_th_free (th[i]);
+		} else {
+			self.user = &w[i];
+			blockmap_worker (&self);
+		}
+	}
+	for (i = 0; i < n; i++) {
+		for (k = 0; k < w[i].nres; k++) {
+			blockmap_replay (bm, w[i].res + k * recsize);
+		}
+	}
+	done = nblocks * bm->bsize;
+	bm->addr = start + done;
+	bm->seen += done;
+	bm->len = 0;
+	if (bm->hm) {
+		r_hash_multi_begin (bm->hm);
+	}
+beach:
+	for (i = 0; w && i < n; i++) {
+		r_hash_blockmap_free (w[i].bm);
+		free (w[i].res);
+	}
+	free (w);
+	free (th);
+	return done;
+}
+
+R_API bool r_hash_blockmap_update(RHashBlockMap *bm, const ut8 *buf, ut64 len) {
+	if (bm->ring) {
+		blockmap_slide (bm, buf, len);
+		return true;
+	}
+	if (bm->threads > 1) {
+		/* the block left open by the last chunk is finished first */
+		ut64 head = bm->len? R_MIN (len, bm->bsize - bm->len): 0;
+		ut64 done;
+		if (!blockmap_feed (bm, buf, head)) {
+			return false;
+		}
+		done = blockmap_parallel (bm, buf + head, len - head);
+		buf += head + done;
+		len -= head + done;
+	}
+	return blockmap_feed (bm, buf, len);
+}
+
+/* flushes the last block, which can be shorter than bsize. overlapping
+ * maps get a last full window if the stream did not end on a step */
+R_API void r_hash_blockmap_end(RHashBlockMap *bm) {
+	if (bm->ring) {
+		if (bm->seen && (bm->seen < bm->bsize || (bm->seen - bm->bsize) % bm->step)) {
+			blockmap_emit_window (bm);
+		}
+	} else if (bm->len > 0) {
+		blockmap_emit (bm);
+		bm->addr += bm->len;
+		bm->len = 0;
+		r_hash_entropy_init (&bm->ent);
+		if (bm->hm) {
+			r_hash_multi_begin (bm->hm);
+		}
+	}
+}
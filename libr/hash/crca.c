@@ -12,7 +12,8 @@ void crc_init (R_CRC_CTX *ctx, ut32 crc, ut32 size, int reflect, ut32 poly, ut32
 	ctx->xout = xout;
 }
 
-void crc_update (R_CRC_CTX *ctx, const ut8 *data, ut32 sz) {
+/* bit at a time, for parameters without a precomputed table */
+static void crc_update_bits (R_CRC_CTX *ctx, const ut8 *data, ut32 sz) {
 	ut32 crc, d;
 	int i, j;
 
@@ -34,7 +35,7 @@ void crc_update (R_CRC_CTX *ctx, const ut8 *data, ut32 sz) {
 	ctx->crc = crc;
 }
 
-static void crc_final (R_CRC_CTX *ctx, ut32 *r) {
+void crc_final (R_CRC_CTX *ctx, ut32 *r) {
 	ut32 crc;
 	int i;
 
@@ -64,6 +65,114 @@ R_CRC_CTX crc_presets[] = {
 	{ 0x00      ,  8, 0, 0x07      , 0x00 },       //CRC-8-SMBUS, test vector for "1234567892: f4
 };
 
+/* slicing-by-8 tables of the presets above. reflected presets run on the
+ * reflected register and the rest on the register aligned to the top of
+ * 32 bits, so any width up to 32 shares the code */
+#include "crca_tables.h"
+
+static ut32 crc_reflect (ut32 v, int bits) {
+	ut32 r = 0;
+	int i;
+	for (i = 0; i < bits; i++, v >>= 1) {
+		r = (r << 1) | (v & 1);
+	}
+	return r;
+}
+
+static ut32 crc_slice_reflected (const ut32 (*t)[256], ut32 crc, const ut8 *p, ut32 sz) {
+	for (; sz >= 8; sz -= 8, p += 8) {
+		ut32 one = crc ^ r_read_le32 (p);
+		ut32 two = r_read_le32 (p + 4);
+		crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff]
+			^ t[5][(one >> 16) & 0xff] ^ t[4][one >> 24]
+			^ t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff]
+			^ t[1][(two >> 16) & 0xff] ^ t[0][two >> 24];
+	}
+	for (; sz > 0; sz--, p++) {
+		crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xff];
+	}
+	return crc;
+}
+
+static ut32 crc_slice_aligned (const ut32 (*t)[256], ut32 crc, const ut8 *p, ut32 sz) {
+	for (; sz >= 8; sz -= 8, p += 8) {
+		ut32 one = crc ^ r_read_be32 (p);
+		ut32 two = r_read_be32 (p + 4);
+		crc = t[7][one >> 24] ^ t[6][(one >> 16) & 0xff]
+			^ t[5][(one >> 8) & 0xff] ^ t[4][one & 0xff]
+			^ t[3][two >> 24] ^ t[2][(two >> 16) & 0xff]
+			^ t[1][(two >> 8) & 0xff] ^ t[0][two & 0xff];
+	}
+	for (; sz > 0; sz--, p++) {
+		crc = (crc << 8) ^ t[0][(crc >> 24) ^ *p];
+	}
+	return crc;
+}
+
+#if __x86_64__ && (__GNUC__ >= 5 || __clang__)
+#define CRC32C_HW 1
+/* the sse4.2 crc32 instruction is crc-32c on the reflected register */
+__attribute__((target("sse4.2")))
+static ut32 crc32c_hw (ut32 crc, const ut8 *p, ut32 sz) {
+	ut64 c = crc;
+	for (; sz >= 8; sz -= 8, p += 8) {
+		ut64 v;
+		memcpy (&v, p, sizeof (v));
+		c = __builtin_ia32_crc32di (c, v);
+	}
+	crc = c;
+	for (; sz > 0; sz--, p++) {
+		crc = __builtin_ia32_crc32qi (crc, *p);
+	}
+	return crc;
+}
+
+static bool crc32c_hw_available (void) {
+	return __builtin_cpu_supports ("sse4.2");
+}
+#else
+#define CRC32C_HW 0
+#define crc32c_hw(crc, p, sz) (crc)
+#define crc32c_hw_available() false
+#endif
+
+static int crc_preset_of (const R_CRC_CTX *ctx) {
+	int i;
+	for (i = 0; i < CRC_PRESET_SIZE; i++) {
+		R_CRC_CTX *p = &crc_presets[i];
+		if (p->size == ctx->size && p->poly == ctx->poly && p->reflect == ctx->reflect) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+void crc_update (R_CRC_CTX *ctx, const ut8 *data, ut32 sz) {
+	int preset = crc_preset_of (ctx);
+	ut32 crc, mask;
+	if (preset == -1 || ctx->size < 8 || ctx->size > 32) {
+		crc_update_bits (ctx, data, sz);
+		return;
+	}
+	/* the state is kept in the same form crc_update_bits uses */
+	mask = ((((ut32) 1 << (ctx->size - 1)) - 1) << 1) | 1;
+	crc = ctx->crc & mask;
+	if (ctx->reflect) {
+		crc = crc_reflect (crc, ctx->size);
+		if (CRC32C_HW && preset == CRC_PRESET_32C && crc32c_hw_available ()) {
+			crc = crc32c_hw (crc, data, sz);
+		} else {
+			crc = crc_slice_reflected (crc_tables[preset], crc, data, sz);
+		}
+		crc = crc_reflect (crc, ctx->size);
+	} else {
+		crc <<= 32 - ctx->size;
+		crc = crc_slice_aligned (crc_tables[preset], crc, data, sz);
+		crc >>= 32 - ctx->size;
+	}
+	ctx->crc = crc;
+}
+
 void crc_init_preset (R_CRC_CTX *ctx, enum CRC_PRESETS preset) {
 	ctx->crc = crc_presets[preset].crc;
 	ctx->size = crc_presets[preset].size;
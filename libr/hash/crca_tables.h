@@ -0,0 +1,3624 @@
+/* generated by sys/crc-tables.py, do not edit */
+
+static const ut32 crc_tables[CRC_PRESET_SIZE][8][256] = {
+	{ /* CRC_PRESET_32 */
+		{
+			0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
+			0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
+			0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
+			0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+			0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9,
+			0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
+			0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c,
+			0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+			0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
+			0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
+			0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106,
+			0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+			0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d,
+			0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
+			0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
+			0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+			0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7,
+			0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
+			0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa,
+			0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+			0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
+			0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
+			0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84,
+			0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+			0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb,
+			0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
+			0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
+			0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+			0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55,
+			0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
+			0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28,
+			0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+			0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
+			0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
+			0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242,
+			0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+			0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69,
+			0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
+			0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
+			0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+			0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693,
+			0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
+			0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+		},
+		{
+			0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445,
+			0x565aa786, 0x4f4196c7, 0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb,
+			0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf, 0x4ac21251, 0x53d92310,
+			0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+			0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c,
+			0xd4413fdf, 0xcd5a0e9e, 0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761,
+			0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265, 0x5d5daeaa, 0x44469feb,
+			0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+			0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6,
+			0x891c9175, 0x9007a034, 0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38,
+			0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c, 0xf0794f05, 0xe9627e44,
+			0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+			0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148,
+			0x6efa628b, 0x77e153ca, 0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97,
+			0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93, 0x7262d75c, 0x6b79e61d,
+			0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+			0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2,
+			0x33a7cc21, 0x2abcfd60, 0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c,
+			0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768, 0x2f3f79f6, 0x362448b7,
+			0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+			0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb,
+			0xb1bc5478, 0xa8a76539, 0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88,
+			0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c, 0xf35a1243, 0xea412302,
+			0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+			0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f,
+			0x271b2d9c, 0x3e001cdd, 0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1,
+			0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5, 0xae07bce9, 0xb71c8da8,
+			0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+			0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4,
+			0x30849167, 0x299fa026, 0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b,
+			0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f, 0x2c1c24b0, 0x350715f1,
+			0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+			0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b,
+			0x9da070c8, 0x84bb4189, 0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85,
+			0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81, 0x8138c51f, 0x9823f45e,
+			0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+			0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52,
+			0x1fbbe891, 0x06a0d9d0, 0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f,
+			0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b, 0x96a779e4, 0x8fbc48a5,
+			0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+			0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8,
+			0x42e6463b, 0x5bfd777a, 0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876,
+			0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72,
+		},
+		{
+			0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb,
+			0x048d7cb2, 0x054f1685, 0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1,
+			0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d, 0x1c26a370, 0x1de4c947,
+			0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+			0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023,
+			0x16b88e7a, 0x177ae44d, 0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9,
+			0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065, 0x365e1758, 0x379c7d6f,
+			0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+			0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b,
+			0x20e69922, 0x2124f315, 0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71,
+			0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad, 0x709a8dc0, 0x7158e7f7,
+			0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+			0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93,
+			0x7a04a0ca, 0x7bc6cafd, 0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9,
+			0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835, 0x62af7f08, 0x636d153f,
+			0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+			0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb,
+			0x4c5ab792, 0x4d98dda5, 0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1,
+			0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d, 0x54f16850, 0x55330267,
+			0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+			0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03,
+			0x5e6f455a, 0x5fad2f6d, 0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9,
+			0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05, 0xef264a38, 0xeee4200f,
+			0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+			0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b,
+			0xf99ec442, 0xf85cae75, 0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711,
+			0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd, 0xd9785d60, 0xd8ba3757,
+			0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+			0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33,
+			0xd3e6706a, 0xd2241a5d, 0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049,
+			0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895, 0xcb4dafa8, 0xca8fc59f,
+			0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+			0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab,
+			0x9522eaf2, 0x94e080c5, 0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1,
+			0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d, 0x8d893530, 0x8c4b5f07,
+			0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+			0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663,
+			0x8717183a, 0x86d5720d, 0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9,
+			0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625, 0xa7f18118, 0xa633eb2f,
+			0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+			0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b,
+			0xb1490f62, 0xb08b6555, 0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31,
+			0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed,
+		},
+		{
+			0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032,
+			0x256b5fdc, 0x9dd738b9, 0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701,
+			0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056, 0x5019579f, 0xe8a530fa,
+			0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+			0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42,
+			0xb0c620ac, 0x087a47c9, 0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0,
+			0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787, 0x658687d1, 0xdd3ae0b4,
+			0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+			0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893,
+			0xd540a77d, 0x6dfcc018, 0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0,
+			0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7, 0x9b14583d, 0x23a83f58,
+			0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+			0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0,
+			0x7bcb2f0e, 0xc377486b, 0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c,
+			0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b, 0x0eb9274d, 0xb6054028,
+			0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+			0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731,
+			0x1e4da8df, 0xa6f1cfba, 0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002,
+			0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755, 0x6b3fa09c, 0xd383c7f9,
+			0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+			0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841,
+			0x8be0d7af, 0x335cb0ca, 0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5,
+			0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82, 0x28ed9ed4, 0x9051f9b1,
+			0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+			0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196,
+			0x982bbe78, 0x2097d91d, 0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5,
+			0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2, 0x4d6b1905, 0xf5d77e60,
+			0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+			0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8,
+			0xadb46e36, 0x15080953, 0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174,
+			0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623, 0xd8c66675, 0x607a0110,
+			0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+			0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34,
+			0x5326b1da, 0xeb9ad6bf, 0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907,
+			0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50, 0x2654b999, 0x9ee8defc,
+			0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+			0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144,
+			0xc68bceaa, 0x7e37a9cf, 0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6,
+			0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981, 0x13cb69d7, 0xab770eb2,
+			0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+			0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695,
+			0xa30d497b, 0x1bb12e1e, 0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6,
+			0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1,
+		},
+		{
+			0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70,
+			0x8f40f5a0, 0xb220dc10, 0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111,
+			0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1, 0x60e09782, 0x5d80be32,
+			0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+			0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333,
+			0xdfd029e3, 0xe2b00053, 0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4,
+			0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314, 0xf1b164c5, 0xccd14d75,
+			0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+			0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6,
+			0x2e614d26, 0x13016496, 0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997,
+			0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57, 0x58f35849, 0x659371f9,
+			0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+			0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8,
+			0xe7c3e628, 0xdaa3cf98, 0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b,
+			0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db, 0x0863840a, 0x3503adba,
+			0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+			0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d,
+			0x167282ed, 0x2b12ab5d, 0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c,
+			0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c, 0xf9d2e0cf, 0xc4b2c97f,
+			0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+			0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e,
+			0x46e25eae, 0x7b82771e, 0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42,
+			0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82, 0x8196fb53, 0xbcf6d2e3,
+			0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+			0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860,
+			0x5e46d2b0, 0x6326fb00, 0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601,
+			0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1, 0x70279f96, 0x4d47b626,
+			0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+			0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27,
+			0xcf1721f7, 0xf2770847, 0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4,
+			0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404, 0x20b743d5, 0x1dd76a65,
+			0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+			0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab,
+			0x66551d7b, 0x5b3534cb, 0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca,
+			0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a, 0x89f57f59, 0xb49556e9,
+			0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+			0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8,
+			0x36c5c138, 0x0ba5e888, 0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f,
+			0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf, 0x18a48c1e, 0x25c4a5ae,
+			0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+			0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d,
+			0xc774a5fd, 0xfa148c4d, 0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c,
+			0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c,
+		},
+		{
+			0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3,
+			0xd659e31d, 0x1d0530b8, 0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3,
+			0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5, 0x03d6029b, 0xc88ad13e,
+			0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+			0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145,
+			0x39dc63eb, 0xf280b04e, 0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798,
+			0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e, 0xebff875b, 0x20a354fe,
+			0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+			0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e,
+			0xd223e4b0, 0x197f3715, 0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e,
+			0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578, 0x0f580a6c, 0xc404d9c9,
+			0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+			0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2,
+			0x35526b1c, 0xfe0eb8b9, 0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59,
+			0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f, 0xe0dd8a9a, 0x2b81593f,
+			0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+			0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9,
+			0xdeadec47, 0x15f13fe2, 0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99,
+			0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f, 0x0b220dc1, 0xc07ede64,
+			0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+			0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f,
+			0x31286cb1, 0xfa74bf14, 0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676,
+			0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460, 0xf2e396b5, 0x39bf4510,
+			0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+			0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0,
+			0xcb3ff55e, 0x006326fb, 0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680,
+			0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496, 0x191c11ee, 0xd240c24b,
+			0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+			0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230,
+			0x2316709e, 0xe84aa33b, 0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db,
+			0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd, 0xf6999118, 0x3dc542bd,
+			0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+			0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07,
+			0xc7b1fda9, 0x0ced2e0c, 0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77,
+			0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61, 0x123e1c2f, 0xd962cf8a,
+			0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+			0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1,
+			0x28347d5f, 0xe368aefa, 0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c,
+			0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a, 0xfa1799ef, 0x314b4a4a,
+			0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+			0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa,
+			0xc3cbfa04, 0x089729a1, 0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da,
+			0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc,
+		},
+		{
+			0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7,
+			0x63d0353a, 0xc5a73e8e, 0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa,
+			0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9, 0x67de9cce, 0xc1a9977a,
+			0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+			0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e,
+			0x37e1e793, 0x9196ec27, 0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301,
+			0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712, 0xfc5277fb, 0x5a257c4f,
+			0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+			0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5,
+			0xcbb39068, 0x6dc49bdc, 0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8,
+			0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb, 0x440b7579, 0xe27c7ecd,
+			0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+			0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9,
+			0x14340e24, 0xb2430590, 0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a,
+			0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739, 0x103aa7d0, 0xb64dac64,
+			0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+			0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342,
+			0xe86679df, 0x4e11726b, 0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f,
+			0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c, 0xec68d02b, 0x4a1fdb9f,
+			0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+			0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb,
+			0xbc57ab76, 0x1a20a0c2, 0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f,
+			0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c, 0xbbf9a495, 0x1d8eaf21,
+			0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+			0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b,
+			0x8c184306, 0x2a6f48b2, 0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6,
+			0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5, 0x47abd36e, 0xe1dcd8da,
+			0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+			0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae,
+			0x1794a833, 0xb1e3a387, 0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d,
+			0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e, 0x139a01c7, 0xb5ed0a73,
+			0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+			0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c,
+			0xafcdaab1, 0x09baa105, 0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71,
+			0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62, 0xabc30345, 0x0db408f1,
+			0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+			0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285,
+			0xfbfc7818, 0x5d8b73ac, 0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a,
+			0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899, 0x304fe870, 0x9638e3c4,
+			0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+			0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e,
+			0x07ae0fe3, 0xa1d90457, 0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23,
+			0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30,
+		},
+		{
+			0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64,
+			0xc66f0987, 0x0ac50919, 0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56,
+			0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac, 0x7cbb312b, 0xb01131b5,
+			0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+			0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa,
+			0x69312319, 0xa59b2387, 0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5,
+			0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f, 0x2a9379e3, 0xe639797d,
+			0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+			0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19,
+			0x43a25afa, 0x8f085a64, 0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b,
+			0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1, 0x299dc2ed, 0xe537c273,
+			0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+			0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c,
+			0x3c17d0df, 0xf0bdd041, 0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425,
+			0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf, 0x86c3e873, 0x4a69e8ed,
+			0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+			0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf,
+			0x1684a93c, 0xda2ea9a2, 0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced,
+			0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217, 0xac509190, 0x60fa910e,
+			0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+			0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441,
+			0xb9da83a2, 0x7570833c, 0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239,
+			0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3, 0x80de9e6f, 0x4c749ef1,
+			0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+			0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95,
+			0xe9efbd76, 0x2545bde8, 0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7,
+			0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d, 0xaa4de78c, 0x66e7e712,
+			0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+			0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d,
+			0xbfc7f5be, 0x736df520, 0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144,
+			0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe, 0x0513cd12, 0xc9b9cd8c,
+			0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+			0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953,
+			0xbcc94eb0, 0x70634e2e, 0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61,
+			0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b, 0x061d761c, 0xcab77682,
+			0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+			0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd,
+			0x1397642e, 0xdf3d64b0, 0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282,
+			0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78, 0x50353ed4, 0x9c9f3e4a,
+			0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+			0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e,
+			0x39041dcd, 0xf5ae1d53, 0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c,
+			0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6,
+		},
+	},
+	{ /* CRC_PRESET_16 */
+		{
+			0x00000000, 0x0000c0c1, 0x0000c181, 0x00000140, 0x0000c301, 0x000003c0,
+			0x00000280, 0x0000c241, 0x0000c601, 0x000006c0, 0x00000780, 0x0000c741,
+			0x00000500, 0x0000c5c1, 0x0000c481, 0x00000440, 0x0000cc01, 0x00000cc0,
+			0x00000d80, 0x0000cd41, 0x00000f00, 0x0000cfc1, 0x0000ce81, 0x00000e40,
+			0x00000a00, 0x0000cac1, 0x0000cb81, 0x00000b40, 0x0000c901, 0x000009c0,
+			0x00000880, 0x0000c841, 0x0000d801, 0x000018c0, 0x00001980, 0x0000d941,
+			0x00001b00, 0x0000dbc1, 0x0000da81, 0x00001a40, 0x00001e00, 0x0000dec1,
+			0x0000df81, 0x00001f40, 0x0000dd01, 0x00001dc0, 0x00001c80, 0x0000dc41,
+			0x00001400, 0x0000d4c1, 0x0000d581, 0x00001540, 0x0000d701, 0x000017c0,
+			0x00001680, 0x0000d641, 0x0000d201, 0x000012c0, 0x00001380, 0x0000d341,
+			0x00001100, 0x0000d1c1, 0x0000d081, 0x00001040, 0x0000f001, 0x000030c0,
+			0x00003180, 0x0000f141, 0x00003300, 0x0000f3c1, 0x0000f281, 0x00003240,
+			0x00003600, 0x0000f6c1, 0x0000f781, 0x00003740, 0x0000f501, 0x000035c0,
+			0x00003480, 0x0000f441, 0x00003c00, 0x0000fcc1, 0x0000fd81, 0x00003d40,
+			0x0000ff01, 0x00003fc0, 0x00003e80, 0x0000fe41, 0x0000fa01, 0x00003ac0,
+			0x00003b80, 0x0000fb41, 0x00003900, 0x0000f9c1, 0x0000f881, 0x00003840,
+			0x00002800, 0x0000e8c1, 0x0000e981, 0x00002940, 0x0000eb01, 0x00002bc0,
+			0x00002a80, 0x0000ea41, 0x0000ee01, 0x00002ec0, 0x00002f80, 0x0000ef41,
+			0x00002d00, 0x0000edc1, 0x0000ec81, 0x00002c40, 0x0000e401, 0x000024c0,
+			0x00002580, 0x0000e541, 0x00002700, 0x0000e7c1, 0x0000e681, 0x00002640,
+			0x00002200, 0x0000e2c1, 0x0000e381, 0x00002340, 0x0000e101, 0x000021c0,
+			0x00002080, 0x0000e041, 0x0000a001, 0x000060c0, 0x00006180, 0x0000a141,
+			0x00006300, 0x0000a3c1, 0x0000a281, 0x00006240, 0x00006600, 0x0000a6c1,
+			0x0000a781, 0x00006740, 0x0000a501, 0x000065c0, 0x00006480, 0x0000a441,
+			0x00006c00, 0x0000acc1, 0x0000ad81, 0x00006d40, 0x0000af01, 0x00006fc0,
+			0x00006e80, 0x0000ae41, 0x0000aa01, 0x00006ac0, 0x00006b80, 0x0000ab41,
+			0x00006900, 0x0000a9c1, 0x0000a881, 0x00006840, 0x00007800, 0x0000b8c1,
+			0x0000b981, 0x00007940, 0x0000bb01, 0x00007bc0, 0x00007a80, 0x0000ba41,
+			0x0000be01, 0x00007ec0, 0x00007f80, 0x0000bf41, 0x00007d00, 0x0000bdc1,
+			0x0000bc81, 0x00007c40, 0x0000b401, 0x000074c0, 0x00007580, 0x0000b541,
+			0x00007700, 0x0000b7c1, 0x0000b681, 0x00007640, 0x00007200, 0x0000b2c1,
+			0x0000b381, 0x00007340, 0x0000b101, 0x000071c0, 0x00007080, 0x0000b041,
+			0x00005000, 0x000090c1, 0x00009181, 0x00005140, 0x00009301, 0x000053c0,
+			0x00005280, 0x00009241, 0x00009601, 0x000056c0, 0x00005780, 0x00009741,
+			0x00005500, 0x000095c1, 0x00009481, 0x00005440, 0x00009c01, 0x00005cc0,
+			0x00005d80, 0x00009d41, 0x00005f00, 0x00009fc1, 0x00009e81, 0x00005e40,
+			0x00005a00, 0x00009ac1, 0x00009b81, 0x00005b40, 0x00009901, 0x000059c0,
+			0x00005880, 0x00009841, 0x00008801, 0x000048c0, 0x00004980, 0x00008941,
+			0x00004b00, 0x00008bc1, 0x00008a81, 0x00004a40, 0x00004e00, 0x00008ec1,
+			0x00008f81, 0x00004f40, 0x00008d01, 0x00004dc0, 0x00004c80, 0x00008c41,
+			0x00004400, 0x000084c1, 0x00008581, 0x00004540, 0x00008701, 0x000047c0,
+			0x00004680, 0x00008641, 0x00008201, 0x000042c0, 0x00004380, 0x00008341,
+			0x00004100, 0x000081c1, 0x00008081, 0x00004040,
+		},
+		{
+			0x00000000, 0x00009001, 0x00006001, 0x0000f000, 0x0000c002, 0x00005003,
+			0x0000a003, 0x00003002, 0x0000c007, 0x00005006, 0x0000a006, 0x00003007,
+			0x00000005, 0x00009004, 0x00006004, 0x0000f005, 0x0000c00d, 0x0000500c,
+			0x0000a00c, 0x0000300d, 0x0000000f, 0x0000900e, 0x0000600e, 0x0000f00f,
+			0x0000000a, 0x0000900b, 0x0000600b, 0x0000f00a, 0x0000c008, 0x00005009,
+			0x0000a009, 0x00003008, 0x0000c019, 0x00005018, 0x0000a018, 0x00003019,
+			0x0000001b, 0x0000901a, 0x0000601a, 0x0000f01b, 0x0000001e, 0x0000901f,
+			0x0000601f, 0x0000f01e, 0x0000c01c, 0x0000501d, 0x0000a01d, 0x0000301c,
+			0x00000014, 0x00009015, 0x00006015, 0x0000f014, 0x0000c016, 0x00005017,
+			0x0000a017, 0x00003016, 0x0000c013, 0x00005012, 0x0000a012, 0x00003013,
+			0x00000011, 0x00009010, 0x00006010, 0x0000f011, 0x0000c031, 0x00005030,
+			0x0000a030, 0x00003031, 0x00000033, 0x00009032, 0x00006032, 0x0000f033,
+			0x00000036, 0x00009037, 0x00006037, 0x0000f036, 0x0000c034, 0x00005035,
+			0x0000a035, 0x00003034, 0x0000003c, 0x0000903d, 0x0000603d, 0x0000f03c,
+			0x0000c03e, 0x0000503f, 0x0000a03f, 0x0000303e, 0x0000c03b, 0x0000503a,
+			0x0000a03a, 0x0000303b, 0x00000039, 0x00009038, 0x00006038, 0x0000f039,
+			0x00000028, 0x00009029, 0x00006029, 0x0000f028, 0x0000c02a, 0x0000502b,
+			0x0000a02b, 0x0000302a, 0x0000c02f, 0x0000502e, 0x0000a02e, 0x0000302f,
+			0x0000002d, 0x0000902c, 0x0000602c, 0x0000f02d, 0x0000c025, 0x00005024,
+			0x0000a024, 0x00003025, 0x00000027, 0x00009026, 0x00006026, 0x0000f027,
+			0x00000022, 0x00009023, 0x00006023, 0x0000f022, 0x0000c020, 0x00005021,
+			0x0000a021, 0x00003020, 0x0000c061, 0x00005060, 0x0000a060, 0x00003061,
+			0x00000063, 0x00009062, 0x00006062, 0x0000f063, 0x00000066, 0x00009067,
+			0x00006067, 0x0000f066, 0x0000c064, 0x00005065, 0x0000a065, 0x00003064,
+			0x0000006c, 0x0000906d, 0x0000606d, 0x0000f06c, 0x0000c06e, 0x0000506f,
+			0x0000a06f, 0x0000306e, 0x0000c06b, 0x0000506a, 0x0000a06a, 0x0000306b,
+			0x00000069, 0x00009068, 0x00006068, 0x0000f069, 0x00000078, 0x00009079,
+			0x00006079, 0x0000f078, 0x0000c07a, 0x0000507b, 0x0000a07b, 0x0000307a,
+			0x0000c07f, 0x0000507e, 0x0000a07e, 0x0000307f, 0x0000007d, 0x0000907c,
+			0x0000607c, 0x0000f07d, 0x0000c075, 0x00005074, 0x0000a074, 0x00003075,
+			0x00000077, 0x00009076, 0x00006076, 0x0000f077, 0x00000072, 0x00009073,
+			0x00006073, 0x0000f072, 0x0000c070, 0x00005071, 0x0000a071, 0x00003070,
+			0x00000050, 0x00009051, 0x00006051, 0x0000f050, 0x0000c052, 0x00005053,
+			0x0000a053, 0x00003052, 0x0000c057, 0x00005056, 0x0000a056, 0x00003057,
+			0x00000055, 0x00009054, 0x00006054, 0x0000f055, 0x0000c05d, 0x0000505c,
+			0x0000a05c, 0x0000305d, 0x0000005f, 0x0000905e, 0x0000605e, 0x0000f05f,
+			0x0000005a, 0x0000905b, 0x0000605b, 0x0000f05a, 0x0000c058, 0x00005059,
+			0x0000a059, 0x00003058, 0x0000c049, 0x00005048, 0x0000a048, 0x00003049,
+			0x0000004b, 0x0000904a, 0x0000604a, 0x0000f04b, 0x0000004e, 0x0000904f,
+			0x0000604f, 0x0000f04e, 0x0000c04c, 0x0000504d, 0x0000a04d, 0x0000304c,
+			0x00000044, 0x00009045, 0x00006045, 0x0000f044, 0x0000c046, 0x00005047,
+			0x0000a047, 0x00003046, 0x0000c043, 0x00005042, 0x0000a042, 0x00003043,
+			0x00000041, 0x00009040, 0x00006040, 0x0000f041,
+		},
+		{
+			0x00000000, 0x0000c051, 0x0000c0a1, 0x000000f0, 0x0000c141, 0x00000110,
+			0x000001e0, 0x0000c1b1, 0x0000c281, 0x000002d0, 0x00000220, 0x0000c271,
+			0x000003c0, 0x0000c391, 0x0000c361, 0x00000330, 0x0000c501, 0x00000550,
+			0x000005a0, 0x0000c5f1, 0x00000440, 0x0000c411, 0x0000c4e1, 0x000004b0,
+			0x00000780, 0x0000c7d1, 0x0000c721, 0x00000770, 0x0000c6c1, 0x00000690,
+			0x00000660, 0x0000c631, 0x0000ca01, 0x00000a50, 0x00000aa0, 0x0000caf1,
+			0x00000b40, 0x0000cb11, 0x0000cbe1, 0x00000bb0, 0x00000880, 0x0000c8d1,
+			0x0000c821, 0x00000870, 0x0000c9c1, 0x00000990, 0x00000960, 0x0000c931,
+			0x00000f00, 0x0000cf51, 0x0000cfa1, 0x00000ff0, 0x0000ce41, 0x00000e10,
+			0x00000ee0, 0x0000ceb1, 0x0000cd81, 0x00000dd0, 0x00000d20, 0x0000cd71,
+			0x00000cc0, 0x0000cc91, 0x0000cc61, 0x00000c30, 0x0000d401, 0x00001450,
+			0x000014a0, 0x0000d4f1, 0x00001540, 0x0000d511, 0x0000d5e1, 0x000015b0,
+			0x00001680, 0x0000d6d1, 0x0000d621, 0x00001670, 0x0000d7c1, 0x00001790,
+			0x00001760, 0x0000d731, 0x00001100, 0x0000d151, 0x0000d1a1, 0x000011f0,
+			0x0000d041, 0x00001010, 0x000010e0, 0x0000d0b1, 0x0000d381, 0x000013d0,
+			0x00001320, 0x0000d371, 0x000012c0, 0x0000d291, 0x0000d261, 0x00001230,
+			0x00001e00, 0x0000de51, 0x0000dea1, 0x00001ef0, 0x0000df41, 0x00001f10,
+			0x00001fe0, 0x0000dfb1, 0x0000dc81, 0x00001cd0, 0x00001c20, 0x0000dc71,
+			0x00001dc0, 0x0000dd91, 0x0000dd61, 0x00001d30, 0x0000db01, 0x00001b50,
+			0x00001ba0, 0x0000dbf1, 0x00001a40, 0x0000da11, 0x0000dae1, 0x00001ab0,
+			0x00001980, 0x0000d9d1, 0x0000d921, 0x00001970, 0x0000d8c1, 0x00001890,
+			0x00001860, 0x0000d831, 0x0000e801, 0x00002850, 0x000028a0, 0x0000e8f1,
+			0x00002940, 0x0000e911, 0x0000e9e1, 0x000029b0, 0x00002a80, 0x0000ead1,
+			0x0000ea21, 0x00002a70, 0x0000ebc1, 0x00002b90, 0x00002b60, 0x0000eb31,
+			0x00002d00, 0x0000ed51, 0x0000eda1, 0x00002df0, 0x0000ec41, 0x00002c10,
+			0x00002ce0, 0x0000ecb1, 0x0000ef81, 0x00002fd0, 0x00002f20, 0x0000ef71,
+			0x00002ec0, 0x0000ee91, 0x0000ee61, 0x00002e30, 0x00002200, 0x0000e251,
+			0x0000e2a1, 0x000022f0, 0x0000e341, 0x00002310, 0x000023e0, 0x0000e3b1,
+			0x0000e081, 0x000020d0, 0x00002020, 0x0000e071, 0x000021c0, 0x0000e191,
+			0x0000e161, 0x00002130, 0x0000e701, 0x00002750, 0x000027a0, 0x0000e7f1,
+			0x00002640, 0x0000e611, 0x0000e6e1, 0x000026b0, 0x00002580, 0x0000e5d1,
+			0x0000e521, 0x00002570, 0x0000e4c1, 0x00002490, 0x00002460, 0x0000e431,
+			0x00003c00, 0x0000fc51, 0x0000fca1, 0x00003cf0, 0x0000fd41, 0x00003d10,
+			0x00003de0, 0x0000fdb1, 0x0000fe81, 0x00003ed0, 0x00003e20, 0x0000fe71,
+			0x00003fc0, 0x0000ff91, 0x0000ff61, 0x00003f30, 0x0000f901, 0x00003950,
+			0x000039a0, 0x0000f9f1, 0x00003840, 0x0000f811, 0x0000f8e1, 0x000038b0,
+			0x00003b80, 0x0000fbd1, 0x0000fb21, 0x00003b70, 0x0000fac1, 0x00003a90,
+			0x00003a60, 0x0000fa31, 0x0000f601, 0x00003650, 0x000036a0, 0x0000f6f1,
+			0x00003740, 0x0000f711, 0x0000f7e1, 0x000037b0, 0x00003480, 0x0000f4d1,
+			0x0000f421, 0x00003470, 0x0000f5c1, 0x00003590, 0x00003560, 0x0000f531,
+			0x00003300, 0x0000f351, 0x0000f3a1, 0x000033f0, 0x0000f241, 0x00003210,
+			0x000032e0, 0x0000f2b1, 0x0000f181, 0x000031d0, 0x00003120, 0x0000f171,
+			0x000030c0, 0x0000f091, 0x0000f061, 0x00003030,
+		},
+		{
+			0x00000000, 0x0000fc01, 0x0000b801, 0x00004400, 0x00003001, 0x0000cc00,
+			0x00008800, 0x00007401, 0x00006002, 0x00009c03, 0x0000d803, 0x00002402,
+			0x00005003, 0x0000ac02, 0x0000e802, 0x00001403, 0x0000c004, 0x00003c05,
+			0x00007805, 0x00008404, 0x0000f005, 0x00000c04, 0x00004804, 0x0000b405,
+			0x0000a006, 0x00005c07, 0x00001807, 0x0000e406, 0x00009007, 0x00006c06,
+			0x00002806, 0x0000d407, 0x0000c00b, 0x00003c0a, 0x0000780a, 0x0000840b,
+			0x0000f00a, 0x00000c0b, 0x0000480b, 0x0000b40a, 0x0000a009, 0x00005c08,
+			0x00001808, 0x0000e409, 0x00009008, 0x00006c09, 0x00002809, 0x0000d408,
+			0x0000000f, 0x0000fc0e, 0x0000b80e, 0x0000440f, 0x0000300e, 0x0000cc0f,
+			0x0000880f, 0x0000740e, 0x0000600d, 0x00009c0c, 0x0000d80c, 0x0000240d,
+			0x0000500c, 0x0000ac0d, 0x0000e80d, 0x0000140c, 0x0000c015, 0x00003c14,
+			0x00007814, 0x00008415, 0x0000f014, 0x00000c15, 0x00004815, 0x0000b414,
+			0x0000a017, 0x00005c16, 0x00001816, 0x0000e417, 0x00009016, 0x00006c17,
+			0x00002817, 0x0000d416, 0x00000011, 0x0000fc10, 0x0000b810, 0x00004411,
+			0x00003010, 0x0000cc11, 0x00008811, 0x00007410, 0x00006013, 0x00009c12,
+			0x0000d812, 0x00002413, 0x00005012, 0x0000ac13, 0x0000e813, 0x00001412,
+			0x0000001e, 0x0000fc1f, 0x0000b81f, 0x0000441e, 0x0000301f, 0x0000cc1e,
+			0x0000881e, 0x0000741f, 0x0000601c, 0x00009c1d, 0x0000d81d, 0x0000241c,
+			0x0000501d, 0x0000ac1c, 0x0000e81c, 0x0000141d, 0x0000c01a, 0x00003c1b,
+			0x0000781b, 0x0000841a, 0x0000f01b, 0x00000c1a, 0x0000481a, 0x0000b41b,
+			0x0000a018, 0x00005c19, 0x00001819, 0x0000e418, 0x00009019, 0x00006c18,
+			0x00002818, 0x0000d419, 0x0000c029, 0x00003c28, 0x00007828, 0x00008429,
+			0x0000f028, 0x00000c29, 0x00004829, 0x0000b428, 0x0000a02b, 0x00005c2a,
+			0x0000182a, 0x0000e42b, 0x0000902a, 0x00006c2b, 0x0000282b, 0x0000d42a,
+			0x0000002d, 0x0000fc2c, 0x0000b82c, 0x0000442d, 0x0000302c, 0x0000cc2d,
+			0x0000882d, 0x0000742c, 0x0000602f, 0x00009c2e, 0x0000d82e, 0x0000242f,
+			0x0000502e, 0x0000ac2f, 0x0000e82f, 0x0000142e, 0x00000022, 0x0000fc23,
+			0x0000b823, 0x00004422, 0x00003023, 0x0000cc22, 0x00008822, 0x00007423,
+			0x00006020, 0x00009c21, 0x0000d821, 0x00002420, 0x00005021, 0x0000ac20,
+			0x0000e820, 0x00001421, 0x0000c026, 0x00003c27, 0x00007827, 0x00008426,
+			0x0000f027, 0x00000c26, 0x00004826, 0x0000b427, 0x0000a024, 0x00005c25,
+			0x00001825, 0x0000e424, 0x00009025, 0x00006c24, 0x00002824, 0x0000d425,
+			0x0000003c, 0x0000fc3d, 0x0000b83d, 0x0000443c, 0x0000303d, 0x0000cc3c,
+			0x0000883c, 0x0000743d, 0x0000603e, 0x00009c3f, 0x0000d83f, 0x0000243e,
+			0x0000503f, 0x0000ac3e, 0x0000e83e, 0x0000143f, 0x0000c038, 0x00003c39,
+			0x00007839, 0x00008438, 0x0000f039, 0x00000c38, 0x00004838, 0x0000b439,
+			0x0000a03a, 0x00005c3b, 0x0000183b, 0x0000e43a, 0x0000903b, 0x00006c3a,
+			0x0000283a, 0x0000d43b, 0x0000c037, 0x00003c36, 0x00007836, 0x00008437,
+			0x0000f036, 0x00000c37, 0x00004837, 0x0000b436, 0x0000a035, 0x00005c34,
+			0x00001834, 0x0000e435, 0x00009034, 0x00006c35, 0x00002835, 0x0000d434,
+			0x00000033, 0x0000fc32, 0x0000b832, 0x00004433, 0x00003032, 0x0000cc33,
+			0x00008833, 0x00007432, 0x00006031, 0x00009c30, 0x0000d830, 0x00002431,
+			0x00005030, 0x0000ac31, 0x0000e831, 0x00001430,
+		},
+		{
+			0x00000000, 0x0000c03d, 0x0000c079, 0x00000044, 0x0000c0f1, 0x000000cc,
+			0x00000088, 0x0000c0b5, 0x0000c1e1, 0x000001dc, 0x00000198, 0x0000c1a5,
+			0x00000110, 0x0000c12d, 0x0000c169, 0x00000154, 0x0000c3c1, 0x000003fc,
+			0x000003b8, 0x0000c385, 0x00000330, 0x0000c30d, 0x0000c349, 0x00000374,
+			0x00000220, 0x0000c21d, 0x0000c259, 0x00000264, 0x0000c2d1, 0x000002ec,
+			0x000002a8, 0x0000c295, 0x0000c781, 0x000007bc, 0x000007f8, 0x0000c7c5,
+			0x00000770, 0x0000c74d, 0x0000c709, 0x00000734, 0x00000660, 0x0000c65d,
+			0x0000c619, 0x00000624, 0x0000c691, 0x000006ac, 0x000006e8, 0x0000c6d5,
+			0x00000440, 0x0000c47d, 0x0000c439, 0x00000404, 0x0000c4b1, 0x0000048c,
+			0x000004c8, 0x0000c4f5, 0x0000c5a1, 0x0000059c, 0x000005d8, 0x0000c5e5,
+			0x00000550, 0x0000c56d, 0x0000c529, 0x00000514, 0x0000cf01, 0x00000f3c,
+			0x00000f78, 0x0000cf45, 0x00000ff0, 0x0000cfcd, 0x0000cf89, 0x00000fb4,
+			0x00000ee0, 0x0000cedd, 0x0000ce99, 0x00000ea4, 0x0000ce11, 0x00000e2c,
+			0x00000e68, 0x0000ce55, 0x00000cc0, 0x0000ccfd, 0x0000ccb9, 0x00000c84,
+			0x0000cc31, 0x00000c0c, 0x00000c48, 0x0000cc75, 0x0000cd21, 0x00000d1c,
+			0x00000d58, 0x0000cd65, 0x00000dd0, 0x0000cded, 0x0000cda9, 0x00000d94,
+			0x00000880, 0x0000c8bd, 0x0000c8f9, 0x000008c4, 0x0000c871, 0x0000084c,
+			0x00000808, 0x0000c835, 0x0000c961, 0x0000095c, 0x00000918, 0x0000c925,
+			0x00000990, 0x0000c9ad, 0x0000c9e9, 0x000009d4, 0x0000cb41, 0x00000b7c,
+			0x00000b38, 0x0000cb05, 0x00000bb0, 0x0000cb8d, 0x0000cbc9, 0x00000bf4,
+			0x00000aa0, 0x0000ca9d, 0x0000cad9, 0x00000ae4, 0x0000ca51, 0x00000a6c,
+			0x00000a28, 0x0000ca15, 0x0000de01, 0x00001e3c, 0x00001e78, 0x0000de45,
+			0x00001ef0, 0x0000decd, 0x0000de89, 0x00001eb4, 0x00001fe0, 0x0000dfdd,
+			0x0000df99, 0x00001fa4, 0x0000df11, 0x00001f2c, 0x00001f68, 0x0000df55,
+			0x00001dc0, 0x0000ddfd, 0x0000ddb9, 0x00001d84, 0x0000dd31, 0x00001d0c,
+			0x00001d48, 0x0000dd75, 0x0000dc21, 0x00001c1c, 0x00001c58, 0x0000dc65,
+			0x00001cd0, 0x0000dced, 0x0000dca9, 0x00001c94, 0x00001980, 0x0000d9bd,
+			0x0000d9f9, 0x000019c4, 0x0000d971, 0x0000194c, 0x00001908, 0x0000d935,
+			0x0000d861, 0x0000185c, 0x00001818, 0x0000d825, 0x00001890, 0x0000d8ad,
+			0x0000d8e9, 0x000018d4, 0x0000da41, 0x00001a7c, 0x00001a38, 0x0000da05,
+			0x00001ab0, 0x0000da8d, 0x0000dac9, 0x00001af4, 0x00001ba0, 0x0000db9d,
+			0x0000dbd9, 0x00001be4, 0x0000db51, 0x00001b6c, 0x00001b28, 0x0000db15,
+			0x00001100, 0x0000d13d, 0x0000d179, 0x00001144, 0x0000d1f1, 0x000011cc,
+			0x00001188, 0x0000d1b5, 0x0000d0e1, 0x000010dc, 0x00001098, 0x0000d0a5,
+			0x00001010, 0x0000d02d, 0x0000d069, 0x00001054, 0x0000d2c1, 0x000012fc,
+			0x000012b8, 0x0000d285, 0x00001230, 0x0000d20d, 0x0000d249, 0x00001274,
+			0x00001320, 0x0000d31d, 0x0000d359, 0x00001364, 0x0000d3d1, 0x000013ec,
+			0x000013a8, 0x0000d395, 0x0000d681, 0x000016bc, 0x000016f8, 0x0000d6c5,
+			0x00001670, 0x0000d64d, 0x0000d609, 0x00001634, 0x00001760, 0x0000d75d,
+			0x0000d719, 0x00001724, 0x0000d791, 0x000017ac, 0x000017e8, 0x0000d7d5,
+			0x00001540, 0x0000d57d, 0x0000d539, 0x00001504, 0x0000d5b1, 0x0000158c,
+			0x000015c8, 0x0000d5f5, 0x0000d4a1, 0x0000149c, 0x000014d8, 0x0000d4e5,
+			0x00001450, 0x0000d46d, 0x0000d429, 0x00001414,
+		},
+		{
+			0x00000000, 0x0000d101, 0x0000e201, 0x00003300, 0x00008401, 0x00005500,
+			0x00006600, 0x0000b701, 0x00004801, 0x00009900, 0x0000aa00, 0x00007b01,
+			0x0000cc00, 0x00001d01, 0x00002e01, 0x0000ff00, 0x00009002, 0x00004103,
+			0x00007203, 0x0000a302, 0x00001403, 0x0000c502, 0x0000f602, 0x00002703,
+			0x0000d803, 0x00000902, 0x00003a02, 0x0000eb03, 0x00005c02, 0x00008d03,
+			0x0000be03, 0x00006f02, 0x00006007, 0x0000b106, 0x00008206, 0x00005307,
+			0x0000e406, 0x00003507, 0x00000607, 0x0000d706, 0x00002806, 0x0000f907,
+			0x0000ca07, 0x00001b06, 0x0000ac07, 0x00007d06, 0x00004e06, 0x00009f07,
+			0x0000f005, 0x00002104, 0x00001204, 0x0000c305, 0x00007404, 0x0000a505,
+			0x00009605, 0x00004704, 0x0000b804, 0x00006905, 0x00005a05, 0x00008b04,
+			0x00003c05, 0x0000ed04, 0x0000de04, 0x00000f05, 0x0000c00e, 0x0000110f,
+			0x0000220f, 0x0000f30e, 0x0000440f, 0x0000950e, 0x0000a60e, 0x0000770f,
+			0x0000880f, 0x0000590e, 0x00006a0e, 0x0000bb0f, 0x00000c0e, 0x0000dd0f,
+			0x0000ee0f, 0x00003f0e, 0x0000500c, 0x0000810d, 0x0000b20d, 0x0000630c,
+			0x0000d40d, 0x0000050c, 0x0000360c, 0x0000e70d, 0x0000180d, 0x0000c90c,
+			0x0000fa0c, 0x00002b0d, 0x00009c0c, 0x00004d0d, 0x00007e0d, 0x0000af0c,
+			0x0000a009, 0x00007108, 0x00004208, 0x00009309, 0x00002408, 0x0000f509,
+			0x0000c609, 0x00001708, 0x0000e808, 0x00003909, 0x00000a09, 0x0000db08,
+			0x00006c09, 0x0000bd08, 0x00008e08, 0x00005f09, 0x0000300b, 0x0000e10a,
+			0x0000d20a, 0x0000030b, 0x0000b40a, 0x0000650b, 0x0000560b, 0x0000870a,
+			0x0000780a, 0x0000a90b, 0x00009a0b, 0x00004b0a, 0x0000fc0b, 0x00002d0a,
+			0x00001e0a, 0x0000cf0b, 0x0000c01f, 0x0000111e, 0x0000221e, 0x0000f31f,
+			0x0000441e, 0x0000951f, 0x0000a61f, 0x0000771e, 0x0000881e, 0x0000591f,
+			0x00006a1f, 0x0000bb1e, 0x00000c1f, 0x0000dd1e, 0x0000ee1e, 0x00003f1f,
+			0x0000501d, 0x0000811c, 0x0000b21c, 0x0000631d, 0x0000d41c, 0x0000051d,
+			0x0000361d, 0x0000e71c, 0x0000181c, 0x0000c91d, 0x0000fa1d, 0x00002b1c,
+			0x00009c1d, 0x00004d1c, 0x00007e1c, 0x0000af1d, 0x0000a018, 0x00007119,
+			0x00004219, 0x00009318, 0x00002419, 0x0000f518, 0x0000c618, 0x00001719,
+			0x0000e819, 0x00003918, 0x00000a18, 0x0000db19, 0x00006c18, 0x0000bd19,
+			0x00008e19, 0x00005f18, 0x0000301a, 0x0000e11b, 0x0000d21b, 0x0000031a,
+			0x0000b41b, 0x0000651a, 0x0000561a, 0x0000871b, 0x0000781b, 0x0000a91a,
+			0x00009a1a, 0x00004b1b, 0x0000fc1a, 0x00002d1b, 0x00001e1b, 0x0000cf1a,
+			0x00000011, 0x0000d110, 0x0000e210, 0x00003311, 0x00008410, 0x00005511,
+			0x00006611, 0x0000b710, 0x00004810, 0x00009911, 0x0000aa11, 0x00007b10,
+			0x0000cc11, 0x00001d10, 0x00002e10, 0x0000ff11, 0x00009013, 0x00004112,
+			0x00007212, 0x0000a313, 0x00001412, 0x0000c513, 0x0000f613, 0x00002712,
+			0x0000d812, 0x00000913, 0x00003a13, 0x0000eb12, 0x00005c13, 0x00008d12,
+			0x0000be12, 0x00006f13, 0x00006016, 0x0000b117, 0x00008217, 0x00005316,
+			0x0000e417, 0x00003516, 0x00000616, 0x0000d717, 0x00002817, 0x0000f916,
+			0x0000ca16, 0x00001b17, 0x0000ac16, 0x00007d17, 0x00004e17, 0x00009f16,
+			0x0000f014, 0x00002115, 0x00001215, 0x0000c314, 0x00007415, 0x0000a514,
+			0x00009614, 0x00004715, 0x0000b815, 0x00006914, 0x00005a14, 0x00008b15,
+			0x00003c14, 0x0000ed15, 0x0000de15, 0x00000f14,
+		},
+		{
+			0x00000000, 0x0000c010, 0x0000c023, 0x00000033, 0x0000c045, 0x00000055,
+			0x00000066, 0x0000c076, 0x0000c089, 0x00000099, 0x000000aa, 0x0000c0ba,
+			0x000000cc, 0x0000c0dc, 0x0000c0ef, 0x000000ff, 0x0000c111, 0x00000101,
+			0x00000132, 0x0000c122, 0x00000154, 0x0000c144, 0x0000c177, 0x00000167,
+			0x00000198, 0x0000c188, 0x0000c1bb, 0x000001ab, 0x0000c1dd, 0x000001cd,
+			0x000001fe, 0x0000c1ee, 0x0000c221, 0x00000231, 0x00000202, 0x0000c212,
+			0x00000264, 0x0000c274, 0x0000c247, 0x00000257, 0x000002a8, 0x0000c2b8,
+			0x0000c28b, 0x0000029b, 0x0000c2ed, 0x000002fd, 0x000002ce, 0x0000c2de,
+			0x00000330, 0x0000c320, 0x0000c313, 0x00000303, 0x0000c375, 0x00000365,
+			0x00000356, 0x0000c346, 0x0000c3b9, 0x000003a9, 0x0000039a, 0x0000c38a,
+			0x000003fc, 0x0000c3ec, 0x0000c3df, 0x000003cf, 0x0000c441, 0x00000451,
+			0x00000462, 0x0000c472, 0x00000404, 0x0000c414, 0x0000c427, 0x00000437,
+			0x000004c8, 0x0000c4d8, 0x0000c4eb, 0x000004fb, 0x0000c48d, 0x0000049d,
+			0x000004ae, 0x0000c4be, 0x00000550, 0x0000c540, 0x0000c573, 0x00000563,
+			0x0000c515, 0x00000505, 0x00000536, 0x0000c526, 0x0000c5d9, 0x000005c9,
+			0x000005fa, 0x0000c5ea, 0x0000059c, 0x0000c58c, 0x0000c5bf, 0x000005af,
+			0x00000660, 0x0000c670, 0x0000c643, 0x00000653, 0x0000c625, 0x00000635,
+			0x00000606, 0x0000c616, 0x0000c6e9, 0x000006f9, 0x000006ca, 0x0000c6da,
+			0x000006ac, 0x0000c6bc, 0x0000c68f, 0x0000069f, 0x0000c771, 0x00000761,
+			0x00000752, 0x0000c742, 0x00000734, 0x0000c724, 0x0000c717, 0x00000707,
+			0x000007f8, 0x0000c7e8, 0x0000c7db, 0x000007cb, 0x0000c7bd, 0x000007ad,
+			0x0000079e, 0x0000c78e, 0x0000c881, 0x00000891, 0x000008a2, 0x0000c8b2,
+			0x000008c4, 0x0000c8d4, 0x0000c8e7, 0x000008f7, 0x00000808, 0x0000c818,
+			0x0000c82b, 0x0000083b, 0x0000c84d, 0x0000085d, 0x0000086e, 0x0000c87e,
+			0x00000990, 0x0000c980, 0x0000c9b3, 0x000009a3, 0x0000c9d5, 0x000009c5,
+			0x000009f6, 0x0000c9e6, 0x0000c919, 0x00000909, 0x0000093a, 0x0000c92a,
+			0x0000095c, 0x0000c94c, 0x0000c97f, 0x0000096f, 0x00000aa0, 0x0000cab0,
+			0x0000ca83, 0x00000a93, 0x0000cae5, 0x00000af5, 0x00000ac6, 0x0000cad6,
+			0x0000ca29, 0x00000a39, 0x00000a0a, 0x0000ca1a, 0x00000a6c, 0x0000ca7c,
+			0x0000ca4f, 0x00000a5f, 0x0000cbb1, 0x00000ba1, 0x00000b92, 0x0000cb82,
+			0x00000bf4, 0x0000cbe4, 0x0000cbd7, 0x00000bc7, 0x00000b38, 0x0000cb28,
+			0x0000cb1b, 0x00000b0b, 0x0000cb7d, 0x00000b6d, 0x00000b5e, 0x0000cb4e,
+			0x00000cc0, 0x0000ccd0, 0x0000cce3, 0x00000cf3, 0x0000cc85, 0x00000c95,
+			0x00000ca6, 0x0000ccb6, 0x0000cc49, 0x00000c59, 0x00000c6a, 0x0000cc7a,
+			0x00000c0c, 0x0000cc1c, 0x0000cc2f, 0x00000c3f, 0x0000cdd1, 0x00000dc1,
+			0x00000df2, 0x0000cde2, 0x00000d94, 0x0000cd84, 0x0000cdb7, 0x00000da7,
+			0x00000d58, 0x0000cd48, 0x0000cd7b, 0x00000d6b, 0x0000cd1d, 0x00000d0d,
+			0x00000d3e, 0x0000cd2e, 0x0000cee1, 0x00000ef1, 0x00000ec2, 0x0000ced2,
+			0x00000ea4, 0x0000ceb4, 0x0000ce87, 0x00000e97, 0x00000e68, 0x0000ce78,
+			0x0000ce4b, 0x00000e5b, 0x0000ce2d, 0x00000e3d, 0x00000e0e, 0x0000ce1e,
+			0x00000ff0, 0x0000cfe0, 0x0000cfd3, 0x00000fc3, 0x0000cfb5, 0x00000fa5,
+			0x00000f96, 0x0000cf86, 0x0000cf79, 0x00000f69, 0x00000f5a, 0x0000cf4a,
+			0x00000f3c, 0x0000cf2c, 0x0000cf1f, 0x00000f0f,
+		},
+		{
+			0x00000000, 0x0000ccc1, 0x0000d981, 0x00001540, 0x0000f301, 0x00003fc0,
+			0x00002a80, 0x0000e641, 0x0000a601, 0x00006ac0, 0x00007f80, 0x0000b341,
+			0x00005500, 0x000099c1, 0x00008c81, 0x00004040, 0x00000c01, 0x0000c0c0,
+			0x0000d580, 0x00001941, 0x0000ff00, 0x000033c1, 0x00002681, 0x0000ea40,
+			0x0000aa00, 0x000066c1, 0x00007381, 0x0000bf40, 0x00005901, 0x000095c0,
+			0x00008080, 0x00004c41, 0x00001802, 0x0000d4c3, 0x0000c183, 0x00000d42,
+			0x0000eb03, 0x000027c2, 0x00003282, 0x0000fe43, 0x0000be03, 0x000072c2,
+			0x00006782, 0x0000ab43, 0x00004d02, 0x000081c3, 0x00009483, 0x00005842,
+			0x00001403, 0x0000d8c2, 0x0000cd82, 0x00000143, 0x0000e702, 0x00002bc3,
+			0x00003e83, 0x0000f242, 0x0000b202, 0x00007ec3, 0x00006b83, 0x0000a742,
+			0x00004103, 0x00008dc2, 0x00009882, 0x00005443, 0x00003004, 0x0000fcc5,
+			0x0000e985, 0x00002544, 0x0000c305, 0x00000fc4, 0x00001a84, 0x0000d645,
+			0x00009605, 0x00005ac4, 0x00004f84, 0x00008345, 0x00006504, 0x0000a9c5,
+			0x0000bc85, 0x00007044, 0x00003c05, 0x0000f0c4, 0x0000e584, 0x00002945,
+			0x0000cf04, 0x000003c5, 0x00001685, 0x0000da44, 0x00009a04, 0x000056c5,
+			0x00004385, 0x00008f44, 0x00006905, 0x0000a5c4, 0x0000b084, 0x00007c45,
+			0x00002806, 0x0000e4c7, 0x0000f187, 0x00003d46, 0x0000db07, 0x000017c6,
+			0x00000286, 0x0000ce47, 0x00008e07, 0x000042c6, 0x00005786, 0x00009b47,
+			0x00007d06, 0x0000b1c7, 0x0000a487, 0x00006846, 0x00002407, 0x0000e8c6,
+			0x0000fd86, 0x00003147, 0x0000d706, 0x00001bc7, 0x00000e87, 0x0000c246,
+			0x00008206, 0x00004ec7, 0x00005b87, 0x00009746, 0x00007107, 0x0000bdc6,
+			0x0000a886, 0x00006447, 0x00006008, 0x0000acc9, 0x0000b989, 0x00007548,
+			0x00009309, 0x00005fc8, 0x00004a88, 0x00008649, 0x0000c609, 0x00000ac8,
+			0x00001f88, 0x0000d349, 0x00003508, 0x0000f9c9, 0x0000ec89, 0x00002048,
+			0x00006c09, 0x0000a0c8, 0x0000b588, 0x00007949, 0x00009f08, 0x000053c9,
+			0x00004689, 0x00008a48, 0x0000ca08, 0x000006c9, 0x00001389, 0x0000df48,
+			0x00003909, 0x0000f5c8, 0x0000e088, 0x00002c49, 0x0000780a, 0x0000b4cb,
+			0x0000a18b, 0x00006d4a, 0x00008b0b, 0x000047ca, 0x0000528a, 0x00009e4b,
+			0x0000de0b, 0x000012ca, 0x0000078a, 0x0000cb4b, 0x00002d0a, 0x0000e1cb,
+			0x0000f48b, 0x0000384a, 0x0000740b, 0x0000b8ca, 0x0000ad8a, 0x0000614b,
+			0x0000870a, 0x00004bcb, 0x00005e8b, 0x0000924a, 0x0000d20a, 0x00001ecb,
+			0x00000b8b, 0x0000c74a, 0x0000210b, 0x0000edca, 0x0000f88a, 0x0000344b,
+			0x0000500c, 0x00009ccd, 0x0000898d, 0x0000454c, 0x0000a30d, 0x00006fcc,
+			0x00007a8c, 0x0000b64d, 0x0000f60d, 0x00003acc, 0x00002f8c, 0x0000e34d,
+			0x0000050c, 0x0000c9cd, 0x0000dc8d, 0x0000104c, 0x00005c0d, 0x000090cc,
+			0x0000858c, 0x0000494d, 0x0000af0c, 0x000063cd, 0x0000768d, 0x0000ba4c,
+			0x0000fa0c, 0x000036cd, 0x0000238d, 0x0000ef4c, 0x0000090d, 0x0000c5cc,
+			0x0000d08c, 0x00001c4d, 0x0000480e, 0x000084cf, 0x0000918f, 0x00005d4e,
+			0x0000bb0f, 0x000077ce, 0x0000628e, 0x0000ae4f, 0x0000ee0f, 0x000022ce,
+			0x0000378e, 0x0000fb4f, 0x00001d0e, 0x0000d1cf, 0x0000c48f, 0x0000084e,
+			0x0000440f, 0x000088ce, 0x00009d8e, 0x0000514f, 0x0000b70e, 0x00007bcf,
+			0x00006e8f, 0x0000a24e, 0x0000e20e, 0x00002ecf, 0x00003b8f, 0x0000f74e,
+			0x0000110f, 0x0000ddce, 0x0000c88e, 0x0000044f,
+		},
+	},
+	{ /* CRC_PRESET_32_ECMA_267 */
+		{
+			0x00000000, 0x80000011, 0x80000033, 0x00000022, 0x80000077, 0x00000066,
+			0x00000044, 0x80000055, 0x800000ff, 0x000000ee, 0x000000cc, 0x800000dd,
+			0x00000088, 0x80000099, 0x800000bb, 0x000000aa, 0x800001ef, 0x000001fe,
+			0x000001dc, 0x800001cd, 0x00000198, 0x80000189, 0x800001ab, 0x000001ba,
+			0x00000110, 0x80000101, 0x80000123, 0x00000132, 0x80000167, 0x00000176,
+			0x00000154, 0x80000145, 0x800003cf, 0x000003de, 0x000003fc, 0x800003ed,
+			0x000003b8, 0x800003a9, 0x8000038b, 0x0000039a, 0x00000330, 0x80000321,
+			0x80000303, 0x00000312, 0x80000347, 0x00000356, 0x00000374, 0x80000365,
+			0x00000220, 0x80000231, 0x80000213, 0x00000202, 0x80000257, 0x00000246,
+			0x00000264, 0x80000275, 0x800002df, 0x000002ce, 0x000002ec, 0x800002fd,
+			0x000002a8, 0x800002b9, 0x8000029b, 0x0000028a, 0x8000078f, 0x0000079e,
+			0x000007bc, 0x800007ad, 0x000007f8, 0x800007e9, 0x800007cb, 0x000007da,
+			0x00000770, 0x80000761, 0x80000743, 0x00000752, 0x80000707, 0x00000716,
+			0x00000734, 0x80000725, 0x00000660, 0x80000671, 0x80000653, 0x00000642,
+			0x80000617, 0x00000606, 0x00000624, 0x80000635, 0x8000069f, 0x0000068e,
+			0x000006ac, 0x800006bd, 0x000006e8, 0x800006f9, 0x800006db, 0x000006ca,
+			0x00000440, 0x80000451, 0x80000473, 0x00000462, 0x80000437, 0x00000426,
+			0x00000404, 0x80000415, 0x800004bf, 0x000004ae, 0x0000048c, 0x8000049d,
+			0x000004c8, 0x800004d9, 0x800004fb, 0x000004ea, 0x800005af, 0x000005be,
+			0x0000059c, 0x8000058d, 0x000005d8, 0x800005c9, 0x800005eb, 0x000005fa,
+			0x00000550, 0x80000541, 0x80000563, 0x00000572, 0x80000527, 0x00000536,
+			0x00000514, 0x80000505, 0x80000f0f, 0x00000f1e, 0x00000f3c, 0x80000f2d,
+			0x00000f78, 0x80000f69, 0x80000f4b, 0x00000f5a, 0x00000ff0, 0x80000fe1,
+			0x80000fc3, 0x00000fd2, 0x80000f87, 0x00000f96, 0x00000fb4, 0x80000fa5,
+			0x00000ee0, 0x80000ef1, 0x80000ed3, 0x00000ec2, 0x80000e97, 0x00000e86,
+			0x00000ea4, 0x80000eb5, 0x80000e1f, 0x00000e0e, 0x00000e2c, 0x80000e3d,
+			0x00000e68, 0x80000e79, 0x80000e5b, 0x00000e4a, 0x00000cc0, 0x80000cd1,
+			0x80000cf3, 0x00000ce2, 0x80000cb7, 0x00000ca6, 0x00000c84, 0x80000c95,
+			0x80000c3f, 0x00000c2e, 0x00000c0c, 0x80000c1d, 0x00000c48, 0x80000c59,
+			0x80000c7b, 0x00000c6a, 0x80000d2f, 0x00000d3e, 0x00000d1c, 0x80000d0d,
+			0x00000d58, 0x80000d49, 0x80000d6b, 0x00000d7a, 0x00000dd0, 0x80000dc1,
+			0x80000de3, 0x00000df2, 0x80000da7, 0x00000db6, 0x00000d94, 0x80000d85,
+			0x00000880, 0x80000891, 0x800008b3, 0x000008a2, 0x800008f7, 0x000008e6,
+			0x000008c4, 0x800008d5, 0x8000087f, 0x0000086e, 0x0000084c, 0x8000085d,
+			0x00000808, 0x80000819, 0x8000083b, 0x0000082a, 0x8000096f, 0x0000097e,
+			0x0000095c, 0x8000094d, 0x00000918, 0x80000909, 0x8000092b, 0x0000093a,
+			0x00000990, 0x80000981, 0x800009a3, 0x000009b2, 0x800009e7, 0x000009f6,
+			0x000009d4, 0x800009c5, 0x80000b4f, 0x00000b5e, 0x00000b7c, 0x80000b6d,
+			0x00000b38, 0x80000b29, 0x80000b0b, 0x00000b1a, 0x00000bb0, 0x80000ba1,
+			0x80000b83, 0x00000b92, 0x80000bc7, 0x00000bd6, 0x00000bf4, 0x80000be5,
+			0x00000aa0, 0x80000ab1, 0x80000a93, 0x00000a82, 0x80000ad7, 0x00000ac6,
+			0x00000ae4, 0x80000af5, 0x80000a5f, 0x00000a4e, 0x00000a6c, 0x80000a7d,
+			0x00000a28, 0x80000a39, 0x80000a1b, 0x00000a0a,
+		},
+		{
+			0x00000000, 0x80001e0f, 0x80003c0f, 0x00002200, 0x8000780f, 0x00006600,
+			0x00004400, 0x80005a0f, 0x8000f00f, 0x0000ee00, 0x0000cc00, 0x8000d20f,
+			0x00008800, 0x8000960f, 0x8000b40f, 0x0000aa00, 0x8001e00f, 0x0001fe00,
+			0x0001dc00, 0x8001c20f, 0x00019800, 0x8001860f, 0x8001a40f, 0x0001ba00,
+			0x00011000, 0x80010e0f, 0x80012c0f, 0x00013200, 0x8001680f, 0x00017600,
+			0x00015400, 0x80014a0f, 0x8003c00f, 0x0003de00, 0x0003fc00, 0x8003e20f,
+			0x0003b800, 0x8003a60f, 0x8003840f, 0x00039a00, 0x00033000, 0x80032e0f,
+			0x80030c0f, 0x00031200, 0x8003480f, 0x00035600, 0x00037400, 0x80036a0f,
+			0x00022000, 0x80023e0f, 0x80021c0f, 0x00020200, 0x8002580f, 0x00024600,
+			0x00026400, 0x80027a0f, 0x8002d00f, 0x0002ce00, 0x0002ec00, 0x8002f20f,
+			0x0002a800, 0x8002b60f, 0x8002940f, 0x00028a00, 0x8007800f, 0x00079e00,
+			0x0007bc00, 0x8007a20f, 0x0007f800, 0x8007e60f, 0x8007c40f, 0x0007da00,
+			0x00077000, 0x80076e0f, 0x80074c0f, 0x00075200, 0x8007080f, 0x00071600,
+			0x00073400, 0x80072a0f, 0x00066000, 0x80067e0f, 0x80065c0f, 0x00064200,
+			0x8006180f, 0x00060600, 0x00062400, 0x80063a0f, 0x8006900f, 0x00068e00,
+			0x0006ac00, 0x8006b20f, 0x0006e800, 0x8006f60f, 0x8006d40f, 0x0006ca00,
+			0x00044000, 0x80045e0f, 0x80047c0f, 0x00046200, 0x8004380f, 0x00042600,
+			0x00040400, 0x80041a0f, 0x8004b00f, 0x0004ae00, 0x00048c00, 0x8004920f,
+			0x0004c800, 0x8004d60f, 0x8004f40f, 0x0004ea00, 0x8005a00f, 0x0005be00,
+			0x00059c00, 0x8005820f, 0x0005d800, 0x8005c60f, 0x8005e40f, 0x0005fa00,
+			0x00055000, 0x80054e0f, 0x80056c0f, 0x00057200, 0x8005280f, 0x00053600,
+			0x00051400, 0x80050a0f, 0x800f000f, 0x000f1e00, 0x000f3c00, 0x800f220f,
+			0x000f7800, 0x800f660f, 0x800f440f, 0x000f5a00, 0x000ff000, 0x800fee0f,
+			0x800fcc0f, 0x000fd200, 0x800f880f, 0x000f9600, 0x000fb400, 0x800faa0f,
+			0x000ee000, 0x800efe0f, 0x800edc0f, 0x000ec200, 0x800e980f, 0x000e8600,
+			0x000ea400, 0x800eba0f, 0x800e100f, 0x000e0e00, 0x000e2c00, 0x800e320f,
+			0x000e6800, 0x800e760f, 0x800e540f, 0x000e4a00, 0x000cc000, 0x800cde0f,
+			0x800cfc0f, 0x000ce200, 0x800cb80f, 0x000ca600, 0x000c8400, 0x800c9a0f,
+			0x800c300f, 0x000c2e00, 0x000c0c00, 0x800c120f, 0x000c4800, 0x800c560f,
+			0x800c740f, 0x000c6a00, 0x800d200f, 0x000d3e00, 0x000d1c00, 0x800d020f,
+			0x000d5800, 0x800d460f, 0x800d640f, 0x000d7a00, 0x000dd000, 0x800dce0f,
+			0x800dec0f, 0x000df200, 0x800da80f, 0x000db600, 0x000d9400, 0x800d8a0f,
+			0x00088000, 0x80089e0f, 0x8008bc0f, 0x0008a200, 0x8008f80f, 0x0008e600,
+			0x0008c400, 0x8008da0f, 0x8008700f, 0x00086e00, 0x00084c00, 0x8008520f,
+			0x00080800, 0x8008160f, 0x8008340f, 0x00082a00, 0x8009600f, 0x00097e00,
+			0x00095c00, 0x8009420f, 0x00091800, 0x8009060f, 0x8009240f, 0x00093a00,
+			0x00099000, 0x80098e0f, 0x8009ac0f, 0x0009b200, 0x8009e80f, 0x0009f600,
+			0x0009d400, 0x8009ca0f, 0x800b400f, 0x000b5e00, 0x000b7c00, 0x800b620f,
+			0x000b3800, 0x800b260f, 0x800b040f, 0x000b1a00, 0x000bb000, 0x800bae0f,
+			0x800b8c0f, 0x000b9200, 0x800bc80f, 0x000bd600, 0x000bf400, 0x800bea0f,
+			0x000aa000, 0x800abe0f, 0x800a9c0f, 0x000a8200, 0x800ad80f, 0x000ac600,
+			0x000ae400, 0x800afa0f, 0x800a500f, 0x000a4e00, 0x000a6c00, 0x800a720f,
+			0x000a2800, 0x800a360f, 0x800a140f, 0x000a0a00,
+		},
+		{
+			0x00000000, 0x801e000f, 0x803c000f, 0x00220000, 0x8078000f, 0x00660000,
+			0x00440000, 0x805a000f, 0x80f0000f, 0x00ee0000, 0x00cc0000, 0x80d2000f,
+			0x00880000, 0x8096000f, 0x80b4000f, 0x00aa0000, 0x81e0000f, 0x01fe0000,
+			0x01dc0000, 0x81c2000f, 0x01980000, 0x8186000f, 0x81a4000f, 0x01ba0000,
+			0x01100000, 0x810e000f, 0x812c000f, 0x01320000, 0x8168000f, 0x01760000,
+			0x01540000, 0x814a000f, 0x83c0000f, 0x03de0000, 0x03fc0000, 0x83e2000f,
+			0x03b80000, 0x83a6000f, 0x8384000f, 0x039a0000, 0x03300000, 0x832e000f,
+			0x830c000f, 0x03120000, 0x8348000f, 0x03560000, 0x03740000, 0x836a000f,
+			0x02200000, 0x823e000f, 0x821c000f, 0x02020000, 0x8258000f, 0x02460000,
+			0x02640000, 0x827a000f, 0x82d0000f, 0x02ce0000, 0x02ec0000, 0x82f2000f,
+			0x02a80000, 0x82b6000f, 0x8294000f, 0x028a0000, 0x8780000f, 0x079e0000,
+			0x07bc0000, 0x87a2000f, 0x07f80000, 0x87e6000f, 0x87c4000f, 0x07da0000,
+			0x07700000, 0x876e000f, 0x874c000f, 0x07520000, 0x8708000f, 0x07160000,
+			0x07340000, 0x872a000f, 0x06600000, 0x867e000f, 0x865c000f, 0x06420000,
+			0x8618000f, 0x06060000, 0x06240000, 0x863a000f, 0x8690000f, 0x068e0000,
+			0x06ac0000, 0x86b2000f, 0x06e80000, 0x86f6000f, 0x86d4000f, 0x06ca0000,
+			0x04400000, 0x845e000f, 0x847c000f, 0x04620000, 0x8438000f, 0x04260000,
+			0x04040000, 0x841a000f, 0x84b0000f, 0x04ae0000, 0x048c0000, 0x8492000f,
+			0x04c80000, 0x84d6000f, 0x84f4000f, 0x04ea0000, 0x85a0000f, 0x05be0000,
+			0x059c0000, 0x8582000f, 0x05d80000, 0x85c6000f, 0x85e4000f, 0x05fa0000,
+			0x05500000, 0x854e000f, 0x856c000f, 0x05720000, 0x8528000f, 0x05360000,
+			0x05140000, 0x850a000f, 0x8f00000f, 0x0f1e0000, 0x0f3c0000, 0x8f22000f,
+			0x0f780000, 0x8f66000f, 0x8f44000f, 0x0f5a0000, 0x0ff00000, 0x8fee000f,
+			0x8fcc000f, 0x0fd20000, 0x8f88000f, 0x0f960000, 0x0fb40000, 0x8faa000f,
+			0x0ee00000, 0x8efe000f, 0x8edc000f, 0x0ec20000, 0x8e98000f, 0x0e860000,
+			0x0ea40000, 0x8eba000f, 0x8e10000f, 0x0e0e0000, 0x0e2c0000, 0x8e32000f,
+			0x0e680000, 0x8e76000f, 0x8e54000f, 0x0e4a0000, 0x0cc00000, 0x8cde000f,
+			0x8cfc000f, 0x0ce20000, 0x8cb8000f, 0x0ca60000, 0x0c840000, 0x8c9a000f,
+			0x8c30000f, 0x0c2e0000, 0x0c0c0000, 0x8c12000f, 0x0c480000, 0x8c56000f,
+			0x8c74000f, 0x0c6a0000, 0x8d20000f, 0x0d3e0000, 0x0d1c0000, 0x8d02000f,
+			0x0d580000, 0x8d46000f, 0x8d64000f, 0x0d7a0000, 0x0dd00000, 0x8dce000f,
+			0x8dec000f, 0x0df20000, 0x8da8000f, 0x0db60000, 0x0d940000, 0x8d8a000f,
+			0x08800000, 0x889e000f, 0x88bc000f, 0x08a20000, 0x88f8000f, 0x08e60000,
+			0x08c40000, 0x88da000f, 0x8870000f, 0x086e0000, 0x084c0000, 0x8852000f,
+			0x08080000, 0x8816000f, 0x8834000f, 0x082a0000, 0x8960000f, 0x097e0000,
+			0x095c0000, 0x8942000f, 0x09180000, 0x8906000f, 0x8924000f, 0x093a0000,
+			0x09900000, 0x898e000f, 0x89ac000f, 0x09b20000, 0x89e8000f, 0x09f60000,
+			0x09d40000, 0x89ca000f, 0x8b40000f, 0x0b5e0000, 0x0b7c0000, 0x8b62000f,
+			0x0b380000, 0x8b26000f, 0x8b04000f, 0x0b1a0000, 0x0bb00000, 0x8bae000f,
+			0x8b8c000f, 0x0b920000, 0x8bc8000f, 0x0bd60000, 0x0bf40000, 0x8bea000f,
+			0x0aa00000, 0x8abe000f, 0x8a9c000f, 0x0a820000, 0x8ad8000f, 0x0ac60000,
+			0x0ae40000, 0x8afa000f, 0x8a50000f, 0x0a4e0000, 0x0a6c0000, 0x8a72000f,
+			0x0a280000, 0x8a36000f, 0x8a14000f, 0x0a0a0000,
+		},
+		{
+			0x00000000, 0x9e00000f, 0xbc00000f, 0x22000000, 0xf800000f, 0x66000000,
+			0x44000000, 0xda00000f, 0x7000000f, 0xee000000, 0xcc000000, 0x5200000f,
+			0x88000000, 0x1600000f, 0x3400000f, 0xaa000000, 0xe000001e, 0x7e000011,
+			0x5c000011, 0xc200001e, 0x18000011, 0x8600001e, 0xa400001e, 0x3a000011,
+			0x90000011, 0x0e00001e, 0x2c00001e, 0xb2000011, 0x6800001e, 0xf6000011,
+			0xd4000011, 0x4a00001e, 0x4000002d, 0xde000022, 0xfc000022, 0x6200002d,
+			0xb8000022, 0x2600002d, 0x0400002d, 0x9a000022, 0x30000022, 0xae00002d,
+			0x8c00002d, 0x12000022, 0xc800002d, 0x56000022, 0x74000022, 0xea00002d,
+			0xa0000033, 0x3e00003c, 0x1c00003c, 0x82000033, 0x5800003c, 0xc6000033,
+			0xe4000033, 0x7a00003c, 0xd000003c, 0x4e000033, 0x6c000033, 0xf200003c,
+			0x28000033, 0xb600003c, 0x9400003c, 0x0a000033, 0x8000005a, 0x1e000055,
+			0x3c000055, 0xa200005a, 0x78000055, 0xe600005a, 0xc400005a, 0x5a000055,
+			0xf0000055, 0x6e00005a, 0x4c00005a, 0xd2000055, 0x0800005a, 0x96000055,
+			0xb4000055, 0x2a00005a, 0x60000044, 0xfe00004b, 0xdc00004b, 0x42000044,
+			0x9800004b, 0x06000044, 0x24000044, 0xba00004b, 0x1000004b, 0x8e000044,
+			0xac000044, 0x3200004b, 0xe8000044, 0x7600004b, 0x5400004b, 0xca000044,
+			0xc0000077, 0x5e000078, 0x7c000078, 0xe2000077, 0x38000078, 0xa6000077,
+			0x84000077, 0x1a000078, 0xb0000078, 0x2e000077, 0x0c000077, 0x92000078,
+			0x48000077, 0xd6000078, 0xf4000078, 0x6a000077, 0x20000069, 0xbe000066,
+			0x9c000066, 0x02000069, 0xd8000066, 0x46000069, 0x64000069, 0xfa000066,
+			0x50000066, 0xce000069, 0xec000069, 0x72000066, 0xa8000069, 0x36000066,
+			0x14000066, 0x8a000069, 0x800000a5, 0x1e0000aa, 0x3c0000aa, 0xa20000a5,
+			0x780000aa, 0xe60000a5, 0xc40000a5, 0x5a0000aa, 0xf00000aa, 0x6e0000a5,
+			0x4c0000a5, 0xd20000aa, 0x080000a5, 0x960000aa, 0xb40000aa, 0x2a0000a5,
+			0x600000bb, 0xfe0000b4, 0xdc0000b4, 0x420000bb, 0x980000b4, 0x060000bb,
+			0x240000bb, 0xba0000b4, 0x100000b4, 0x8e0000bb, 0xac0000bb, 0x320000b4,
+			0xe80000bb, 0x760000b4, 0x540000b4, 0xca0000bb, 0xc0000088, 0x5e000087,
+			0x7c000087, 0xe2000088, 0x38000087, 0xa6000088, 0x84000088, 0x1a000087,
+			0xb0000087, 0x2e000088, 0x0c000088, 0x92000087, 0x48000088, 0xd6000087,
+			0xf4000087, 0x6a000088, 0x20000096, 0xbe000099, 0x9c000099, 0x02000096,
+			0xd8000099, 0x46000096, 0x64000096, 0xfa000099, 0x50000099, 0xce000096,
+			0xec000096, 0x72000099, 0xa8000096, 0x36000099, 0x14000099, 0x8a000096,
+			0x000000ff, 0x9e0000f0, 0xbc0000f0, 0x220000ff, 0xf80000f0, 0x660000ff,
+			0x440000ff, 0xda0000f0, 0x700000f0, 0xee0000ff, 0xcc0000ff, 0x520000f0,
+			0x880000ff, 0x160000f0, 0x340000f0, 0xaa0000ff, 0xe00000e1, 0x7e0000ee,
+			0x5c0000ee, 0xc20000e1, 0x180000ee, 0x860000e1, 0xa40000e1, 0x3a0000ee,
+			0x900000ee, 0x0e0000e1, 0x2c0000e1, 0xb20000ee, 0x680000e1, 0xf60000ee,
+			0xd40000ee, 0x4a0000e1, 0x400000d2, 0xde0000dd, 0xfc0000dd, 0x620000d2,
+			0xb80000dd, 0x260000d2, 0x040000d2, 0x9a0000dd, 0x300000dd, 0xae0000d2,
+			0x8c0000d2, 0x120000dd, 0xc80000d2, 0x560000dd, 0x740000dd, 0xea0000d2,
+			0xa00000cc, 0x3e0000c3, 0x1c0000c3, 0x820000cc, 0x580000c3, 0xc60000cc,
+			0xe40000cc, 0x7a0000c3, 0xd00000c3, 0x4e0000cc, 0x6c0000cc, 0xf20000c3,
+			0x280000cc, 0xb60000c3, 0x940000c3, 0x0a0000cc,
+		},
+		{
+			0x00000000, 0x8000015b, 0x800002a7, 0x000003fc, 0x8000055f, 0x00000404,
+			0x000007f8, 0x800006a3, 0x80000aaf, 0x00000bf4, 0x00000808, 0x80000953,
+			0x00000ff0, 0x80000eab, 0x80000d57, 0x00000c0c, 0x8000154f, 0x00001414,
+			0x000017e8, 0x800016b3, 0x00001010, 0x8000114b, 0x800012b7, 0x000013ec,
+			0x00001fe0, 0x80001ebb, 0x80001d47, 0x00001c1c, 0x80001abf, 0x00001be4,
+			0x00001818, 0x80001943, 0x80002a8f, 0x00002bd4, 0x00002828, 0x80002973,
+			0x00002fd0, 0x80002e8b, 0x80002d77, 0x00002c2c, 0x00002020, 0x8000217b,
+			0x80002287, 0x000023dc, 0x8000257f, 0x00002424, 0x000027d8, 0x80002683,
+			0x00003fc0, 0x80003e9b, 0x80003d67, 0x00003c3c, 0x80003a9f, 0x00003bc4,
+			0x00003838, 0x80003963, 0x8000356f, 0x00003434, 0x000037c8, 0x80003693,
+			0x00003030, 0x8000316b, 0x80003297, 0x000033cc, 0x8000550f, 0x00005454,
+			0x000057a8, 0x800056f3, 0x00005050, 0x8000510b, 0x800052f7, 0x000053ac,
+			0x00005fa0, 0x80005efb, 0x80005d07, 0x00005c5c, 0x80005aff, 0x00005ba4,
+			0x00005858, 0x80005903, 0x00004040, 0x8000411b, 0x800042e7, 0x000043bc,
+			0x8000451f, 0x00004444, 0x000047b8, 0x800046e3, 0x80004aef, 0x00004bb4,
+			0x00004848, 0x80004913, 0x00004fb0, 0x80004eeb, 0x80004d17, 0x00004c4c,
+			0x00007f80, 0x80007edb, 0x80007d27, 0x00007c7c, 0x80007adf, 0x00007b84,
+			0x00007878, 0x80007923, 0x8000752f, 0x00007474, 0x00007788, 0x800076d3,
+			0x00007070, 0x8000712b, 0x800072d7, 0x0000738c, 0x80006acf, 0x00006b94,
+			0x00006868, 0x80006933, 0x00006f90, 0x80006ecb, 0x80006d37, 0x00006c6c,
+			0x00006060, 0x8000613b, 0x800062c7, 0x0000639c, 0x8000653f, 0x00006464,
+			0x00006798, 0x800066c3, 0x8000aa0f, 0x0000ab54, 0x0000a8a8, 0x8000a9f3,
+			0x0000af50, 0x8000ae0b, 0x8000adf7, 0x0000acac, 0x0000a0a0, 0x8000a1fb,
+			0x8000a207, 0x0000a35c, 0x8000a5ff, 0x0000a4a4, 0x0000a758, 0x8000a603,
+			0x0000bf40, 0x8000be1b, 0x8000bde7, 0x0000bcbc, 0x8000ba1f, 0x0000bb44,
+			0x0000b8b8, 0x8000b9e3, 0x8000b5ef, 0x0000b4b4, 0x0000b748, 0x8000b613,
+			0x0000b0b0, 0x8000b1eb, 0x8000b217, 0x0000b34c, 0x00008080, 0x800081db,
+			0x80008227, 0x0000837c, 0x800085df, 0x00008484, 0x00008778, 0x80008623,
+			0x80008a2f, 0x00008b74, 0x00008888, 0x800089d3, 0x00008f70, 0x80008e2b,
+			0x80008dd7, 0x00008c8c, 0x800095cf, 0x00009494, 0x00009768, 0x80009633,
+			0x00009090, 0x800091cb, 0x80009237, 0x0000936c, 0x00009f60, 0x80009e3b,
+			0x80009dc7, 0x00009c9c, 0x80009a3f, 0x00009b64, 0x00009898, 0x800099c3,
+			0x0000ff00, 0x8000fe5b, 0x8000fda7, 0x0000fcfc, 0x8000fa5f, 0x0000fb04,
+			0x0000f8f8, 0x8000f9a3, 0x8000f5af, 0x0000f4f4, 0x0000f708, 0x8000f653,
+			0x0000f0f0, 0x8000f1ab, 0x8000f257, 0x0000f30c, 0x8000ea4f, 0x0000eb14,
+			0x0000e8e8, 0x8000e9b3, 0x0000ef10, 0x8000ee4b, 0x8000edb7, 0x0000ecec,
+			0x0000e0e0, 0x8000e1bb, 0x8000e247, 0x0000e31c, 0x8000e5bf, 0x0000e4e4,
+			0x0000e718, 0x8000e643, 0x8000d58f, 0x0000d4d4, 0x0000d728, 0x8000d673,
+			0x0000d0d0, 0x8000d18b, 0x8000d277, 0x0000d32c, 0x0000df20, 0x8000de7b,
+			0x8000dd87, 0x0000dcdc, 0x8000da7f, 0x0000db24, 0x0000d8d8, 0x8000d983,
+			0x0000c0c0, 0x8000c19b, 0x8000c267, 0x0000c33c, 0x8000c59f, 0x0000c4c4,
+			0x0000c738, 0x8000c663, 0x8000ca6f, 0x0000cb34, 0x0000c8c8, 0x8000c993,
+			0x0000cf30, 0x8000ce6b, 0x8000cd97, 0x0000cccc,
+		},
+		{
+			0x00000000, 0x8001540f, 0x8002a80f, 0x0003fc00, 0x8005500f, 0x00040400,
+			0x0007f800, 0x8006ac0f, 0x800aa00f, 0x000bf400, 0x00080800, 0x80095c0f,
+			0x000ff000, 0x800ea40f, 0x800d580f, 0x000c0c00, 0x8015400f, 0x00141400,
+			0x0017e800, 0x8016bc0f, 0x00101000, 0x8011440f, 0x8012b80f, 0x0013ec00,
+			0x001fe000, 0x801eb40f, 0x801d480f, 0x001c1c00, 0x801ab00f, 0x001be400,
+			0x00181800, 0x80194c0f, 0x802a800f, 0x002bd400, 0x00282800, 0x80297c0f,
+			0x002fd000, 0x802e840f, 0x802d780f, 0x002c2c00, 0x00202000, 0x8021740f,
+			0x8022880f, 0x0023dc00, 0x8025700f, 0x00242400, 0x0027d800, 0x80268c0f,
+			0x003fc000, 0x803e940f, 0x803d680f, 0x003c3c00, 0x803a900f, 0x003bc400,
+			0x00383800, 0x80396c0f, 0x8035600f, 0x00343400, 0x0037c800, 0x80369c0f,
+			0x00303000, 0x8031640f, 0x8032980f, 0x0033cc00, 0x8055000f, 0x00545400,
+			0x0057a800, 0x8056fc0f, 0x00505000, 0x8051040f, 0x8052f80f, 0x0053ac00,
+			0x005fa000, 0x805ef40f, 0x805d080f, 0x005c5c00, 0x805af00f, 0x005ba400,
+			0x00585800, 0x80590c0f, 0x00404000, 0x8041140f, 0x8042e80f, 0x0043bc00,
+			0x8045100f, 0x00444400, 0x0047b800, 0x8046ec0f, 0x804ae00f, 0x004bb400,
+			0x00484800, 0x80491c0f, 0x004fb000, 0x804ee40f, 0x804d180f, 0x004c4c00,
+			0x007f8000, 0x807ed40f, 0x807d280f, 0x007c7c00, 0x807ad00f, 0x007b8400,
+			0x00787800, 0x80792c0f, 0x8075200f, 0x00747400, 0x00778800, 0x8076dc0f,
+			0x00707000, 0x8071240f, 0x8072d80f, 0x00738c00, 0x806ac00f, 0x006b9400,
+			0x00686800, 0x80693c0f, 0x006f9000, 0x806ec40f, 0x806d380f, 0x006c6c00,
+			0x00606000, 0x8061340f, 0x8062c80f, 0x00639c00, 0x8065300f, 0x00646400,
+			0x00679800, 0x8066cc0f, 0x80aa000f, 0x00ab5400, 0x00a8a800, 0x80a9fc0f,
+			0x00af5000, 0x80ae040f, 0x80adf80f, 0x00acac00, 0x00a0a000, 0x80a1f40f,
+			0x80a2080f, 0x00a35c00, 0x80a5f00f, 0x00a4a400, 0x00a75800, 0x80a60c0f,
+			0x00bf4000, 0x80be140f, 0x80bde80f, 0x00bcbc00, 0x80ba100f, 0x00bb4400,
+			0x00b8b800, 0x80b9ec0f, 0x80b5e00f, 0x00b4b400, 0x00b74800, 0x80b61c0f,
+			0x00b0b000, 0x80b1e40f, 0x80b2180f, 0x00b34c00, 0x00808000, 0x8081d40f,
+			0x8082280f, 0x00837c00, 0x8085d00f, 0x00848400, 0x00877800, 0x80862c0f,
+			0x808a200f, 0x008b7400, 0x00888800, 0x8089dc0f, 0x008f7000, 0x808e240f,
+			0x808dd80f, 0x008c8c00, 0x8095c00f, 0x00949400, 0x00976800, 0x80963c0f,
+			0x00909000, 0x8091c40f, 0x8092380f, 0x00936c00, 0x009f6000, 0x809e340f,
+			0x809dc80f, 0x009c9c00, 0x809a300f, 0x009b6400, 0x00989800, 0x8099cc0f,
+			0x00ff0000, 0x80fe540f, 0x80fda80f, 0x00fcfc00, 0x80fa500f, 0x00fb0400,
+			0x00f8f800, 0x80f9ac0f, 0x80f5a00f, 0x00f4f400, 0x00f70800, 0x80f65c0f,
+			0x00f0f000, 0x80f1a40f, 0x80f2580f, 0x00f30c00, 0x80ea400f, 0x00eb1400,
+			0x00e8e800, 0x80e9bc0f, 0x00ef1000, 0x80ee440f, 0x80edb80f, 0x00ecec00,
+			0x00e0e000, 0x80e1b40f, 0x80e2480f, 0x00e31c00, 0x80e5b00f, 0x00e4e400,
+			0x00e71800, 0x80e64c0f, 0x80d5800f, 0x00d4d400, 0x00d72800, 0x80d67c0f,
+			0x00d0d000, 0x80d1840f, 0x80d2780f, 0x00d32c00, 0x00df2000, 0x80de740f,
+			0x80dd880f, 0x00dcdc00, 0x80da700f, 0x00db2400, 0x00d8d800, 0x80d98c0f,
+			0x00c0c000, 0x80c1940f, 0x80c2680f, 0x00c33c00, 0x80c5900f, 0x00c4c400,
+			0x00c73800, 0x80c66c0f, 0x80ca600f, 0x00cb3400, 0x00c8c800, 0x80c99c0f,
+			0x00cf3000, 0x80ce640f, 0x80cd980f, 0x00cccc00,
+		},
+		{
+			0x00000000, 0x8154000f, 0x82a8000f, 0x03fc0000, 0x8550000f, 0x04040000,
+			0x07f80000, 0x86ac000f, 0x8aa0000f, 0x0bf40000, 0x08080000, 0x895c000f,
+			0x0ff00000, 0x8ea4000f, 0x8d58000f, 0x0c0c0000, 0x9540000f, 0x14140000,
+			0x17e80000, 0x96bc000f, 0x10100000, 0x9144000f, 0x92b8000f, 0x13ec0000,
+			0x1fe00000, 0x9eb4000f, 0x9d48000f, 0x1c1c0000, 0x9ab0000f, 0x1be40000,
+			0x18180000, 0x994c000f, 0xaa80000f, 0x2bd40000, 0x28280000, 0xa97c000f,
+			0x2fd00000, 0xae84000f, 0xad78000f, 0x2c2c0000, 0x20200000, 0xa174000f,
+			0xa288000f, 0x23dc0000, 0xa570000f, 0x24240000, 0x27d80000, 0xa68c000f,
+			0x3fc00000, 0xbe94000f, 0xbd68000f, 0x3c3c0000, 0xba90000f, 0x3bc40000,
+			0x38380000, 0xb96c000f, 0xb560000f, 0x34340000, 0x37c80000, 0xb69c000f,
+			0x30300000, 0xb164000f, 0xb298000f, 0x33cc0000, 0xd500000f, 0x54540000,
+			0x57a80000, 0xd6fc000f, 0x50500000, 0xd104000f, 0xd2f8000f, 0x53ac0000,
+			0x5fa00000, 0xdef4000f, 0xdd08000f, 0x5c5c0000, 0xdaf0000f, 0x5ba40000,
+			0x58580000, 0xd90c000f, 0x40400000, 0xc114000f, 0xc2e8000f, 0x43bc0000,
+			0xc510000f, 0x44440000, 0x47b80000, 0xc6ec000f, 0xcae0000f, 0x4bb40000,
+			0x48480000, 0xc91c000f, 0x4fb00000, 0xcee4000f, 0xcd18000f, 0x4c4c0000,
+			0x7f800000, 0xfed4000f, 0xfd28000f, 0x7c7c0000, 0xfad0000f, 0x7b840000,
+			0x78780000, 0xf92c000f, 0xf520000f, 0x74740000, 0x77880000, 0xf6dc000f,
+			0x70700000, 0xf124000f, 0xf2d8000f, 0x738c0000, 0xeac0000f, 0x6b940000,
+			0x68680000, 0xe93c000f, 0x6f900000, 0xeec4000f, 0xed38000f, 0x6c6c0000,
+			0x60600000, 0xe134000f, 0xe2c8000f, 0x639c0000, 0xe530000f, 0x64640000,
+			0x67980000, 0xe6cc000f, 0x2a00000f, 0xab540000, 0xa8a80000, 0x29fc000f,
+			0xaf500000, 0x2e04000f, 0x2df8000f, 0xacac0000, 0xa0a00000, 0x21f4000f,
+			0x2208000f, 0xa35c0000, 0x25f0000f, 0xa4a40000, 0xa7580000, 0x260c000f,
+			0xbf400000, 0x3e14000f, 0x3de8000f, 0xbcbc0000, 0x3a10000f, 0xbb440000,
+			0xb8b80000, 0x39ec000f, 0x35e0000f, 0xb4b40000, 0xb7480000, 0x361c000f,
+			0xb0b00000, 0x31e4000f, 0x3218000f, 0xb34c0000, 0x80800000, 0x01d4000f,
+			0x0228000f, 0x837c0000, 0x05d0000f, 0x84840000, 0x87780000, 0x062c000f,
+			0x0a20000f, 0x8b740000, 0x88880000, 0x09dc000f, 0x8f700000, 0x0e24000f,
+			0x0dd8000f, 0x8c8c0000, 0x15c0000f, 0x94940000, 0x97680000, 0x163c000f,
+			0x90900000, 0x11c4000f, 0x1238000f, 0x936c0000, 0x9f600000, 0x1e34000f,
+			0x1dc8000f, 0x9c9c0000, 0x1a30000f, 0x9b640000, 0x98980000, 0x19cc000f,
+			0xff000000, 0x7e54000f, 0x7da8000f, 0xfcfc0000, 0x7a50000f, 0xfb040000,
+			0xf8f80000, 0x79ac000f, 0x75a0000f, 0xf4f40000, 0xf7080000, 0x765c000f,
+			0xf0f00000, 0x71a4000f, 0x7258000f, 0xf30c0000, 0x6a40000f, 0xeb140000,
+			0xe8e80000, 0x69bc000f, 0xef100000, 0x6e44000f, 0x6db8000f, 0xecec0000,
+			0xe0e00000, 0x61b4000f, 0x6248000f, 0xe31c0000, 0x65b0000f, 0xe4e40000,
+			0xe7180000, 0x664c000f, 0x5580000f, 0xd4d40000, 0xd7280000, 0x567c000f,
+			0xd0d00000, 0x5184000f, 0x5278000f, 0xd32c0000, 0xdf200000, 0x5e74000f,
+			0x5d88000f, 0xdcdc0000, 0x5a70000f, 0xdb240000, 0xd8d80000, 0x598c000f,
+			0xc0c00000, 0x4194000f, 0x4268000f, 0xc33c0000, 0x4590000f, 0xc4c40000,
+			0xc7380000, 0x466c000f, 0x4a60000f, 0xcb340000, 0xc8c80000, 0x499c000f,
+			0xcf300000, 0x4e64000f, 0x4d98000f, 0xcccc0000,
+		},
+		{
+			0x00000000, 0x5400001e, 0xa800003c, 0xfc000022, 0xd0000069, 0x84000077,
+			0x78000055, 0x2c00004b, 0x200000c3, 0x740000dd, 0x880000ff, 0xdc0000e1,
+			0xf00000aa, 0xa40000b4, 0x58000096, 0x0c000088, 0x40000186, 0x14000198,
+			0xe80001ba, 0xbc0001a4, 0x900001ef, 0xc40001f1, 0x380001d3, 0x6c0001cd,
+			0x60000145, 0x3400015b, 0xc8000179, 0x9c000167, 0xb000012c, 0xe4000132,
+			0x18000110, 0x4c00010e, 0x8000030c, 0xd4000312, 0x28000330, 0x7c00032e,
+			0x50000365, 0x0400037b, 0xf8000359, 0xac000347, 0xa00003cf, 0xf40003d1,
+			0x080003f3, 0x5c0003ed, 0x700003a6, 0x240003b8, 0xd800039a, 0x8c000384,
+			0xc000028a, 0x94000294, 0x680002b6, 0x3c0002a8, 0x100002e3, 0x440002fd,
+			0xb80002df, 0xec0002c1, 0xe0000249, 0xb4000257, 0x48000275, 0x1c00026b,
+			0x30000220, 0x6400023e, 0x9800021c, 0xcc000202, 0x80000609, 0xd4000617,
+			0x28000635, 0x7c00062b, 0x50000660, 0x0400067e, 0xf800065c, 0xac000642,
+			0xa00006ca, 0xf40006d4, 0x080006f6, 0x5c0006e8, 0x700006a3, 0x240006bd,
+			0xd800069f, 0x8c000681, 0xc000078f, 0x94000791, 0x680007b3, 0x3c0007ad,
+			0x100007e6, 0x440007f8, 0xb80007da, 0xec0007c4, 0xe000074c, 0xb4000752,
+			0x48000770, 0x1c00076e, 0x30000725, 0x6400073b, 0x98000719, 0xcc000707,
+			0x00000505, 0x5400051b, 0xa8000539, 0xfc000527, 0xd000056c, 0x84000572,
+			0x78000550, 0x2c00054e, 0x200005c6, 0x740005d8, 0x880005fa, 0xdc0005e4,
+			0xf00005af, 0xa40005b1, 0x58000593, 0x0c00058d, 0x40000483, 0x1400049d,
+			0xe80004bf, 0xbc0004a1, 0x900004ea, 0xc40004f4, 0x380004d6, 0x6c0004c8,
+			0x60000440, 0x3400045e, 0xc800047c, 0x9c000462, 0xb0000429, 0xe4000437,
+			0x18000415, 0x4c00040b, 0x80000c03, 0xd4000c1d, 0x28000c3f, 0x7c000c21,
+			0x50000c6a, 0x04000c74, 0xf8000c56, 0xac000c48, 0xa0000cc0, 0xf4000cde,
+			0x08000cfc, 0x5c000ce2, 0x70000ca9, 0x24000cb7, 0xd8000c95, 0x8c000c8b,
+			0xc0000d85, 0x94000d9b, 0x68000db9, 0x3c000da7, 0x10000dec, 0x44000df2,
+			0xb8000dd0, 0xec000dce, 0xe0000d46, 0xb4000d58, 0x48000d7a, 0x1c000d64,
+			0x30000d2f, 0x64000d31, 0x98000d13, 0xcc000d0d, 0x00000f0f, 0x54000f11,
+			0xa8000f33, 0xfc000f2d, 0xd0000f66, 0x84000f78, 0x78000f5a, 0x2c000f44,
+			0x20000fcc, 0x74000fd2, 0x88000ff0, 0xdc000fee, 0xf0000fa5, 0xa4000fbb,
+			0x58000f99, 0x0c000f87, 0x40000e89, 0x14000e97, 0xe8000eb5, 0xbc000eab,
+			0x90000ee0, 0xc4000efe, 0x38000edc, 0x6c000ec2, 0x60000e4a, 0x34000e54,
+			0xc8000e76, 0x9c000e68, 0xb0000e23, 0xe4000e3d, 0x18000e1f, 0x4c000e01,
+			0x00000a0a, 0x54000a14, 0xa8000a36, 0xfc000a28, 0xd0000a63, 0x84000a7d,
+			0x78000a5f, 0x2c000a41, 0x20000ac9, 0x74000ad7, 0x88000af5, 0xdc000aeb,
+			0xf0000aa0, 0xa4000abe, 0x58000a9c, 0x0c000a82, 0x40000b8c, 0x14000b92,
+			0xe8000bb0, 0xbc000bae, 0x90000be5, 0xc4000bfb, 0x38000bd9, 0x6c000bc7,
+			0x60000b4f, 0x34000b51, 0xc8000b73, 0x9c000b6d, 0xb0000b26, 0xe4000b38,
+			0x18000b1a, 0x4c000b04, 0x80000906, 0xd4000918, 0x2800093a, 0x7c000924,
+			0x5000096f, 0x04000971, 0xf8000953, 0xac00094d, 0xa00009c5, 0xf40009db,
+			0x080009f9, 0x5c0009e7, 0x700009ac, 0x240009b2, 0xd8000990, 0x8c00098e,
+			0xc0000880, 0x9400089e, 0x680008bc, 0x3c0008a2, 0x100008e9, 0x440008f7,
+			0xb80008d5, 0xec0008cb, 0xe0000843, 0xb400085d, 0x4800087f, 0x1c000861,
+			0x3000082a, 0x64000834, 0x98000816, 0xcc000808,
+		},
+	},
+	{ /* CRC_PRESET_32C */
+		{
+			0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c,
+			0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b,
+			0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24, 0x105ec76f, 0xe235446c,
+			0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+			0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+			0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a,
+			0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35, 0xaa64d611, 0x580f5512,
+			0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+			0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad,
+			0x1642ae59, 0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+			0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc, 0xb3109ebf,
+			0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+			0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f,
+			0xed03a29b, 0x1f682198, 0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927,
+			0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+			0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+			0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e,
+			0x4767748a, 0xb50cf789, 0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859,
+			0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e,
+			0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+			0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de,
+			0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c,
+			0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93, 0x082f63b7, 0xfa44e0b4,
+			0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+			0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+			0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c,
+			0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033, 0xa24bb5a6, 0x502036a5,
+			0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+			0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975,
+			0x0e330a81, 0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+			0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06, 0xcaa7a905,
+			0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+			0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8,
+			0xe52cc12c, 0x1747422f, 0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff,
+			0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+			0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+			0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78,
+			0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee,
+			0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6,
+			0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+			0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69,
+			0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e,
+			0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+		},
+		{
+			0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc, 0x5d28f9ab,
+			0x69cf5132, 0x7a6dc945, 0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21,
+			0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd, 0x3fc5f181, 0x2c6769f6,
+			0x1880c16f, 0x0b225918, 0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+			0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92,
+			0xcb1e630b, 0xd8bcfb7c, 0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b,
+			0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47, 0xe29f20ba, 0xf13db8cd,
+			0xc5da1054, 0xd6788823, 0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+			0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28,
+			0x298143b1, 0x3a23dbc6, 0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2,
+			0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e, 0xff17c604, 0xecb55e73,
+			0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+			0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25, 0x2c896460, 0x3f2bfc17,
+			0x0bcc548e, 0x186eccf9, 0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c,
+			0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0, 0x5dc6f43d, 0x4e646c4a,
+			0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f, 0x27ab3d78,
+			0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f, 0xce1644da, 0xddb4dcad,
+			0xe9537434, 0xfaf1ec43, 0x1d88e6be, 0x0e2a7ec9, 0x3acdd650, 0x296f4e27,
+			0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb, 0xbf59d487, 0xacfb4cf0,
+			0x981ce469, 0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+			0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3, 0x7f65ee94,
+			0x4b82460d, 0x5820de7a, 0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260,
+			0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc, 0x66d73941, 0x7575a136,
+			0x419209af, 0x523091d8, 0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004,
+			0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3,
+			0xadc95a4a, 0xbe6bc23d, 0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059,
+			0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185, 0x844819fb, 0x97ea818c,
+			0xa30d2915, 0xb0afb162, 0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+			0x195cda43, 0x0afe4234, 0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8,
+			0x70938b71, 0x63311306, 0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3,
+			0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f, 0x26992bc2, 0x353bb3b5,
+			0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+			0x04d43cfd, 0x1776a48a, 0x23910c13, 0x30339464, 0x4a5e5d21, 0x59fcc556,
+			0x6d1b6dcf, 0x7eb9f5b8, 0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc,
+			0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600, 0x3b11cd7c, 0x28b3550b,
+			0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+			0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d, 0xe88f6f18, 0xfb2df76f,
+			0xcfca5ff6, 0xdc68c781, 0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766,
+			0x35d5be23, 0x26772654, 0x12908ecd, 0x013216ba, 0xe64b1c47, 0xf5e98430,
+			0xc10e2ca9, 0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+			0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2, 0x19b2d7d5,
+			0x2d557f4c, 0x3ef7e73b, 0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f,
+			0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+		},
+		{
+			0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a, 0x3b9f3664,
+			0xd1b1f617, 0x74f06469, 0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6,
+			0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2, 0x4ca15aac, 0x70a27d8a, 0xd5e3eff4,
+			0x3fcd2f87, 0x9a8cbdf9, 0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3,
+			0x48f3434f, 0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b,
+			0x9942b558, 0x3c032726, 0xe144fb14, 0x4405696a, 0xae2ba919, 0x0b6a3b67,
+			0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d, 0xd915c5d1, 0x7c5457af,
+			0x967a97dc, 0x333b05a2, 0x47cb61cb, 0xe28af3b5, 0x08a433c6, 0xade5a1b8,
+			0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa,
+			0x40577089, 0xe516e2f7, 0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828,
+			0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32, 0xc76580d9, 0x622412a7,
+			0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+			0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f, 0x61ea1a06, 0xc4ab8878,
+			0x2e85480b, 0x8bc4da75, 0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20,
+			0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a, 0x8f96c396, 0x2ad751e8,
+			0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+			0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe, 0xb8ffdfd7, 0x1dbe4da9,
+			0xf7908dda, 0x52d11fa4, 0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b,
+			0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161, 0x56830647, 0xf3c29439,
+			0x19ec544a, 0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+			0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98, 0x554d0ee6,
+			0xbf63ce95, 0x1a225ceb, 0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730,
+			0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a, 0xb3764986, 0x1637dbf8,
+			0xfc191b8b, 0x595889f5, 0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+			0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad,
+			0x2a34fcde, 0x8f756ea0, 0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f,
+			0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065, 0x6a638c57, 0xcf221e29,
+			0x250cde5a, 0x804d4c24, 0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+			0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6,
+			0x83834485, 0x26c2d6fb, 0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae,
+			0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4, 0x2290cf18, 0x87d15d66,
+			0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+			0x4c42f79a, 0xe90365e4, 0x032da597, 0xa66c37e9, 0xd29c5380, 0x77ddc1fe,
+			0x9df3018d, 0x38b293f3, 0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c,
+			0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0x00e3ad36, 0x3ce08a10, 0x99a1186e,
+			0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07, 0x4810ee79,
+			0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6, 0x9a6f10cf, 0x3f2e82b1,
+			0xd50042c2, 0x7041d0bc, 0xad060c8e, 0x08479ef0, 0xe2695e83, 0x4728ccfd,
+			0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7, 0x9557324b, 0x3016a035,
+			0xda386046, 0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+			0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e, 0xe63b4760,
+			0x0c158713, 0xa954156d, 0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0x0fdb8fb2,
+			0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+		},
+		{
+			0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3, 0xa6679b4b,
+			0xc4451272, 0x1900b8ca, 0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf,
+			0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c, 0xe964b13d, 0x34211b85,
+			0x560392bc, 0x8b463804, 0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+			0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990,
+			0xdb65c0a9, 0x06206a11, 0xd725148b, 0x0a60be33, 0x6842370a, 0xb5079db2,
+			0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41, 0x2161776d, 0xfc24ddd5,
+			0x9e0654ec, 0x4343fe54, 0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+			0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd,
+			0xfa04b7c4, 0x27411d7c, 0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69,
+			0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a, 0xaba65fe7, 0x76e3f55f,
+			0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+			0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538, 0x26c00df2, 0xfb85a74a,
+			0x99a72e73, 0x44e284cb, 0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3,
+			0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610, 0xb4868d3c, 0x69c32784,
+			0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+			0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255, 0x07a17a9f, 0xdae4d027,
+			0xb8c6591e, 0x6583f3a6, 0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3,
+			0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040, 0x95e7fa51, 0x48a250e9,
+			0x2a80d9d0, 0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+			0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844, 0xc5c402fc,
+			0xa7e68bc5, 0x7aa3217d, 0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006,
+			0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5, 0xa4e4aad9, 0x79a10061,
+			0x1b838958, 0xc6c623e0, 0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213,
+			0xbbc47802, 0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349,
+			0x7f816a70, 0xa2c4c0c8, 0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd,
+			0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e, 0x8585ddb4, 0x58c0770c,
+			0x3ae2fe35, 0xe7a7548d, 0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+			0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519,
+			0xb784ac20, 0x6ac10698, 0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0,
+			0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443, 0x9aa50f6f, 0x47e0a5d7,
+			0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+			0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1, 0x8224a72b, 0x5f610d93,
+			0x3d4384aa, 0xe0062e12, 0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07,
+			0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4, 0x106227e5, 0xcd278d5d,
+			0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597, 0x09629f2f,
+			0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a, 0x9d0475f0, 0x4041df48,
+			0x22635671, 0xff26fcc9, 0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a,
+			0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99, 0xd867e1b5, 0x05224b0d,
+			0x6700c234, 0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+			0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d, 0x6120a825,
+			0x0302211c, 0xde478ba4, 0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1,
+			0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+		},
+		{
+			0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0, 0xd854d11c,
+			0x906761e8, 0xa8760e44, 0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65,
+			0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5, 0x8f2261d3, 0xb7330e7f,
+			0xff00be8b, 0xc711d127, 0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+			0x4a456a42, 0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e,
+			0xda220baa, 0xe2336406, 0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3,
+			0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13, 0xdecfbec6, 0xe6ded16a,
+			0xaeed619e, 0x96fc0e32, 0x3e8a0076, 0x069b6fda, 0x4ea8df2e, 0x76b9b082,
+			0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598,
+			0x04edb56c, 0x3cfcdac0, 0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1,
+			0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151, 0x37516aae, 0x0f400502,
+			0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+			0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb, 0x1273df8f, 0x2a62b023,
+			0x625100d7, 0x5a406f7b, 0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89,
+			0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539, 0x7d1400ec, 0x45056f40,
+			0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+			0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d, 0xccbc6149, 0xf4ad0ee5,
+			0xbc9ebe11, 0x848fd1bd, 0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c,
+			0x09db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c, 0xa3dbbe2a, 0x9bcad186,
+			0xd3f96172, 0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+			0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b, 0xbee864a7,
+			0xf6dbd453, 0xcecabbff, 0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8,
+			0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18, 0xabc5decd, 0x93d4b161,
+			0xdbe70195, 0xe3f66e39, 0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089,
+			0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593,
+			0x71e7d567, 0x49f6bacb, 0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea,
+			0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a, 0x750a600b, 0x4d1b0fa7,
+			0x0528bf53, 0x3d39d0ff, 0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+			0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86,
+			0x200a0a72, 0x181b65de, 0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c,
+			0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c, 0x3f4f0a49, 0x075e65e5,
+			0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+			0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06, 0xb9b60142, 0x81a76eee,
+			0xc994de1a, 0xf185b1b6, 0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497,
+			0x7cd10ad3, 0x44c0657f, 0x0cf3d58b, 0x34e2ba27, 0xd6d1de21, 0xeec0b18d,
+			0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9, 0x7ea7d065,
+			0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544, 0xf3f36b00, 0xcbe204ac,
+			0x83d1b458, 0xbbc0dbf4, 0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0x0a68ba51,
+			0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1, 0x873c0134, 0xbf2d6e98,
+			0xf71ede6c, 0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+			0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6, 0x152dba6a,
+			0x5d1e0a9e, 0x650f6532, 0x081e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013,
+			0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+		},
+		{
+			0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777, 0x5dc55c6e,
+			0x697997b4, 0x8649fcad, 0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5,
+			0xd2f32f68, 0x3dc34471, 0x097f8fab, 0xe64fe4b2, 0xc00c303e, 0x2f3c5b27,
+			0x1b8090fd, 0xf4b0fbe4, 0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+			0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f,
+			0xc973bf95, 0x2643d48c, 0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57,
+			0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20, 0xe5f20e92, 0x0ac2658b,
+			0x3e7eae51, 0xd14ec548, 0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+			0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add,
+			0x2c81b107, 0xc3b1da1e, 0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576,
+			0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201, 0x0e045beb, 0xe13430f2,
+			0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+			0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e, 0xdcf77483, 0x33c71f9a,
+			0x077bd440, 0xe84bbf59, 0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f,
+			0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778, 0xae0e73ca, 0x413e18d3,
+			0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+			0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc, 0x39057a11, 0xd6351108,
+			0xe289dad2, 0x0db9b1cb, 0xebf65579, 0x04c63e60, 0x307af5ba, 0xdf4a9ea3,
+			0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4, 0x4bfc7d58, 0xa4cc1641,
+			0x9070dd9b, 0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+			0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230, 0x763f3929,
+			0x4283f2f3, 0xadb399ea, 0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c,
+			0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b, 0x7c0eafc9, 0x933ec4d0,
+			0xa7820f0a, 0x48b26413, 0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+			0xdc0487e8, 0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86,
+			0xb57d105c, 0x5a4d7b45, 0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d,
+			0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a, 0x99fca15b, 0x76ccca42,
+			0x42700198, 0xad406a81, 0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+			0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a,
+			0x90832ef0, 0x7fb345e9, 0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf,
+			0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8, 0x39f6897a, 0xd6c6e263,
+			0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+			0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7, 0xa0f9db4a, 0x4fc9b053,
+			0x7b757b89, 0x94451090, 0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8,
+			0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f, 0xd200dc03, 0x3d30b71a,
+			0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+			0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6, 0x00f3f36b, 0xefc39872,
+			0xdb7f53a8, 0x344f38b1, 0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a,
+			0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d, 0xf7fee2af, 0x18ce89b6,
+			0x2c72426c, 0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+			0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9, 0x0a3196e0,
+			0x3e8d5d3a, 0xd1bd3623, 0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x034e194b,
+			0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+		},
+		{
+			0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1, 0xcde3e919,
+			0x75e69c41, 0x1de5b089, 0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b,
+			0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda, 0x9c5bfaa6, 0xf458d66e,
+			0x4c5da336, 0x245e8ffe, 0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+			0xd27607f5, 0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec,
+			0xa7909bb4, 0xcf93b77c, 0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5,
+			0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334, 0x73767eee, 0x1b755226,
+			0xa370277e, 0xcb730bb6, 0xd696bb3f, 0xbe9597f7, 0x0690e2af, 0x6e93ce67,
+			0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002,
+			0xd4e6e55a, 0xbce5c992, 0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110,
+			0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1, 0x7ab7077a, 0x12b42bb2,
+			0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63, 0x0f519b3b, 0x6752b7f3,
+			0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71, 0x917a3ff8, 0xf9791330,
+			0x417c6668, 0x297f4aa0, 0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884,
+			0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55, 0xa8c1008f, 0xc0c22c47,
+			0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+			0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f, 0xe20c4116, 0x8a0f6dde,
+			0x320a1886, 0x5a09344e, 0x09c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc,
+			0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d, 0xdbb77e61, 0xb3b452a9,
+			0x0bb127f1, 0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+			0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3, 0x58796a2b,
+			0xe07c1f73, 0x887f33bb, 0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac,
+			0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d, 0xbb43f3a7, 0xd340df6f,
+			0x6b45aa37, 0x034686ff, 0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+			0x6935f452, 0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b,
+			0x1cd36813, 0x74d044db, 0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59,
+			0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988, 0xc8358d49, 0xa036a181,
+			0x1833d4d9, 0x7030f811, 0x6dd54898, 0x05d66450, 0xbdd31108, 0xd5d03dc0,
+			0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903,
+			0xf3feec5b, 0x9bfdc093, 0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7,
+			0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766, 0x1a438abc, 0x7240a674,
+			0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x07a63a35,
+			0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6, 0x2a39cc5f, 0x423ae097,
+			0xfa3f95cf, 0x923cb907, 0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185,
+			0x6414310c, 0x0c171dc4, 0xb412689c, 0xdc114454, 0x1382f328, 0x7b81dfe0,
+			0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69, 0x0e6743a1,
+			0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23, 0xf84fcbaa, 0x904ce762,
+			0x2849923a, 0x404abef2, 0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0x0a87ff6b,
+			0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba, 0xfcaf7760, 0x94ac5ba8,
+			0x2ca92ef0, 0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+			0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544, 0xe33a998c,
+			0x5b3fecd4, 0x333cc01c, 0x60f48dc6, 0x08f7a10e, 0xb0f2d456, 0xd8f1f89e,
+			0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+		},
+		{
+			0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d, 0x6821ff4a,
+			0xb3657823, 0xfa590504, 0x423b04da, 0x0b0779fd, 0xd043fe94, 0x997f83b3,
+			0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de, 0x847609b4, 0xcd4a7493,
+			0x160ef3fa, 0x5f328edd, 0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+			0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224,
+			0x7528754d, 0x3c14086a, 0x0d006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0,
+			0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d, 0x4f3b6143, 0x06071c64,
+			0xdd439b0d, 0x947fe62a, 0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+			0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367,
+			0x3a13140e, 0x732f6929, 0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e,
+			0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3, 0x1a00cb32, 0x533cb615,
+			0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+			0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881, 0x79264d85, 0x301a30a2,
+			0xeb5eb7cb, 0xa262caec, 0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef,
+			0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782, 0xdc4dc65c, 0x9571bb7b,
+			0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+			0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2, 0x361d2cc6, 0x7f2151e1,
+			0xa465d688, 0xed59abaf, 0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18,
+			0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75, 0x9376a71f, 0xda4ada38,
+			0x010e5d51, 0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+			0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8, 0xb96c5c8f,
+			0x6228dbe6, 0x2b14a6c1, 0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d,
+			0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360, 0x763a92be, 0x3f06ef99,
+			0xe44268f0, 0xad7e15d7, 0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+			0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a,
+			0x0312e7f3, 0x4a2e9ad4, 0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63,
+			0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e, 0x3901f3fd, 0x703d8eda,
+			0xab7909b3, 0xe2457494, 0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+			0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d,
+			0xc85f8f04, 0x8163f223, 0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20,
+			0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d, 0xff4cfe93, 0xb67083b4,
+			0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x0515fb97,
+			0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f, 0x0f1cdf3b, 0x4620a21c,
+			0x9d642575, 0xd4585852, 0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5,
+			0x4d27dbe1, 0x041ba6c6, 0xdf5f21af, 0x96635c88, 0xaa7754e2, 0xe34b29c5,
+			0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+			0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751, 0xc951d255, 0x806daf72,
+			0x5b29281b, 0x1215553c, 0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6,
+			0x021cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb, 0x613a3c15, 0x28064132,
+			0xf342c65b, 0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+			0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316, 0xcf56ce31,
+			0x14124958, 0x5d2e347f, 0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8,
+			0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+		},
+	},
+	{ /* CRC_PRESET_24 */
+		{
+			0x00000000, 0x864cfb00, 0x8ad50d00, 0x0c99f600, 0x93e6e100, 0x15aa1a00,
+			0x1933ec00, 0x9f7f1700, 0xa1813900, 0x27cdc200, 0x2b543400, 0xad18cf00,
+			0x3267d800, 0xb42b2300, 0xb8b2d500, 0x3efe2e00, 0xc54e8900, 0x43027200,
+			0x4f9b8400, 0xc9d77f00, 0x56a86800, 0xd0e49300, 0xdc7d6500, 0x5a319e00,
+			0x64cfb000, 0xe2834b00, 0xee1abd00, 0x68564600, 0xf7295100, 0x7165aa00,
+			0x7dfc5c00, 0xfbb0a700, 0x0cd1e900, 0x8a9d1200, 0x8604e400, 0x00481f00,
+			0x9f370800, 0x197bf300, 0x15e20500, 0x93aefe00, 0xad50d000, 0x2b1c2b00,
+			0x2785dd00, 0xa1c92600, 0x3eb63100, 0xb8faca00, 0xb4633c00, 0x322fc700,
+			0xc99f6000, 0x4fd39b00, 0x434a6d00, 0xc5069600, 0x5a798100, 0xdc357a00,
+			0xd0ac8c00, 0x56e07700, 0x681e5900, 0xee52a200, 0xe2cb5400, 0x6487af00,
+			0xfbf8b800, 0x7db44300, 0x712db500, 0xf7614e00, 0x19a3d200, 0x9fef2900,
+			0x9376df00, 0x153a2400, 0x8a453300, 0x0c09c800, 0x00903e00, 0x86dcc500,
+			0xb822eb00, 0x3e6e1000, 0x32f7e600, 0xb4bb1d00, 0x2bc40a00, 0xad88f100,
+			0xa1110700, 0x275dfc00, 0xdced5b00, 0x5aa1a000, 0x56385600, 0xd074ad00,
+			0x4f0bba00, 0xc9474100, 0xc5deb700, 0x43924c00, 0x7d6c6200, 0xfb209900,
+			0xf7b96f00, 0x71f59400, 0xee8a8300, 0x68c67800, 0x645f8e00, 0xe2137500,
+			0x15723b00, 0x933ec000, 0x9fa73600, 0x19ebcd00, 0x8694da00, 0x00d82100,
+			0x0c41d700, 0x8a0d2c00, 0xb4f30200, 0x32bff900, 0x3e260f00, 0xb86af400,
+			0x2715e300, 0xa1591800, 0xadc0ee00, 0x2b8c1500, 0xd03cb200, 0x56704900,
+			0x5ae9bf00, 0xdca54400, 0x43da5300, 0xc596a800, 0xc90f5e00, 0x4f43a500,
+			0x71bd8b00, 0xf7f17000, 0xfb688600, 0x7d247d00, 0xe25b6a00, 0x64179100,
+			0x688e6700, 0xeec29c00, 0x3347a400, 0xb50b5f00, 0xb992a900, 0x3fde5200,
+			0xa0a14500, 0x26edbe00, 0x2a744800, 0xac38b300, 0x92c69d00, 0x148a6600,
+			0x18139000, 0x9e5f6b00, 0x01207c00, 0x876c8700, 0x8bf57100, 0x0db98a00,
+			0xf6092d00, 0x7045d600, 0x7cdc2000, 0xfa90db00, 0x65efcc00, 0xe3a33700,
+			0xef3ac100, 0x69763a00, 0x57881400, 0xd1c4ef00, 0xdd5d1900, 0x5b11e200,
+			0xc46ef500, 0x42220e00, 0x4ebbf800, 0xc8f70300, 0x3f964d00, 0xb9dab600,
+			0xb5434000, 0x330fbb00, 0xac70ac00, 0x2a3c5700, 0x26a5a100, 0xa0e95a00,
+			0x9e177400, 0x185b8f00, 0x14c27900, 0x928e8200, 0x0df19500, 0x8bbd6e00,
+			0x87249800, 0x01686300, 0xfad8c400, 0x7c943f00, 0x700dc900, 0xf6413200,
+			0x693e2500, 0xef72de00, 0xe3eb2800, 0x65a7d300, 0x5b59fd00, 0xdd150600,
+			0xd18cf000, 0x57c00b00, 0xc8bf1c00, 0x4ef3e700, 0x426a1100, 0xc426ea00,
+			0x2ae47600, 0xaca88d00, 0xa0317b00, 0x267d8000, 0xb9029700, 0x3f4e6c00,
+			0x33d79a00, 0xb59b6100, 0x8b654f00, 0x0d29b400, 0x01b04200, 0x87fcb900,
+			0x1883ae00, 0x9ecf5500, 0x9256a300, 0x141a5800, 0xefaaff00, 0x69e60400,
+			0x657ff200, 0xe3330900, 0x7c4c1e00, 0xfa00e500, 0xf6991300, 0x70d5e800,
+			0x4e2bc600, 0xc8673d00, 0xc4fecb00, 0x42b23000, 0xddcd2700, 0x5b81dc00,
+			0x57182a00, 0xd154d100, 0x26359f00, 0xa0796400, 0xace09200, 0x2aac6900,
+			0xb5d37e00, 0x339f8500, 0x3f067300, 0xb94a8800, 0x87b4a600, 0x01f85d00,
+			0x0d61ab00, 0x8b2d5000, 0x14524700, 0x921ebc00, 0x9e874a00, 0x18cbb100,
+			0xe37b1600, 0x6537ed00, 0x69ae1b00, 0xefe2e000, 0x709df700, 0xf6d10c00,
+			0xfa48fa00, 0x7c040100, 0x42fa2f00, 0xc4b6d400, 0xc82f2200, 0x4e63d900,
+			0xd11cce00, 0x57503500, 0x5bc9c300, 0xdd853800,
+		},
+		{
+			0x00000000, 0x668f4800, 0xcd1e9000, 0xab91d800, 0x1c71db00, 0x7afe9300,
+			0xd16f4b00, 0xb7e00300, 0x38e3b600, 0x5e6cfe00, 0xf5fd2600, 0x93726e00,
+			0x24926d00, 0x421d2500, 0xe98cfd00, 0x8f03b500, 0x71c76c00, 0x17482400,
+			0xbcd9fc00, 0xda56b400, 0x6db6b700, 0x0b39ff00, 0xa0a82700, 0xc6276f00,
+			0x4924da00, 0x2fab9200, 0x843a4a00, 0xe2b50200, 0x55550100, 0x33da4900,
+			0x984b9100, 0xfec4d900, 0xe38ed800, 0x85019000, 0x2e904800, 0x481f0000,
+			0xffff0300, 0x99704b00, 0x32e19300, 0x546edb00, 0xdb6d6e00, 0xbde22600,
+			0x1673fe00, 0x70fcb600, 0xc71cb500, 0xa193fd00, 0x0a022500, 0x6c8d6d00,
+			0x9249b400, 0xf4c6fc00, 0x5f572400, 0x39d86c00, 0x8e386f00, 0xe8b72700,
+			0x4326ff00, 0x25a9b700, 0xaaaa0200, 0xcc254a00, 0x67b49200, 0x013bda00,
+			0xb6dbd900, 0xd0549100, 0x7bc54900, 0x1d4a0100, 0x41514b00, 0x27de0300,
+			0x8c4fdb00, 0xeac09300, 0x5d209000, 0x3bafd800, 0x903e0000, 0xf6b14800,
+			0x79b2fd00, 0x1f3db500, 0xb4ac6d00, 0xd2232500, 0x65c32600, 0x034c6e00,
+			0xa8ddb600, 0xce52fe00, 0x30962700, 0x56196f00, 0xfd88b700, 0x9b07ff00,
+			0x2ce7fc00, 0x4a68b400, 0xe1f96c00, 0x87762400, 0x08759100, 0x6efad900,
+			0xc56b0100, 0xa3e44900, 0x14044a00, 0x728b0200, 0xd91ada00, 0xbf959200,
+			0xa2df9300, 0xc450db00, 0x6fc10300, 0x094e4b00, 0xbeae4800, 0xd8210000,
+			0x73b0d800, 0x153f9000, 0x9a3c2500, 0xfcb36d00, 0x5722b500, 0x31adfd00,
+			0x864dfe00, 0xe0c2b600, 0x4b536e00, 0x2ddc2600, 0xd318ff00, 0xb597b700,
+			0x1e066f00, 0x78892700, 0xcf692400, 0xa9e66c00, 0x0277b400, 0x64f8fc00,
+			0xebfb4900, 0x8d740100, 0x26e5d900, 0x406a9100, 0xf78a9200, 0x9105da00,
+			0x3a940200, 0x5c1b4a00, 0x82a29600, 0xe42dde00, 0x4fbc0600, 0x29334e00,
+			0x9ed34d00, 0xf85c0500, 0x53cddd00, 0x35429500, 0xba412000, 0xdcce6800,
+			0x775fb000, 0x11d0f800, 0xa630fb00, 0xc0bfb300, 0x6b2e6b00, 0x0da12300,
+			0xf365fa00, 0x95eab200, 0x3e7b6a00, 0x58f42200, 0xef142100, 0x899b6900,
+			0x220ab100, 0x4485f900, 0xcb864c00, 0xad090400, 0x0698dc00, 0x60179400,
+			0xd7f79700, 0xb178df00, 0x1ae90700, 0x7c664f00, 0x612c4e00, 0x07a30600,
+			0xac32de00, 0xcabd9600, 0x7d5d9500, 0x1bd2dd00, 0xb0430500, 0xd6cc4d00,
+			0x59cff800, 0x3f40b000, 0x94d16800, 0xf25e2000, 0x45be2300, 0x23316b00,
+			0x88a0b300, 0xee2ffb00, 0x10eb2200, 0x76646a00, 0xddf5b200, 0xbb7afa00,
+			0x0c9af900, 0x6a15b100, 0xc1846900, 0xa70b2100, 0x28089400, 0x4e87dc00,
+			0xe5160400, 0x83994c00, 0x34794f00, 0x52f60700, 0xf967df00, 0x9fe89700,
+			0xc3f3dd00, 0xa57c9500, 0x0eed4d00, 0x68620500, 0xdf820600, 0xb90d4e00,
+			0x129c9600, 0x7413de00, 0xfb106b00, 0x9d9f2300, 0x360efb00, 0x5081b300,
+			0xe761b000, 0x81eef800, 0x2a7f2000, 0x4cf06800, 0xb234b100, 0xd4bbf900,
+			0x7f2a2100, 0x19a56900, 0xae456a00, 0xc8ca2200, 0x635bfa00, 0x05d4b200,
+			0x8ad70700, 0xec584f00, 0x47c99700, 0x2146df00, 0x96a6dc00, 0xf0299400,
+			0x5bb84c00, 0x3d370400, 0x207d0500, 0x46f24d00, 0xed639500, 0x8becdd00,
+			0x3c0cde00, 0x5a839600, 0xf1124e00, 0x979d0600, 0x189eb300, 0x7e11fb00,
+			0xd5802300, 0xb30f6b00, 0x04ef6800, 0x62602000, 0xc9f1f800, 0xaf7eb000,
+			0x51ba6900, 0x37352100, 0x9ca4f900, 0xfa2bb100, 0x4dcbb200, 0x2b44fa00,
+			0x80d52200, 0xe65a6a00, 0x6959df00, 0x0fd69700, 0xa4474f00, 0xc2c80700,
+			0x75280400, 0x13a74c00, 0xb8369400, 0xdeb9dc00,
+		},
+		{
+			0x00000000, 0x8309d700, 0x805f5500, 0x03568200, 0x86f25100, 0x05fb8600,
+			0x06ad0400, 0x85a4d300, 0x8ba85900, 0x08a18e00, 0x0bf70c00, 0x88fedb00,
+			0x0d5a0800, 0x8e53df00, 0x8d055d00, 0x0e0c8a00, 0x911c4900, 0x12159e00,
+			0x11431c00, 0x924acb00, 0x17ee1800, 0x94e7cf00, 0x97b14d00, 0x14b89a00,
+			0x1ab41000, 0x99bdc700, 0x9aeb4500, 0x19e29200, 0x9c464100, 0x1f4f9600,
+			0x1c191400, 0x9f10c300, 0xa4746900, 0x277dbe00, 0x242b3c00, 0xa722eb00,
+			0x22863800, 0xa18fef00, 0xa2d96d00, 0x21d0ba00, 0x2fdc3000, 0xacd5e700,
+			0xaf836500, 0x2c8ab200, 0xa92e6100, 0x2a27b600, 0x29713400, 0xaa78e300,
+			0x35682000, 0xb661f700, 0xb5377500, 0x363ea200, 0xb39a7100, 0x3093a600,
+			0x33c52400, 0xb0ccf300, 0xbec07900, 0x3dc9ae00, 0x3e9f2c00, 0xbd96fb00,
+			0x38322800, 0xbb3bff00, 0xb86d7d00, 0x3b64aa00, 0xcea42900, 0x4dadfe00,
+			0x4efb7c00, 0xcdf2ab00, 0x48567800, 0xcb5faf00, 0xc8092d00, 0x4b00fa00,
+			0x450c7000, 0xc605a700, 0xc5532500, 0x465af200, 0xc3fe2100, 0x40f7f600,
+			0x43a17400, 0xc0a8a300, 0x5fb86000, 0xdcb1b700, 0xdfe73500, 0x5ceee200,
+			0xd94a3100, 0x5a43e600, 0x59156400, 0xda1cb300, 0xd4103900, 0x5719ee00,
+			0x544f6c00, 0xd746bb00, 0x52e26800, 0xd1ebbf00, 0xd2bd3d00, 0x51b4ea00,
+			0x6ad04000, 0xe9d99700, 0xea8f1500, 0x6986c200, 0xec221100, 0x6f2bc600,
+			0x6c7d4400, 0xef749300, 0xe1781900, 0x6271ce00, 0x61274c00, 0xe22e9b00,
+			0x678a4800, 0xe4839f00, 0xe7d51d00, 0x64dcca00, 0xfbcc0900, 0x78c5de00,
+			0x7b935c00, 0xf89a8b00, 0x7d3e5800, 0xfe378f00, 0xfd610d00, 0x7e68da00,
+			0x70645000, 0xf36d8700, 0xf03b0500, 0x7332d200, 0xf6960100, 0x759fd600,
+			0x76c95400, 0xf5c08300, 0x1b04a900, 0x980d7e00, 0x9b5bfc00, 0x18522b00,
+			0x9df6f800, 0x1eff2f00, 0x1da9ad00, 0x9ea07a00, 0x90acf000, 0x13a52700,
+			0x10f3a500, 0x93fa7200, 0x165ea100, 0x95577600, 0x9601f400, 0x15082300,
+			0x8a18e000, 0x09113700, 0x0a47b500, 0x894e6200, 0x0ceab100, 0x8fe36600,
+			0x8cb5e400, 0x0fbc3300, 0x01b0b900, 0x82b96e00, 0x81efec00, 0x02e63b00,
+			0x8742e800, 0x044b3f00, 0x071dbd00, 0x84146a00, 0xbf70c000, 0x3c791700,
+			0x3f2f9500, 0xbc264200, 0x39829100, 0xba8b4600, 0xb9ddc400, 0x3ad41300,
+			0x34d89900, 0xb7d14e00, 0xb487cc00, 0x378e1b00, 0xb22ac800, 0x31231f00,
+			0x32759d00, 0xb17c4a00, 0x2e6c8900, 0xad655e00, 0xae33dc00, 0x2d3a0b00,
+			0xa89ed800, 0x2b970f00, 0x28c18d00, 0xabc85a00, 0xa5c4d000, 0x26cd0700,
+			0x259b8500, 0xa6925200, 0x23368100, 0xa03f5600, 0xa369d400, 0x20600300,
+			0xd5a08000, 0x56a95700, 0x55ffd500, 0xd6f60200, 0x5352d100, 0xd05b0600,
+			0xd30d8400, 0x50045300, 0x5e08d900, 0xdd010e00, 0xde578c00, 0x5d5e5b00,
+			0xd8fa8800, 0x5bf35f00, 0x58a5dd00, 0xdbac0a00, 0x44bcc900, 0xc7b51e00,
+			0xc4e39c00, 0x47ea4b00, 0xc24e9800, 0x41474f00, 0x4211cd00, 0xc1181a00,
+			0xcf149000, 0x4c1d4700, 0x4f4bc500, 0xcc421200, 0x49e6c100, 0xcaef1600,
+			0xc9b99400, 0x4ab04300, 0x71d4e900, 0xf2dd3e00, 0xf18bbc00, 0x72826b00,
+			0xf726b800, 0x742f6f00, 0x7779ed00, 0xf4703a00, 0xfa7cb000, 0x79756700,
+			0x7a23e500, 0xf92a3200, 0x7c8ee100, 0xff873600, 0xfcd1b400, 0x7fd86300,
+			0xe0c8a000, 0x63c17700, 0x6097f500, 0xe39e2200, 0x663af100, 0xe5332600,
+			0xe665a400, 0x656c7300, 0x6b60f900, 0xe8692e00, 0xeb3fac00, 0x68367b00,
+			0xed92a800, 0x6e9b7f00, 0x6dcdfd00, 0xeec42a00,
+		},
+		{
+			0x00000000, 0x36095200, 0x6c12a400, 0x5a1bf600, 0xd8254800, 0xee2c1a00,
+			0xb437ec00, 0x823ebe00, 0x36066b00, 0x000f3900, 0x5a14cf00, 0x6c1d9d00,
+			0xee232300, 0xd82a7100, 0x82318700, 0xb438d500, 0x6c0cd600, 0x5a058400,
+			0x001e7200, 0x36172000, 0xb4299e00, 0x8220cc00, 0xd83b3a00, 0xee326800,
+			0x5a0abd00, 0x6c03ef00, 0x36181900, 0x00114b00, 0x822ff500, 0xb426a700,
+			0xee3d5100, 0xd8340300, 0xd819ac00, 0xee10fe00, 0xb40b0800, 0x82025a00,
+			0x003ce400, 0x3635b600, 0x6c2e4000, 0x5a271200, 0xee1fc700, 0xd8169500,
+			0x820d6300, 0xb4043100, 0x363a8f00, 0x0033dd00, 0x5a282b00, 0x6c217900,
+			0xb4157a00, 0x821c2800, 0xd807de00, 0xee0e8c00, 0x6c303200, 0x5a396000,
+			0x00229600, 0x362bc400, 0x82131100, 0xb41a4300, 0xee01b500, 0xd808e700,
+			0x5a365900, 0x6c3f0b00, 0x3624fd00, 0x002daf00, 0x367fa300, 0x0076f100,
+			0x5a6d0700, 0x6c645500, 0xee5aeb00, 0xd853b900, 0x82484f00, 0xb4411d00,
+			0x0079c800, 0x36709a00, 0x6c6b6c00, 0x5a623e00, 0xd85c8000, 0xee55d200,
+			0xb44e2400, 0x82477600, 0x5a737500, 0x6c7a2700, 0x3661d100, 0x00688300,
+			0x82563d00, 0xb45f6f00, 0xee449900, 0xd84dcb00, 0x6c751e00, 0x5a7c4c00,
+			0x0067ba00, 0x366ee800, 0xb4505600, 0x82590400, 0xd842f200, 0xee4ba000,
+			0xee660f00, 0xd86f5d00, 0x8274ab00, 0xb47df900, 0x36434700, 0x004a1500,
+			0x5a51e300, 0x6c58b100, 0xd8606400, 0xee693600, 0xb472c000, 0x827b9200,
+			0x00452c00, 0x364c7e00, 0x6c578800, 0x5a5eda00, 0x826ad900, 0xb4638b00,
+			0xee787d00, 0xd8712f00, 0x5a4f9100, 0x6c46c300, 0x365d3500, 0x00546700,
+			0xb46cb200, 0x8265e000, 0xd87e1600, 0xee774400, 0x6c49fa00, 0x5a40a800,
+			0x005b5e00, 0x36520c00, 0x6cff4600, 0x5af61400, 0x00ede200, 0x36e4b000,
+			0xb4da0e00, 0x82d35c00, 0xd8c8aa00, 0xeec1f800, 0x5af92d00, 0x6cf07f00,
+			0x36eb8900, 0x00e2db00, 0x82dc6500, 0xb4d53700, 0xeecec100, 0xd8c79300,
+			0x00f39000, 0x36fac200, 0x6ce13400, 0x5ae86600, 0xd8d6d800, 0xeedf8a00,
+			0xb4c47c00, 0x82cd2e00, 0x36f5fb00, 0x00fca900, 0x5ae75f00, 0x6cee0d00,
+			0xeed0b300, 0xd8d9e100, 0x82c21700, 0xb4cb4500, 0xb4e6ea00, 0x82efb800,
+			0xd8f44e00, 0xeefd1c00, 0x6cc3a200, 0x5acaf000, 0x00d10600, 0x36d85400,
+			0x82e08100, 0xb4e9d300, 0xeef22500, 0xd8fb7700, 0x5ac5c900, 0x6ccc9b00,
+			0x36d76d00, 0x00de3f00, 0xd8ea3c00, 0xeee36e00, 0xb4f89800, 0x82f1ca00,
+			0x00cf7400, 0x36c62600, 0x6cddd000, 0x5ad48200, 0xeeec5700, 0xd8e50500,
+			0x82fef300, 0xb4f7a100, 0x36c91f00, 0x00c04d00, 0x5adbbb00, 0x6cd2e900,
+			0x5a80e500, 0x6c89b700, 0x36924100, 0x009b1300, 0x82a5ad00, 0xb4acff00,
+			0xeeb70900, 0xd8be5b00, 0x6c868e00, 0x5a8fdc00, 0x00942a00, 0x369d7800,
+			0xb4a3c600, 0x82aa9400, 0xd8b16200, 0xeeb83000, 0x368c3300, 0x00856100,
+			0x5a9e9700, 0x6c97c500, 0xeea97b00, 0xd8a02900, 0x82bbdf00, 0xb4b28d00,
+			0x008a5800, 0x36830a00, 0x6c98fc00, 0x5a91ae00, 0xd8af1000, 0xeea64200,
+			0xb4bdb400, 0x82b4e600, 0x82994900, 0xb4901b00, 0xee8bed00, 0xd882bf00,
+			0x5abc0100, 0x6cb55300, 0x36aea500, 0x00a7f700, 0xb49f2200, 0x82967000,
+			0xd88d8600, 0xee84d400, 0x6cba6a00, 0x5ab33800, 0x00a8ce00, 0x36a19c00,
+			0xee959f00, 0xd89ccd00, 0x82873b00, 0xb48e6900, 0x36b0d700, 0x00b98500,
+			0x5aa27300, 0x6cab2100, 0xd893f400, 0xee9aa600, 0xb4815000, 0x82880200,
+			0x00b6bc00, 0x36bfee00, 0x6ca41800, 0x5aad4a00,
+		},
+		{
+			0x00000000, 0xd9fe8c00, 0x35b1e300, 0xec4f6f00, 0x6b63c600, 0xb29d4a00,
+			0x5ed22500, 0x872ca900, 0xd6c78c00, 0x0f390000, 0xe3766f00, 0x3a88e300,
+			0xbda44a00, 0x645ac600, 0x8815a900, 0x51eb2500, 0x2bc3e300, 0xf23d6f00,
+			0x1e720000, 0xc78c8c00, 0x40a02500, 0x995ea900, 0x7511c600, 0xacef4a00,
+			0xfd046f00, 0x24fae300, 0xc8b58c00, 0x114b0000, 0x9667a900, 0x4f992500,
+			0xa3d64a00, 0x7a28c600, 0x5787c600, 0x8e794a00, 0x62362500, 0xbbc8a900,
+			0x3ce40000, 0xe51a8c00, 0x0955e300, 0xd0ab6f00, 0x81404a00, 0x58bec600,
+			0xb4f1a900, 0x6d0f2500, 0xea238c00, 0x33dd0000, 0xdf926f00, 0x066ce300,
+			0x7c442500, 0xa5baa900, 0x49f5c600, 0x900b4a00, 0x1727e300, 0xced96f00,
+			0x22960000, 0xfb688c00, 0xaa83a900, 0x737d2500, 0x9f324a00, 0x46ccc600,
+			0xc1e06f00, 0x181ee300, 0xf4518c00, 0x2daf0000, 0xaf0f8c00, 0x76f10000,
+			0x9abe6f00, 0x4340e300, 0xc46c4a00, 0x1d92c600, 0xf1dda900, 0x28232500,
+			0x79c80000, 0xa0368c00, 0x4c79e300, 0x95876f00, 0x12abc600, 0xcb554a00,
+			0x271a2500, 0xfee4a900, 0x84cc6f00, 0x5d32e300, 0xb17d8c00, 0x68830000,
+			0xefafa900, 0x36512500, 0xda1e4a00, 0x03e0c600, 0x520be300, 0x8bf56f00,
+			0x67ba0000, 0xbe448c00, 0x39682500, 0xe096a900, 0x0cd9c600, 0xd5274a00,
+			0xf8884a00, 0x2176c600, 0xcd39a900, 0x14c72500, 0x93eb8c00, 0x4a150000,
+			0xa65a6f00, 0x7fa4e300, 0x2e4fc600, 0xf7b14a00, 0x1bfe2500, 0xc200a900,
+			0x452c0000, 0x9cd28c00, 0x709de300, 0xa9636f00, 0xd34ba900, 0x0ab52500,
+			0xe6fa4a00, 0x3f04c600, 0xb8286f00, 0x61d6e300, 0x8d998c00, 0x54670000,
+			0x058c2500, 0xdc72a900, 0x303dc600, 0xe9c34a00, 0x6eefe300, 0xb7116f00,
+			0x5b5e0000, 0x82a08c00, 0xd853e300, 0x01ad6f00, 0xede20000, 0x341c8c00,
+			0xb3302500, 0x6acea900, 0x8681c600, 0x5f7f4a00, 0x0e946f00, 0xd76ae300,
+			0x3b258c00, 0xe2db0000, 0x65f7a900, 0xbc092500, 0x50464a00, 0x89b8c600,
+			0xf3900000, 0x2a6e8c00, 0xc621e300, 0x1fdf6f00, 0x98f3c600, 0x410d4a00,
+			0xad422500, 0x74bca900, 0x25578c00, 0xfca90000, 0x10e66f00, 0xc918e300,
+			0x4e344a00, 0x97cac600, 0x7b85a900, 0xa27b2500, 0x8fd42500, 0x562aa900,
+			0xba65c600, 0x639b4a00, 0xe4b7e300, 0x3d496f00, 0xd1060000, 0x08f88c00,
+			0x5913a900, 0x80ed2500, 0x6ca24a00, 0xb55cc600, 0x32706f00, 0xeb8ee300,
+			0x07c18c00, 0xde3f0000, 0xa417c600, 0x7de94a00, 0x91a62500, 0x4858a900,
+			0xcf740000, 0x168a8c00, 0xfac5e300, 0x233b6f00, 0x72d04a00, 0xab2ec600,
+			0x4761a900, 0x9e9f2500, 0x19b38c00, 0xc04d0000, 0x2c026f00, 0xf5fce300,
+			0x775c6f00, 0xaea2e300, 0x42ed8c00, 0x9b130000, 0x1c3fa900, 0xc5c12500,
+			0x298e4a00, 0xf070c600, 0xa19be300, 0x78656f00, 0x942a0000, 0x4dd48c00,
+			0xcaf82500, 0x1306a900, 0xff49c600, 0x26b74a00, 0x5c9f8c00, 0x85610000,
+			0x692e6f00, 0xb0d0e300, 0x37fc4a00, 0xee02c600, 0x024da900, 0xdbb32500,
+			0x8a580000, 0x53a68c00, 0xbfe9e300, 0x66176f00, 0xe13bc600, 0x38c54a00,
+			0xd48a2500, 0x0d74a900, 0x20dba900, 0xf9252500, 0x156a4a00, 0xcc94c600,
+			0x4bb86f00, 0x9246e300, 0x7e098c00, 0xa7f70000, 0xf61c2500, 0x2fe2a900,
+			0xc3adc600, 0x1a534a00, 0x9d7fe300, 0x44816f00, 0xa8ce0000, 0x71308c00,
+			0x0b184a00, 0xd2e6c600, 0x3ea9a900, 0xe7572500, 0x607b8c00, 0xb9850000,
+			0x55ca6f00, 0x8c34e300, 0xdddfc600, 0x04214a00, 0xe86e2500, 0x3190a900,
+			0xb6bc0000, 0x6f428c00, 0x830de300, 0x5af36f00,
+		},
+		{
+			0x00000000, 0x36eb3d00, 0x6dd67a00, 0x5b3d4700, 0xdbacf400, 0xed47c900,
+			0xb67a8e00, 0x8091b300, 0x31151300, 0x07fe2e00, 0x5cc36900, 0x6a285400,
+			0xeab9e700, 0xdc52da00, 0x876f9d00, 0xb184a000, 0x622a2600, 0x54c11b00,
+			0x0ffc5c00, 0x39176100, 0xb986d200, 0x8f6def00, 0xd450a800, 0xe2bb9500,
+			0x533f3500, 0x65d40800, 0x3ee94f00, 0x08027200, 0x8893c100, 0xbe78fc00,
+			0xe545bb00, 0xd3ae8600, 0xc4544c00, 0xf2bf7100, 0xa9823600, 0x9f690b00,
+			0x1ff8b800, 0x29138500, 0x722ec200, 0x44c5ff00, 0xf5415f00, 0xc3aa6200,
+			0x98972500, 0xae7c1800, 0x2eedab00, 0x18069600, 0x433bd100, 0x75d0ec00,
+			0xa67e6a00, 0x90955700, 0xcba81000, 0xfd432d00, 0x7dd29e00, 0x4b39a300,
+			0x1004e400, 0x26efd900, 0x976b7900, 0xa1804400, 0xfabd0300, 0xcc563e00,
+			0x4cc78d00, 0x7a2cb000, 0x2111f700, 0x17faca00, 0x0ee46300, 0x380f5e00,
+			0x63321900, 0x55d92400, 0xd5489700, 0xe3a3aa00, 0xb89eed00, 0x8e75d000,
+			0x3ff17000, 0x091a4d00, 0x52270a00, 0x64cc3700, 0xe45d8400, 0xd2b6b900,
+			0x898bfe00, 0xbf60c300, 0x6cce4500, 0x5a257800, 0x01183f00, 0x37f30200,
+			0xb762b100, 0x81898c00, 0xdab4cb00, 0xec5ff600, 0x5ddb5600, 0x6b306b00,
+			0x300d2c00, 0x06e61100, 0x8677a200, 0xb09c9f00, 0xeba1d800, 0xdd4ae500,
+			0xcab02f00, 0xfc5b1200, 0xa7665500, 0x918d6800, 0x111cdb00, 0x27f7e600,
+			0x7ccaa100, 0x4a219c00, 0xfba53c00, 0xcd4e0100, 0x96734600, 0xa0987b00,
+			0x2009c800, 0x16e2f500, 0x4ddfb200, 0x7b348f00, 0xa89a0900, 0x9e713400,
+			0xc54c7300, 0xf3a74e00, 0x7336fd00, 0x45ddc000, 0x1ee08700, 0x280bba00,
+			0x998f1a00, 0xaf642700, 0xf4596000, 0xc2b25d00, 0x4223ee00, 0x74c8d300,
+			0x2ff59400, 0x191ea900, 0x1dc8c600, 0x2b23fb00, 0x701ebc00, 0x46f58100,
+			0xc6643200, 0xf08f0f00, 0xabb24800, 0x9d597500, 0x2cddd500, 0x1a36e800,
+			0x410baf00, 0x77e09200, 0xf7712100, 0xc19a1c00, 0x9aa75b00, 0xac4c6600,
+			0x7fe2e000, 0x4909dd00, 0x12349a00, 0x24dfa700, 0xa44e1400, 0x92a52900,
+			0xc9986e00, 0xff735300, 0x4ef7f300, 0x781cce00, 0x23218900, 0x15cab400,
+			0x955b0700, 0xa3b03a00, 0xf88d7d00, 0xce664000, 0xd99c8a00, 0xef77b700,
+			0xb44af000, 0x82a1cd00, 0x02307e00, 0x34db4300, 0x6fe60400, 0x590d3900,
+			0xe8899900, 0xde62a400, 0x855fe300, 0xb3b4de00, 0x33256d00, 0x05ce5000,
+			0x5ef31700, 0x68182a00, 0xbbb6ac00, 0x8d5d9100, 0xd660d600, 0xe08beb00,
+			0x601a5800, 0x56f16500, 0x0dcc2200, 0x3b271f00, 0x8aa3bf00, 0xbc488200,
+			0xe775c500, 0xd19ef800, 0x510f4b00, 0x67e47600, 0x3cd93100, 0x0a320c00,
+			0x132ca500, 0x25c79800, 0x7efadf00, 0x4811e200, 0xc8805100, 0xfe6b6c00,
+			0xa5562b00, 0x93bd1600, 0x2239b600, 0x14d28b00, 0x4fefcc00, 0x7904f100,
+			0xf9954200, 0xcf7e7f00, 0x94433800, 0xa2a80500, 0x71068300, 0x47edbe00,
+			0x1cd0f900, 0x2a3bc400, 0xaaaa7700, 0x9c414a00, 0xc77c0d00, 0xf1973000,
+			0x40139000, 0x76f8ad00, 0x2dc5ea00, 0x1b2ed700, 0x9bbf6400, 0xad545900,
+			0xf6691e00, 0xc0822300, 0xd778e900, 0xe193d400, 0xbaae9300, 0x8c45ae00,
+			0x0cd41d00, 0x3a3f2000, 0x61026700, 0x57e95a00, 0xe66dfa00, 0xd086c700,
+			0x8bbb8000, 0xbd50bd00, 0x3dc10e00, 0x0b2a3300, 0x50177400, 0x66fc4900,
+			0xb552cf00, 0x83b9f200, 0xd884b500, 0xee6f8800, 0x6efe3b00, 0x58150600,
+			0x03284100, 0x35c37c00, 0x8447dc00, 0xb2ace100, 0xe991a600, 0xdf7a9b00,
+			0x5feb2800, 0x69001500, 0x323d5200, 0x04d66f00,
+		},
+		{
+			0x00000000, 0x3b918c00, 0x77231800, 0x4cb29400, 0xee463000, 0xd5d7bc00,
+			0x99652800, 0xa2f4a400, 0x5ac09b00, 0x61511700, 0x2de38300, 0x16720f00,
+			0xb486ab00, 0x8f172700, 0xc3a5b300, 0xf8343f00, 0xb5813600, 0x8e10ba00,
+			0xc2a22e00, 0xf933a200, 0x5bc70600, 0x60568a00, 0x2ce41e00, 0x17759200,
+			0xef41ad00, 0xd4d02100, 0x9862b500, 0xa3f33900, 0x01079d00, 0x3a961100,
+			0x76248500, 0x4db50900, 0xed4e9700, 0xd6df1b00, 0x9a6d8f00, 0xa1fc0300,
+			0x0308a700, 0x38992b00, 0x742bbf00, 0x4fba3300, 0xb78e0c00, 0x8c1f8000,
+			0xc0ad1400, 0xfb3c9800, 0x59c83c00, 0x6259b000, 0x2eeb2400, 0x157aa800,
+			0x58cfa100, 0x635e2d00, 0x2fecb900, 0x147d3500, 0xb6899100, 0x8d181d00,
+			0xc1aa8900, 0xfa3b0500, 0x020f3a00, 0x399eb600, 0x752c2200, 0x4ebdae00,
+			0xec490a00, 0xd7d88600, 0x9b6a1200, 0xa0fb9e00, 0x5cd1d500, 0x67405900,
+			0x2bf2cd00, 0x10634100, 0xb297e500, 0x89066900, 0xc5b4fd00, 0xfe257100,
+			0x06114e00, 0x3d80c200, 0x71325600, 0x4aa3da00, 0xe8577e00, 0xd3c6f200,
+			0x9f746600, 0xa4e5ea00, 0xe950e300, 0xd2c16f00, 0x9e73fb00, 0xa5e27700,
+			0x0716d300, 0x3c875f00, 0x7035cb00, 0x4ba44700, 0xb3907800, 0x8801f400,
+			0xc4b36000, 0xff22ec00, 0x5dd64800, 0x6647c400, 0x2af55000, 0x1164dc00,
+			0xb19f4200, 0x8a0ece00, 0xc6bc5a00, 0xfd2dd600, 0x5fd97200, 0x6448fe00,
+			0x28fa6a00, 0x136be600, 0xeb5fd900, 0xd0ce5500, 0x9c7cc100, 0xa7ed4d00,
+			0x0519e900, 0x3e886500, 0x723af100, 0x49ab7d00, 0x041e7400, 0x3f8ff800,
+			0x733d6c00, 0x48ace000, 0xea584400, 0xd1c9c800, 0x9d7b5c00, 0xa6ead000,
+			0x5edeef00, 0x654f6300, 0x29fdf700, 0x126c7b00, 0xb098df00, 0x8b095300,
+			0xc7bbc700, 0xfc2a4b00, 0xb9a3aa00, 0x82322600, 0xce80b200, 0xf5113e00,
+			0x57e59a00, 0x6c741600, 0x20c68200, 0x1b570e00, 0xe3633100, 0xd8f2bd00,
+			0x94402900, 0xafd1a500, 0x0d250100, 0x36b48d00, 0x7a061900, 0x41979500,
+			0x0c229c00, 0x37b31000, 0x7b018400, 0x40900800, 0xe264ac00, 0xd9f52000,
+			0x9547b400, 0xaed63800, 0x56e20700, 0x6d738b00, 0x21c11f00, 0x1a509300,
+			0xb8a43700, 0x8335bb00, 0xcf872f00, 0xf416a300, 0x54ed3d00, 0x6f7cb100,
+			0x23ce2500, 0x185fa900, 0xbaab0d00, 0x813a8100, 0xcd881500, 0xf6199900,
+			0x0e2da600, 0x35bc2a00, 0x790ebe00, 0x429f3200, 0xe06b9600, 0xdbfa1a00,
+			0x97488e00, 0xacd90200, 0xe16c0b00, 0xdafd8700, 0x964f1300, 0xadde9f00,
+			0x0f2a3b00, 0x34bbb700, 0x78092300, 0x4398af00, 0xbbac9000, 0x803d1c00,
+			0xcc8f8800, 0xf71e0400, 0x55eaa000, 0x6e7b2c00, 0x22c9b800, 0x19583400,
+			0xe5727f00, 0xdee3f300, 0x92516700, 0xa9c0eb00, 0x0b344f00, 0x30a5c300,
+			0x7c175700, 0x4786db00, 0xbfb2e400, 0x84236800, 0xc891fc00, 0xf3007000,
+			0x51f4d400, 0x6a655800, 0x26d7cc00, 0x1d464000, 0x50f34900, 0x6b62c500,
+			0x27d05100, 0x1c41dd00, 0xbeb57900, 0x8524f500, 0xc9966100, 0xf207ed00,
+			0x0a33d200, 0x31a25e00, 0x7d10ca00, 0x46814600, 0xe475e200, 0xdfe46e00,
+			0x9356fa00, 0xa8c77600, 0x083ce800, 0x33ad6400, 0x7f1ff000, 0x448e7c00,
+			0xe67ad800, 0xddeb5400, 0x9159c000, 0xaac84c00, 0x52fc7300, 0x696dff00,
+			0x25df6b00, 0x1e4ee700, 0xbcba4300, 0x872bcf00, 0xcb995b00, 0xf008d700,
+			0xbdbdde00, 0x862c5200, 0xca9ec600, 0xf10f4a00, 0x53fbee00, 0x686a6200,
+			0x24d8f600, 0x1f497a00, 0xe77d4500, 0xdcecc900, 0x905e5d00, 0xabcfd100,
+			0x093b7500, 0x32aaf900, 0x7e186d00, 0x4589e100,
+		},
+		{
+			0x00000000, 0xf50baf00, 0x6c5ba500, 0x99500a00, 0xd8b74a00, 0x2dbce500,
+			0xb4ecef00, 0x41e74000, 0x37226f00, 0xc229c000, 0x5b79ca00, 0xae726500,
+			0xef952500, 0x1a9e8a00, 0x83ce8000, 0x76c52f00, 0x6e44de00, 0x9b4f7100,
+			0x021f7b00, 0xf714d400, 0xb6f39400, 0x43f83b00, 0xdaa83100, 0x2fa39e00,
+			0x5966b100, 0xac6d1e00, 0x353d1400, 0xc036bb00, 0x81d1fb00, 0x74da5400,
+			0xed8a5e00, 0x1881f100, 0xdc89bc00, 0x29821300, 0xb0d21900, 0x45d9b600,
+			0x043ef600, 0xf1355900, 0x68655300, 0x9d6efc00, 0xebabd300, 0x1ea07c00,
+			0x87f07600, 0x72fbd900, 0x331c9900, 0xc6173600, 0x5f473c00, 0xaa4c9300,
+			0xb2cd6200, 0x47c6cd00, 0xde96c700, 0x2b9d6800, 0x6a7a2800, 0x9f718700,
+			0x06218d00, 0xf32a2200, 0x85ef0d00, 0x70e4a200, 0xe9b4a800, 0x1cbf0700,
+			0x5d584700, 0xa853e800, 0x3103e200, 0xc4084d00, 0x3f5f8300, 0xca542c00,
+			0x53042600, 0xa60f8900, 0xe7e8c900, 0x12e36600, 0x8bb36c00, 0x7eb8c300,
+			0x087dec00, 0xfd764300, 0x64264900, 0x912de600, 0xd0caa600, 0x25c10900,
+			0xbc910300, 0x499aac00, 0x511b5d00, 0xa410f200, 0x3d40f800, 0xc84b5700,
+			0x89ac1700, 0x7ca7b800, 0xe5f7b200, 0x10fc1d00, 0x66393200, 0x93329d00,
+			0x0a629700, 0xff693800, 0xbe8e7800, 0x4b85d700, 0xd2d5dd00, 0x27de7200,
+			0xe3d63f00, 0x16dd9000, 0x8f8d9a00, 0x7a863500, 0x3b617500, 0xce6ada00,
+			0x573ad000, 0xa2317f00, 0xd4f45000, 0x21ffff00, 0xb8aff500, 0x4da45a00,
+			0x0c431a00, 0xf948b500, 0x6018bf00, 0x95131000, 0x8d92e100, 0x78994e00,
+			0xe1c94400, 0x14c2eb00, 0x5525ab00, 0xa02e0400, 0x397e0e00, 0xcc75a100,
+			0xbab08e00, 0x4fbb2100, 0xd6eb2b00, 0x23e08400, 0x6207c400, 0x970c6b00,
+			0x0e5c6100, 0xfb57ce00, 0x7ebf0600, 0x8bb4a900, 0x12e4a300, 0xe7ef0c00,
+			0xa6084c00, 0x5303e300, 0xca53e900, 0x3f584600, 0x499d6900, 0xbc96c600,
+			0x25c6cc00, 0xd0cd6300, 0x912a2300, 0x64218c00, 0xfd718600, 0x087a2900,
+			0x10fbd800, 0xe5f07700, 0x7ca07d00, 0x89abd200, 0xc84c9200, 0x3d473d00,
+			0xa4173700, 0x511c9800, 0x27d9b700, 0xd2d21800, 0x4b821200, 0xbe89bd00,
+			0xff6efd00, 0x0a655200, 0x93355800, 0x663ef700, 0xa236ba00, 0x573d1500,
+			0xce6d1f00, 0x3b66b000, 0x7a81f000, 0x8f8a5f00, 0x16da5500, 0xe3d1fa00,
+			0x9514d500, 0x601f7a00, 0xf94f7000, 0x0c44df00, 0x4da39f00, 0xb8a83000,
+			0x21f83a00, 0xd4f39500, 0xcc726400, 0x3979cb00, 0xa029c100, 0x55226e00,
+			0x14c52e00, 0xe1ce8100, 0x789e8b00, 0x8d952400, 0xfb500b00, 0x0e5ba400,
+			0x970bae00, 0x62000100, 0x23e74100, 0xd6ecee00, 0x4fbce400, 0xbab74b00,
+			0x41e08500, 0xb4eb2a00, 0x2dbb2000, 0xd8b08f00, 0x9957cf00, 0x6c5c6000,
+			0xf50c6a00, 0x0007c500, 0x76c2ea00, 0x83c94500, 0x1a994f00, 0xef92e000,
+			0xae75a000, 0x5b7e0f00, 0xc22e0500, 0x3725aa00, 0x2fa45b00, 0xdaaff400,
+			0x43fffe00, 0xb6f45100, 0xf7131100, 0x0218be00, 0x9b48b400, 0x6e431b00,
+			0x18863400, 0xed8d9b00, 0x74dd9100, 0x81d63e00, 0xc0317e00, 0x353ad100,
+			0xac6adb00, 0x59617400, 0x9d693900, 0x68629600, 0xf1329c00, 0x04393300,
+			0x45de7300, 0xb0d5dc00, 0x2985d600, 0xdc8e7900, 0xaa4b5600, 0x5f40f900,
+			0xc610f300, 0x331b5c00, 0x72fc1c00, 0x87f7b300, 0x1ea7b900, 0xebac1600,
+			0xf32de700, 0x06264800, 0x9f764200, 0x6a7ded00, 0x2b9aad00, 0xde910200,
+			0x47c10800, 0xb2caa700, 0xc40f8800, 0x31042700, 0xa8542d00, 0x5d5f8200,
+			0x1cb8c200, 0xe9b36d00, 0x70e36700, 0x85e8c800,
+		},
+	},
+	{ /* CRC_PRESET_16_CITT */
+		{
+			0x00000000, 0x10210000, 0x20420000, 0x30630000, 0x40840000, 0x50a50000,
+			0x60c60000, 0x70e70000, 0x81080000, 0x91290000, 0xa14a0000, 0xb16b0000,
+			0xc18c0000, 0xd1ad0000, 0xe1ce0000, 0xf1ef0000, 0x12310000, 0x02100000,
+			0x32730000, 0x22520000, 0x52b50000, 0x42940000, 0x72f70000, 0x62d60000,
+			0x93390000, 0x83180000, 0xb37b0000, 0xa35a0000, 0xd3bd0000, 0xc39c0000,
+			0xf3ff0000, 0xe3de0000, 0x24620000, 0x34430000, 0x04200000, 0x14010000,
+			0x64e60000, 0x74c70000, 0x44a40000, 0x54850000, 0xa56a0000, 0xb54b0000,
+			0x85280000, 0x95090000, 0xe5ee0000, 0xf5cf0000, 0xc5ac0000, 0xd58d0000,
+			0x36530000, 0x26720000, 0x16110000, 0x06300000, 0x76d70000, 0x66f60000,
+			0x56950000, 0x46b40000, 0xb75b0000, 0xa77a0000, 0x97190000, 0x87380000,
+			0xf7df0000, 0xe7fe0000, 0xd79d0000, 0xc7bc0000, 0x48c40000, 0x58e50000,
+			0x68860000, 0x78a70000, 0x08400000, 0x18610000, 0x28020000, 0x38230000,
+			0xc9cc0000, 0xd9ed0000, 0xe98e0000, 0xf9af0000, 0x89480000, 0x99690000,
+			0xa90a0000, 0xb92b0000, 0x5af50000, 0x4ad40000, 0x7ab70000, 0x6a960000,
+			0x1a710000, 0x0a500000, 0x3a330000, 0x2a120000, 0xdbfd0000, 0xcbdc0000,
+			0xfbbf0000, 0xeb9e0000, 0x9b790000, 0x8b580000, 0xbb3b0000, 0xab1a0000,
+			0x6ca60000, 0x7c870000, 0x4ce40000, 0x5cc50000, 0x2c220000, 0x3c030000,
+			0x0c600000, 0x1c410000, 0xedae0000, 0xfd8f0000, 0xcdec0000, 0xddcd0000,
+			0xad2a0000, 0xbd0b0000, 0x8d680000, 0x9d490000, 0x7e970000, 0x6eb60000,
+			0x5ed50000, 0x4ef40000, 0x3e130000, 0x2e320000, 0x1e510000, 0x0e700000,
+			0xff9f0000, 0xefbe0000, 0xdfdd0000, 0xcffc0000, 0xbf1b0000, 0xaf3a0000,
+			0x9f590000, 0x8f780000, 0x91880000, 0x81a90000, 0xb1ca0000, 0xa1eb0000,
+			0xd10c0000, 0xc12d0000, 0xf14e0000, 0xe16f0000, 0x10800000, 0x00a10000,
+			0x30c20000, 0x20e30000, 0x50040000, 0x40250000, 0x70460000, 0x60670000,
+			0x83b90000, 0x93980000, 0xa3fb0000, 0xb3da0000, 0xc33d0000, 0xd31c0000,
+			0xe37f0000, 0xf35e0000, 0x02b10000, 0x12900000, 0x22f30000, 0x32d20000,
+			0x42350000, 0x52140000, 0x62770000, 0x72560000, 0xb5ea0000, 0xa5cb0000,
+			0x95a80000, 0x85890000, 0xf56e0000, 0xe54f0000, 0xd52c0000, 0xc50d0000,
+			0x34e20000, 0x24c30000, 0x14a00000, 0x04810000, 0x74660000, 0x64470000,
+			0x54240000, 0x44050000, 0xa7db0000, 0xb7fa0000, 0x87990000, 0x97b80000,
+			0xe75f0000, 0xf77e0000, 0xc71d0000, 0xd73c0000, 0x26d30000, 0x36f20000,
+			0x06910000, 0x16b00000, 0x66570000, 0x76760000, 0x46150000, 0x56340000,
+			0xd94c0000, 0xc96d0000, 0xf90e0000, 0xe92f0000, 0x99c80000, 0x89e90000,
+			0xb98a0000, 0xa9ab0000, 0x58440000, 0x48650000, 0x78060000, 0x68270000,
+			0x18c00000, 0x08e10000, 0x38820000, 0x28a30000, 0xcb7d0000, 0xdb5c0000,
+			0xeb3f0000, 0xfb1e0000, 0x8bf90000, 0x9bd80000, 0xabbb0000, 0xbb9a0000,
+			0x4a750000, 0x5a540000, 0x6a370000, 0x7a160000, 0x0af10000, 0x1ad00000,
+			0x2ab30000, 0x3a920000, 0xfd2e0000, 0xed0f0000, 0xdd6c0000, 0xcd4d0000,
+			0xbdaa0000, 0xad8b0000, 0x9de80000, 0x8dc90000, 0x7c260000, 0x6c070000,
+			0x5c640000, 0x4c450000, 0x3ca20000, 0x2c830000, 0x1ce00000, 0x0cc10000,
+			0xef1f0000, 0xff3e0000, 0xcf5d0000, 0xdf7c0000, 0xaf9b0000, 0xbfba0000,
+			0x8fd90000, 0x9ff80000, 0x6e170000, 0x7e360000, 0x4e550000, 0x5e740000,
+			0x2e930000, 0x3eb20000, 0x0ed10000, 0x1ef00000,
+		},
+		{
+			0x00000000, 0x33310000, 0x66620000, 0x55530000, 0xccc40000, 0xfff50000,
+			0xaaa60000, 0x99970000, 0x89a90000, 0xba980000, 0xefcb0000, 0xdcfa0000,
+			0x456d0000, 0x765c0000, 0x230f0000, 0x103e0000, 0x03730000, 0x30420000,
+			0x65110000, 0x56200000, 0xcfb70000, 0xfc860000, 0xa9d50000, 0x9ae40000,
+			0x8ada0000, 0xb9eb0000, 0xecb80000, 0xdf890000, 0x461e0000, 0x752f0000,
+			0x207c0000, 0x134d0000, 0x06e60000, 0x35d70000, 0x60840000, 0x53b50000,
+			0xca220000, 0xf9130000, 0xac400000, 0x9f710000, 0x8f4f0000, 0xbc7e0000,
+			0xe92d0000, 0xda1c0000, 0x438b0000, 0x70ba0000, 0x25e90000, 0x16d80000,
+			0x05950000, 0x36a40000, 0x63f70000, 0x50c60000, 0xc9510000, 0xfa600000,
+			0xaf330000, 0x9c020000, 0x8c3c0000, 0xbf0d0000, 0xea5e0000, 0xd96f0000,
+			0x40f80000, 0x73c90000, 0x269a0000, 0x15ab0000, 0x0dcc0000, 0x3efd0000,
+			0x6bae0000, 0x589f0000, 0xc1080000, 0xf2390000, 0xa76a0000, 0x945b0000,
+			0x84650000, 0xb7540000, 0xe2070000, 0xd1360000, 0x48a10000, 0x7b900000,
+			0x2ec30000, 0x1df20000, 0x0ebf0000, 0x3d8e0000, 0x68dd0000, 0x5bec0000,
+			0xc27b0000, 0xf14a0000, 0xa4190000, 0x97280000, 0x87160000, 0xb4270000,
+			0xe1740000, 0xd2450000, 0x4bd20000, 0x78e30000, 0x2db00000, 0x1e810000,
+			0x0b2a0000, 0x381b0000, 0x6d480000, 0x5e790000, 0xc7ee0000, 0xf4df0000,
+			0xa18c0000, 0x92bd0000, 0x82830000, 0xb1b20000, 0xe4e10000, 0xd7d00000,
+			0x4e470000, 0x7d760000, 0x28250000, 0x1b140000, 0x08590000, 0x3b680000,
+			0x6e3b0000, 0x5d0a0000, 0xc49d0000, 0xf7ac0000, 0xa2ff0000, 0x91ce0000,
+			0x81f00000, 0xb2c10000, 0xe7920000, 0xd4a30000, 0x4d340000, 0x7e050000,
+			0x2b560000, 0x18670000, 0x1b980000, 0x28a90000, 0x7dfa0000, 0x4ecb0000,
+			0xd75c0000, 0xe46d0000, 0xb13e0000, 0x820f0000, 0x92310000, 0xa1000000,
+			0xf4530000, 0xc7620000, 0x5ef50000, 0x6dc40000, 0x38970000, 0x0ba60000,
+			0x18eb0000, 0x2bda0000, 0x7e890000, 0x4db80000, 0xd42f0000, 0xe71e0000,
+			0xb24d0000, 0x817c0000, 0x91420000, 0xa2730000, 0xf7200000, 0xc4110000,
+			0x5d860000, 0x6eb70000, 0x3be40000, 0x08d50000, 0x1d7e0000, 0x2e4f0000,
+			0x7b1c0000, 0x482d0000, 0xd1ba0000, 0xe28b0000, 0xb7d80000, 0x84e90000,
+			0x94d70000, 0xa7e60000, 0xf2b50000, 0xc1840000, 0x58130000, 0x6b220000,
+			0x3e710000, 0x0d400000, 0x1e0d0000, 0x2d3c0000, 0x786f0000, 0x4b5e0000,
+			0xd2c90000, 0xe1f80000, 0xb4ab0000, 0x879a0000, 0x97a40000, 0xa4950000,
+			0xf1c60000, 0xc2f70000, 0x5b600000, 0x68510000, 0x3d020000, 0x0e330000,
+			0x16540000, 0x25650000, 0x70360000, 0x43070000, 0xda900000, 0xe9a10000,
+			0xbcf20000, 0x8fc30000, 0x9ffd0000, 0xaccc0000, 0xf99f0000, 0xcaae0000,
+			0x53390000, 0x60080000, 0x355b0000, 0x066a0000, 0x15270000, 0x26160000,
+			0x73450000, 0x40740000, 0xd9e30000, 0xead20000, 0xbf810000, 0x8cb00000,
+			0x9c8e0000, 0xafbf0000, 0xfaec0000, 0xc9dd0000, 0x504a0000, 0x637b0000,
+			0x36280000, 0x05190000, 0x10b20000, 0x23830000, 0x76d00000, 0x45e10000,
+			0xdc760000, 0xef470000, 0xba140000, 0x89250000, 0x991b0000, 0xaa2a0000,
+			0xff790000, 0xcc480000, 0x55df0000, 0x66ee0000, 0x33bd0000, 0x008c0000,
+			0x13c10000, 0x20f00000, 0x75a30000, 0x46920000, 0xdf050000, 0xec340000,
+			0xb9670000, 0x8a560000, 0x9a680000, 0xa9590000, 0xfc0a0000, 0xcf3b0000,
+			0x56ac0000, 0x659d0000, 0x30ce0000, 0x03ff0000,
+		},
+		{
+			0x00000000, 0x37300000, 0x6e600000, 0x59500000, 0xdcc00000, 0xebf00000,
+			0xb2a00000, 0x85900000, 0xa9a10000, 0x9e910000, 0xc7c10000, 0xf0f10000,
+			0x75610000, 0x42510000, 0x1b010000, 0x2c310000, 0x43630000, 0x74530000,
+			0x2d030000, 0x1a330000, 0x9fa30000, 0xa8930000, 0xf1c30000, 0xc6f30000,
+			0xeac20000, 0xddf20000, 0x84a20000, 0xb3920000, 0x36020000, 0x01320000,
+			0x58620000, 0x6f520000, 0x86c60000, 0xb1f60000, 0xe8a60000, 0xdf960000,
+			0x5a060000, 0x6d360000, 0x34660000, 0x03560000, 0x2f670000, 0x18570000,
+			0x41070000, 0x76370000, 0xf3a70000, 0xc4970000, 0x9dc70000, 0xaaf70000,
+			0xc5a50000, 0xf2950000, 0xabc50000, 0x9cf50000, 0x19650000, 0x2e550000,
+			0x77050000, 0x40350000, 0x6c040000, 0x5b340000, 0x02640000, 0x35540000,
+			0xb0c40000, 0x87f40000, 0xdea40000, 0xe9940000, 0x1dad0000, 0x2a9d0000,
+			0x73cd0000, 0x44fd0000, 0xc16d0000, 0xf65d0000, 0xaf0d0000, 0x983d0000,
+			0xb40c0000, 0x833c0000, 0xda6c0000, 0xed5c0000, 0x68cc0000, 0x5ffc0000,
+			0x06ac0000, 0x319c0000, 0x5ece0000, 0x69fe0000, 0x30ae0000, 0x079e0000,
+			0x820e0000, 0xb53e0000, 0xec6e0000, 0xdb5e0000, 0xf76f0000, 0xc05f0000,
+			0x990f0000, 0xae3f0000, 0x2baf0000, 0x1c9f0000, 0x45cf0000, 0x72ff0000,
+			0x9b6b0000, 0xac5b0000, 0xf50b0000, 0xc23b0000, 0x47ab0000, 0x709b0000,
+			0x29cb0000, 0x1efb0000, 0x32ca0000, 0x05fa0000, 0x5caa0000, 0x6b9a0000,
+			0xee0a0000, 0xd93a0000, 0x806a0000, 0xb75a0000, 0xd8080000, 0xef380000,
+			0xb6680000, 0x81580000, 0x04c80000, 0x33f80000, 0x6aa80000, 0x5d980000,
+			0x71a90000, 0x46990000, 0x1fc90000, 0x28f90000, 0xad690000, 0x9a590000,
+			0xc3090000, 0xf4390000, 0x3b5a0000, 0x0c6a0000, 0x553a0000, 0x620a0000,
+			0xe79a0000, 0xd0aa0000, 0x89fa0000, 0xbeca0000, 0x92fb0000, 0xa5cb0000,
+			0xfc9b0000, 0xcbab0000, 0x4e3b0000, 0x790b0000, 0x205b0000, 0x176b0000,
+			0x78390000, 0x4f090000, 0x16590000, 0x21690000, 0xa4f90000, 0x93c90000,
+			0xca990000, 0xfda90000, 0xd1980000, 0xe6a80000, 0xbff80000, 0x88c80000,
+			0x0d580000, 0x3a680000, 0x63380000, 0x54080000, 0xbd9c0000, 0x8aac0000,
+			0xd3fc0000, 0xe4cc0000, 0x615c0000, 0x566c0000, 0x0f3c0000, 0x380c0000,
+			0x143d0000, 0x230d0000, 0x7a5d0000, 0x4d6d0000, 0xc8fd0000, 0xffcd0000,
+			0xa69d0000, 0x91ad0000, 0xfeff0000, 0xc9cf0000, 0x909f0000, 0xa7af0000,
+			0x223f0000, 0x150f0000, 0x4c5f0000, 0x7b6f0000, 0x575e0000, 0x606e0000,
+			0x393e0000, 0x0e0e0000, 0x8b9e0000, 0xbcae0000, 0xe5fe0000, 0xd2ce0000,
+			0x26f70000, 0x11c70000, 0x48970000, 0x7fa70000, 0xfa370000, 0xcd070000,
+			0x94570000, 0xa3670000, 0x8f560000, 0xb8660000, 0xe1360000, 0xd6060000,
+			0x53960000, 0x64a60000, 0x3df60000, 0x0ac60000, 0x65940000, 0x52a40000,
+			0x0bf40000, 0x3cc40000, 0xb9540000, 0x8e640000, 0xd7340000, 0xe0040000,
+			0xcc350000, 0xfb050000, 0xa2550000, 0x95650000, 0x10f50000, 0x27c50000,
+			0x7e950000, 0x49a50000, 0xa0310000, 0x97010000, 0xce510000, 0xf9610000,
+			0x7cf10000, 0x4bc10000, 0x12910000, 0x25a10000, 0x09900000, 0x3ea00000,
+			0x67f00000, 0x50c00000, 0xd5500000, 0xe2600000, 0xbb300000, 0x8c000000,
+			0xe3520000, 0xd4620000, 0x8d320000, 0xba020000, 0x3f920000, 0x08a20000,
+			0x51f20000, 0x66c20000, 0x4af30000, 0x7dc30000, 0x24930000, 0x13a30000,
+			0x96330000, 0xa1030000, 0xf8530000, 0xcf630000,
+		},
+		{
+			0x00000000, 0x76b40000, 0xed680000, 0x9bdc0000, 0xcaf10000, 0xbc450000,
+			0x27990000, 0x512d0000, 0x85c30000, 0xf3770000, 0x68ab0000, 0x1e1f0000,
+			0x4f320000, 0x39860000, 0xa25a0000, 0xd4ee0000, 0x1ba70000, 0x6d130000,
+			0xf6cf0000, 0x807b0000, 0xd1560000, 0xa7e20000, 0x3c3e0000, 0x4a8a0000,
+			0x9e640000, 0xe8d00000, 0x730c0000, 0x05b80000, 0x54950000, 0x22210000,
+			0xb9fd0000, 0xcf490000, 0x374e0000, 0x41fa0000, 0xda260000, 0xac920000,
+			0xfdbf0000, 0x8b0b0000, 0x10d70000, 0x66630000, 0xb28d0000, 0xc4390000,
+			0x5fe50000, 0x29510000, 0x787c0000, 0x0ec80000, 0x95140000, 0xe3a00000,
+			0x2ce90000, 0x5a5d0000, 0xc1810000, 0xb7350000, 0xe6180000, 0x90ac0000,
+			0x0b700000, 0x7dc40000, 0xa92a0000, 0xdf9e0000, 0x44420000, 0x32f60000,
+			0x63db0000, 0x156f0000, 0x8eb30000, 0xf8070000, 0x6e9c0000, 0x18280000,
+			0x83f40000, 0xf5400000, 0xa46d0000, 0xd2d90000, 0x49050000, 0x3fb10000,
+			0xeb5f0000, 0x9deb0000, 0x06370000, 0x70830000, 0x21ae0000, 0x571a0000,
+			0xccc60000, 0xba720000, 0x753b0000, 0x038f0000, 0x98530000, 0xeee70000,
+			0xbfca0000, 0xc97e0000, 0x52a20000, 0x24160000, 0xf0f80000, 0x864c0000,
+			0x1d900000, 0x6b240000, 0x3a090000, 0x4cbd0000, 0xd7610000, 0xa1d50000,
+			0x59d20000, 0x2f660000, 0xb4ba0000, 0xc20e0000, 0x93230000, 0xe5970000,
+			0x7e4b0000, 0x08ff0000, 0xdc110000, 0xaaa50000, 0x31790000, 0x47cd0000,
+			0x16e00000, 0x60540000, 0xfb880000, 0x8d3c0000, 0x42750000, 0x34c10000,
+			0xaf1d0000, 0xd9a90000, 0x88840000, 0xfe300000, 0x65ec0000, 0x13580000,
+			0xc7b60000, 0xb1020000, 0x2ade0000, 0x5c6a0000, 0x0d470000, 0x7bf30000,
+			0xe02f0000, 0x969b0000, 0xdd380000, 0xab8c0000, 0x30500000, 0x46e40000,
+			0x17c90000, 0x617d0000, 0xfaa10000, 0x8c150000, 0x58fb0000, 0x2e4f0000,
+			0xb5930000, 0xc3270000, 0x920a0000, 0xe4be0000, 0x7f620000, 0x09d60000,
+			0xc69f0000, 0xb02b0000, 0x2bf70000, 0x5d430000, 0x0c6e0000, 0x7ada0000,
+			0xe1060000, 0x97b20000, 0x435c0000, 0x35e80000, 0xae340000, 0xd8800000,
+			0x89ad0000, 0xff190000, 0x64c50000, 0x12710000, 0xea760000, 0x9cc20000,
+			0x071e0000, 0x71aa0000, 0x20870000, 0x56330000, 0xcdef0000, 0xbb5b0000,
+			0x6fb50000, 0x19010000, 0x82dd0000, 0xf4690000, 0xa5440000, 0xd3f00000,
+			0x482c0000, 0x3e980000, 0xf1d10000, 0x87650000, 0x1cb90000, 0x6a0d0000,
+			0x3b200000, 0x4d940000, 0xd6480000, 0xa0fc0000, 0x74120000, 0x02a60000,
+			0x997a0000, 0xefce0000, 0xbee30000, 0xc8570000, 0x538b0000, 0x253f0000,
+			0xb3a40000, 0xc5100000, 0x5ecc0000, 0x28780000, 0x79550000, 0x0fe10000,
+			0x943d0000, 0xe2890000, 0x36670000, 0x40d30000, 0xdb0f0000, 0xadbb0000,
+			0xfc960000, 0x8a220000, 0x11fe0000, 0x674a0000, 0xa8030000, 0xdeb70000,
+			0x456b0000, 0x33df0000, 0x62f20000, 0x14460000, 0x8f9a0000, 0xf92e0000,
+			0x2dc00000, 0x5b740000, 0xc0a80000, 0xb61c0000, 0xe7310000, 0x91850000,
+			0x0a590000, 0x7ced0000, 0x84ea0000, 0xf25e0000, 0x69820000, 0x1f360000,
+			0x4e1b0000, 0x38af0000, 0xa3730000, 0xd5c70000, 0x01290000, 0x779d0000,
+			0xec410000, 0x9af50000, 0xcbd80000, 0xbd6c0000, 0x26b00000, 0x50040000,
+			0x9f4d0000, 0xe9f90000, 0x72250000, 0x04910000, 0x55bc0000, 0x23080000,
+			0xb8d40000, 0xce600000, 0x1a8e0000, 0x6c3a0000, 0xf7e60000, 0x81520000,
+			0xd07f0000, 0xa6cb0000, 0x3d170000, 0x4ba30000,
+		},
+		{
+			0x00000000, 0xaa510000, 0x44830000, 0xeed20000, 0x89060000, 0x23570000,
+			0xcd850000, 0x67d40000, 0x022d0000, 0xa87c0000, 0x46ae0000, 0xecff0000,
+			0x8b2b0000, 0x217a0000, 0xcfa80000, 0x65f90000, 0x045a0000, 0xae0b0000,
+			0x40d90000, 0xea880000, 0x8d5c0000, 0x270d0000, 0xc9df0000, 0x638e0000,
+			0x06770000, 0xac260000, 0x42f40000, 0xe8a50000, 0x8f710000, 0x25200000,
+			0xcbf20000, 0x61a30000, 0x08b40000, 0xa2e50000, 0x4c370000, 0xe6660000,
+			0x81b20000, 0x2be30000, 0xc5310000, 0x6f600000, 0x0a990000, 0xa0c80000,
+			0x4e1a0000, 0xe44b0000, 0x839f0000, 0x29ce0000, 0xc71c0000, 0x6d4d0000,
+			0x0cee0000, 0xa6bf0000, 0x486d0000, 0xe23c0000, 0x85e80000, 0x2fb90000,
+			0xc16b0000, 0x6b3a0000, 0x0ec30000, 0xa4920000, 0x4a400000, 0xe0110000,
+			0x87c50000, 0x2d940000, 0xc3460000, 0x69170000, 0x11680000, 0xbb390000,
+			0x55eb0000, 0xffba0000, 0x986e0000, 0x323f0000, 0xdced0000, 0x76bc0000,
+			0x13450000, 0xb9140000, 0x57c60000, 0xfd970000, 0x9a430000, 0x30120000,
+			0xdec00000, 0x74910000, 0x15320000, 0xbf630000, 0x51b10000, 0xfbe00000,
+			0x9c340000, 0x36650000, 0xd8b70000, 0x72e60000, 0x171f0000, 0xbd4e0000,
+			0x539c0000, 0xf9cd0000, 0x9e190000, 0x34480000, 0xda9a0000, 0x70cb0000,
+			0x19dc0000, 0xb38d0000, 0x5d5f0000, 0xf70e0000, 0x90da0000, 0x3a8b0000,
+			0xd4590000, 0x7e080000, 0x1bf10000, 0xb1a00000, 0x5f720000, 0xf5230000,
+			0x92f70000, 0x38a60000, 0xd6740000, 0x7c250000, 0x1d860000, 0xb7d70000,
+			0x59050000, 0xf3540000, 0x94800000, 0x3ed10000, 0xd0030000, 0x7a520000,
+			0x1fab0000, 0xb5fa0000, 0x5b280000, 0xf1790000, 0x96ad0000, 0x3cfc0000,
+			0xd22e0000, 0x787f0000, 0x22d00000, 0x88810000, 0x66530000, 0xcc020000,
+			0xabd60000, 0x01870000, 0xef550000, 0x45040000, 0x20fd0000, 0x8aac0000,
+			0x647e0000, 0xce2f0000, 0xa9fb0000, 0x03aa0000, 0xed780000, 0x47290000,
+			0x268a0000, 0x8cdb0000, 0x62090000, 0xc8580000, 0xaf8c0000, 0x05dd0000,
+			0xeb0f0000, 0x415e0000, 0x24a70000, 0x8ef60000, 0x60240000, 0xca750000,
+			0xada10000, 0x07f00000, 0xe9220000, 0x43730000, 0x2a640000, 0x80350000,
+			0x6ee70000, 0xc4b60000, 0xa3620000, 0x09330000, 0xe7e10000, 0x4db00000,
+			0x28490000, 0x82180000, 0x6cca0000, 0xc69b0000, 0xa14f0000, 0x0b1e0000,
+			0xe5cc0000, 0x4f9d0000, 0x2e3e0000, 0x846f0000, 0x6abd0000, 0xc0ec0000,
+			0xa7380000, 0x0d690000, 0xe3bb0000, 0x49ea0000, 0x2c130000, 0x86420000,
+			0x68900000, 0xc2c10000, 0xa5150000, 0x0f440000, 0xe1960000, 0x4bc70000,
+			0x33b80000, 0x99e90000, 0x773b0000, 0xdd6a0000, 0xbabe0000, 0x10ef0000,
+			0xfe3d0000, 0x546c0000, 0x31950000, 0x9bc40000, 0x75160000, 0xdf470000,
+			0xb8930000, 0x12c20000, 0xfc100000, 0x56410000, 0x37e20000, 0x9db30000,
+			0x73610000, 0xd9300000, 0xbee40000, 0x14b50000, 0xfa670000, 0x50360000,
+			0x35cf0000, 0x9f9e0000, 0x714c0000, 0xdb1d0000, 0xbcc90000, 0x16980000,
+			0xf84a0000, 0x521b0000, 0x3b0c0000, 0x915d0000, 0x7f8f0000, 0xd5de0000,
+			0xb20a0000, 0x185b0000, 0xf6890000, 0x5cd80000, 0x39210000, 0x93700000,
+			0x7da20000, 0xd7f30000, 0xb0270000, 0x1a760000, 0xf4a40000, 0x5ef50000,
+			0x3f560000, 0x95070000, 0x7bd50000, 0xd1840000, 0xb6500000, 0x1c010000,
+			0xf2d30000, 0x58820000, 0x3d7b0000, 0x972a0000, 0x79f80000, 0xd3a90000,
+			0xb47d0000, 0x1e2c0000, 0xf0fe0000, 0x5aaf0000,
+		},
+		{
+			0x00000000, 0x45a00000, 0x8b400000, 0xcee00000, 0x06a10000, 0x43010000,
+			0x8de10000, 0xc8410000, 0x0d420000, 0x48e20000, 0x86020000, 0xc3a20000,
+			0x0be30000, 0x4e430000, 0x80a30000, 0xc5030000, 0x1a840000, 0x5f240000,
+			0x91c40000, 0xd4640000, 0x1c250000, 0x59850000, 0x97650000, 0xd2c50000,
+			0x17c60000, 0x52660000, 0x9c860000, 0xd9260000, 0x11670000, 0x54c70000,
+			0x9a270000, 0xdf870000, 0x35080000, 0x70a80000, 0xbe480000, 0xfbe80000,
+			0x33a90000, 0x76090000, 0xb8e90000, 0xfd490000, 0x384a0000, 0x7dea0000,
+			0xb30a0000, 0xf6aa0000, 0x3eeb0000, 0x7b4b0000, 0xb5ab0000, 0xf00b0000,
+			0x2f8c0000, 0x6a2c0000, 0xa4cc0000, 0xe16c0000, 0x292d0000, 0x6c8d0000,
+			0xa26d0000, 0xe7cd0000, 0x22ce0000, 0x676e0000, 0xa98e0000, 0xec2e0000,
+			0x246f0000, 0x61cf0000, 0xaf2f0000, 0xea8f0000, 0x6a100000, 0x2fb00000,
+			0xe1500000, 0xa4f00000, 0x6cb10000, 0x29110000, 0xe7f10000, 0xa2510000,
+			0x67520000, 0x22f20000, 0xec120000, 0xa9b20000, 0x61f30000, 0x24530000,
+			0xeab30000, 0xaf130000, 0x70940000, 0x35340000, 0xfbd40000, 0xbe740000,
+			0x76350000, 0x33950000, 0xfd750000, 0xb8d50000, 0x7dd60000, 0x38760000,
+			0xf6960000, 0xb3360000, 0x7b770000, 0x3ed70000, 0xf0370000, 0xb5970000,
+			0x5f180000, 0x1ab80000, 0xd4580000, 0x91f80000, 0x59b90000, 0x1c190000,
+			0xd2f90000, 0x97590000, 0x525a0000, 0x17fa0000, 0xd91a0000, 0x9cba0000,
+			0x54fb0000, 0x115b0000, 0xdfbb0000, 0x9a1b0000, 0x459c0000, 0x003c0000,
+			0xcedc0000, 0x8b7c0000, 0x433d0000, 0x069d0000, 0xc87d0000, 0x8ddd0000,
+			0x48de0000, 0x0d7e0000, 0xc39e0000, 0x863e0000, 0x4e7f0000, 0x0bdf0000,
+			0xc53f0000, 0x809f0000, 0xd4200000, 0x91800000, 0x5f600000, 0x1ac00000,
+			0xd2810000, 0x97210000, 0x59c10000, 0x1c610000, 0xd9620000, 0x9cc20000,
+			0x52220000, 0x17820000, 0xdfc30000, 0x9a630000, 0x54830000, 0x11230000,
+			0xcea40000, 0x8b040000, 0x45e40000, 0x00440000, 0xc8050000, 0x8da50000,
+			0x43450000, 0x06e50000, 0xc3e60000, 0x86460000, 0x48a60000, 0x0d060000,
+			0xc5470000, 0x80e70000, 0x4e070000, 0x0ba70000, 0xe1280000, 0xa4880000,
+			0x6a680000, 0x2fc80000, 0xe7890000, 0xa2290000, 0x6cc90000, 0x29690000,
+			0xec6a0000, 0xa9ca0000, 0x672a0000, 0x228a0000, 0xeacb0000, 0xaf6b0000,
+			0x618b0000, 0x242b0000, 0xfbac0000, 0xbe0c0000, 0x70ec0000, 0x354c0000,
+			0xfd0d0000, 0xb8ad0000, 0x764d0000, 0x33ed0000, 0xf6ee0000, 0xb34e0000,
+			0x7dae0000, 0x380e0000, 0xf04f0000, 0xb5ef0000, 0x7b0f0000, 0x3eaf0000,
+			0xbe300000, 0xfb900000, 0x35700000, 0x70d00000, 0xb8910000, 0xfd310000,
+			0x33d10000, 0x76710000, 0xb3720000, 0xf6d20000, 0x38320000, 0x7d920000,
+			0xb5d30000, 0xf0730000, 0x3e930000, 0x7b330000, 0xa4b40000, 0xe1140000,
+			0x2ff40000, 0x6a540000, 0xa2150000, 0xe7b50000, 0x29550000, 0x6cf50000,
+			0xa9f60000, 0xec560000, 0x22b60000, 0x67160000, 0xaf570000, 0xeaf70000,
+			0x24170000, 0x61b70000, 0x8b380000, 0xce980000, 0x00780000, 0x45d80000,
+			0x8d990000, 0xc8390000, 0x06d90000, 0x43790000, 0x867a0000, 0xc3da0000,
+			0x0d3a0000, 0x489a0000, 0x80db0000, 0xc57b0000, 0x0b9b0000, 0x4e3b0000,
+			0x91bc0000, 0xd41c0000, 0x1afc0000, 0x5f5c0000, 0x971d0000, 0xd2bd0000,
+			0x1c5d0000, 0x59fd0000, 0x9cfe0000, 0xd95e0000, 0x17be0000, 0x521e0000,
+			0x9a5f0000, 0xdfff0000, 0x111f0000, 0x54bf0000,
+		},
+		{
+			0x00000000, 0xb8610000, 0x60e30000, 0xd8820000, 0xc1c60000, 0x79a70000,
+			0xa1250000, 0x19440000, 0x93ad0000, 0x2bcc0000, 0xf34e0000, 0x4b2f0000,
+			0x526b0000, 0xea0a0000, 0x32880000, 0x8ae90000, 0x377b0000, 0x8f1a0000,
+			0x57980000, 0xeff90000, 0xf6bd0000, 0x4edc0000, 0x965e0000, 0x2e3f0000,
+			0xa4d60000, 0x1cb70000, 0xc4350000, 0x7c540000, 0x65100000, 0xdd710000,
+			0x05f30000, 0xbd920000, 0x6ef60000, 0xd6970000, 0x0e150000, 0xb6740000,
+			0xaf300000, 0x17510000, 0xcfd30000, 0x77b20000, 0xfd5b0000, 0x453a0000,
+			0x9db80000, 0x25d90000, 0x3c9d0000, 0x84fc0000, 0x5c7e0000, 0xe41f0000,
+			0x598d0000, 0xe1ec0000, 0x396e0000, 0x810f0000, 0x984b0000, 0x202a0000,
+			0xf8a80000, 0x40c90000, 0xca200000, 0x72410000, 0xaac30000, 0x12a20000,
+			0x0be60000, 0xb3870000, 0x6b050000, 0xd3640000, 0xddec0000, 0x658d0000,
+			0xbd0f0000, 0x056e0000, 0x1c2a0000, 0xa44b0000, 0x7cc90000, 0xc4a80000,
+			0x4e410000, 0xf6200000, 0x2ea20000, 0x96c30000, 0x8f870000, 0x37e60000,
+			0xef640000, 0x57050000, 0xea970000, 0x52f60000, 0x8a740000, 0x32150000,
+			0x2b510000, 0x93300000, 0x4bb20000, 0xf3d30000, 0x793a0000, 0xc15b0000,
+			0x19d90000, 0xa1b80000, 0xb8fc0000, 0x009d0000, 0xd81f0000, 0x607e0000,
+			0xb31a0000, 0x0b7b0000, 0xd3f90000, 0x6b980000, 0x72dc0000, 0xcabd0000,
+			0x123f0000, 0xaa5e0000, 0x20b70000, 0x98d60000, 0x40540000, 0xf8350000,
+			0xe1710000, 0x59100000, 0x81920000, 0x39f30000, 0x84610000, 0x3c000000,
+			0xe4820000, 0x5ce30000, 0x45a70000, 0xfdc60000, 0x25440000, 0x9d250000,
+			0x17cc0000, 0xafad0000, 0x772f0000, 0xcf4e0000, 0xd60a0000, 0x6e6b0000,
+			0xb6e90000, 0x0e880000, 0xabf90000, 0x13980000, 0xcb1a0000, 0x737b0000,
+			0x6a3f0000, 0xd25e0000, 0x0adc0000, 0xb2bd0000, 0x38540000, 0x80350000,
+			0x58b70000, 0xe0d60000, 0xf9920000, 0x41f30000, 0x99710000, 0x21100000,
+			0x9c820000, 0x24e30000, 0xfc610000, 0x44000000, 0x5d440000, 0xe5250000,
+			0x3da70000, 0x85c60000, 0x0f2f0000, 0xb74e0000, 0x6fcc0000, 0xd7ad0000,
+			0xcee90000, 0x76880000, 0xae0a0000, 0x166b0000, 0xc50f0000, 0x7d6e0000,
+			0xa5ec0000, 0x1d8d0000, 0x04c90000, 0xbca80000, 0x642a0000, 0xdc4b0000,
+			0x56a20000, 0xeec30000, 0x36410000, 0x8e200000, 0x97640000, 0x2f050000,
+			0xf7870000, 0x4fe60000, 0xf2740000, 0x4a150000, 0x92970000, 0x2af60000,
+			0x33b20000, 0x8bd30000, 0x53510000, 0xeb300000, 0x61d90000, 0xd9b80000,
+			0x013a0000, 0xb95b0000, 0xa01f0000, 0x187e0000, 0xc0fc0000, 0x789d0000,
+			0x76150000, 0xce740000, 0x16f60000, 0xae970000, 0xb7d30000, 0x0fb20000,
+			0xd7300000, 0x6f510000, 0xe5b80000, 0x5dd90000, 0x855b0000, 0x3d3a0000,
+			0x247e0000, 0x9c1f0000, 0x449d0000, 0xfcfc0000, 0x416e0000, 0xf90f0000,
+			0x218d0000, 0x99ec0000, 0x80a80000, 0x38c90000, 0xe04b0000, 0x582a0000,
+			0xd2c30000, 0x6aa20000, 0xb2200000, 0x0a410000, 0x13050000, 0xab640000,
+			0x73e60000, 0xcb870000, 0x18e30000, 0xa0820000, 0x78000000, 0xc0610000,
+			0xd9250000, 0x61440000, 0xb9c60000, 0x01a70000, 0x8b4e0000, 0x332f0000,
+			0xebad0000, 0x53cc0000, 0x4a880000, 0xf2e90000, 0x2a6b0000, 0x920a0000,
+			0x2f980000, 0x97f90000, 0x4f7b0000, 0xf71a0000, 0xee5e0000, 0x563f0000,
+			0x8ebd0000, 0x36dc0000, 0xbc350000, 0x04540000, 0xdcd60000, 0x64b70000,
+			0x7df30000, 0xc5920000, 0x1d100000, 0xa5710000,
+		},
+		{
+			0x00000000, 0x47d30000, 0x8fa60000, 0xc8750000, 0x0f6d0000, 0x48be0000,
+			0x80cb0000, 0xc7180000, 0x1eda0000, 0x59090000, 0x917c0000, 0xd6af0000,
+			0x11b70000, 0x56640000, 0x9e110000, 0xd9c20000, 0x3db40000, 0x7a670000,
+			0xb2120000, 0xf5c10000, 0x32d90000, 0x750a0000, 0xbd7f0000, 0xfaac0000,
+			0x236e0000, 0x64bd0000, 0xacc80000, 0xeb1b0000, 0x2c030000, 0x6bd00000,
+			0xa3a50000, 0xe4760000, 0x7b680000, 0x3cbb0000, 0xf4ce0000, 0xb31d0000,
+			0x74050000, 0x33d60000, 0xfba30000, 0xbc700000, 0x65b20000, 0x22610000,
+			0xea140000, 0xadc70000, 0x6adf0000, 0x2d0c0000, 0xe5790000, 0xa2aa0000,
+			0x46dc0000, 0x010f0000, 0xc97a0000, 0x8ea90000, 0x49b10000, 0x0e620000,
+			0xc6170000, 0x81c40000, 0x58060000, 0x1fd50000, 0xd7a00000, 0x90730000,
+			0x576b0000, 0x10b80000, 0xd8cd0000, 0x9f1e0000, 0xf6d00000, 0xb1030000,
+			0x79760000, 0x3ea50000, 0xf9bd0000, 0xbe6e0000, 0x761b0000, 0x31c80000,
+			0xe80a0000, 0xafd90000, 0x67ac0000, 0x207f0000, 0xe7670000, 0xa0b40000,
+			0x68c10000, 0x2f120000, 0xcb640000, 0x8cb70000, 0x44c20000, 0x03110000,
+			0xc4090000, 0x83da0000, 0x4baf0000, 0x0c7c0000, 0xd5be0000, 0x926d0000,
+			0x5a180000, 0x1dcb0000, 0xdad30000, 0x9d000000, 0x55750000, 0x12a60000,
+			0x8db80000, 0xca6b0000, 0x021e0000, 0x45cd0000, 0x82d50000, 0xc5060000,
+			0x0d730000, 0x4aa00000, 0x93620000, 0xd4b10000, 0x1cc40000, 0x5b170000,
+			0x9c0f0000, 0xdbdc0000, 0x13a90000, 0x547a0000, 0xb00c0000, 0xf7df0000,
+			0x3faa0000, 0x78790000, 0xbf610000, 0xf8b20000, 0x30c70000, 0x77140000,
+			0xaed60000, 0xe9050000, 0x21700000, 0x66a30000, 0xa1bb0000, 0xe6680000,
+			0x2e1d0000, 0x69ce0000, 0xfd810000, 0xba520000, 0x72270000, 0x35f40000,
+			0xf2ec0000, 0xb53f0000, 0x7d4a0000, 0x3a990000, 0xe35b0000, 0xa4880000,
+			0x6cfd0000, 0x2b2e0000, 0xec360000, 0xabe50000, 0x63900000, 0x24430000,
+			0xc0350000, 0x87e60000, 0x4f930000, 0x08400000, 0xcf580000, 0x888b0000,
+			0x40fe0000, 0x072d0000, 0xdeef0000, 0x993c0000, 0x51490000, 0x169a0000,
+			0xd1820000, 0x96510000, 0x5e240000, 0x19f70000, 0x86e90000, 0xc13a0000,
+			0x094f0000, 0x4e9c0000, 0x89840000, 0xce570000, 0x06220000, 0x41f10000,
+			0x98330000, 0xdfe00000, 0x17950000, 0x50460000, 0x975e0000, 0xd08d0000,
+			0x18f80000, 0x5f2b0000, 0xbb5d0000, 0xfc8e0000, 0x34fb0000, 0x73280000,
+			0xb4300000, 0xf3e30000, 0x3b960000, 0x7c450000, 0xa5870000, 0xe2540000,
+			0x2a210000, 0x6df20000, 0xaaea0000, 0xed390000, 0x254c0000, 0x629f0000,
+			0x0b510000, 0x4c820000, 0x84f70000, 0xc3240000, 0x043c0000, 0x43ef0000,
+			0x8b9a0000, 0xcc490000, 0x158b0000, 0x52580000, 0x9a2d0000, 0xddfe0000,
+			0x1ae60000, 0x5d350000, 0x95400000, 0xd2930000, 0x36e50000, 0x71360000,
+			0xb9430000, 0xfe900000, 0x39880000, 0x7e5b0000, 0xb62e0000, 0xf1fd0000,
+			0x283f0000, 0x6fec0000, 0xa7990000, 0xe04a0000, 0x27520000, 0x60810000,
+			0xa8f40000, 0xef270000, 0x70390000, 0x37ea0000, 0xff9f0000, 0xb84c0000,
+			0x7f540000, 0x38870000, 0xf0f20000, 0xb7210000, 0x6ee30000, 0x29300000,
+			0xe1450000, 0xa6960000, 0x618e0000, 0x265d0000, 0xee280000, 0xa9fb0000,
+			0x4d8d0000, 0x0a5e0000, 0xc22b0000, 0x85f80000, 0x42e00000, 0x05330000,
+			0xcd460000, 0x8a950000, 0x53570000, 0x14840000, 0xdcf10000, 0x9b220000,
+			0x5c3a0000, 0x1be90000, 0xd39c0000, 0x944f0000,
+		},
+	},
+	{ /* CRC_PRESET_16_USB */
+		{
+			0x00000000, 0x0000c0c1, 0x0000c181, 0x00000140, 0x0000c301, 0x000003c0,
+			0x00000280, 0x0000c241, 0x0000c601, 0x000006c0, 0x00000780, 0x0000c741,
+			0x00000500, 0x0000c5c1, 0x0000c481, 0x00000440, 0x0000cc01, 0x00000cc0,
+			0x00000d80, 0x0000cd41, 0x00000f00, 0x0000cfc1, 0x0000ce81, 0x00000e40,
+			0x00000a00, 0x0000cac1, 0x0000cb81, 0x00000b40, 0x0000c901, 0x000009c0,
+			0x00000880, 0x0000c841, 0x0000d801, 0x000018c0, 0x00001980, 0x0000d941,
+			0x00001b00, 0x0000dbc1, 0x0000da81, 0x00001a40, 0x00001e00, 0x0000dec1,
+			0x0000df81, 0x00001f40, 0x0000dd01, 0x00001dc0, 0x00001c80, 0x0000dc41,
+			0x00001400, 0x0000d4c1, 0x0000d581, 0x00001540, 0x0000d701, 0x000017c0,
+			0x00001680, 0x0000d641, 0x0000d201, 0x000012c0, 0x00001380, 0x0000d341,
+			0x00001100, 0x0000d1c1, 0x0000d081, 0x00001040, 0x0000f001, 0x000030c0,
+			0x00003180, 0x0000f141, 0x00003300, 0x0000f3c1, 0x0000f281, 0x00003240,
+			0x00003600, 0x0000f6c1, 0x0000f781, 0x00003740, 0x0000f501, 0x000035c0,
+			0x00003480, 0x0000f441, 0x00003c00, 0x0000fcc1, 0x0000fd81, 0x00003d40,
+			0x0000ff01, 0x00003fc0, 0x00003e80, 0x0000fe41, 0x0000fa01, 0x00003ac0,
+			0x00003b80, 0x0000fb41, 0x00003900, 0x0000f9c1, 0x0000f881, 0x00003840,
+			0x00002800, 0x0000e8c1, 0x0000e981, 0x00002940, 0x0000eb01, 0x00002bc0,
+			0x00002a80, 0x0000ea41, 0x0000ee01, 0x00002ec0, 0x00002f80, 0x0000ef41,
+			0x00002d00, 0x0000edc1, 0x0000ec81, 0x00002c40, 0x0000e401, 0x000024c0,
+			0x00002580, 0x0000e541, 0x00002700, 0x0000e7c1, 0x0000e681, 0x00002640,
+			0x00002200, 0x0000e2c1, 0x0000e381, 0x00002340, 0x0000e101, 0x000021c0,
+			0x00002080, 0x0000e041, 0x0000a001, 0x000060c0, 0x00006180, 0x0000a141,
+			0x00006300, 0x0000a3c1, 0x0000a281, 0x00006240, 0x00006600, 0x0000a6c1,
+			0x0000a781, 0x00006740, 0x0000a501, 0x000065c0, 0x00006480, 0x0000a441,
+			0x00006c00, 0x0000acc1, 0x0000ad81, 0x00006d40, 0x0000af01, 0x00006fc0,
+			0x00006e80, 0x0000ae41, 0x0000aa01, 0x00006ac0, 0x00006b80, 0x0000ab41,
+			0x00006900, 0x0000a9c1, 0x0000a881, 0x00006840, 0x00007800, 0x0000b8c1,
+			0x0000b981, 0x00007940, 0x0000bb01, 0x00007bc0, 0x00007a80, 0x0000ba41,
+			0x0000be01, 0x00007ec0, 0x00007f80, 0x0000bf41, 0x00007d00, 0x0000bdc1,
+			0x0000bc81, 0x00007c40, 0x0000b401, 0x000074c0, 0x00007580, 0x0000b541,
+			0x00007700, 0x0000b7c1, 0x0000b681, 0x00007640, 0x00007200, 0x0000b2c1,
+			0x0000b381, 0x00007340, 0x0000b101, 0x000071c0, 0x00007080, 0x0000b041,
+			0x00005000, 0x000090c1, 0x00009181, 0x00005140, 0x00009301, 0x000053c0,
+			0x00005280, 0x00009241, 0x00009601, 0x000056c0, 0x00005780, 0x00009741,
+			0x00005500, 0x000095c1, 0x00009481, 0x00005440, 0x00009c01, 0x00005cc0,
+			0x00005d80, 0x00009d41, 0x00005f00, 0x00009fc1, 0x00009e81, 0x00005e40,
+			0x00005a00, 0x00009ac1, 0x00009b81, 0x00005b40, 0x00009901, 0x000059c0,
+			0x00005880, 0x00009841, 0x00008801, 0x000048c0, 0x00004980, 0x00008941,
+			0x00004b00, 0x00008bc1, 0x00008a81, 0x00004a40, 0x00004e00, 0x00008ec1,
+			0x00008f81, 0x00004f40, 0x00008d01, 0x00004dc0, 0x00004c80, 0x00008c41,
+			0x00004400, 0x000084c1, 0x00008581, 0x00004540, 0x00008701, 0x000047c0,
+			0x00004680, 0x00008641, 0x00008201, 0x000042c0, 0x00004380, 0x00008341,
+			0x00004100, 0x000081c1, 0x00008081, 0x00004040,
+		},
+		{
+			0x00000000, 0x00009001, 0x00006001, 0x0000f000, 0x0000c002, 0x00005003,
+			0x0000a003, 0x00003002, 0x0000c007, 0x00005006, 0x0000a006, 0x00003007,
+			0x00000005, 0x00009004, 0x00006004, 0x0000f005, 0x0000c00d, 0x0000500c,
+			0x0000a00c, 0x0000300d, 0x0000000f, 0x0000900e, 0x0000600e, 0x0000f00f,
+			0x0000000a, 0x0000900b, 0x0000600b, 0x0000f00a, 0x0000c008, 0x00005009,
+			0x0000a009, 0x00003008, 0x0000c019, 0x00005018, 0x0000a018, 0x00003019,
+			0x0000001b, 0x0000901a, 0x0000601a, 0x0000f01b, 0x0000001e, 0x0000901f,
+			0x0000601f, 0x0000f01e, 0x0000c01c, 0x0000501d, 0x0000a01d, 0x0000301c,
+			0x00000014, 0x00009015, 0x00006015, 0x0000f014, 0x0000c016, 0x00005017,
+			0x0000a017, 0x00003016, 0x0000c013, 0x00005012, 0x0000a012, 0x00003013,
+			0x00000011, 0x00009010, 0x00006010, 0x0000f011, 0x0000c031, 0x00005030,
+			0x0000a030, 0x00003031, 0x00000033, 0x00009032, 0x00006032, 0x0000f033,
+			0x00000036, 0x00009037, 0x00006037, 0x0000f036, 0x0000c034, 0x00005035,
+			0x0000a035, 0x00003034, 0x0000003c, 0x0000903d, 0x0000603d, 0x0000f03c,
+			0x0000c03e, 0x0000503f, 0x0000a03f, 0x0000303e, 0x0000c03b, 0x0000503a,
+			0x0000a03a, 0x0000303b, 0x00000039, 0x00009038, 0x00006038, 0x0000f039,
+			0x00000028, 0x00009029, 0x00006029, 0x0000f028, 0x0000c02a, 0x0000502b,
+			0x0000a02b, 0x0000302a, 0x0000c02f, 0x0000502e, 0x0000a02e, 0x0000302f,
+			0x0000002d, 0x0000902c, 0x0000602c, 0x0000f02d, 0x0000c025, 0x00005024,
+			0x0000a024, 0x00003025, 0x00000027, 0x00009026, 0x00006026, 0x0000f027,
+			0x00000022, 0x00009023, 0x00006023, 0x0000f022, 0x0000c020, 0x00005021,
+			0x0000a021, 0x00003020, 0x0000c061, 0x00005060, 0x0000a060, 0x00003061,
+			0x00000063, 0x00009062, 0x00006062, 0x0000f063, 0x00000066, 0x00009067,
+			0x00006067, 0x0000f066, 0x0000c064, 0x00005065, 0x0000a065, 0x00003064,
+			0x0000006c, 0x0000906d, 0x0000606d, 0x0000f06c, 0x0000c06e, 0x0000506f,
+			0x0000a06f, 0x0000306e, 0x0000c06b, 0x0000506a, 0x0000a06a, 0x0000306b,
+			0x00000069, 0x00009068, 0x00006068, 0x0000f069, 0x00000078, 0x00009079,
+			0x00006079, 0x0000f078, 0x0000c07a, 0x0000507b, 0x0000a07b, 0x0000307a,
+			0x0000c07f, 0x0000507e, 0x0000a07e, 0x0000307f, 0x0000007d, 0x0000907c,
+			0x0000607c, 0x0000f07d, 0x0000c075, 0x00005074, 0x0000a074, 0x00003075,
+			0x00000077, 0x00009076, 0x00006076, 0x0000f077, 0x00000072, 0x00009073,
+			0x00006073, 0x0000f072, 0x0000c070, 0x00005071, 0x0000a071, 0x00003070,
+			0x00000050, 0x00009051, 0x00006051, 0x0000f050, 0x0000c052, 0x00005053,
+			0x0000a053, 0x00003052, 0x0000c057, 0x00005056, 0x0000a056, 0x00003057,
+			0x00000055, 0x00009054, 0x00006054, 0x0000f055, 0x0000c05d, 0x0000505c,
+			0x0000a05c, 0x0000305d, 0x0000005f, 0x0000905e, 0x0000605e, 0x0000f05f,
+			0x0000005a, 0x0000905b, 0x0000605b, 0x0000f05a, 0x0000c058, 0x00005059,
+			0x0000a059, 0x00003058, 0x0000c049, 0x00005048, 0x0000a048, 0x00003049,
+			0x0000004b, 0x0000904a, 0x0000604a, 0x0000f04b, 0x0000004e, 0x0000904f,
+			0x0000604f, 0x0000f04e, 0x0000c04c, 0x0000504d, 0x0000a04d, 0x0000304c,
+			0x00000044, 0x00009045, 0x00006045, 0x0000f044, 0x0000c046, 0x00005047,
+			0x0000a047, 0x00003046, 0x0000c043, 0x00005042, 0x0000a042, 0x00003043,
+			0x00000041, 0x00009040, 0x00006040, 0x0000f041,
+		},
+		{
+			0x00000000, 0x0000c051, 0x0000c0a1, 0x000000f0, 0x0000c141, 0x00000110,
+			0x000001e0, 0x0000c1b1, 0x0000c281, 0x000002d0, 0x00000220, 0x0000c271,
+			0x000003c0, 0x0000c391, 0x0000c361, 0x00000330, 0x0000c501, 0x00000550,
+			0x000005a0, 0x0000c5f1, 0x00000440, 0x0000c411, 0x0000c4e1, 0x000004b0,
+			0x00000780, 0x0000c7d1, 0x0000c721, 0x00000770, 0x0000c6c1, 0x00000690,
+			0x00000660, 0x0000c631, 0x0000ca01, 0x00000a50, 0x00000aa0, 0x0000caf1,
+			0x00000b40, 0x0000cb11, 0x0000cbe1, 0x00000bb0, 0x00000880, 0x0000c8d1,
+			0x0000c821, 0x00000870, 0x0000c9c1, 0x00000990, 0x00000960, 0x0000c931,
+			0x00000f00, 0x0000cf51, 0x0000cfa1, 0x00000ff0, 0x0000ce41, 0x00000e10,
+			0x00000ee0, 0x0000ceb1, 0x0000cd81, 0x00000dd0, 0x00000d20, 0x0000cd71,
+			0x00000cc0, 0x0000cc91, 0x0000cc61, 0x00000c30, 0x0000d401, 0x00001450,
+			0x000014a0, 0x0000d4f1, 0x00001540, 0x0000d511, 0x0000d5e1, 0x000015b0,
+			0x00001680, 0x0000d6d1, 0x0000d621, 0x00001670, 0x0000d7c1, 0x00001790,
+			0x00001760, 0x0000d731, 0x00001100, 0x0000d151, 0x0000d1a1, 0x000011f0,
+			0x0000d041, 0x00001010, 0x000010e0, 0x0000d0b1, 0x0000d381, 0x000013d0,
+			0x00001320, 0x0000d371, 0x000012c0, 0x0000d291, 0x0000d261, 0x00001230,
+			0x00001e00, 0x0000de51, 0x0000dea1, 0x00001ef0, 0x0000df41, 0x00001f10,
+			0x00001fe0, 0x0000dfb1, 0x0000dc81, 0x00001cd0, 0x00001c20, 0x0000dc71,
+			0x00001dc0, 0x0000dd91, 0x0000dd61, 0x00001d30, 0x0000db01, 0x00001b50,
+			0x00001ba0, 0x0000dbf1, 0x00001a40, 0x0000da11, 0x0000dae1, 0x00001ab0,
+			0x00001980, 0x0000d9d1, 0x0000d921, 0x00001970, 0x0000d8c1, 0x00001890,
+			0x00001860, 0x0000d831, 0x0000e801, 0x00002850, 0x000028a0, 0x0000e8f1,
+			0x00002940, 0x0000e911, 0x0000e9e1, 0x000029b0, 0x00002a80, 0x0000ead1,
+			0x0000ea21, 0x00002a70, 0x0000ebc1, 0x00002b90, 0x00002b60, 0x0000eb31,
+			0x00002d00, 0x0000ed51, 0x0000eda1, 0x00002df0, 0x0000ec41, 0x00002c10,
+			0x00002ce0, 0x0000ecb1, 0x0000ef81, 0x00002fd0, 0x00002f20, 0x0000ef71,
+			0x00002ec0, 0x0000ee91, 0x0000ee61, 0x00002e30, 0x00002200, 0x0000e251,
+			0x0000e2a1, 0x000022f0, 0x0000e341, 0x00002310, 0x000023e0, 0x0000e3b1,
+			0x0000e081, 0x000020d0, 0x00002020, 0x0000e071, 0x000021c0, 0x0000e191,
+			0x0000e161, 0x00002130, 0x0000e701, 0x00002750, 0x000027a0, 0x0000e7f1,
+			0x00002640, 0x0000e611, 0x0000e6e1, 0x000026b0, 0x00002580, 0x0000e5d1,
+			0x0000e521, 0x00002570, 0x0000e4c1, 0x00002490, 0x00002460, 0x0000e431,
+			0x00003c00, 0x0000fc51, 0x0000fca1, 0x00003cf0, 0x0000fd41, 0x00003d10,
+			0x00003de0, 0x0000fdb1, 0x0000fe81, 0x00003ed0, 0x00003e20, 0x0000fe71,
+			0x00003fc0, 0x0000ff91, 0x0000ff61, 0x00003f30, 0x0000f901, 0x00003950,
+			0x000039a0, 0x0000f9f1, 0x00003840, 0x0000f811, 0x0000f8e1, 0x000038b0,
+			0x00003b80, 0x0000fbd1, 0x0000fb21, 0x00003b70, 0x0000fac1, 0x00003a90,
+			0x00003a60, 0x0000fa31, 0x0000f601, 0x00003650, 0x000036a0, 0x0000f6f1,
+			0x00003740, 0x0000f711, 0x0000f7e1, 0x000037b0, 0x00003480, 0x0000f4d1,
+			0x0000f421, 0x00003470, 0x0000f5c1, 0x00003590, 0x00003560, 0x0000f531,
+			0x00003300, 0x0000f351, 0x0000f3a1, 0x000033f0, 0x0000f241, 0x00003210,
+			0x000032e0, 0x0000f2b1, 0x0000f181, 0x000031d0, 0x00003120, 0x0000f171,
+			0x000030c0, 0x0000f091, 0x0000f061, 0x00003030,
+		},
+		{
+			0x00000000, 0x0000fc01, 0x0000b801, 0x00004400, 0x00003001, 0x0000cc00,
+			0x00008800, 0x00007401, 0x00006002, 0x00009c03, 0x0000d803, 0x00002402,
+			0x00005003, 0x0000ac02, 0x0000e802, 0x00001403, 0x0000c004, 0x00003c05,
+			0x00007805, 0x00008404, 0x0000f005, 0x00000c04, 0x00004804, 0x0000b405,
+			0x0000a006, 0x00005c07, 0x00001807, 0x0000e406, 0x00009007, 0x00006c06,
+			0x00002806, 0x0000d407, 0x0000c00b, 0x00003c0a, 0x0000780a, 0x0000840b,
+			0x0000f00a, 0x00000c0b, 0x0000480b, 0x0000b40a, 0x0000a009, 0x00005c08,
+			0x00001808, 0x0000e409, 0x00009008, 0x00006c09, 0x00002809, 0x0000d408,
+			0x0000000f, 0x0000fc0e, 0x0000b80e, 0x0000440f, 0x0000300e, 0x0000cc0f,
+			0x0000880f, 0x0000740e, 0x0000600d, 0x00009c0c, 0x0000d80c, 0x0000240d,
+			0x0000500c, 0x0000ac0d, 0x0000e80d, 0x0000140c, 0x0000c015, 0x00003c14,
+			0x00007814, 0x00008415, 0x0000f014, 0x00000c15, 0x00004815, 0x0000b414,
+			0x0000a017, 0x00005c16, 0x00001816, 0x0000e417, 0x00009016, 0x00006c17,
+			0x00002817, 0x0000d416, 0x00000011, 0x0000fc10, 0x0000b810, 0x00004411,
+			0x00003010, 0x0000cc11, 0x00008811, 0x00007410, 0x00006013, 0x00009c12,
+			0x0000d812, 0x00002413, 0x00005012, 0x0000ac13, 0x0000e813, 0x00001412,
+			0x0000001e, 0x0000fc1f, 0x0000b81f, 0x0000441e, 0x0000301f, 0x0000cc1e,
+			0x0000881e, 0x0000741f, 0x0000601c, 0x00009c1d, 0x0000d81d, 0x0000241c,
+			0x0000501d, 0x0000ac1c, 0x0000e81c, 0x0000141d, 0x0000c01a, 0x00003c1b,
+			0x0000781b, 0x0000841a, 0x0000f01b, 0x00000c1a, 0x0000481a, 0x0000b41b,
+			0x0000a018, 0x00005c19, 0x00001819, 0x0000e418, 0x00009019, 0x00006c18,
+			0x00002818, 0x0000d419, 0x0000c029, 0x00003c28, 0x00007828, 0x00008429,
+			0x0000f028, 0x00000c29, 0x00004829, 0x0000b428, 0x0000a02b, 0x00005c2a,
+			0x0000182a, 0x0000e42b, 0x0000902a, 0x00006c2b, 0x0000282b, 0x0000d42a,
+			0x0000002d, 0x0000fc2c, 0x0000b82c, 0x0000442d, 0x0000302c, 0x0000cc2d,
+			0x0000882d, 0x0000742c, 0x0000602f, 0x00009c2e, 0x0000d82e, 0x0000242f,
+			0x0000502e, 0x0000ac2f, 0x0000e82f, 0x0000142e, 0x00000022, 0x0000fc23,
+			0x0000b823, 0x00004422, 0x00003023, 0x0000cc22, 0x00008822, 0x00007423,
+			0x00006020, 0x00009c21, 0x0000d821, 0x00002420, 0x00005021, 0x0000ac20,
+			0x0000e820, 0x00001421, 0x0000c026, 0x00003c27, 0x00007827, 0x00008426,
+			0x0000f027, 0x00000c26, 0x00004826, 0x0000b427, 0x0000a024, 0x00005c25,
+			0x00001825, 0x0000e424, 0x00009025, 0x00006c24, 0x00002824, 0x0000d425,
+			0x0000003c, 0x0000fc3d, 0x0000b83d, 0x0000443c, 0x0000303d, 0x0000cc3c,
+			0x0000883c, 0x0000743d, 0x0000603e, 0x00009c3f, 0x0000d83f, 0x0000243e,
+			0x0000503f, 0x0000ac3e, 0x0000e83e, 0x0000143f, 0x0000c038, 0x00003c39,
+			0x00007839, 0x00008438, 0x0000f039, 0x00000c38, 0x00004838, 0x0000b439,
+			0x0000a03a, 0x00005c3b, 0x0000183b, 0x0000e43a, 0x0000903b, 0x00006c3a,
+			0x0000283a, 0x0000d43b, 0x0000c037, 0x00003c36, 0x00007836, 0x00008437,
+			0x0000f036, 0x00000c37, 0x00004837, 0x0000b436, 0x0000a035, 0x00005c34,
+			0x00001834, 0x0000e435, 0x00009034, 0x00006c35, 0x00002835, 0x0000d434,
+			0x00000033, 0x0000fc32, 0x0000b832, 0x00004433, 0x00003032, 0x0000cc33,
+			0x00008833, 0x00007432, 0x00006031, 0x00009c30, 0x0000d830, 0x00002431,
+			0x00005030, 0x0000ac31, 0x0000e831, 0x00001430,
+		},
+		{
+			0x00000000, 0x0000c03d, 0x0000c079, 0x00000044, 0x0000c0f1, 0x000000cc,
+			0x00000088, 0x0000c0b5, 0x0000c1e1, 0x000001dc, 0x00000198, 0x0000c1a5,
+			0x00000110, 0x0000c12d, 0x0000c169, 0x00000154, 0x0000c3c1, 0x000003fc,
+			0x000003b8, 0x0000c385, 0x00000330, 0x0000c30d, 0x0000c349, 0x00000374,
+			0x00000220, 0x0000c21d, 0x0000c259, 0x00000264, 0x0000c2d1, 0x000002ec,
+			0x000002a8, 0x0000c295, 0x0000c781, 0x000007bc, 0x000007f8, 0x0000c7c5,
+			0x00000770, 0x0000c74d, 0x0000c709, 0x00000734, 0x00000660, 0x0000c65d,
+			0x0000c619, 0x00000624, 0x0000c691, 0x000006ac, 0x000006e8, 0x0000c6d5,
+			0x00000440, 0x0000c47d, 0x0000c439, 0x00000404, 0x0000c4b1, 0x0000048c,
+			0x000004c8, 0x0000c4f5, 0x0000c5a1, 0x0000059c, 0x000005d8, 0x0000c5e5,
+			0x00000550, 0x0000c56d, 0x0000c529, 0x00000514, 0x0000cf01, 0x00000f3c,
+			0x00000f78, 0x0000cf45, 0x00000ff0, 0x0000cfcd, 0x0000cf89, 0x00000fb4,
+			0x00000ee0, 0x0000cedd, 0x0000ce99, 0x00000ea4, 0x0000ce11, 0x00000e2c,
+			0x00000e68, 0x0000ce55, 0x00000cc0, 0x0000ccfd, 0x0000ccb9, 0x00000c84,
+			0x0000cc31, 0x00000c0c, 0x00000c48, 0x0000cc75, 0x0000cd21, 0x00000d1c,
+			0x00000d58, 0x0000cd65, 0x00000dd0, 0x0000cded, 0x0000cda9, 0x00000d94,
+			0x00000880, 0x0000c8bd, 0x0000c8f9, 0x000008c4, 0x0000c871, 0x0000084c,
+			0x00000808, 0x0000c835, 0x0000c961, 0x0000095c, 0x00000918, 0x0000c925,
+			0x00000990, 0x0000c9ad, 0x0000c9e9, 0x000009d4, 0x0000cb41, 0x00000b7c,
+			0x00000b38, 0x0000cb05, 0x00000bb0, 0x0000cb8d, 0x0000cbc9, 0x00000bf4,
+			0x00000aa0, 0x0000ca9d, 0x0000cad9, 0x00000ae4, 0x0000ca51, 0x00000a6c,
+			0x00000a28, 0x0000ca15, 0x0000de01, 0x00001e3c, 0x00001e78, 0x0000de45,
+			0x00001ef0, 0x0000decd, 0x0000de89, 0x00001eb4, 0x00001fe0, 0x0000dfdd,
+			0x0000df99, 0x00001fa4, 0x0000df11, 0x00001f2c, 0x00001f68, 0x0000df55,
+			0x00001dc0, 0x0000ddfd, 0x0000ddb9, 0x00001d84, 0x0000dd31, 0x00001d0c,
+			0x00001d48, 0x0000dd75, 0x0000dc21, 0x00001c1c, 0x00001c58, 0x0000dc65,
+			0x00001cd0, 0x0000dced, 0x0000dca9, 0x00001c94, 0x00001980, 0x0000d9bd,
+			0x0000d9f9, 0x000019c4, 0x0000d971, 0x0000194c, 0x00001908, 0x0000d935,
+			0x0000d861, 0x0000185c, 0x00001818, 0x0000d825, 0x00001890, 0x0000d8ad,
+			0x0000d8e9, 0x000018d4, 0x0000da41, 0x00001a7c, 0x00001a38, 0x0000da05,
+			0x00001ab0, 0x0000da8d, 0x0000dac9, 0x00001af4, 0x00001ba0, 0x0000db9d,
+			0x0000dbd9, 0x00001be4, 0x0000db51, 0x00001b6c, 0x00001b28, 0x0000db15,
+			0x00001100, 0x0000d13d, 0x0000d179, 0x00001144, 0x0000d1f1, 0x000011cc,
+			0x00001188, 0x0000d1b5, 0x0000d0e1, 0x000010dc, 0x00001098, 0x0000d0a5,
+			0x00001010, 0x0000d02d, 0x0000d069, 0x00001054, 0x0000d2c1, 0x000012fc,
+			0x000012b8, 0x0000d285, 0x00001230, 0x0000d20d, 0x0000d249, 0x00001274,
+			0x00001320, 0x0000d31d, 0x0000d359, 0x00001364, 0x0000d3d1, 0x000013ec,
+			0x000013a8, 0x0000d395, 0x0000d681, 0x000016bc, 0x000016f8, 0x0000d6c5,
+			0x00001670, 0x0000d64d, 0x0000d609, 0x00001634, 0x00001760, 0x0000d75d,
+			0x0000d719, 0x00001724, 0x0000d791, 0x000017ac, 0x000017e8, 0x0000d7d5,
+			0x00001540, 0x0000d57d, 0x0000d539, 0x00001504, 0x0000d5b1, 0x0000158c,
+			0x000015c8, 0x0000d5f5, 0x0000d4a1, 0x0000149c, 0x000014d8, 0x0000d4e5,
+			0x00001450, 0x0000d46d, 0x0000d429, 0x00001414,
+		},
+		{
+			0x00000000, 0x0000d101, 0x0000e201, 0x00003300, 0x00008401, 0x00005500,
+			0x00006600, 0x0000b701, 0x00004801, 0x00009900, 0x0000aa00, 0x00007b01,
+			0x0000cc00, 0x00001d01, 0x00002e01, 0x0000ff00, 0x00009002, 0x00004103,
+			0x00007203, 0x0000a302, 0x00001403, 0x0000c502, 0x0000f602, 0x00002703,
+			0x0000d803, 0x00000902, 0x00003a02, 0x0000eb03, 0x00005c02, 0x00008d03,
+			0x0000be03, 0x00006f02, 0x00006007, 0x0000b106, 0x00008206, 0x00005307,
+			0x0000e406, 0x00003507, 0x00000607, 0x0000d706, 0x00002806, 0x0000f907,
+			0x0000ca07, 0x00001b06, 0x0000ac07, 0x00007d06, 0x00004e06, 0x00009f07,
+			0x0000f005, 0x00002104, 0x00001204, 0x0000c305, 0x00007404, 0x0000a505,
+			0x00009605, 0x00004704, 0x0000b804, 0x00006905, 0x00005a05, 0x00008b04,
+			0x00003c05, 0x0000ed04, 0x0000de04, 0x00000f05, 0x0000c00e, 0x0000110f,
+			0x0000220f, 0x0000f30e, 0x0000440f, 0x0000950e, 0x0000a60e, 0x0000770f,
+			0x0000880f, 0x0000590e, 0x00006a0e, 0x0000bb0f, 0x00000c0e, 0x0000dd0f,
+			0x0000ee0f, 0x00003f0e, 0x0000500c, 0x0000810d, 0x0000b20d, 0x0000630c,
+			0x0000d40d, 0x0000050c, 0x0000360c, 0x0000e70d, 0x0000180d, 0x0000c90c,
+			0x0000fa0c, 0x00002b0d, 0x00009c0c, 0x00004d0d, 0x00007e0d, 0x0000af0c,
+			0x0000a009, 0x00007108, 0x00004208, 0x00009309, 0x00002408, 0x0000f509,
+			0x0000c609, 0x00001708, 0x0000e808, 0x00003909, 0x00000a09, 0x0000db08,
+			0x00006c09, 0x0000bd08, 0x00008e08, 0x00005f09, 0x0000300b, 0x0000e10a,
+			0x0000d20a, 0x0000030b, 0x0000b40a, 0x0000650b, 0x0000560b, 0x0000870a,
+			0x0000780a, 0x0000a90b, 0x00009a0b, 0x00004b0a, 0x0000fc0b, 0x00002d0a,
+			0x00001e0a, 0x0000cf0b, 0x0000c01f, 0x0000111e, 0x0000221e, 0x0000f31f,
+			0x0000441e, 0x0000951f, 0x0000a61f, 0x0000771e, 0x0000881e, 0x0000591f,
+			0x00006a1f, 0x0000bb1e, 0x00000c1f, 0x0000dd1e, 0x0000ee1e, 0x00003f1f,
+			0x0000501d, 0x0000811c, 0x0000b21c, 0x0000631d, 0x0000d41c, 0x0000051d,
+			0x0000361d, 0x0000e71c, 0x0000181c, 0x0000c91d, 0x0000fa1d, 0x00002b1c,
+			0x00009c1d, 0x00004d1c, 0x00007e1c, 0x0000af1d, 0x0000a018, 0x00007119,
+			0x00004219, 0x00009318, 0x00002419, 0x0000f518, 0x0000c618, 0x00001719,
+			0x0000e819, 0x00003918, 0x00000a18, 0x0000db19, 0x00006c18, 0x0000bd19,
+			0x00008e19, 0x00005f18, 0x0000301a, 0x0000e11b, 0x0000d21b, 0x0000031a,
+			0x0000b41b, 0x0000651a, 0x0000561a, 0x0000871b, 0x0000781b, 0x0000a91a,
+			0x00009a1a, 0x00004b1b, 0x0000fc1a, 0x00002d1b, 0x00001e1b, 0x0000cf1a,
+			0x00000011, 0x0000d110, 0x0000e210, 0x00003311, 0x00008410, 0x00005511,
+			0x00006611, 0x0000b710, 0x00004810, 0x00009911, 0x0000aa11, 0x00007b10,
+			0x0000cc11, 0x00001d10, 0x00002e10, 0x0000ff11, 0x00009013, 0x00004112,
+			0x00007212, 0x0000a313, 0x00001412, 0x0000c513, 0x0000f613, 0x00002712,
+			0x0000d812, 0x00000913, 0x00003a13, 0x0000eb12, 0x00005c13, 0x00008d12,
+			0x0000be12, 0x00006f13, 0x00006016, 0x0000b117, 0x00008217, 0x00005316,
+			0x0000e417, 0x00003516, 0x00000616, 0x0000d717, 0x00002817, 0x0000f916,
+			0x0000ca16, 0x00001b17, 0x0000ac16, 0x00007d17, 0x00004e17, 0x00009f16,
+			0x0000f014, 0x00002115, 0x00001215, 0x0000c314, 0x00007415, 0x0000a514,
+			0x00009614, 0x00004715, 0x0000b815, 0x00006914, 0x00005a14, 0x00008b15,
+			0x00003c14, 0x0000ed15, 0x0000de15, 0x00000f14,
+		},
+		{
+			0x00000000, 0x0000c010, 0x0000c023, 0x00000033, 0x0000c045, 0x00000055,
+			0x00000066, 0x0000c076, 0x0000c089, 0x00000099, 0x000000aa, 0x0000c0ba,
+			0x000000cc, 0x0000c0dc, 0x0000c0ef, 0x000000ff, 0x0000c111, 0x00000101,
+			0x00000132, 0x0000c122, 0x00000154, 0x0000c144, 0x0000c177, 0x00000167,
+			0x00000198, 0x0000c188, 0x0000c1bb, 0x000001ab, 0x0000c1dd, 0x000001cd,
+			0x000001fe, 0x0000c1ee, 0x0000c221, 0x00000231, 0x00000202, 0x0000c212,
+			0x00000264, 0x0000c274, 0x0000c247, 0x00000257, 0x000002a8, 0x0000c2b8,
+			0x0000c28b, 0x0000029b, 0x0000c2ed, 0x000002fd, 0x000002ce, 0x0000c2de,
+			0x00000330, 0x0000c320, 0x0000c313, 0x00000303, 0x0000c375, 0x00000365,
+			0x00000356, 0x0000c346, 0x0000c3b9, 0x000003a9, 0x0000039a, 0x0000c38a,
+			0x000003fc, 0x0000c3ec, 0x0000c3df, 0x000003cf, 0x0000c441, 0x00000451,
+			0x00000462, 0x0000c472, 0x00000404, 0x0000c414, 0x0000c427, 0x00000437,
+			0x000004c8, 0x0000c4d8, 0x0000c4eb, 0x000004fb, 0x0000c48d, 0x0000049d,
+			0x000004ae, 0x0000c4be, 0x00000550, 0x0000c540, 0x0000c573, 0x00000563,
+			0x0000c515, 0x00000505, 0x00000536, 0x0000c526, 0x0000c5d9, 0x000005c9,
+			0x000005fa, 0x0000c5ea, 0x0000059c, 0x0000c58c, 0x0000c5bf, 0x000005af,
+			0x00000660, 0x0000c670, 0x0000c643, 0x00000653, 0x0000c625, 0x00000635,
+			0x00000606, 0x0000c616, 0x0000c6e9, 0x000006f9, 0x000006ca, 0x0000c6da,
+			0x000006ac, 0x0000c6bc, 0x0000c68f, 0x0000069f, 0x0000c771, 0x00000761,
+			0x00000752, 0x0000c742, 0x00000734, 0x0000c724, 0x0000c717, 0x00000707,
+			0x000007f8, 0x0000c7e8, 0x0000c7db, 0x000007cb, 0x0000c7bd, 0x000007ad,
+			0x0000079e, 0x0000c78e, 0x0000c881, 0x00000891, 0x000008a2, 0x0000c8b2,
+			0x000008c4, 0x0000c8d4, 0x0000c8e7, 0x000008f7, 0x00000808, 0x0000c818,
+			0x0000c82b, 0x0000083b, 0x0000c84d, 0x0000085d, 0x0000086e, 0x0000c87e,
+			0x00000990, 0x0000c980, 0x0000c9b3, 0x000009a3, 0x0000c9d5, 0x000009c5,
+			0x000009f6, 0x0000c9e6, 0x0000c919, 0x00000909, 0x0000093a, 0x0000c92a,
+			0x0000095c, 0x0000c94c, 0x0000c97f, 0x0000096f, 0x00000aa0, 0x0000cab0,
+			0x0000ca83, 0x00000a93, 0x0000cae5, 0x00000af5, 0x00000ac6, 0x0000cad6,
+			0x0000ca29, 0x00000a39, 0x00000a0a, 0x0000ca1a, 0x00000a6c, 0x0000ca7c,
+			0x0000ca4f, 0x00000a5f, 0x0000cbb1, 0x00000ba1, 0x00000b92, 0x0000cb82,
+			0x00000bf4, 0x0000cbe4, 0x0000cbd7, 0x00000bc7, 0x00000b38, 0x0000cb28,
+			0x0000cb1b, 0x00000b0b, 0x0000cb7d, 0x00000b6d, 0x00000b5e, 0x0000cb4e,
+			0x00000cc0, 0x0000ccd0, 0x0000cce3, 0x00000cf3, 0x0000cc85, 0x00000c95,
+			0x00000ca6, 0x0000ccb6, 0x0000cc49, 0x00000c59, 0x00000c6a, 0x0000cc7a,
+			0x00000c0c, 0x0000cc1c, 0x0000cc2f, 0x00000c3f, 0x0000cdd1, 0x00000dc1,
+			0x00000df2, 0x0000cde2, 0x00000d94, 0x0000cd84, 0x0000cdb7, 0x00000da7,
+			0x00000d58, 0x0000cd48, 0x0000cd7b, 0x00000d6b, 0x0000cd1d, 0x00000d0d,
+			0x00000d3e, 0x0000cd2e, 0x0000cee1, 0x00000ef1, 0x00000ec2, 0x0000ced2,
+			0x00000ea4, 0x0000ceb4, 0x0000ce87, 0x00000e97, 0x00000e68, 0x0000ce78,
+			0x0000ce4b, 0x00000e5b, 0x0000ce2d, 0x00000e3d, 0x00000e0e, 0x0000ce1e,
+			0x00000ff0, 0x0000cfe0, 0x0000cfd3, 0x00000fc3, 0x0000cfb5, 0x00000fa5,
+			0x00000f96, 0x0000cf86, 0x0000cf79, 0x00000f69, 0x00000f5a, 0x0000cf4a,
+			0x00000f3c, 0x0000cf2c, 0x0000cf1f, 0x00000f0f,
+		},
+		{
+			0x00000000, 0x0000ccc1, 0x0000d981, 0x00001540, 0x0000f301, 0x00003fc0,
+			0x00002a80, 0x0000e641, 0x0000a601, 0x00006ac0, 0x00007f80, 0x0000b341,
+			0x00005500, 0x000099c1, 0x00008c81, 0x00004040, 0x00000c01, 0x0000c0c0,
+			0x0000d580, 0x00001941, 0x0000ff00, 0x000033c1, 0x00002681, 0x0000ea40,
+			0x0000aa00, 0x000066c1, 0x00007381, 0x0000bf40, 0x00005901, 0x000095c0,
+			0x00008080, 0x00004c41, 0x00001802, 0x0000d4c3, 0x0000c183, 0x00000d42,
+			0x0000eb03, 0x000027c2, 0x00003282, 0x0000fe43, 0x0000be03, 0x000072c2,
+			0x00006782, 0x0000ab43, 0x00004d02, 0x000081c3, 0x00009483, 0x00005842,
+			0x00001403, 0x0000d8c2, 0x0000cd82, 0x00000143, 0x0000e702, 0x00002bc3,
+			0x00003e83, 0x0000f242, 0x0000b202, 0x00007ec3, 0x00006b83, 0x0000a742,
+			0x00004103, 0x00008dc2, 0x00009882, 0x00005443, 0x00003004, 0x0000fcc5,
+			0x0000e985, 0x00002544, 0x0000c305, 0x00000fc4, 0x00001a84, 0x0000d645,
+			0x00009605, 0x00005ac4, 0x00004f84, 0x00008345, 0x00006504, 0x0000a9c5,
+			0x0000bc85, 0x00007044, 0x00003c05, 0x0000f0c4, 0x0000e584, 0x00002945,
+			0x0000cf04, 0x000003c5, 0x00001685, 0x0000da44, 0x00009a04, 0x000056c5,
+			0x00004385, 0x00008f44, 0x00006905, 0x0000a5c4, 0x0000b084, 0x00007c45,
+			0x00002806, 0x0000e4c7, 0x0000f187, 0x00003d46, 0x0000db07, 0x000017c6,
+			0x00000286, 0x0000ce47, 0x00008e07, 0x000042c6, 0x00005786, 0x00009b47,
+			0x00007d06, 0x0000b1c7, 0x0000a487, 0x00006846, 0x00002407, 0x0000e8c6,
+			0x0000fd86, 0x00003147, 0x0000d706, 0x00001bc7, 0x00000e87, 0x0000c246,
+			0x00008206, 0x00004ec7, 0x00005b87, 0x00009746, 0x00007107, 0x0000bdc6,
+			0x0000a886, 0x00006447, 0x00006008, 0x0000acc9, 0x0000b989, 0x00007548,
+			0x00009309, 0x00005fc8, 0x00004a88, 0x00008649, 0x0000c609, 0x00000ac8,
+			0x00001f88, 0x0000d349, 0x00003508, 0x0000f9c9, 0x0000ec89, 0x00002048,
+			0x00006c09, 0x0000a0c8, 0x0000b588, 0x00007949, 0x00009f08, 0x000053c9,
+			0x00004689, 0x00008a48, 0x0000ca08, 0x000006c9, 0x00001389, 0x0000df48,
+			0x00003909, 0x0000f5c8, 0x0000e088, 0x00002c49, 0x0000780a, 0x0000b4cb,
+			0x0000a18b, 0x00006d4a, 0x00008b0b, 0x000047ca, 0x0000528a, 0x00009e4b,
+			0x0000de0b, 0x000012ca, 0x0000078a, 0x0000cb4b, 0x00002d0a, 0x0000e1cb,
+			0x0000f48b, 0x0000384a, 0x0000740b, 0x0000b8ca, 0x0000ad8a, 0x0000614b,
+			0x0000870a, 0x00004bcb, 0x00005e8b, 0x0000924a, 0x0000d20a, 0x00001ecb,
+			0x00000b8b, 0x0000c74a, 0x0000210b, 0x0000edca, 0x0000f88a, 0x0000344b,
+			0x0000500c, 0x00009ccd, 0x0000898d, 0x0000454c, 0x0000a30d, 0x00006fcc,
+			0x00007a8c, 0x0000b64d, 0x0000f60d, 0x00003acc, 0x00002f8c, 0x0000e34d,
+			0x0000050c, 0x0000c9cd, 0x0000dc8d, 0x0000104c, 0x00005c0d, 0x000090cc,
+			0x0000858c, 0x0000494d, 0x0000af0c, 0x000063cd, 0x0000768d, 0x0000ba4c,
+			0x0000fa0c, 0x000036cd, 0x0000238d, 0x0000ef4c, 0x0000090d, 0x0000c5cc,
+			0x0000d08c, 0x00001c4d, 0x0000480e, 0x000084cf, 0x0000918f, 0x00005d4e,
+			0x0000bb0f, 0x000077ce, 0x0000628e, 0x0000ae4f, 0x0000ee0f, 0x000022ce,
+			0x0000378e, 0x0000fb4f, 0x00001d0e, 0x0000d1cf, 0x0000c48f, 0x0000084e,
+			0x0000440f, 0x000088ce, 0x00009d8e, 0x0000514f, 0x0000b70e, 0x00007bcf,
+			0x00006e8f, 0x0000a24e, 0x0000e20e, 0x00002ecf, 0x00003b8f, 0x0000f74e,
+			0x0000110f, 0x0000ddce, 0x0000c88e, 0x0000044f,
+		},
+	},
+	{ /* CRC_PRESET_16_HDLC */
+		{
+			0x00000000, 0x00001189, 0x00002312, 0x0000329b, 0x00004624, 0x000057ad,
+			0x00006536, 0x000074bf, 0x00008c48, 0x00009dc1, 0x0000af5a, 0x0000bed3,
+			0x0000ca6c, 0x0000dbe5, 0x0000e97e, 0x0000f8f7, 0x00001081, 0x00000108,
+			0x00003393, 0x0000221a, 0x000056a5, 0x0000472c, 0x000075b7, 0x0000643e,
+			0x00009cc9, 0x00008d40, 0x0000bfdb, 0x0000ae52, 0x0000daed, 0x0000cb64,
+			0x0000f9ff, 0x0000e876, 0x00002102, 0x0000308b, 0x00000210, 0x00001399,
+			0x00006726, 0x000076af, 0x00004434, 0x000055bd, 0x0000ad4a, 0x0000bcc3,
+			0x00008e58, 0x00009fd1, 0x0000eb6e, 0x0000fae7, 0x0000c87c, 0x0000d9f5,
+			0x00003183, 0x0000200a, 0x00001291, 0x00000318, 0x000077a7, 0x0000662e,
+			0x000054b5, 0x0000453c, 0x0000bdcb, 0x0000ac42, 0x00009ed9, 0x00008f50,
+			0x0000fbef, 0x0000ea66, 0x0000d8fd, 0x0000c974, 0x00004204, 0x0000538d,
+			0x00006116, 0x0000709f, 0x00000420, 0x000015a9, 0x00002732, 0x000036bb,
+			0x0000ce4c, 0x0000dfc5, 0x0000ed5e, 0x0000fcd7, 0x00008868, 0x000099e1,
+			0x0000ab7a, 0x0000baf3, 0x00005285, 0x0000430c, 0x00007197, 0x0000601e,
+			0x000014a1, 0x00000528, 0x000037b3, 0x0000263a, 0x0000decd, 0x0000cf44,
+			0x0000fddf, 0x0000ec56, 0x000098e9, 0x00008960, 0x0000bbfb, 0x0000aa72,
+			0x00006306, 0x0000728f, 0x00004014, 0x0000519d, 0x00002522, 0x000034ab,
+			0x00000630, 0x000017b9, 0x0000ef4e, 0x0000fec7, 0x0000cc5c, 0x0000ddd5,
+			0x0000a96a, 0x0000b8e3, 0x00008a78, 0x00009bf1, 0x00007387, 0x0000620e,
+			0x00005095, 0x0000411c, 0x000035a3, 0x0000242a, 0x000016b1, 0x00000738,
+			0x0000ffcf, 0x0000ee46, 0x0000dcdd, 0x0000cd54, 0x0000b9eb, 0x0000a862,
+			0x00009af9, 0x00008b70, 0x00008408, 0x00009581, 0x0000a71a, 0x0000b693,
+			0x0000c22c, 0x0000d3a5, 0x0000e13e, 0x0000f0b7, 0x00000840, 0x000019c9,
+			0x00002b52, 0x00003adb, 0x00004e64, 0x00005fed, 0x00006d76, 0x00007cff,
+			0x00009489, 0x00008500, 0x0000b79b, 0x0000a612, 0x0000d2ad, 0x0000c324,
+			0x0000f1bf, 0x0000e036, 0x000018c1, 0x00000948, 0x00003bd3, 0x00002a5a,
+			0x00005ee5, 0x00004f6c, 0x00007df7, 0x00006c7e, 0x0000a50a, 0x0000b483,
+			0x00008618, 0x00009791, 0x0000e32e, 0x0000f2a7, 0x0000c03c, 0x0000d1b5,
+			0x00002942, 0x000038cb, 0x00000a50, 0x00001bd9, 0x00006f66, 0x00007eef,
+			0x00004c74, 0x00005dfd, 0x0000b58b, 0x0000a402, 0x00009699, 0x00008710,
+			0x0000f3af, 0x0000e226, 0x0000d0bd, 0x0000c134, 0x000039c3, 0x0000284a,
+			0x00001ad1, 0x00000b58, 0x00007fe7, 0x00006e6e, 0x00005cf5, 0x00004d7c,
+			0x0000c60c, 0x0000d785, 0x0000e51e, 0x0000f497, 0x00008028, 0x000091a1,
+			0x0000a33a, 0x0000b2b3, 0x00004a44, 0x00005bcd, 0x00006956, 0x000078df,
+			0x00000c60, 0x00001de9, 0x00002f72, 0x00003efb, 0x0000d68d, 0x0000c704,
+			0x0000f59f, 0x0000e416, 0x000090a9, 0x00008120, 0x0000b3bb, 0x0000a232,
+			0x00005ac5, 0x00004b4c, 0x000079d7, 0x0000685e, 0x00001ce1, 0x00000d68,
+			0x00003ff3, 0x00002e7a, 0x0000e70e, 0x0000f687, 0x0000c41c, 0x0000d595,
+			0x0000a12a, 0x0000b0a3, 0x00008238, 0x000093b1, 0x00006b46, 0x00007acf,
+			0x00004854, 0x000059dd, 0x00002d62, 0x00003ceb, 0x00000e70, 0x00001ff9,
+			0x0000f78f, 0x0000e606, 0x0000d49d, 0x0000c514, 0x0000b1ab, 0x0000a022,
+			0x000092b9, 0x00008330, 0x00007bc7, 0x00006a4e, 0x000058d5, 0x0000495c,
+			0x00003de3, 0x00002c6a, 0x00001ef1, 0x00000f78,
+		},
+		{
+			0x00000000, 0x000019d8, 0x000033b0, 0x00002a68, 0x00006760, 0x00007eb8,
+			0x000054d0, 0x00004d08, 0x0000cec0, 0x0000d718, 0x0000fd70, 0x0000e4a8,
+			0x0000a9a0, 0x0000b078, 0x00009a10, 0x000083c8, 0x00009591, 0x00008c49,
+			0x0000a621, 0x0000bff9, 0x0000f2f1, 0x0000eb29, 0x0000c141, 0x0000d899,
+			0x00005b51, 0x00004289, 0x000068e1, 0x00007139, 0x00003c31, 0x000025e9,
+			0x00000f81, 0x00001659, 0x00002333, 0x00003aeb, 0x00001083, 0x0000095b,
+			0x00004453, 0x00005d8b, 0x000077e3, 0x00006e3b, 0x0000edf3, 0x0000f42b,
+			0x0000de43, 0x0000c79b, 0x00008a93, 0x0000934b, 0x0000b923, 0x0000a0fb,
+			0x0000b6a2, 0x0000af7a, 0x00008512, 0x00009cca, 0x0000d1c2, 0x0000c81a,
+			0x0000e272, 0x0000fbaa, 0x00007862, 0x000061ba, 0x00004bd2, 0x0000520a,
+			0x00001f02, 0x000006da, 0x00002cb2, 0x0000356a, 0x00004666, 0x00005fbe,
+			0x000075d6, 0x00006c0e, 0x00002106, 0x000038de, 0x000012b6, 0x00000b6e,
+			0x000088a6, 0x0000917e, 0x0000bb16, 0x0000a2ce, 0x0000efc6, 0x0000f61e,
+			0x0000dc76, 0x0000c5ae, 0x0000d3f7, 0x0000ca2f, 0x0000e047, 0x0000f99f,
+			0x0000b497, 0x0000ad4f, 0x00008727, 0x00009eff, 0x00001d37, 0x000004ef,
+			0x00002e87, 0x0000375f, 0x00007a57, 0x0000638f, 0x000049e7, 0x0000503f,
+			0x00006555, 0x00007c8d, 0x000056e5, 0x00004f3d, 0x00000235, 0x00001bed,
+			0x00003185, 0x0000285d, 0x0000ab95, 0x0000b24d, 0x00009825, 0x000081fd,
+			0x0000ccf5, 0x0000d52d, 0x0000ff45, 0x0000e69d, 0x0000f0c4, 0x0000e91c,
+			0x0000c374, 0x0000daac, 0x000097a4, 0x00008e7c, 0x0000a414, 0x0000bdcc,
+			0x00003e04, 0x000027dc, 0x00000db4, 0x0000146c, 0x00005964, 0x000040bc,
+			0x00006ad4, 0x0000730c, 0x00008ccc, 0x00009514, 0x0000bf7c, 0x0000a6a4,
+			0x0000ebac, 0x0000f274, 0x0000d81c, 0x0000c1c4, 0x0000420c, 0x00005bd4,
+			0x000071bc, 0x00006864, 0x0000256c, 0x00003cb4, 0x000016dc, 0x00000f04,
+			0x0000195d, 0x00000085, 0x00002aed, 0x00003335, 0x00007e3d, 0x000067e5,
+			0x00004d8d, 0x00005455, 0x0000d79d, 0x0000ce45, 0x0000e42d, 0x0000fdf5,
+			0x0000b0fd, 0x0000a925, 0x0000834d, 0x00009a95, 0x0000afff, 0x0000b627,
+			0x00009c4f, 0x00008597, 0x0000c89f, 0x0000d147, 0x0000fb2f, 0x0000e2f7,
+			0x0000613f, 0x000078e7, 0x0000528f, 0x00004b57, 0x0000065f, 0x00001f87,
+			0x000035ef, 0x00002c37, 0x00003a6e, 0x000023b6, 0x000009de, 0x00001006,
+			0x00005d0e, 0x000044d6, 0x00006ebe, 0x00007766, 0x0000f4ae, 0x0000ed76,
+			0x0000c71e, 0x0000dec6, 0x000093ce, 0x00008a16, 0x0000a07e, 0x0000b9a6,
+			0x0000caaa, 0x0000d372, 0x0000f91a, 0x0000e0c2, 0x0000adca, 0x0000b412,
+			0x00009e7a, 0x000087a2, 0x0000046a, 0x00001db2, 0x000037da, 0x00002e02,
+			0x0000630a, 0x00007ad2, 0x000050ba, 0x00004962, 0x00005f3b, 0x000046e3,
+			0x00006c8b, 0x00007553, 0x0000385b, 0x00002183, 0x00000beb, 0x00001233,
+			0x000091fb, 0x00008823, 0x0000a24b, 0x0000bb93, 0x0000f69b, 0x0000ef43,
+			0x0000c52b, 0x0000dcf3, 0x0000e999, 0x0000f041, 0x0000da29, 0x0000c3f1,
+			0x00008ef9, 0x00009721, 0x0000bd49, 0x0000a491, 0x00002759, 0x00003e81,
+			0x000014e9, 0x00000d31, 0x00004039, 0x000059e1, 0x00007389, 0x00006a51,
+			0x00007c08, 0x000065d0, 0x00004fb8, 0x00005660, 0x00001b68, 0x000002b0,
+			0x000028d8, 0x00003100, 0x0000b2c8, 0x0000ab10, 0x00008178, 0x000098a0,
+			0x0000d5a8, 0x0000cc70, 0x0000e618, 0x0000ffc0,
+		},
+		{
+			0x00000000, 0x00005adc, 0x0000b5b8, 0x0000ef64, 0x00006361, 0x000039bd,
+			0x0000d6d9, 0x00008c05, 0x0000c6c2, 0x00009c1e, 0x0000737a, 0x000029a6,
+			0x0000a5a3, 0x0000ff7f, 0x0000101b, 0x00004ac7, 0x00008595, 0x0000df49,
+			0x0000302d, 0x00006af1, 0x0000e6f4, 0x0000bc28, 0x0000534c, 0x00000990,
+			0x00004357, 0x0000198b, 0x0000f6ef, 0x0000ac33, 0x00002036, 0x00007aea,
+			0x0000958e, 0x0000cf52, 0x0000033b, 0x000059e7, 0x0000b683, 0x0000ec5f,
+			0x0000605a, 0x00003a86, 0x0000d5e2, 0x00008f3e, 0x0000c5f9, 0x00009f25,
+			0x00007041, 0x00002a9d, 0x0000a698, 0x0000fc44, 0x00001320, 0x000049fc,
+			0x000086ae, 0x0000dc72, 0x00003316, 0x000069ca, 0x0000e5cf, 0x0000bf13,
+			0x00005077, 0x00000aab, 0x0000406c, 0x00001ab0, 0x0000f5d4, 0x0000af08,
+			0x0000230d, 0x000079d1, 0x000096b5, 0x0000cc69, 0x00000676, 0x00005caa,
+			0x0000b3ce, 0x0000e912, 0x00006517, 0x00003fcb, 0x0000d0af, 0x00008a73,
+			0x0000c0b4, 0x00009a68, 0x0000750c, 0x00002fd0, 0x0000a3d5, 0x0000f909,
+			0x0000166d, 0x00004cb1, 0x000083e3, 0x0000d93f, 0x0000365b, 0x00006c87,
+			0x0000e082, 0x0000ba5e, 0x0000553a, 0x00000fe6, 0x00004521, 0x00001ffd,
+			0x0000f099, 0x0000aa45, 0x00002640, 0x00007c9c, 0x000093f8, 0x0000c924,
+			0x0000054d, 0x00005f91, 0x0000b0f5, 0x0000ea29, 0x0000662c, 0x00003cf0,
+			0x0000d394, 0x00008948, 0x0000c38f, 0x00009953, 0x00007637, 0x00002ceb,
+			0x0000a0ee, 0x0000fa32, 0x00001556, 0x00004f8a, 0x000080d8, 0x0000da04,
+			0x00003560, 0x00006fbc, 0x0000e3b9, 0x0000b965, 0x00005601, 0x00000cdd,
+			0x0000461a, 0x00001cc6, 0x0000f3a2, 0x0000a97e, 0x0000257b, 0x00007fa7,
+			0x000090c3, 0x0000ca1f, 0x00000cec, 0x00005630, 0x0000b954, 0x0000e388,
+			0x00006f8d, 0x00003551, 0x0000da35, 0x000080e9, 0x0000ca2e, 0x000090f2,
+			0x00007f96, 0x0000254a, 0x0000a94f, 0x0000f393, 0x00001cf7, 0x0000462b,
+			0x00008979, 0x0000d3a5, 0x00003cc1, 0x0000661d, 0x0000ea18, 0x0000b0c4,
+			0x00005fa0, 0x0000057c, 0x00004fbb, 0x00001567, 0x0000fa03, 0x0000a0df,
+			0x00002cda, 0x00007606, 0x00009962, 0x0000c3be, 0x00000fd7, 0x0000550b,
+			0x0000ba6f, 0x0000e0b3, 0x00006cb6, 0x0000366a, 0x0000d90e, 0x000083d2,
+			0x0000c915, 0x000093c9, 0x00007cad, 0x00002671, 0x0000aa74, 0x0000f0a8,
+			0x00001fcc, 0x00004510, 0x00008a42, 0x0000d09e, 0x00003ffa, 0x00006526,
+			0x0000e923, 0x0000b3ff, 0x00005c9b, 0x00000647, 0x00004c80, 0x0000165c,
+			0x0000f938, 0x0000a3e4, 0x00002fe1, 0x0000753d, 0x00009a59, 0x0000c085,
+			0x00000a9a, 0x00005046, 0x0000bf22, 0x0000e5fe, 0x000069fb, 0x00003327,
+			0x0000dc43, 0x0000869f, 0x0000cc58, 0x00009684, 0x000079e0, 0x0000233c,
+			0x0000af39, 0x0000f5e5, 0x00001a81, 0x0000405d, 0x00008f0f, 0x0000d5d3,
+			0x00003ab7, 0x0000606b, 0x0000ec6e, 0x0000b6b2, 0x000059d6, 0x0000030a,
+			0x000049cd, 0x00001311, 0x0000fc75, 0x0000a6a9, 0x00002aac, 0x00007070,
+			0x00009f14, 0x0000c5c8, 0x000009a1, 0x0000537d, 0x0000bc19, 0x0000e6c5,
+			0x00006ac0, 0x0000301c, 0x0000df78, 0x000085a4, 0x0000cf63, 0x000095bf,
+			0x00007adb, 0x00002007, 0x0000ac02, 0x0000f6de, 0x000019ba, 0x00004366,
+			0x00008c34, 0x0000d6e8, 0x0000398c, 0x00006350, 0x0000ef55, 0x0000b589,
+			0x00005aed, 0x00000031, 0x00004af6, 0x0000102a, 0x0000ff4e, 0x0000a592,
+			0x00002997, 0x0000734b, 0x00009c2f, 0x0000c6f3,
+		},
+		{
+			0x00000000, 0x00001cbb, 0x00003976, 0x000025cd, 0x000072ec, 0x00006e57,
+			0x00004b9a, 0x00005721, 0x0000e5d8, 0x0000f963, 0x0000dcae, 0x0000c015,
+			0x00009734, 0x00008b8f, 0x0000ae42, 0x0000b2f9, 0x0000c3a1, 0x0000df1a,
+			0x0000fad7, 0x0000e66c, 0x0000b14d, 0x0000adf6, 0x0000883b, 0x00009480,
+			0x00002679, 0x00003ac2, 0x00001f0f, 0x000003b4, 0x00005495, 0x0000482e,
+			0x00006de3, 0x00007158, 0x00008f53, 0x000093e8, 0x0000b625, 0x0000aa9e,
+			0x0000fdbf, 0x0000e104, 0x0000c4c9, 0x0000d872, 0x00006a8b, 0x00007630,
+			0x000053fd, 0x00004f46, 0x00001867, 0x000004dc, 0x00002111, 0x00003daa,
+			0x00004cf2, 0x00005049, 0x00007584, 0x0000693f, 0x00003e1e, 0x000022a5,
+			0x00000768, 0x00001bd3, 0x0000a92a, 0x0000b591, 0x0000905c, 0x00008ce7,
+			0x0000dbc6, 0x0000c77d, 0x0000e2b0, 0x0000fe0b, 0x000016b7, 0x00000a0c,
+			0x00002fc1, 0x0000337a, 0x0000645b, 0x000078e0, 0x00005d2d, 0x00004196,
+			0x0000f36f, 0x0000efd4, 0x0000ca19, 0x0000d6a2, 0x00008183, 0x00009d38,
+			0x0000b8f5, 0x0000a44e, 0x0000d516, 0x0000c9ad, 0x0000ec60, 0x0000f0db,
+			0x0000a7fa, 0x0000bb41, 0x00009e8c, 0x00008237, 0x000030ce, 0x00002c75,
+			0x000009b8, 0x00001503, 0x00004222, 0x00005e99, 0x00007b54, 0x000067ef,
+			0x000099e4, 0x0000855f, 0x0000a092, 0x0000bc29, 0x0000eb08, 0x0000f7b3,
+			0x0000d27e, 0x0000cec5, 0x00007c3c, 0x00006087, 0x0000454a, 0x000059f1,
+			0x00000ed0, 0x0000126b, 0x000037a6, 0x00002b1d, 0x00005a45, 0x000046fe,
+			0x00006333, 0x00007f88, 0x000028a9, 0x00003412, 0x000011df, 0x00000d64,
+			0x0000bf9d, 0x0000a326, 0x000086eb, 0x00009a50, 0x0000cd71, 0x0000d1ca,
+			0x0000f407, 0x0000e8bc, 0x00002d6e, 0x000031d5, 0x00001418, 0x000008a3,
+			0x00005f82, 0x00004339, 0x000066f4, 0x00007a4f, 0x0000c8b6, 0x0000d40d,
+			0x0000f1c0, 0x0000ed7b, 0x0000ba5a, 0x0000a6e1, 0x0000832c, 0x00009f97,
+			0x0000eecf, 0x0000f274, 0x0000d7b9, 0x0000cb02, 0x00009c23, 0x00008098,
+			0x0000a555, 0x0000b9ee, 0x00000b17, 0x000017ac, 0x00003261, 0x00002eda,
+			0x000079fb, 0x00006540, 0x0000408d, 0x00005c36, 0x0000a23d, 0x0000be86,
+			0x00009b4b, 0x000087f0, 0x0000d0d1, 0x0000cc6a, 0x0000e9a7, 0x0000f51c,
+			0x000047e5, 0x00005b5e, 0x00007e93, 0x00006228, 0x00003509, 0x000029b2,
+			0x00000c7f, 0x000010c4, 0x0000619c, 0x00007d27, 0x000058ea, 0x00004451,
+			0x00001370, 0x00000fcb, 0x00002a06, 0x000036bd, 0x00008444, 0x000098ff,
+			0x0000bd32, 0x0000a189, 0x0000f6a8, 0x0000ea13, 0x0000cfde, 0x0000d365,
+			0x00003bd9, 0x00002762, 0x000002af, 0x00001e14, 0x00004935, 0x0000558e,
+			0x00007043, 0x00006cf8, 0x0000de01, 0x0000c2ba, 0x0000e777, 0x0000fbcc,
+			0x0000aced, 0x0000b056, 0x0000959b, 0x00008920, 0x0000f878, 0x0000e4c3,
+			0x0000c10e, 0x0000ddb5, 0x00008a94, 0x0000962f, 0x0000b3e2, 0x0000af59,
+			0x00001da0, 0x0000011b, 0x000024d6, 0x0000386d, 0x00006f4c, 0x000073f7,
+			0x0000563a, 0x00004a81, 0x0000b48a, 0x0000a831, 0x00008dfc, 0x00009147,
+			0x0000c666, 0x0000dadd, 0x0000ff10, 0x0000e3ab, 0x00005152, 0x00004de9,
+			0x00006824, 0x0000749f, 0x000023be, 0x00003f05, 0x00001ac8, 0x00000673,
+			0x0000772b, 0x00006b90, 0x00004e5d, 0x000052e6, 0x000005c7, 0x0000197c,
+			0x00003cb1, 0x0000200a, 0x000092f3, 0x00008e48, 0x0000ab85, 0x0000b73e,
+			0x0000e01f, 0x0000fca4, 0x0000d969, 0x0000c5d2,
+		},
+		{
+			0x00000000, 0x00000b44, 0x00001688, 0x00001dcc, 0x00002d10, 0x00002654,
+			0x00003b98, 0x000030dc, 0x00005a20, 0x00005164, 0x00004ca8, 0x000047ec,
+			0x00007730, 0x00007c74, 0x000061b8, 0x00006afc, 0x0000b440, 0x0000bf04,
+			0x0000a2c8, 0x0000a98c, 0x00009950, 0x00009214, 0x00008fd8, 0x0000849c,
+			0x0000ee60, 0x0000e524, 0x0000f8e8, 0x0000f3ac, 0x0000c370, 0x0000c834,
+			0x0000d5f8, 0x0000debc, 0x00006091, 0x00006bd5, 0x00007619, 0x00007d5d,
+			0x00004d81, 0x000046c5, 0x00005b09, 0x0000504d, 0x00003ab1, 0x000031f5,
+			0x00002c39, 0x0000277d, 0x000017a1, 0x00001ce5, 0x00000129, 0x00000a6d,
+			0x0000d4d1, 0x0000df95, 0x0000c259, 0x0000c91d, 0x0000f9c1, 0x0000f285,
+			0x0000ef49, 0x0000e40d, 0x00008ef1, 0x000085b5, 0x00009879, 0x0000933d,
+			0x0000a3e1, 0x0000a8a5, 0x0000b569, 0x0000be2d, 0x0000c122, 0x0000ca66,
+			0x0000d7aa, 0x0000dcee, 0x0000ec32, 0x0000e776, 0x0000faba, 0x0000f1fe,
+			0x00009b02, 0x00009046, 0x00008d8a, 0x000086ce, 0x0000b612, 0x0000bd56,
+			0x0000a09a, 0x0000abde, 0x00007562, 0x00007e26, 0x000063ea, 0x000068ae,
+			0x00005872, 0x00005336, 0x00004efa, 0x000045be, 0x00002f42, 0x00002406,
+			0x000039ca, 0x0000328e, 0x00000252, 0x00000916, 0x000014da, 0x00001f9e,
+			0x0000a1b3, 0x0000aaf7, 0x0000b73b, 0x0000bc7f, 0x00008ca3, 0x000087e7,
+			0x00009a2b, 0x0000916f, 0x0000fb93, 0x0000f0d7, 0x0000ed1b, 0x0000e65f,
+			0x0000d683, 0x0000ddc7, 0x0000c00b, 0x0000cb4f, 0x000015f3, 0x00001eb7,
+			0x0000037b, 0x0000083f, 0x000038e3, 0x000033a7, 0x00002e6b, 0x0000252f,
+			0x00004fd3, 0x00004497, 0x0000595b, 0x0000521f, 0x000062c3, 0x00006987,
+			0x0000744b, 0x00007f0f, 0x00008a55, 0x00008111, 0x00009cdd, 0x00009799,
+			0x0000a745, 0x0000ac01, 0x0000b1cd, 0x0000ba89, 0x0000d075, 0x0000db31,
+			0x0000c6fd, 0x0000cdb9, 0x0000fd65, 0x0000f621, 0x0000ebed, 0x0000e0a9,
+			0x00003e15, 0x00003551, 0x0000289d, 0x000023d9, 0x00001305, 0x00001841,
+			0x0000058d, 0x00000ec9, 0x00006435, 0x00006f71, 0x000072bd, 0x000079f9,
+			0x00004925, 0x00004261, 0x00005fad, 0x000054e9, 0x0000eac4, 0x0000e180,
+			0x0000fc4c, 0x0000f708, 0x0000c7d4, 0x0000cc90, 0x0000d15c, 0x0000da18,
+			0x0000b0e4, 0x0000bba0, 0x0000a66c, 0x0000ad28, 0x00009df4, 0x000096b0,
+			0x00008b7c, 0x00008038, 0x00005e84, 0x000055c0, 0x0000480c, 0x00004348,
+			0x00007394, 0x000078d0, 0x0000651c, 0x00006e58, 0x000004a4, 0x00000fe0,
+			0x0000122c, 0x00001968, 0x000029b4, 0x000022f0, 0x00003f3c, 0x00003478,
+			0x00004b77, 0x00004033, 0x00005dff, 0x000056bb, 0x00006667, 0x00006d23,
+			0x000070ef, 0x00007bab, 0x00001157, 0x00001a13, 0x000007df, 0x00000c9b,
+			0x00003c47, 0x00003703, 0x00002acf, 0x0000218b, 0x0000ff37, 0x0000f473,
+			0x0000e9bf, 0x0000e2fb, 0x0000d227, 0x0000d963, 0x0000c4af, 0x0000cfeb,
+			0x0000a517, 0x0000ae53, 0x0000b39f, 0x0000b8db, 0x00008807, 0x00008343,
+			0x00009e8f, 0x000095cb, 0x00002be6, 0x000020a2, 0x00003d6e, 0x0000362a,
+			0x000006f6, 0x00000db2, 0x0000107e, 0x00001b3a, 0x000071c6, 0x00007a82,
+			0x0000674e, 0x00006c0a, 0x00005cd6, 0x00005792, 0x00004a5e, 0x0000411a,
+			0x00009fa6, 0x000094e2, 0x0000892e, 0x0000826a, 0x0000b2b6, 0x0000b9f2,
+			0x0000a43e, 0x0000af7a, 0x0000c586, 0x0000cec2, 0x0000d30e, 0x0000d84a,
+			0x0000e896, 0x0000e3d2, 0x0000fe1e, 0x0000f55a,
+		},
+		{
+			0x00000000, 0x0000042b, 0x00000856, 0x00000c7d, 0x000010ac, 0x00001487,
+			0x000018fa, 0x00001cd1, 0x00002158, 0x00002573, 0x0000290e, 0x00002d25,
+			0x000031f4, 0x000035df, 0x000039a2, 0x00003d89, 0x000042b0, 0x0000469b,
+			0x00004ae6, 0x00004ecd, 0x0000521c, 0x00005637, 0x00005a4a, 0x00005e61,
+			0x000063e8, 0x000067c3, 0x00006bbe, 0x00006f95, 0x00007344, 0x0000776f,
+			0x00007b12, 0x00007f39, 0x00008560, 0x0000814b, 0x00008d36, 0x0000891d,
+			0x000095cc, 0x000091e7, 0x00009d9a, 0x000099b1, 0x0000a438, 0x0000a013,
+			0x0000ac6e, 0x0000a845, 0x0000b494, 0x0000b0bf, 0x0000bcc2, 0x0000b8e9,
+			0x0000c7d0, 0x0000c3fb, 0x0000cf86, 0x0000cbad, 0x0000d77c, 0x0000d357,
+			0x0000df2a, 0x0000db01, 0x0000e688, 0x0000e2a3, 0x0000eede, 0x0000eaf5,
+			0x0000f624, 0x0000f20f, 0x0000fe72, 0x0000fa59, 0x000002d1, 0x000006fa,
+			0x00000a87, 0x00000eac, 0x0000127d, 0x00001656, 0x00001a2b, 0x00001e00,
+			0x00002389, 0x000027a2, 0x00002bdf, 0x00002ff4, 0x00003325, 0x0000370e,
+			0x00003b73, 0x00003f58, 0x00004061, 0x0000444a, 0x00004837, 0x00004c1c,
+			0x000050cd, 0x000054e6, 0x0000589b, 0x00005cb0, 0x00006139, 0x00006512,
+			0x0000696f, 0x00006d44, 0x00007195, 0x000075be, 0x000079c3, 0x00007de8,
+			0x000087b1, 0x0000839a, 0x00008fe7, 0x00008bcc, 0x0000971d, 0x00009336,
+			0x00009f4b, 0x00009b60, 0x0000a6e9, 0x0000a2c2, 0x0000aebf, 0x0000aa94,
+			0x0000b645, 0x0000b26e, 0x0000be13, 0x0000ba38, 0x0000c501, 0x0000c12a,
+			0x0000cd57, 0x0000c97c, 0x0000d5ad, 0x0000d186, 0x0000ddfb, 0x0000d9d0,
+			0x0000e459, 0x0000e072, 0x0000ec0f, 0x0000e824, 0x0000f4f5, 0x0000f0de,
+			0x0000fca3, 0x0000f888, 0x000005a2, 0x00000189, 0x00000df4, 0x000009df,
+			0x0000150e, 0x00001125, 0x00001d58, 0x00001973, 0x000024fa, 0x000020d1,
+			0x00002cac, 0x00002887, 0x00003456, 0x0000307d, 0x00003c00, 0x0000382b,
+			0x00004712, 0x00004339, 0x00004f44, 0x00004b6f, 0x000057be, 0x00005395,
+			0x00005fe8, 0x00005bc3, 0x0000664a, 0x00006261, 0x00006e1c, 0x00006a37,
+			0x000076e6, 0x000072cd, 0x00007eb0, 0x00007a9b, 0x000080c2, 0x000084e9,
+			0x00008894, 0x00008cbf, 0x0000906e, 0x00009445, 0x00009838, 0x00009c13,
+			0x0000a19a, 0x0000a5b1, 0x0000a9cc, 0x0000ade7, 0x0000b136, 0x0000b51d,
+			0x0000b960, 0x0000bd4b, 0x0000c272, 0x0000c659, 0x0000ca24, 0x0000ce0f,
+			0x0000d2de, 0x0000d6f5, 0x0000da88, 0x0000dea3, 0x0000e32a, 0x0000e701,
+			0x0000eb7c, 0x0000ef57, 0x0000f386, 0x0000f7ad, 0x0000fbd0, 0x0000fffb,
+			0x00000773, 0x00000358, 0x00000f25, 0x00000b0e, 0x000017df, 0x000013f4,
+			0x00001f89, 0x00001ba2, 0x0000262b, 0x00002200, 0x00002e7d, 0x00002a56,
+			0x00003687, 0x000032ac, 0x00003ed1, 0x00003afa, 0x000045c3, 0x000041e8,
+			0x00004d95, 0x000049be, 0x0000556f, 0x00005144, 0x00005d39, 0x00005912,
+			0x0000649b, 0x000060b0, 0x00006ccd, 0x000068e6, 0x00007437, 0x0000701c,
+			0x00007c61, 0x0000784a, 0x00008213, 0x00008638, 0x00008a45, 0x00008e6e,
+			0x000092bf, 0x00009694, 0x00009ae9, 0x00009ec2, 0x0000a34b, 0x0000a760,
+			0x0000ab1d, 0x0000af36, 0x0000b3e7, 0x0000b7cc, 0x0000bbb1, 0x0000bf9a,
+			0x0000c0a3, 0x0000c488, 0x0000c8f5, 0x0000ccde, 0x0000d00f, 0x0000d424,
+			0x0000d859, 0x0000dc72, 0x0000e1fb, 0x0000e5d0, 0x0000e9ad, 0x0000ed86,
+			0x0000f157, 0x0000f57c, 0x0000f901, 0x0000fd2a,
+		},
+		{
+			0x00000000, 0x00009fd5, 0x000037bb, 0x0000a86e, 0x00006f76, 0x0000f0a3,
+			0x000058cd, 0x0000c718, 0x0000deec, 0x00004139, 0x0000e957, 0x00007682,
+			0x0000b19a, 0x00002e4f, 0x00008621, 0x000019f4, 0x0000b5c9, 0x00002a1c,
+			0x00008272, 0x00001da7, 0x0000dabf, 0x0000456a, 0x0000ed04, 0x000072d1,
+			0x00006b25, 0x0000f4f0, 0x00005c9e, 0x0000c34b, 0x00000453, 0x00009b86,
+			0x000033e8, 0x0000ac3d, 0x00006383, 0x0000fc56, 0x00005438, 0x0000cbed,
+			0x00000cf5, 0x00009320, 0x00003b4e, 0x0000a49b, 0x0000bd6f, 0x000022ba,
+			0x00008ad4, 0x00001501, 0x0000d219, 0x00004dcc, 0x0000e5a2, 0x00007a77,
+			0x0000d64a, 0x0000499f, 0x0000e1f1, 0x00007e24, 0x0000b93c, 0x000026e9,
+			0x00008e87, 0x00001152, 0x000008a6, 0x00009773, 0x00003f1d, 0x0000a0c8,
+			0x000067d0, 0x0000f805, 0x0000506b, 0x0000cfbe, 0x0000c706, 0x000058d3,
+			0x0000f0bd, 0x00006f68, 0x0000a870, 0x000037a5, 0x00009fcb, 0x0000001e,
+			0x000019ea, 0x0000863f, 0x00002e51, 0x0000b184, 0x0000769c, 0x0000e949,
+			0x00004127, 0x0000def2, 0x000072cf, 0x0000ed1a, 0x00004574, 0x0000daa1,
+			0x00001db9, 0x0000826c, 0x00002a02, 0x0000b5d7, 0x0000ac23, 0x000033f6,
+			0x00009b98, 0x0000044d, 0x0000c355, 0x00005c80, 0x0000f4ee, 0x00006b3b,
+			0x0000a485, 0x00003b50, 0x0000933e, 0x00000ceb, 0x0000cbf3, 0x00005426,
+			0x0000fc48, 0x0000639d, 0x00007a69, 0x0000e5bc, 0x00004dd2, 0x0000d207,
+			0x0000151f, 0x00008aca, 0x000022a4, 0x0000bd71, 0x0000114c, 0x00008e99,
+			0x000026f7, 0x0000b922, 0x00007e3a, 0x0000e1ef, 0x00004981, 0x0000d654,
+			0x0000cfa0, 0x00005075, 0x0000f81b, 0x000067ce, 0x0000a0d6, 0x00003f03,
+			0x0000976d, 0x000008b8, 0x0000861d, 0x000019c8, 0x0000b1a6, 0x00002e73,
+			0x0000e96b, 0x000076be, 0x0000ded0, 0x00004105, 0x000058f1, 0x0000c724,
+			0x00006f4a, 0x0000f09f, 0x00003787, 0x0000a852, 0x0000003c, 0x00009fe9,
+			0x000033d4, 0x0000ac01, 0x0000046f, 0x00009bba, 0x00005ca2, 0x0000c377,
+			0x00006b19, 0x0000f4cc, 0x0000ed38, 0x000072ed, 0x0000da83, 0x00004556,
+			0x0000824e, 0x00001d9b, 0x0000b5f5, 0x00002a20, 0x0000e59e, 0x00007a4b,
+			0x0000d225, 0x00004df0, 0x00008ae8, 0x0000153d, 0x0000bd53, 0x00002286,
+			0x00003b72, 0x0000a4a7, 0x00000cc9, 0x0000931c, 0x00005404, 0x0000cbd1,
+			0x000063bf, 0x0000fc6a, 0x00005057, 0x0000cf82, 0x000067ec, 0x0000f839,
+			0x00003f21, 0x0000a0f4, 0x0000089a, 0x0000974f, 0x00008ebb, 0x0000116e,
+			0x0000b900, 0x000026d5, 0x0000e1cd, 0x00007e18, 0x0000d676, 0x000049a3,
+			0x0000411b, 0x0000dece, 0x000076a0, 0x0000e975, 0x00002e6d, 0x0000b1b8,
+			0x000019d6, 0x00008603, 0x00009ff7, 0x00000022, 0x0000a84c, 0x00003799,
+			0x0000f081, 0x00006f54, 0x0000c73a, 0x000058ef, 0x0000f4d2, 0x00006b07,
+			0x0000c369, 0x00005cbc, 0x00009ba4, 0x00000471, 0x0000ac1f, 0x000033ca,
+			0x00002a3e, 0x0000b5eb, 0x00001d85, 0x00008250, 0x00004548, 0x0000da9d,
+			0x000072f3, 0x0000ed26, 0x00002298, 0x0000bd4d, 0x00001523, 0x00008af6,
+			0x00004dee, 0x0000d23b, 0x00007a55, 0x0000e580, 0x0000fc74, 0x000063a1,
+			0x0000cbcf, 0x0000541a, 0x00009302, 0x00000cd7, 0x0000a4b9, 0x00003b6c,
+			0x00009751, 0x00000884, 0x0000a0ea, 0x00003f3f, 0x0000f827, 0x000067f2,
+			0x0000cf9c, 0x00005049, 0x000049bd, 0x0000d668, 0x00007e06, 0x0000e1d3,
+			0x000026cb, 0x0000b91e, 0x00001170, 0x00008ea5,
+		},
+		{
+			0x00000000, 0x000081bf, 0x00000b6f, 0x00008ad0, 0x000016de, 0x00009761,
+			0x00001db1, 0x00009c0e, 0x00002dbc, 0x0000ac03, 0x000026d3, 0x0000a76c,
+			0x00003b62, 0x0000badd, 0x0000300d, 0x0000b1b2, 0x00005b78, 0x0000dac7,
+			0x00005017, 0x0000d1a8, 0x00004da6, 0x0000cc19, 0x000046c9, 0x0000c776,
+			0x000076c4, 0x0000f77b, 0x00007dab, 0x0000fc14, 0x0000601a, 0x0000e1a5,
+			0x00006b75, 0x0000eaca, 0x0000b6f0, 0x0000374f, 0x0000bd9f, 0x00003c20,
+			0x0000a02e, 0x00002191, 0x0000ab41, 0x00002afe, 0x00009b4c, 0x00001af3,
+			0x00009023, 0x0000119c, 0x00008d92, 0x00000c2d, 0x000086fd, 0x00000742,
+			0x0000ed88, 0x00006c37, 0x0000e6e7, 0x00006758, 0x0000fb56, 0x00007ae9,
+			0x0000f039, 0x00007186, 0x0000c034, 0x0000418b, 0x0000cb5b, 0x00004ae4,
+			0x0000d6ea, 0x00005755, 0x0000dd85, 0x00005c3a, 0x000065f1, 0x0000e44e,
+			0x00006e9e, 0x0000ef21, 0x0000732f, 0x0000f290, 0x00007840, 0x0000f9ff,
+			0x0000484d, 0x0000c9f2, 0x00004322, 0x0000c29d, 0x00005e93, 0x0000df2c,
+			0x000055fc, 0x0000d443, 0x00003e89, 0x0000bf36, 0x000035e6, 0x0000b459,
+			0x00002857, 0x0000a9e8, 0x00002338, 0x0000a287, 0x00001335, 0x0000928a,
+			0x0000185a, 0x000099e5, 0x000005eb, 0x00008454, 0x00000e84, 0x00008f3b,
+			0x0000d301, 0x000052be, 0x0000d86e, 0x000059d1, 0x0000c5df, 0x00004460,
+			0x0000ceb0, 0x00004f0f, 0x0000febd, 0x00007f02, 0x0000f5d2, 0x0000746d,
+			0x0000e863, 0x000069dc, 0x0000e30c, 0x000062b3, 0x00008879, 0x000009c6,
+			0x00008316, 0x000002a9, 0x00009ea7, 0x00001f18, 0x000095c8, 0x00001477,
+			0x0000a5c5, 0x0000247a, 0x0000aeaa, 0x00002f15, 0x0000b31b, 0x000032a4,
+			0x0000b874, 0x000039cb, 0x0000cbe2, 0x00004a5d, 0x0000c08d, 0x00004132,
+			0x0000dd3c, 0x00005c83, 0x0000d653, 0x000057ec, 0x0000e65e, 0x000067e1,
+			0x0000ed31, 0x00006c8e, 0x0000f080, 0x0000713f, 0x0000fbef, 0x00007a50,
+			0x0000909a, 0x00001125, 0x00009bf5, 0x00001a4a, 0x00008644, 0x000007fb,
+			0x00008d2b, 0x00000c94, 0x0000bd26, 0x00003c99, 0x0000b649, 0x000037f6,
+			0x0000abf8, 0x00002a47, 0x0000a097, 0x00002128, 0x00007d12, 0x0000fcad,
+			0x0000767d, 0x0000f7c2, 0x00006bcc, 0x0000ea73, 0x000060a3, 0x0000e11c,
+			0x000050ae, 0x0000d111, 0x00005bc1, 0x0000da7e, 0x00004670, 0x0000c7cf,
+			0x00004d1f, 0x0000cca0, 0x0000266a, 0x0000a7d5, 0x00002d05, 0x0000acba,
+			0x000030b4, 0x0000b10b, 0x00003bdb, 0x0000ba64, 0x00000bd6, 0x00008a69,
+			0x000000b9, 0x00008106, 0x00001d08, 0x00009cb7, 0x00001667, 0x000097d8,
+			0x0000ae13, 0x00002fac, 0x0000a57c, 0x000024c3, 0x0000b8cd, 0x00003972,
+			0x0000b3a2, 0x0000321d, 0x000083af, 0x00000210, 0x000088c0, 0x0000097f,
+			0x00009571, 0x000014ce, 0x00009e1e, 0x00001fa1, 0x0000f56b, 0x000074d4,
+			0x0000fe04, 0x00007fbb, 0x0000e3b5, 0x0000620a, 0x0000e8da, 0x00006965,
+			0x0000d8d7, 0x00005968, 0x0000d3b8, 0x00005207, 0x0000ce09, 0x00004fb6,
+			0x0000c566, 0x000044d9, 0x000018e3, 0x0000995c, 0x0000138c, 0x00009233,
+			0x00000e3d, 0x00008f82, 0x00000552, 0x000084ed, 0x0000355f, 0x0000b4e0,
+			0x00003e30, 0x0000bf8f, 0x00002381, 0x0000a23e, 0x000028ee, 0x0000a951,
+			0x0000439b, 0x0000c224, 0x000048f4, 0x0000c94b, 0x00005545, 0x0000d4fa,
+			0x00005e2a, 0x0000df95, 0x00006e27, 0x0000ef98, 0x00006548, 0x0000e4f7,
+			0x000078f9, 0x0000f946, 0x00007396, 0x0000f229,
+		},
+	},
+	{ /* CRC_PRESET_15_CAN */
+		{
+			0x00000000, 0x8b320000, 0x9d560000, 0x16640000, 0xb19e0000, 0x3aac0000,
+			0x2cc80000, 0xa7fa0000, 0xe80e0000, 0x633c0000, 0x75580000, 0xfe6a0000,
+			0x59900000, 0xd2a20000, 0xc4c60000, 0x4ff40000, 0x5b2e0000, 0xd01c0000,
+			0xc6780000, 0x4d4a0000, 0xeab00000, 0x61820000, 0x77e60000, 0xfcd40000,
+			0xb3200000, 0x38120000, 0x2e760000, 0xa5440000, 0x02be0000, 0x898c0000,
+			0x9fe80000, 0x14da0000, 0xb65c0000, 0x3d6e0000, 0x2b0a0000, 0xa0380000,
+			0x07c20000, 0x8cf00000, 0x9a940000, 0x11a60000, 0x5e520000, 0xd5600000,
+			0xc3040000, 0x48360000, 0xefcc0000, 0x64fe0000, 0x729a0000, 0xf9a80000,
+			0xed720000, 0x66400000, 0x70240000, 0xfb160000, 0x5cec0000, 0xd7de0000,
+			0xc1ba0000, 0x4a880000, 0x057c0000, 0x8e4e0000, 0x982a0000, 0x13180000,
+			0xb4e20000, 0x3fd00000, 0x29b40000, 0xa2860000, 0xe78a0000, 0x6cb80000,
+			0x7adc0000, 0xf1ee0000, 0x56140000, 0xdd260000, 0xcb420000, 0x40700000,
+			0x0f840000, 0x84b60000, 0x92d20000, 0x19e00000, 0xbe1a0000, 0x35280000,
+			0x234c0000, 0xa87e0000, 0xbca40000, 0x37960000, 0x21f20000, 0xaac00000,
+			0x0d3a0000, 0x86080000, 0x906c0000, 0x1b5e0000, 0x54aa0000, 0xdf980000,
+			0xc9fc0000, 0x42ce0000, 0xe5340000, 0x6e060000, 0x78620000, 0xf3500000,
+			0x51d60000, 0xdae40000, 0xcc800000, 0x47b20000, 0xe0480000, 0x6b7a0000,
+			0x7d1e0000, 0xf62c0000, 0xb9d80000, 0x32ea0000, 0x248e0000, 0xafbc0000,
+			0x08460000, 0x83740000, 0x95100000, 0x1e220000, 0x0af80000, 0x81ca0000,
+			0x97ae0000, 0x1c9c0000, 0xbb660000, 0x30540000, 0x26300000, 0xad020000,
+			0xe2f60000, 0x69c40000, 0x7fa00000, 0xf4920000, 0x53680000, 0xd85a0000,
+			0xce3e0000, 0x450c0000, 0x44260000, 0xcf140000, 0xd9700000, 0x52420000,
+			0xf5b80000, 0x7e8a0000, 0x68ee0000, 0xe3dc0000, 0xac280000, 0x271a0000,
+			0x317e0000, 0xba4c0000, 0x1db60000, 0x96840000, 0x80e00000, 0x0bd20000,
+			0x1f080000, 0x943a0000, 0x825e0000, 0x096c0000, 0xae960000, 0x25a40000,
+			0x33c00000, 0xb8f20000, 0xf7060000, 0x7c340000, 0x6a500000, 0xe1620000,
+			0x46980000, 0xcdaa0000, 0xdbce0000, 0x50fc0000, 0xf27a0000, 0x79480000,
+			0x6f2c0000, 0xe41e0000, 0x43e40000, 0xc8d60000, 0xdeb20000, 0x55800000,
+			0x1a740000, 0x91460000, 0x87220000, 0x0c100000, 0xabea0000, 0x20d80000,
+			0x36bc0000, 0xbd8e0000, 0xa9540000, 0x22660000, 0x34020000, 0xbf300000,
+			0x18ca0000, 0x93f80000, 0x859c0000, 0x0eae0000, 0x415a0000, 0xca680000,
+			0xdc0c0000, 0x573e0000, 0xf0c40000, 0x7bf60000, 0x6d920000, 0xe6a00000,
+			0xa3ac0000, 0x289e0000, 0x3efa0000, 0xb5c80000, 0x12320000, 0x99000000,
+			0x8f640000, 0x04560000, 0x4ba20000, 0xc0900000, 0xd6f40000, 0x5dc60000,
+			0xfa3c0000, 0x710e0000, 0x676a0000, 0xec580000, 0xf8820000, 0x73b00000,
+			0x65d40000, 0xeee60000, 0x491c0000, 0xc22e0000, 0xd44a0000, 0x5f780000,
+			0x108c0000, 0x9bbe0000, 0x8dda0000, 0x06e80000, 0xa1120000, 0x2a200000,
+			0x3c440000, 0xb7760000, 0x15f00000, 0x9ec20000, 0x88a60000, 0x03940000,
+			0xa46e0000, 0x2f5c0000, 0x39380000, 0xb20a0000, 0xfdfe0000, 0x76cc0000,
+			0x60a80000, 0xeb9a0000, 0x4c600000, 0xc7520000, 0xd1360000, 0x5a040000,
+			0x4ede0000, 0xc5ec0000, 0xd3880000, 0x58ba0000, 0xff400000, 0x74720000,
+			0x62160000, 0xe9240000, 0xa6d00000, 0x2de20000, 0x3b860000, 0xb0b40000,
+			0x174e0000, 0x9c7c0000, 0x8a180000, 0x012a0000,
+		},
+		{
+			0x00000000, 0x884c0000, 0x9baa0000, 0x13e60000, 0xbc660000, 0x342a0000,
+			0x27cc0000, 0xaf800000, 0xf3fe0000, 0x7bb20000, 0x68540000, 0xe0180000,
+			0x4f980000, 0xc7d40000, 0xd4320000, 0x5c7e0000, 0x6cce0000, 0xe4820000,
+			0xf7640000, 0x7f280000, 0xd0a80000, 0x58e40000, 0x4b020000, 0xc34e0000,
+			0x9f300000, 0x177c0000, 0x049a0000, 0x8cd60000, 0x23560000, 0xab1a0000,
+			0xb8fc0000, 0x30b00000, 0xd99c0000, 0x51d00000, 0x42360000, 0xca7a0000,
+			0x65fa0000, 0xedb60000, 0xfe500000, 0x761c0000, 0x2a620000, 0xa22e0000,
+			0xb1c80000, 0x39840000, 0x96040000, 0x1e480000, 0x0dae0000, 0x85e20000,
+			0xb5520000, 0x3d1e0000, 0x2ef80000, 0xa6b40000, 0x09340000, 0x81780000,
+			0x929e0000, 0x1ad20000, 0x46ac0000, 0xcee00000, 0xdd060000, 0x554a0000,
+			0xfaca0000, 0x72860000, 0x61600000, 0xe92c0000, 0x380a0000, 0xb0460000,
+			0xa3a00000, 0x2bec0000, 0x846c0000, 0x0c200000, 0x1fc60000, 0x978a0000,
+			0xcbf40000, 0x43b80000, 0x505e0000, 0xd8120000, 0x77920000, 0xffde0000,
+			0xec380000, 0x64740000, 0x54c40000, 0xdc880000, 0xcf6e0000, 0x47220000,
+			0xe8a20000, 0x60ee0000, 0x73080000, 0xfb440000, 0xa73a0000, 0x2f760000,
+			0x3c900000, 0xb4dc0000, 0x1b5c0000, 0x93100000, 0x80f60000, 0x08ba0000,
+			0xe1960000, 0x69da0000, 0x7a3c0000, 0xf2700000, 0x5df00000, 0xd5bc0000,
+			0xc65a0000, 0x4e160000, 0x12680000, 0x9a240000, 0x89c20000, 0x018e0000,
+			0xae0e0000, 0x26420000, 0x35a40000, 0xbde80000, 0x8d580000, 0x05140000,
+			0x16f20000, 0x9ebe0000, 0x313e0000, 0xb9720000, 0xaa940000, 0x22d80000,
+			0x7ea60000, 0xf6ea0000, 0xe50c0000, 0x6d400000, 0xc2c00000, 0x4a8c0000,
+			0x596a0000, 0xd1260000, 0x70140000, 0xf8580000, 0xebbe0000, 0x63f20000,
+			0xcc720000, 0x443e0000, 0x57d80000, 0xdf940000, 0x83ea0000, 0x0ba60000,
+			0x18400000, 0x900c0000, 0x3f8c0000, 0xb7c00000, 0xa4260000, 0x2c6a0000,
+			0x1cda0000, 0x94960000, 0x87700000, 0x0f3c0000, 0xa0bc0000, 0x28f00000,
+			0x3b160000, 0xb35a0000, 0xef240000, 0x67680000, 0x748e0000, 0xfcc20000,
+			0x53420000, 0xdb0e0000, 0xc8e80000, 0x40a40000, 0xa9880000, 0x21c40000,
+			0x32220000, 0xba6e0000, 0x15ee0000, 0x9da20000, 0x8e440000, 0x06080000,
+			0x5a760000, 0xd23a0000, 0xc1dc0000, 0x49900000, 0xe6100000, 0x6e5c0000,
+			0x7dba0000, 0xf5f60000, 0xc5460000, 0x4d0a0000, 0x5eec0000, 0xd6a00000,
+			0x79200000, 0xf16c0000, 0xe28a0000, 0x6ac60000, 0x36b80000, 0xbef40000,
+			0xad120000, 0x255e0000, 0x8ade0000, 0x02920000, 0x11740000, 0x99380000,
+			0x481e0000, 0xc0520000, 0xd3b40000, 0x5bf80000, 0xf4780000, 0x7c340000,
+			0x6fd20000, 0xe79e0000, 0xbbe00000, 0x33ac0000, 0x204a0000, 0xa8060000,
+			0x07860000, 0x8fca0000, 0x9c2c0000, 0x14600000, 0x24d00000, 0xac9c0000,
+			0xbf7a0000, 0x37360000, 0x98b60000, 0x10fa0000, 0x031c0000, 0x8b500000,
+			0xd72e0000, 0x5f620000, 0x4c840000, 0xc4c80000, 0x6b480000, 0xe3040000,
+			0xf0e20000, 0x78ae0000, 0x91820000, 0x19ce0000, 0x0a280000, 0x82640000,
+			0x2de40000, 0xa5a80000, 0xb64e0000, 0x3e020000, 0x627c0000, 0xea300000,
+			0xf9d60000, 0x719a0000, 0xde1a0000, 0x56560000, 0x45b00000, 0xcdfc0000,
+			0xfd4c0000, 0x75000000, 0x66e60000, 0xeeaa0000, 0x412a0000, 0xc9660000,
+			0xda800000, 0x52cc0000, 0x0eb20000, 0x86fe0000, 0x95180000, 0x1d540000,
+			0xb2d40000, 0x3a980000, 0x297e0000, 0xa1320000,
+		},
+		{
+			0x00000000, 0xe0280000, 0x4b620000, 0xab4a0000, 0x96c40000, 0x76ec0000,
+			0xdda60000, 0x3d8e0000, 0xa6ba0000, 0x46920000, 0xedd80000, 0x0df00000,
+			0x307e0000, 0xd0560000, 0x7b1c0000, 0x9b340000, 0xc6460000, 0x266e0000,
+			0x8d240000, 0x6d0c0000, 0x50820000, 0xb0aa0000, 0x1be00000, 0xfbc80000,
+			0x60fc0000, 0x80d40000, 0x2b9e0000, 0xcbb60000, 0xf6380000, 0x16100000,
+			0xbd5a0000, 0x5d720000, 0x07be0000, 0xe7960000, 0x4cdc0000, 0xacf40000,
+			0x917a0000, 0x71520000, 0xda180000, 0x3a300000, 0xa1040000, 0x412c0000,
+			0xea660000, 0x0a4e0000, 0x37c00000, 0xd7e80000, 0x7ca20000, 0x9c8a0000,
+			0xc1f80000, 0x21d00000, 0x8a9a0000, 0x6ab20000, 0x573c0000, 0xb7140000,
+			0x1c5e0000, 0xfc760000, 0x67420000, 0x876a0000, 0x2c200000, 0xcc080000,
+			0xf1860000, 0x11ae0000, 0xbae40000, 0x5acc0000, 0x0f7c0000, 0xef540000,
+			0x441e0000, 0xa4360000, 0x99b80000, 0x79900000, 0xd2da0000, 0x32f20000,
+			0xa9c60000, 0x49ee0000, 0xe2a40000, 0x028c0000, 0x3f020000, 0xdf2a0000,
+			0x74600000, 0x94480000, 0xc93a0000, 0x29120000, 0x82580000, 0x62700000,
+			0x5ffe0000, 0xbfd60000, 0x149c0000, 0xf4b40000, 0x6f800000, 0x8fa80000,
+			0x24e20000, 0xc4ca0000, 0xf9440000, 0x196c0000, 0xb2260000, 0x520e0000,
+			0x08c20000, 0xe8ea0000, 0x43a00000, 0xa3880000, 0x9e060000, 0x7e2e0000,
+			0xd5640000, 0x354c0000, 0xae780000, 0x4e500000, 0xe51a0000, 0x05320000,
+			0x38bc0000, 0xd8940000, 0x73de0000, 0x93f60000, 0xce840000, 0x2eac0000,
+			0x85e60000, 0x65ce0000, 0x58400000, 0xb8680000, 0x13220000, 0xf30a0000,
+			0x683e0000, 0x88160000, 0x235c0000, 0xc3740000, 0xfefa0000, 0x1ed20000,
+			0xb5980000, 0x55b00000, 0x1ef80000, 0xfed00000, 0x559a0000, 0xb5b20000,
+			0x883c0000, 0x68140000, 0xc35e0000, 0x23760000, 0xb8420000, 0x586a0000,
+			0xf3200000, 0x13080000, 0x2e860000, 0xceae0000, 0x65e40000, 0x85cc0000,
+			0xd8be0000, 0x38960000, 0x93dc0000, 0x73f40000, 0x4e7a0000, 0xae520000,
+			0x05180000, 0xe5300000, 0x7e040000, 0x9e2c0000, 0x35660000, 0xd54e0000,
+			0xe8c00000, 0x08e80000, 0xa3a20000, 0x438a0000, 0x19460000, 0xf96e0000,
+			0x52240000, 0xb20c0000, 0x8f820000, 0x6faa0000, 0xc4e00000, 0x24c80000,
+			0xbffc0000, 0x5fd40000, 0xf49e0000, 0x14b60000, 0x29380000, 0xc9100000,
+			0x625a0000, 0x82720000, 0xdf000000, 0x3f280000, 0x94620000, 0x744a0000,
+			0x49c40000, 0xa9ec0000, 0x02a60000, 0xe28e0000, 0x79ba0000, 0x99920000,
+			0x32d80000, 0xd2f00000, 0xef7e0000, 0x0f560000, 0xa41c0000, 0x44340000,
+			0x11840000, 0xf1ac0000, 0x5ae60000, 0xbace0000, 0x87400000, 0x67680000,
+			0xcc220000, 0x2c0a0000, 0xb73e0000, 0x57160000, 0xfc5c0000, 0x1c740000,
+			0x21fa0000, 0xc1d20000, 0x6a980000, 0x8ab00000, 0xd7c20000, 0x37ea0000,
+			0x9ca00000, 0x7c880000, 0x41060000, 0xa12e0000, 0x0a640000, 0xea4c0000,
+			0x71780000, 0x91500000, 0x3a1a0000, 0xda320000, 0xe7bc0000, 0x07940000,
+			0xacde0000, 0x4cf60000, 0x163a0000, 0xf6120000, 0x5d580000, 0xbd700000,
+			0x80fe0000, 0x60d60000, 0xcb9c0000, 0x2bb40000, 0xb0800000, 0x50a80000,
+			0xfbe20000, 0x1bca0000, 0x26440000, 0xc66c0000, 0x6d260000, 0x8d0e0000,
+			0xd07c0000, 0x30540000, 0x9b1e0000, 0x7b360000, 0x46b80000, 0xa6900000,
+			0x0dda0000, 0xedf20000, 0x76c60000, 0x96ee0000, 0x3da40000, 0xdd8c0000,
+			0xe0020000, 0x002a0000, 0xab600000, 0x4b480000,
+		},
+		{
+			0x00000000, 0x3df00000, 0x7be00000, 0x46100000, 0xf7c00000, 0xca300000,
+			0x8c200000, 0xb1d00000, 0x64b20000, 0x59420000, 0x1f520000, 0x22a20000,
+			0x93720000, 0xae820000, 0xe8920000, 0xd5620000, 0xc9640000, 0xf4940000,
+			0xb2840000, 0x8f740000, 0x3ea40000, 0x03540000, 0x45440000, 0x78b40000,
+			0xadd60000, 0x90260000, 0xd6360000, 0xebc60000, 0x5a160000, 0x67e60000,
+			0x21f60000, 0x1c060000, 0x19fa0000, 0x240a0000, 0x621a0000, 0x5fea0000,
+			0xee3a0000, 0xd3ca0000, 0x95da0000, 0xa82a0000, 0x7d480000, 0x40b80000,
+			0x06a80000, 0x3b580000, 0x8a880000, 0xb7780000, 0xf1680000, 0xcc980000,
+			0xd09e0000, 0xed6e0000, 0xab7e0000, 0x968e0000, 0x275e0000, 0x1aae0000,
+			0x5cbe0000, 0x614e0000, 0xb42c0000, 0x89dc0000, 0xcfcc0000, 0xf23c0000,
+			0x43ec0000, 0x7e1c0000, 0x380c0000, 0x05fc0000, 0x33f40000, 0x0e040000,
+			0x48140000, 0x75e40000, 0xc4340000, 0xf9c40000, 0xbfd40000, 0x82240000,
+			0x57460000, 0x6ab60000, 0x2ca60000, 0x11560000, 0xa0860000, 0x9d760000,
+			0xdb660000, 0xe6960000, 0xfa900000, 0xc7600000, 0x81700000, 0xbc800000,
+			0x0d500000, 0x30a00000, 0x76b00000, 0x4b400000, 0x9e220000, 0xa3d20000,
+			0xe5c20000, 0xd8320000, 0x69e20000, 0x54120000, 0x12020000, 0x2ff20000,
+			0x2a0e0000, 0x17fe0000, 0x51ee0000, 0x6c1e0000, 0xddce0000, 0xe03e0000,
+			0xa62e0000, 0x9bde0000, 0x4ebc0000, 0x734c0000, 0x355c0000, 0x08ac0000,
+			0xb97c0000, 0x848c0000, 0xc29c0000, 0xff6c0000, 0xe36a0000, 0xde9a0000,
+			0x988a0000, 0xa57a0000, 0x14aa0000, 0x295a0000, 0x6f4a0000, 0x52ba0000,
+			0x87d80000, 0xba280000, 0xfc380000, 0xc1c80000, 0x70180000, 0x4de80000,
+			0x0bf80000, 0x36080000, 0x67e80000, 0x5a180000, 0x1c080000, 0x21f80000,
+			0x90280000, 0xadd80000, 0xebc80000, 0xd6380000, 0x035a0000, 0x3eaa0000,
+			0x78ba0000, 0x454a0000, 0xf49a0000, 0xc96a0000, 0x8f7a0000, 0xb28a0000,
+			0xae8c0000, 0x937c0000, 0xd56c0000, 0xe89c0000, 0x594c0000, 0x64bc0000,
+			0x22ac0000, 0x1f5c0000, 0xca3e0000, 0xf7ce0000, 0xb1de0000, 0x8c2e0000,
+			0x3dfe0000, 0x000e0000, 0x461e0000, 0x7bee0000, 0x7e120000, 0x43e20000,
+			0x05f20000, 0x38020000, 0x89d20000, 0xb4220000, 0xf2320000, 0xcfc20000,
+			0x1aa00000, 0x27500000, 0x61400000, 0x5cb00000, 0xed600000, 0xd0900000,
+			0x96800000, 0xab700000, 0xb7760000, 0x8a860000, 0xcc960000, 0xf1660000,
+			0x40b60000, 0x7d460000, 0x3b560000, 0x06a60000, 0xd3c40000, 0xee340000,
+			0xa8240000, 0x95d40000, 0x24040000, 0x19f40000, 0x5fe40000, 0x62140000,
+			0x541c0000, 0x69ec0000, 0x2ffc0000, 0x120c0000, 0xa3dc0000, 0x9e2c0000,
+			0xd83c0000, 0xe5cc0000, 0x30ae0000, 0x0d5e0000, 0x4b4e0000, 0x76be0000,
+			0xc76e0000, 0xfa9e0000, 0xbc8e0000, 0x817e0000, 0x9d780000, 0xa0880000,
+			0xe6980000, 0xdb680000, 0x6ab80000, 0x57480000, 0x11580000, 0x2ca80000,
+			0xf9ca0000, 0xc43a0000, 0x822a0000, 0xbfda0000, 0x0e0a0000, 0x33fa0000,
+			0x75ea0000, 0x481a0000, 0x4de60000, 0x70160000, 0x36060000, 0x0bf60000,
+			0xba260000, 0x87d60000, 0xc1c60000, 0xfc360000, 0x29540000, 0x14a40000,
+			0x52b40000, 0x6f440000, 0xde940000, 0xe3640000, 0xa5740000, 0x98840000,
+			0x84820000, 0xb9720000, 0xff620000, 0xc2920000, 0x73420000, 0x4eb20000,
+			0x08a20000, 0x35520000, 0xe0300000, 0xddc00000, 0x9bd00000, 0xa6200000,
+			0x17f00000, 0x2a000000, 0x6c100000, 0x51e00000,
+		},
+		{
+			0x00000000, 0xcfd00000, 0x14920000, 0xdb420000, 0x29240000, 0xe6f40000,
+			0x3db60000, 0xf2660000, 0x52480000, 0x9d980000, 0x46da0000, 0x890a0000,
+			0x7b6c0000, 0xb4bc0000, 0x6ffe0000, 0xa02e0000, 0xa4900000, 0x6b400000,
+			0xb0020000, 0x7fd20000, 0x8db40000, 0x42640000, 0x99260000, 0x56f60000,
+			0xf6d80000, 0x39080000, 0xe24a0000, 0x2d9a0000, 0xdffc0000, 0x102c0000,
+			0xcb6e0000, 0x04be0000, 0xc2120000, 0x0dc20000, 0xd6800000, 0x19500000,
+			0xeb360000, 0x24e60000, 0xffa40000, 0x30740000, 0x905a0000, 0x5f8a0000,
+			0x84c80000, 0x4b180000, 0xb97e0000, 0x76ae0000, 0xadec0000, 0x623c0000,
+			0x66820000, 0xa9520000, 0x72100000, 0xbdc00000, 0x4fa60000, 0x80760000,
+			0x5b340000, 0x94e40000, 0x34ca0000, 0xfb1a0000, 0x20580000, 0xef880000,
+			0x1dee0000, 0xd23e0000, 0x097c0000, 0xc6ac0000, 0x0f160000, 0xc0c60000,
+			0x1b840000, 0xd4540000, 0x26320000, 0xe9e20000, 0x32a00000, 0xfd700000,
+			0x5d5e0000, 0x928e0000, 0x49cc0000, 0x861c0000, 0x747a0000, 0xbbaa0000,
+			0x60e80000, 0xaf380000, 0xab860000, 0x64560000, 0xbf140000, 0x70c40000,
+			0x82a20000, 0x4d720000, 0x96300000, 0x59e00000, 0xf9ce0000, 0x361e0000,
+			0xed5c0000, 0x228c0000, 0xd0ea0000, 0x1f3a0000, 0xc4780000, 0x0ba80000,
+			0xcd040000, 0x02d40000, 0xd9960000, 0x16460000, 0xe4200000, 0x2bf00000,
+			0xf0b20000, 0x3f620000, 0x9f4c0000, 0x509c0000, 0x8bde0000, 0x440e0000,
+			0xb6680000, 0x79b80000, 0xa2fa0000, 0x6d2a0000, 0x69940000, 0xa6440000,
+			0x7d060000, 0xb2d60000, 0x40b00000, 0x8f600000, 0x54220000, 0x9bf20000,
+			0x3bdc0000, 0xf40c0000, 0x2f4e0000, 0xe09e0000, 0x12f80000, 0xdd280000,
+			0x066a0000, 0xc9ba0000, 0x1e2c0000, 0xd1fc0000, 0x0abe0000, 0xc56e0000,
+			0x37080000, 0xf8d80000, 0x239a0000, 0xec4a0000, 0x4c640000, 0x83b40000,
+			0x58f60000, 0x97260000, 0x65400000, 0xaa900000, 0x71d20000, 0xbe020000,
+			0xbabc0000, 0x756c0000, 0xae2e0000, 0x61fe0000, 0x93980000, 0x5c480000,
+			0x870a0000, 0x48da0000, 0xe8f40000, 0x27240000, 0xfc660000, 0x33b60000,
+			0xc1d00000, 0x0e000000, 0xd5420000, 0x1a920000, 0xdc3e0000, 0x13ee0000,
+			0xc8ac0000, 0x077c0000, 0xf51a0000, 0x3aca0000, 0xe1880000, 0x2e580000,
+			0x8e760000, 0x41a60000, 0x9ae40000, 0x55340000, 0xa7520000, 0x68820000,
+			0xb3c00000, 0x7c100000, 0x78ae0000, 0xb77e0000, 0x6c3c0000, 0xa3ec0000,
+			0x518a0000, 0x9e5a0000, 0x45180000, 0x8ac80000, 0x2ae60000, 0xe5360000,
+			0x3e740000, 0xf1a40000, 0x03c20000, 0xcc120000, 0x17500000, 0xd8800000,
+			0x113a0000, 0xdeea0000, 0x05a80000, 0xca780000, 0x381e0000, 0xf7ce0000,
+			0x2c8c0000, 0xe35c0000, 0x43720000, 0x8ca20000, 0x57e00000, 0x98300000,
+			0x6a560000, 0xa5860000, 0x7ec40000, 0xb1140000, 0xb5aa0000, 0x7a7a0000,
+			0xa1380000, 0x6ee80000, 0x9c8e0000, 0x535e0000, 0x881c0000, 0x47cc0000,
+			0xe7e20000, 0x28320000, 0xf3700000, 0x3ca00000, 0xcec60000, 0x01160000,
+			0xda540000, 0x15840000, 0xd3280000, 0x1cf80000, 0xc7ba0000, 0x086a0000,
+			0xfa0c0000, 0x35dc0000, 0xee9e0000, 0x214e0000, 0x81600000, 0x4eb00000,
+			0x95f20000, 0x5a220000, 0xa8440000, 0x67940000, 0xbcd60000, 0x73060000,
+			0x77b80000, 0xb8680000, 0x632a0000, 0xacfa0000, 0x5e9c0000, 0x914c0000,
+			0x4a0e0000, 0x85de0000, 0x25f00000, 0xea200000, 0x31620000, 0xfeb20000,
+			0x0cd40000, 0xc3040000, 0x18460000, 0xd7960000,
+		},
+		{
+			0x00000000, 0x3c580000, 0x78b00000, 0x44e80000, 0xf1600000, 0xcd380000,
+			0x89d00000, 0xb5880000, 0x69f20000, 0x55aa0000, 0x11420000, 0x2d1a0000,
+			0x98920000, 0xa4ca0000, 0xe0220000, 0xdc7a0000, 0xd3e40000, 0xefbc0000,
+			0xab540000, 0x970c0000, 0x22840000, 0x1edc0000, 0x5a340000, 0x666c0000,
+			0xba160000, 0x864e0000, 0xc2a60000, 0xfefe0000, 0x4b760000, 0x772e0000,
+			0x33c60000, 0x0f9e0000, 0x2cfa0000, 0x10a20000, 0x544a0000, 0x68120000,
+			0xdd9a0000, 0xe1c20000, 0xa52a0000, 0x99720000, 0x45080000, 0x79500000,
+			0x3db80000, 0x01e00000, 0xb4680000, 0x88300000, 0xccd80000, 0xf0800000,
+			0xff1e0000, 0xc3460000, 0x87ae0000, 0xbbf60000, 0x0e7e0000, 0x32260000,
+			0x76ce0000, 0x4a960000, 0x96ec0000, 0xaab40000, 0xee5c0000, 0xd2040000,
+			0x678c0000, 0x5bd40000, 0x1f3c0000, 0x23640000, 0x59f40000, 0x65ac0000,
+			0x21440000, 0x1d1c0000, 0xa8940000, 0x94cc0000, 0xd0240000, 0xec7c0000,
+			0x30060000, 0x0c5e0000, 0x48b60000, 0x74ee0000, 0xc1660000, 0xfd3e0000,
+			0xb9d60000, 0x858e0000, 0x8a100000, 0xb6480000, 0xf2a00000, 0xcef80000,
+			0x7b700000, 0x47280000, 0x03c00000, 0x3f980000, 0xe3e20000, 0xdfba0000,
+			0x9b520000, 0xa70a0000, 0x12820000, 0x2eda0000, 0x6a320000, 0x566a0000,
+			0x750e0000, 0x49560000, 0x0dbe0000, 0x31e60000, 0x846e0000, 0xb8360000,
+			0xfcde0000, 0xc0860000, 0x1cfc0000, 0x20a40000, 0x644c0000, 0x58140000,
+			0xed9c0000, 0xd1c40000, 0x952c0000, 0xa9740000, 0xa6ea0000, 0x9ab20000,
+			0xde5a0000, 0xe2020000, 0x578a0000, 0x6bd20000, 0x2f3a0000, 0x13620000,
+			0xcf180000, 0xf3400000, 0xb7a80000, 0x8bf00000, 0x3e780000, 0x02200000,
+			0x46c80000, 0x7a900000, 0xb3e80000, 0x8fb00000, 0xcb580000, 0xf7000000,
+			0x42880000, 0x7ed00000, 0x3a380000, 0x06600000, 0xda1a0000, 0xe6420000,
+			0xa2aa0000, 0x9ef20000, 0x2b7a0000, 0x17220000, 0x53ca0000, 0x6f920000,
+			0x600c0000, 0x5c540000, 0x18bc0000, 0x24e40000, 0x916c0000, 0xad340000,
+			0xe9dc0000, 0xd5840000, 0x09fe0000, 0x35a60000, 0x714e0000, 0x4d160000,
+			0xf89e0000, 0xc4c60000, 0x802e0000, 0xbc760000, 0x9f120000, 0xa34a0000,
+			0xe7a20000, 0xdbfa0000, 0x6e720000, 0x522a0000, 0x16c20000, 0x2a9a0000,
+			0xf6e00000, 0xcab80000, 0x8e500000, 0xb2080000, 0x07800000, 0x3bd80000,
+			0x7f300000, 0x43680000, 0x4cf60000, 0x70ae0000, 0x34460000, 0x081e0000,
+			0xbd960000, 0x81ce0000, 0xc5260000, 0xf97e0000, 0x25040000, 0x195c0000,
+			0x5db40000, 0x61ec0000, 0xd4640000, 0xe83c0000, 0xacd40000, 0x908c0000,
+			0xea1c0000, 0xd6440000, 0x92ac0000, 0xaef40000, 0x1b7c0000, 0x27240000,
+			0x63cc0000, 0x5f940000, 0x83ee0000, 0xbfb60000, 0xfb5e0000, 0xc7060000,
+			0x728e0000, 0x4ed60000, 0x0a3e0000, 0x36660000, 0x39f80000, 0x05a00000,
+			0x41480000, 0x7d100000, 0xc8980000, 0xf4c00000, 0xb0280000, 0x8c700000,
+			0x500a0000, 0x6c520000, 0x28ba0000, 0x14e20000, 0xa16a0000, 0x9d320000,
+			0xd9da0000, 0xe5820000, 0xc6e60000, 0xfabe0000, 0xbe560000, 0x820e0000,
+			0x37860000, 0x0bde0000, 0x4f360000, 0x736e0000, 0xaf140000, 0x934c0000,
+			0xd7a40000, 0xebfc0000, 0x5e740000, 0x622c0000, 0x26c40000, 0x1a9c0000,
+			0x15020000, 0x295a0000, 0x6db20000, 0x51ea0000, 0xe4620000, 0xd83a0000,
+			0x9cd20000, 0xa08a0000, 0x7cf00000, 0x40a80000, 0x04400000, 0x38180000,
+			0x8d900000, 0xb1c80000, 0xf5200000, 0xc9780000,
+		},
+		{
+			0x00000000, 0xece20000, 0x52f60000, 0xbe140000, 0xa5ec0000, 0x490e0000,
+			0xf71a0000, 0x1bf80000, 0xc0ea0000, 0x2c080000, 0x921c0000, 0x7efe0000,
+			0x65060000, 0x89e40000, 0x37f00000, 0xdb120000, 0x0ae60000, 0xe6040000,
+			0x58100000, 0xb4f20000, 0xaf0a0000, 0x43e80000, 0xfdfc0000, 0x111e0000,
+			0xca0c0000, 0x26ee0000, 0x98fa0000, 0x74180000, 0x6fe00000, 0x83020000,
+			0x3d160000, 0xd1f40000, 0x15cc0000, 0xf92e0000, 0x473a0000, 0xabd80000,
+			0xb0200000, 0x5cc20000, 0xe2d60000, 0x0e340000, 0xd5260000, 0x39c40000,
+			0x87d00000, 0x6b320000, 0x70ca0000, 0x9c280000, 0x223c0000, 0xcede0000,
+			0x1f2a0000, 0xf3c80000, 0x4ddc0000, 0xa13e0000, 0xbac60000, 0x56240000,
+			0xe8300000, 0x04d20000, 0xdfc00000, 0x33220000, 0x8d360000, 0x61d40000,
+			0x7a2c0000, 0x96ce0000, 0x28da0000, 0xc4380000, 0x2b980000, 0xc77a0000,
+			0x796e0000, 0x958c0000, 0x8e740000, 0x62960000, 0xdc820000, 0x30600000,
+			0xeb720000, 0x07900000, 0xb9840000, 0x55660000, 0x4e9e0000, 0xa27c0000,
+			0x1c680000, 0xf08a0000, 0x217e0000, 0xcd9c0000, 0x73880000, 0x9f6a0000,
+			0x84920000, 0x68700000, 0xd6640000, 0x3a860000, 0xe1940000, 0x0d760000,
+			0xb3620000, 0x5f800000, 0x44780000, 0xa89a0000, 0x168e0000, 0xfa6c0000,
+			0x3e540000, 0xd2b60000, 0x6ca20000, 0x80400000, 0x9bb80000, 0x775a0000,
+			0xc94e0000, 0x25ac0000, 0xfebe0000, 0x125c0000, 0xac480000, 0x40aa0000,
+			0x5b520000, 0xb7b00000, 0x09a40000, 0xe5460000, 0x34b20000, 0xd8500000,
+			0x66440000, 0x8aa60000, 0x915e0000, 0x7dbc0000, 0xc3a80000, 0x2f4a0000,
+			0xf4580000, 0x18ba0000, 0xa6ae0000, 0x4a4c0000, 0x51b40000, 0xbd560000,
+			0x03420000, 0xefa00000, 0x57300000, 0xbbd20000, 0x05c60000, 0xe9240000,
+			0xf2dc0000, 0x1e3e0000, 0xa02a0000, 0x4cc80000, 0x97da0000, 0x7b380000,
+			0xc52c0000, 0x29ce0000, 0x32360000, 0xded40000, 0x60c00000, 0x8c220000,
+			0x5dd60000, 0xb1340000, 0x0f200000, 0xe3c20000, 0xf83a0000, 0x14d80000,
+			0xaacc0000, 0x462e0000, 0x9d3c0000, 0x71de0000, 0xcfca0000, 0x23280000,
+			0x38d00000, 0xd4320000, 0x6a260000, 0x86c40000, 0x42fc0000, 0xae1e0000,
+			0x100a0000, 0xfce80000, 0xe7100000, 0x0bf20000, 0xb5e60000, 0x59040000,
+			0x82160000, 0x6ef40000, 0xd0e00000, 0x3c020000, 0x27fa0000, 0xcb180000,
+			0x750c0000, 0x99ee0000, 0x481a0000, 0xa4f80000, 0x1aec0000, 0xf60e0000,
+			0xedf60000, 0x01140000, 0xbf000000, 0x53e20000, 0x88f00000, 0x64120000,
+			0xda060000, 0x36e40000, 0x2d1c0000, 0xc1fe0000, 0x7fea0000, 0x93080000,
+			0x7ca80000, 0x904a0000, 0x2e5e0000, 0xc2bc0000, 0xd9440000, 0x35a60000,
+			0x8bb20000, 0x67500000, 0xbc420000, 0x50a00000, 0xeeb40000, 0x02560000,
+			0x19ae0000, 0xf54c0000, 0x4b580000, 0xa7ba0000, 0x764e0000, 0x9aac0000,
+			0x24b80000, 0xc85a0000, 0xd3a20000, 0x3f400000, 0x81540000, 0x6db60000,
+			0xb6a40000, 0x5a460000, 0xe4520000, 0x08b00000, 0x13480000, 0xffaa0000,
+			0x41be0000, 0xad5c0000, 0x69640000, 0x85860000, 0x3b920000, 0xd7700000,
+			0xcc880000, 0x206a0000, 0x9e7e0000, 0x729c0000, 0xa98e0000, 0x456c0000,
+			0xfb780000, 0x179a0000, 0x0c620000, 0xe0800000, 0x5e940000, 0xb2760000,
+			0x63820000, 0x8f600000, 0x31740000, 0xdd960000, 0xc66e0000, 0x2a8c0000,
+			0x94980000, 0x787a0000, 0xa3680000, 0x4f8a0000, 0xf19e0000, 0x1d7c0000,
+			0x06840000, 0xea660000, 0x54720000, 0xb8900000,
+		},
+		{
+			0x00000000, 0xae600000, 0xd7f20000, 0x79920000, 0x24d60000, 0x8ab60000,
+			0xf3240000, 0x5d440000, 0x49ac0000, 0xe7cc0000, 0x9e5e0000, 0x303e0000,
+			0x6d7a0000, 0xc31a0000, 0xba880000, 0x14e80000, 0x93580000, 0x3d380000,
+			0x44aa0000, 0xeaca0000, 0xb78e0000, 0x19ee0000, 0x607c0000, 0xce1c0000,
+			0xdaf40000, 0x74940000, 0x0d060000, 0xa3660000, 0xfe220000, 0x50420000,
+			0x29d00000, 0x87b00000, 0xad820000, 0x03e20000, 0x7a700000, 0xd4100000,
+			0x89540000, 0x27340000, 0x5ea60000, 0xf0c60000, 0xe42e0000, 0x4a4e0000,
+			0x33dc0000, 0x9dbc0000, 0xc0f80000, 0x6e980000, 0x170a0000, 0xb96a0000,
+			0x3eda0000, 0x90ba0000, 0xe9280000, 0x47480000, 0x1a0c0000, 0xb46c0000,
+			0xcdfe0000, 0x639e0000, 0x77760000, 0xd9160000, 0xa0840000, 0x0ee40000,
+			0x53a00000, 0xfdc00000, 0x84520000, 0x2a320000, 0xd0360000, 0x7e560000,
+			0x07c40000, 0xa9a40000, 0xf4e00000, 0x5a800000, 0x23120000, 0x8d720000,
+			0x999a0000, 0x37fa0000, 0x4e680000, 0xe0080000, 0xbd4c0000, 0x132c0000,
+			0x6abe0000, 0xc4de0000, 0x436e0000, 0xed0e0000, 0x949c0000, 0x3afc0000,
+			0x67b80000, 0xc9d80000, 0xb04a0000, 0x1e2a0000, 0x0ac20000, 0xa4a20000,
+			0xdd300000, 0x73500000, 0x2e140000, 0x80740000, 0xf9e60000, 0x57860000,
+			0x7db40000, 0xd3d40000, 0xaa460000, 0x04260000, 0x59620000, 0xf7020000,
+			0x8e900000, 0x20f00000, 0x34180000, 0x9a780000, 0xe3ea0000, 0x4d8a0000,
+			0x10ce0000, 0xbeae0000, 0xc73c0000, 0x695c0000, 0xeeec0000, 0x408c0000,
+			0x391e0000, 0x977e0000, 0xca3a0000, 0x645a0000, 0x1dc80000, 0xb3a80000,
+			0xa7400000, 0x09200000, 0x70b20000, 0xded20000, 0x83960000, 0x2df60000,
+			0x54640000, 0xfa040000, 0x2b5e0000, 0x853e0000, 0xfcac0000, 0x52cc0000,
+			0x0f880000, 0xa1e80000, 0xd87a0000, 0x761a0000, 0x62f20000, 0xcc920000,
+			0xb5000000, 0x1b600000, 0x46240000, 0xe8440000, 0x91d60000, 0x3fb60000,
+			0xb8060000, 0x16660000, 0x6ff40000, 0xc1940000, 0x9cd00000, 0x32b00000,
+			0x4b220000, 0xe5420000, 0xf1aa0000, 0x5fca0000, 0x26580000, 0x88380000,
+			0xd57c0000, 0x7b1c0000, 0x028e0000, 0xacee0000, 0x86dc0000, 0x28bc0000,
+			0x512e0000, 0xff4e0000, 0xa20a0000, 0x0c6a0000, 0x75f80000, 0xdb980000,
+			0xcf700000, 0x61100000, 0x18820000, 0xb6e20000, 0xeba60000, 0x45c60000,
+			0x3c540000, 0x92340000, 0x15840000, 0xbbe40000, 0xc2760000, 0x6c160000,
+			0x31520000, 0x9f320000, 0xe6a00000, 0x48c00000, 0x5c280000, 0xf2480000,
+			0x8bda0000, 0x25ba0000, 0x78fe0000, 0xd69e0000, 0xaf0c0000, 0x016c0000,
+			0xfb680000, 0x55080000, 0x2c9a0000, 0x82fa0000, 0xdfbe0000, 0x71de0000,
+			0x084c0000, 0xa62c0000, 0xb2c40000, 0x1ca40000, 0x65360000, 0xcb560000,
+			0x96120000, 0x38720000, 0x41e00000, 0xef800000, 0x68300000, 0xc6500000,
+			0xbfc20000, 0x11a20000, 0x4ce60000, 0xe2860000, 0x9b140000, 0x35740000,
+			0x219c0000, 0x8ffc0000, 0xf66e0000, 0x580e0000, 0x054a0000, 0xab2a0000,
+			0xd2b80000, 0x7cd80000, 0x56ea0000, 0xf88a0000, 0x81180000, 0x2f780000,
+			0x723c0000, 0xdc5c0000, 0xa5ce0000, 0x0bae0000, 0x1f460000, 0xb1260000,
+			0xc8b40000, 0x66d40000, 0x3b900000, 0x95f00000, 0xec620000, 0x42020000,
+			0xc5b20000, 0x6bd20000, 0x12400000, 0xbc200000, 0xe1640000, 0x4f040000,
+			0x36960000, 0x98f60000, 0x8c1e0000, 0x227e0000, 0x5bec0000, 0xf58c0000,
+			0xa8c80000, 0x06a80000, 0x7f3a0000, 0xd15a0000,
+		},
+	},
+	{ /* CRC_PRESET_8_SMBUS */
+		{
+			0x00000000, 0x07000000, 0x0e000000, 0x09000000, 0x1c000000, 0x1b000000,
+			0x12000000, 0x15000000, 0x38000000, 0x3f000000, 0x36000000, 0x31000000,
+			0x24000000, 0x23000000, 0x2a000000, 0x2d000000, 0x70000000, 0x77000000,
+			0x7e000000, 0x79000000, 0x6c000000, 0x6b000000, 0x62000000, 0x65000000,
+			0x48000000, 0x4f000000, 0x46000000, 0x41000000, 0x54000000, 0x53000000,
+			0x5a000000, 0x5d000000, 0xe0000000, 0xe7000000, 0xee000000, 0xe9000000,
+			0xfc000000, 0xfb000000, 0xf2000000, 0xf5000000, 0xd8000000, 0xdf000000,
+			0xd6000000, 0xd1000000, 0xc4000000, 0xc3000000, 0xca000000, 0xcd000000,
+			0x90000000, 0x97000000, 0x9e000000, 0x99000000, 0x8c000000, 0x8b000000,
+			0x82000000, 0x85000000, 0xa8000000, 0xaf000000, 0xa6000000, 0xa1000000,
+			0xb4000000, 0xb3000000, 0xba000000, 0xbd000000, 0xc7000000, 0xc0000000,
+			0xc9000000, 0xce000000, 0xdb000000, 0xdc000000, 0xd5000000, 0xd2000000,
+			0xff000000, 0xf8000000, 0xf1000000, 0xf6000000, 0xe3000000, 0xe4000000,
+			0xed000000, 0xea000000, 0xb7000000, 0xb0000000, 0xb9000000, 0xbe000000,
+			0xab000000, 0xac000000, 0xa5000000, 0xa2000000, 0x8f000000, 0x88000000,
+			0x81000000, 0x86000000, 0x93000000, 0x94000000, 0x9d000000, 0x9a000000,
+			0x27000000, 0x20000000, 0x29000000, 0x2e000000, 0x3b000000, 0x3c000000,
+			0x35000000, 0x32000000, 0x1f000000, 0x18000000, 0x11000000, 0x16000000,
+			0x03000000, 0x04000000, 0x0d000000, 0x0a000000, 0x57000000, 0x50000000,
+			0x59000000, 0x5e000000, 0x4b000000, 0x4c000000, 0x45000000, 0x42000000,
+			0x6f000000, 0x68000000, 0x61000000, 0x66000000, 0x73000000, 0x74000000,
+			0x7d000000, 0x7a000000, 0x89000000, 0x8e000000, 0x87000000, 0x80000000,
+			0x95000000, 0x92000000, 0x9b000000, 0x9c000000, 0xb1000000, 0xb6000000,
+			0xbf000000, 0xb8000000, 0xad000000, 0xaa000000, 0xa3000000, 0xa4000000,
+			0xf9000000, 0xfe000000, 0xf7000000, 0xf0000000, 0xe5000000, 0xe2000000,
+			0xeb000000, 0xec000000, 0xc1000000, 0xc6000000, 0xcf000000, 0xc8000000,
+			0xdd000000, 0xda000000, 0xd3000000, 0xd4000000, 0x69000000, 0x6e000000,
+			0x67000000, 0x60000000, 0x75000000, 0x72000000, 0x7b000000, 0x7c000000,
+			0x51000000, 0x56000000, 0x5f000000, 0x58000000, 0x4d000000, 0x4a000000,
+			0x43000000, 0x44000000, 0x19000000, 0x1e000000, 0x17000000, 0x10000000,
+			0x05000000, 0x02000000, 0x0b000000, 0x0c000000, 0x21000000, 0x26000000,
+			0x2f000000, 0x28000000, 0x3d000000, 0x3a000000, 0x33000000, 0x34000000,
+			0x4e000000, 0x49000000, 0x40000000, 0x47000000, 0x52000000, 0x55000000,
+			0x5c000000, 0x5b000000, 0x76000000, 0x71000000, 0x78000000, 0x7f000000,
+			0x6a000000, 0x6d000000, 0x64000000, 0x63000000, 0x3e000000, 0x39000000,
+			0x30000000, 0x37000000, 0x22000000, 0x25000000, 0x2c000000, 0x2b000000,
+			0x06000000, 0x01000000, 0x08000000, 0x0f000000, 0x1a000000, 0x1d000000,
+			0x14000000, 0x13000000, 0xae000000, 0xa9000000, 0xa0000000, 0xa7000000,
+			0xb2000000, 0xb5000000, 0xbc000000, 0xbb000000, 0x96000000, 0x91000000,
+			0x98000000, 0x9f000000, 0x8a000000, 0x8d000000, 0x84000000, 0x83000000,
+			0xde000000, 0xd9000000, 0xd0000000, 0xd7000000, 0xc2000000, 0xc5000000,
+			0xcc000000, 0xcb000000, 0xe6000000, 0xe1000000, 0xe8000000, 0xef000000,
+			0xfa000000, 0xfd000000, 0xf4000000, 0xf3000000,
+		},
+		{
+			0x00000000, 0x15000000, 0x2a000000, 0x3f000000, 0x54000000, 0x41000000,
+			0x7e000000, 0x6b000000, 0xa8000000, 0xbd000000, 0x82000000, 0x97000000,
+			0xfc000000, 0xe9000000, 0xd6000000, 0xc3000000, 0x57000000, 0x42000000,
+			0x7d000000, 0x68000000, 0x03000000, 0x16000000, 0x29000000, 0x3c000000,
+			0xff000000, 0xea000000, 0xd5000000, 0xc0000000, 0xab000000, 0xbe000000,
+			0x81000000, 0x94000000, 0xae000000, 0xbb000000, 0x84000000, 0x91000000,
+			0xfa000000, 0xef000000, 0xd0000000, 0xc5000000, 0x06000000, 0x13000000,
+			0x2c000000, 0x39000000, 0x52000000, 0x47000000, 0x78000000, 0x6d000000,
+			0xf9000000, 0xec000000, 0xd3000000, 0xc6000000, 0xad000000, 0xb8000000,
+			0x87000000, 0x92000000, 0x51000000, 0x44000000, 0x7b000000, 0x6e000000,
+			0x05000000, 0x10000000, 0x2f000000, 0x3a000000, 0x5b000000, 0x4e000000,
+			0x71000000, 0x64000000, 0x0f000000, 0x1a000000, 0x25000000, 0x30000000,
+			0xf3000000, 0xe6000000, 0xd9000000, 0xcc000000, 0xa7000000, 0xb2000000,
+			0x8d000000, 0x98000000, 0x0c000000, 0x19000000, 0x26000000, 0x33000000,
+			0x58000000, 0x4d000000, 0x72000000, 0x67000000, 0xa4000000, 0xb1000000,
+			0x8e000000, 0x9b000000, 0xf0000000, 0xe5000000, 0xda000000, 0xcf000000,
+			0xf5000000, 0xe0000000, 0xdf000000, 0xca000000, 0xa1000000, 0xb4000000,
+			0x8b000000, 0x9e000000, 0x5d000000, 0x48000000, 0x77000000, 0x62000000,
+			0x09000000, 0x1c000000, 0x23000000, 0x36000000, 0xa2000000, 0xb7000000,
+			0x88000000, 0x9d000000, 0xf6000000, 0xe3000000, 0xdc000000, 0xc9000000,
+			0x0a000000, 0x1f000000, 0x20000000, 0x35000000, 0x5e000000, 0x4b000000,
+			0x74000000, 0x61000000, 0xb6000000, 0xa3000000, 0x9c000000, 0x89000000,
+			0xe2000000, 0xf7000000, 0xc8000000, 0xdd000000, 0x1e000000, 0x0b000000,
+			0x34000000, 0x21000000, 0x4a000000, 0x5f000000, 0x60000000, 0x75000000,
+			0xe1000000, 0xf4000000, 0xcb000000, 0xde000000, 0xb5000000, 0xa0000000,
+			0x9f000000, 0x8a000000, 0x49000000, 0x5c000000, 0x63000000, 0x76000000,
+			0x1d000000, 0x08000000, 0x37000000, 0x22000000, 0x18000000, 0x0d000000,
+			0x32000000, 0x27000000, 0x4c000000, 0x59000000, 0x66000000, 0x73000000,
+			0xb0000000, 0xa5000000, 0x9a000000, 0x8f000000, 0xe4000000, 0xf1000000,
+			0xce000000, 0xdb000000, 0x4f000000, 0x5a000000, 0x65000000, 0x70000000,
+			0x1b000000, 0x0e000000, 0x31000000, 0x24000000, 0xe7000000, 0xf2000000,
+			0xcd000000, 0xd8000000, 0xb3000000, 0xa6000000, 0x99000000, 0x8c000000,
+			0xed000000, 0xf8000000, 0xc7000000, 0xd2000000, 0xb9000000, 0xac000000,
+			0x93000000, 0x86000000, 0x45000000, 0x50000000, 0x6f000000, 0x7a000000,
+			0x11000000, 0x04000000, 0x3b000000, 0x2e000000, 0xba000000, 0xaf000000,
+			0x90000000, 0x85000000, 0xee000000, 0xfb000000, 0xc4000000, 0xd1000000,
+			0x12000000, 0x07000000, 0x38000000, 0x2d000000, 0x46000000, 0x53000000,
+			0x6c000000, 0x79000000, 0x43000000, 0x56000000, 0x69000000, 0x7c000000,
+			0x17000000, 0x02000000, 0x3d000000, 0x28000000, 0xeb000000, 0xfe000000,
+			0xc1000000, 0xd4000000, 0xbf000000, 0xaa000000, 0x95000000, 0x80000000,
+			0x14000000, 0x01000000, 0x3e000000, 0x2b000000, 0x40000000, 0x55000000,
+			0x6a000000, 0x7f000000, 0xbc000000, 0xa9000000, 0x96000000, 0x83000000,
+			0xe8000000, 0xfd000000, 0xc2000000, 0xd7000000,
+		},
+		{
+			0x00000000, 0x6b000000, 0xd6000000, 0xbd000000, 0xab000000, 0xc0000000,
+			0x7d000000, 0x16000000, 0x51000000, 0x3a000000, 0x87000000, 0xec000000,
+			0xfa000000, 0x91000000, 0x2c000000, 0x47000000, 0xa2000000, 0xc9000000,
+			0x74000000, 0x1f000000, 0x09000000, 0x62000000, 0xdf000000, 0xb4000000,
+			0xf3000000, 0x98000000, 0x25000000, 0x4e000000, 0x58000000, 0x33000000,
+			0x8e000000, 0xe5000000, 0x43000000, 0x28000000, 0x95000000, 0xfe000000,
+			0xe8000000, 0x83000000, 0x3e000000, 0x55000000, 0x12000000, 0x79000000,
+			0xc4000000, 0xaf000000, 0xb9000000, 0xd2000000, 0x6f000000, 0x04000000,
+			0xe1000000, 0x8a000000, 0x37000000, 0x5c000000, 0x4a000000, 0x21000000,
+			0x9c000000, 0xf7000000, 0xb0000000, 0xdb000000, 0x66000000, 0x0d000000,
+			0x1b000000, 0x70000000, 0xcd000000, 0xa6000000, 0x86000000, 0xed000000,
+			0x50000000, 0x3b000000, 0x2d000000, 0x46000000, 0xfb000000, 0x90000000,
+			0xd7000000, 0xbc000000, 0x01000000, 0x6a000000, 0x7c000000, 0x17000000,
+			0xaa000000, 0xc1000000, 0x24000000, 0x4f000000, 0xf2000000, 0x99000000,
+			0x8f000000, 0xe4000000, 0x59000000, 0x32000000, 0x75000000, 0x1e000000,
+			0xa3000000, 0xc8000000, 0xde000000, 0xb5000000, 0x08000000, 0x63000000,
+			0xc5000000, 0xae000000, 0x13000000, 0x78000000, 0x6e000000, 0x05000000,
+			0xb8000000, 0xd3000000, 0x94000000, 0xff000000, 0x42000000, 0x29000000,
+			0x3f000000, 0x54000000, 0xe9000000, 0x82000000, 0x67000000, 0x0c000000,
+			0xb1000000, 0xda000000, 0xcc000000, 0xa7000000, 0x1a000000, 0x71000000,
+			0x36000000, 0x5d000000, 0xe0000000, 0x8b000000, 0x9d000000, 0xf6000000,
+			0x4b000000, 0x20000000, 0x0b000000, 0x60000000, 0xdd000000, 0xb6000000,
+			0xa0000000, 0xcb000000, 0x76000000, 0x1d000000, 0x5a000000, 0x31000000,
+			0x8c000000, 0xe7000000, 0xf1000000, 0x9a000000, 0x27000000, 0x4c000000,
+			0xa9000000, 0xc2000000, 0x7f000000, 0x14000000, 0x02000000, 0x69000000,
+			0xd4000000, 0xbf000000, 0xf8000000, 0x93000000, 0x2e000000, 0x45000000,
+			0x53000000, 0x38000000, 0x85000000, 0xee000000, 0x48000000, 0x23000000,
+			0x9e000000, 0xf5000000, 0xe3000000, 0x88000000, 0x35000000, 0x5e000000,
+			0x19000000, 0x72000000, 0xcf000000, 0xa4000000, 0xb2000000, 0xd9000000,
+			0x64000000, 0x0f000000, 0xea000000, 0x81000000, 0x3c000000, 0x57000000,
+			0x41000000, 0x2a000000, 0x97000000, 0xfc000000, 0xbb000000, 0xd0000000,
+			0x6d000000, 0x06000000, 0x10000000, 0x7b000000, 0xc6000000, 0xad000000,
+			0x8d000000, 0xe6000000, 0x5b000000, 0x30000000, 0x26000000, 0x4d000000,
+			0xf0000000, 0x9b000000, 0xdc000000, 0xb7000000, 0x0a000000, 0x61000000,
+			0x77000000, 0x1c000000, 0xa1000000, 0xca000000, 0x2f000000, 0x44000000,
+			0xf9000000, 0x92000000, 0x84000000, 0xef000000, 0x52000000, 0x39000000,
+			0x7e000000, 0x15000000, 0xa8000000, 0xc3000000, 0xd5000000, 0xbe000000,
+			0x03000000, 0x68000000, 0xce000000, 0xa5000000, 0x18000000, 0x73000000,
+			0x65000000, 0x0e000000, 0xb3000000, 0xd8000000, 0x9f000000, 0xf4000000,
+			0x49000000, 0x22000000, 0x34000000, 0x5f000000, 0xe2000000, 0x89000000,
+			0x6c000000, 0x07000000, 0xba000000, 0xd1000000, 0xc7000000, 0xac000000,
+			0x11000000, 0x7a000000, 0x3d000000, 0x56000000, 0xeb000000, 0x80000000,
+			0x96000000, 0xfd000000, 0x40000000, 0x2b000000,
+		},
+		{
+			0x00000000, 0x16000000, 0x2c000000, 0x3a000000, 0x58000000, 0x4e000000,
+			0x74000000, 0x62000000, 0xb0000000, 0xa6000000, 0x9c000000, 0x8a000000,
+			0xe8000000, 0xfe000000, 0xc4000000, 0xd2000000, 0x67000000, 0x71000000,
+			0x4b000000, 0x5d000000, 0x3f000000, 0x29000000, 0x13000000, 0x05000000,
+			0xd7000000, 0xc1000000, 0xfb000000, 0xed000000, 0x8f000000, 0x99000000,
+			0xa3000000, 0xb5000000, 0xce000000, 0xd8000000, 0xe2000000, 0xf4000000,
+			0x96000000, 0x80000000, 0xba000000, 0xac000000, 0x7e000000, 0x68000000,
+			0x52000000, 0x44000000, 0x26000000, 0x30000000, 0x0a000000, 0x1c000000,
+			0xa9000000, 0xbf000000, 0x85000000, 0x93000000, 0xf1000000, 0xe7000000,
+			0xdd000000, 0xcb000000, 0x19000000, 0x0f000000, 0x35000000, 0x23000000,
+			0x41000000, 0x57000000, 0x6d000000, 0x7b000000, 0x9b000000, 0x8d000000,
+			0xb7000000, 0xa1000000, 0xc3000000, 0xd5000000, 0xef000000, 0xf9000000,
+			0x2b000000, 0x3d000000, 0x07000000, 0x11000000, 0x73000000, 0x65000000,
+			0x5f000000, 0x49000000, 0xfc000000, 0xea000000, 0xd0000000, 0xc6000000,
+			0xa4000000, 0xb2000000, 0x88000000, 0x9e000000, 0x4c000000, 0x5a000000,
+			0x60000000, 0x76000000, 0x14000000, 0x02000000, 0x38000000, 0x2e000000,
+			0x55000000, 0x43000000, 0x79000000, 0x6f000000, 0x0d000000, 0x1b000000,
+			0x21000000, 0x37000000, 0xe5000000, 0xf3000000, 0xc9000000, 0xdf000000,
+			0xbd000000, 0xab000000, 0x91000000, 0x87000000, 0x32000000, 0x24000000,
+			0x1e000000, 0x08000000, 0x6a000000, 0x7c000000, 0x46000000, 0x50000000,
+			0x82000000, 0x94000000, 0xae000000, 0xb8000000, 0xda000000, 0xcc000000,
+			0xf6000000, 0xe0000000, 0x31000000, 0x27000000, 0x1d000000, 0x0b000000,
+			0x69000000, 0x7f000000, 0x45000000, 0x53000000, 0x81000000, 0x97000000,
+			0xad000000, 0xbb000000, 0xd9000000, 0xcf000000, 0xf5000000, 0xe3000000,
+			0x56000000, 0x40000000, 0x7a000000, 0x6c000000, 0x0e000000, 0x18000000,
+			0x22000000, 0x34000000, 0xe6000000, 0xf0000000, 0xca000000, 0xdc000000,
+			0xbe000000, 0xa8000000, 0x92000000, 0x84000000, 0xff000000, 0xe9000000,
+			0xd3000000, 0xc5000000, 0xa7000000, 0xb1000000, 0x8b000000, 0x9d000000,
+			0x4f000000, 0x59000000, 0x63000000, 0x75000000, 0x17000000, 0x01000000,
+			0x3b000000, 0x2d000000, 0x98000000, 0x8e000000, 0xb4000000, 0xa2000000,
+			0xc0000000, 0xd6000000, 0xec000000, 0xfa000000, 0x28000000, 0x3e000000,
+			0x04000000, 0x12000000, 0x70000000, 0x66000000, 0x5c000000, 0x4a000000,
+			0xaa000000, 0xbc000000, 0x86000000, 0x90000000, 0xf2000000, 0xe4000000,
+			0xde000000, 0xc8000000, 0x1a000000, 0x0c000000, 0x36000000, 0x20000000,
+			0x42000000, 0x54000000, 0x6e000000, 0x78000000, 0xcd000000, 0xdb000000,
+			0xe1000000, 0xf7000000, 0x95000000, 0x83000000, 0xb9000000, 0xaf000000,
+			0x7d000000, 0x6b000000, 0x51000000, 0x47000000, 0x25000000, 0x33000000,
+			0x09000000, 0x1f000000, 0x64000000, 0x72000000, 0x48000000, 0x5e000000,
+			0x3c000000, 0x2a000000, 0x10000000, 0x06000000, 0xd4000000, 0xc2000000,
+			0xf8000000, 0xee000000, 0x8c000000, 0x9a000000, 0xa0000000, 0xb6000000,
+			0x03000000, 0x15000000, 0x2f000000, 0x39000000, 0x5b000000, 0x4d000000,
+			0x77000000, 0x61000000, 0xb3000000, 0xa5000000, 0x9f000000, 0x89000000,
+			0xeb000000, 0xfd000000, 0xc7000000, 0xd1000000,
+		},
+		{
+			0x00000000, 0x62000000, 0xc4000000, 0xa6000000, 0x8f000000, 0xed000000,
+			0x4b000000, 0x29000000, 0x19000000, 0x7b000000, 0xdd000000, 0xbf000000,
+			0x96000000, 0xf4000000, 0x52000000, 0x30000000, 0x32000000, 0x50000000,
+			0xf6000000, 0x94000000, 0xbd000000, 0xdf000000, 0x79000000, 0x1b000000,
+			0x2b000000, 0x49000000, 0xef000000, 0x8d000000, 0xa4000000, 0xc6000000,
+			0x60000000, 0x02000000, 0x64000000, 0x06000000, 0xa0000000, 0xc2000000,
+			0xeb000000, 0x89000000, 0x2f000000, 0x4d000000, 0x7d000000, 0x1f000000,
+			0xb9000000, 0xdb000000, 0xf2000000, 0x90000000, 0x36000000, 0x54000000,
+			0x56000000, 0x34000000, 0x92000000, 0xf0000000, 0xd9000000, 0xbb000000,
+			0x1d000000, 0x7f000000, 0x4f000000, 0x2d000000, 0x8b000000, 0xe9000000,
+			0xc0000000, 0xa2000000, 0x04000000, 0x66000000, 0xc8000000, 0xaa000000,
+			0x0c000000, 0x6e000000, 0x47000000, 0x25000000, 0x83000000, 0xe1000000,
+			0xd1000000, 0xb3000000, 0x15000000, 0x77000000, 0x5e000000, 0x3c000000,
+			0x9a000000, 0xf8000000, 0xfa000000, 0x98000000, 0x3e000000, 0x5c000000,
+			0x75000000, 0x17000000, 0xb1000000, 0xd3000000, 0xe3000000, 0x81000000,
+			0x27000000, 0x45000000, 0x6c000000, 0x0e000000, 0xa8000000, 0xca000000,
+			0xac000000, 0xce000000, 0x68000000, 0x0a000000, 0x23000000, 0x41000000,
+			0xe7000000, 0x85000000, 0xb5000000, 0xd7000000, 0x71000000, 0x13000000,
+			0x3a000000, 0x58000000, 0xfe000000, 0x9c000000, 0x9e000000, 0xfc000000,
+			0x5a000000, 0x38000000, 0x11000000, 0x73000000, 0xd5000000, 0xb7000000,
+			0x87000000, 0xe5000000, 0x43000000, 0x21000000, 0x08000000, 0x6a000000,
+			0xcc000000, 0xae000000, 0x97000000, 0xf5000000, 0x53000000, 0x31000000,
+			0x18000000, 0x7a000000, 0xdc000000, 0xbe000000, 0x8e000000, 0xec000000,
+			0x4a000000, 0x28000000, 0x01000000, 0x63000000, 0xc5000000, 0xa7000000,
+			0xa5000000, 0xc7000000, 0x61000000, 0x03000000, 0x2a000000, 0x48000000,
+			0xee000000, 0x8c000000, 0xbc000000, 0xde000000, 0x78000000, 0x1a000000,
+			0x33000000, 0x51000000, 0xf7000000, 0x95000000, 0xf3000000, 0x91000000,
+			0x37000000, 0x55000000, 0x7c000000, 0x1e000000, 0xb8000000, 0xda000000,
+			0xea000000, 0x88000000, 0x2e000000, 0x4c000000, 0x65000000, 0x07000000,
+			0xa1000000, 0xc3000000, 0xc1000000, 0xa3000000, 0x05000000, 0x67000000,
+			0x4e000000, 0x2c000000, 0x8a000000, 0xe8000000, 0xd8000000, 0xba000000,
+			0x1c000000, 0x7e000000, 0x57000000, 0x35000000, 0x93000000, 0xf1000000,
+			0x5f000000, 0x3d000000, 0x9b000000, 0xf9000000, 0xd0000000, 0xb2000000,
+			0x14000000, 0x76000000, 0x46000000, 0x24000000, 0x82000000, 0xe0000000,
+			0xc9000000, 0xab000000, 0x0d000000, 0x6f000000, 0x6d000000, 0x0f000000,
+			0xa9000000, 0xcb000000, 0xe2000000, 0x80000000, 0x26000000, 0x44000000,
+			0x74000000, 0x16000000, 0xb0000000, 0xd2000000, 0xfb000000, 0x99000000,
+			0x3f000000, 0x5d000000, 0x3b000000, 0x59000000, 0xff000000, 0x9d000000,
+			0xb4000000, 0xd6000000, 0x70000000, 0x12000000, 0x22000000, 0x40000000,
+			0xe6000000, 0x84000000, 0xad000000, 0xcf000000, 0x69000000, 0x0b000000,
+			0x09000000, 0x6b000000, 0xcd000000, 0xaf000000, 0x86000000, 0xe4000000,
+			0x42000000, 0x20000000, 0x10000000, 0x72000000, 0xd4000000, 0xb6000000,
+			0x9f000000, 0xfd000000, 0x5b000000, 0x39000000,
+		},
+		{
+			0x00000000, 0x29000000, 0x52000000, 0x7b000000, 0xa4000000, 0x8d000000,
+			0xf6000000, 0xdf000000, 0x4f000000, 0x66000000, 0x1d000000, 0x34000000,
+			0xeb000000, 0xc2000000, 0xb9000000, 0x90000000, 0x9e000000, 0xb7000000,
+			0xcc000000, 0xe5000000, 0x3a000000, 0x13000000, 0x68000000, 0x41000000,
+			0xd1000000, 0xf8000000, 0x83000000, 0xaa000000, 0x75000000, 0x5c000000,
+			0x27000000, 0x0e000000, 0x3b000000, 0x12000000, 0x69000000, 0x40000000,
+			0x9f000000, 0xb6000000, 0xcd000000, 0xe4000000, 0x74000000, 0x5d000000,
+			0x26000000, 0x0f000000, 0xd0000000, 0xf9000000, 0x82000000, 0xab000000,
+			0xa5000000, 0x8c000000, 0xf7000000, 0xde000000, 0x01000000, 0x28000000,
+			0x53000000, 0x7a000000, 0xea000000, 0xc3000000, 0xb8000000, 0x91000000,
+			0x4e000000, 0x67000000, 0x1c000000, 0x35000000, 0x76000000, 0x5f000000,
+			0x24000000, 0x0d000000, 0xd2000000, 0xfb000000, 0x80000000, 0xa9000000,
+			0x39000000, 0x10000000, 0x6b000000, 0x42000000, 0x9d000000, 0xb4000000,
+			0xcf000000, 0xe6000000, 0xe8000000, 0xc1000000, 0xba000000, 0x93000000,
+			0x4c000000, 0x65000000, 0x1e000000, 0x37000000, 0xa7000000, 0x8e000000,
+			0xf5000000, 0xdc000000, 0x03000000, 0x2a000000, 0x51000000, 0x78000000,
+			0x4d000000, 0x64000000, 0x1f000000, 0x36000000, 0xe9000000, 0xc0000000,
+			0xbb000000, 0x92000000, 0x02000000, 0x2b000000, 0x50000000, 0x79000000,
+			0xa6000000, 0x8f000000, 0xf4000000, 0xdd000000, 0xd3000000, 0xfa000000,
+			0x81000000, 0xa8000000, 0x77000000, 0x5e000000, 0x25000000, 0x0c000000,
+			0x9c000000, 0xb5000000, 0xce000000, 0xe7000000, 0x38000000, 0x11000000,
+			0x6a000000, 0x43000000, 0xec000000, 0xc5000000, 0xbe000000, 0x97000000,
+			0x48000000, 0x61000000, 0x1a000000, 0x33000000, 0xa3000000, 0x8a000000,
+			0xf1000000, 0xd8000000, 0x07000000, 0x2e000000, 0x55000000, 0x7c000000,
+			0x72000000, 0x5b000000, 0x20000000, 0x09000000, 0xd6000000, 0xff000000,
+			0x84000000, 0xad000000, 0x3d000000, 0x14000000, 0x6f000000, 0x46000000,
+			0x99000000, 0xb0000000, 0xcb000000, 0xe2000000, 0xd7000000, 0xfe000000,
+			0x85000000, 0xac000000, 0x73000000, 0x5a000000, 0x21000000, 0x08000000,
+			0x98000000, 0xb1000000, 0xca000000, 0xe3000000, 0x3c000000, 0x15000000,
+			0x6e000000, 0x47000000, 0x49000000, 0x60000000, 0x1b000000, 0x32000000,
+			0xed000000, 0xc4000000, 0xbf000000, 0x96000000, 0x06000000, 0x2f000000,
+			0x54000000, 0x7d000000, 0xa2000000, 0x8b000000, 0xf0000000, 0xd9000000,
+			0x9a000000, 0xb3000000, 0xc8000000, 0xe1000000, 0x3e000000, 0x17000000,
+			0x6c000000, 0x45000000, 0xd5000000, 0xfc000000, 0x87000000, 0xae000000,
+			0x71000000, 0x58000000, 0x23000000, 0x0a000000, 0x04000000, 0x2d000000,
+			0x56000000, 0x7f000000, 0xa0000000, 0x89000000, 0xf2000000, 0xdb000000,
+			0x4b000000, 0x62000000, 0x19000000, 0x30000000, 0xef000000, 0xc6000000,
+			0xbd000000, 0x94000000, 0xa1000000, 0x88000000, 0xf3000000, 0xda000000,
+			0x05000000, 0x2c000000, 0x57000000, 0x7e000000, 0xee000000, 0xc7000000,
+			0xbc000000, 0x95000000, 0x4a000000, 0x63000000, 0x18000000, 0x31000000,
+			0x3f000000, 0x16000000, 0x6d000000, 0x44000000, 0x9b000000, 0xb2000000,
+			0xc9000000, 0xe0000000, 0x70000000, 0x59000000, 0x22000000, 0x0b000000,
+			0xd4000000, 0xfd000000, 0x86000000, 0xaf000000,
+		},
+		{
+			0x00000000, 0xdf000000, 0xb9000000, 0x66000000, 0x75000000, 0xaa000000,
+			0xcc000000, 0x13000000, 0xea000000, 0x35000000, 0x53000000, 0x8c000000,
+			0x9f000000, 0x40000000, 0x26000000, 0xf9000000, 0xd3000000, 0x0c000000,
+			0x6a000000, 0xb5000000, 0xa6000000, 0x79000000, 0x1f000000, 0xc0000000,
+			0x39000000, 0xe6000000, 0x80000000, 0x5f000000, 0x4c000000, 0x93000000,
+			0xf5000000, 0x2a000000, 0xa1000000, 0x7e000000, 0x18000000, 0xc7000000,
+			0xd4000000, 0x0b000000, 0x6d000000, 0xb2000000, 0x4b000000, 0x94000000,
+			0xf2000000, 0x2d000000, 0x3e000000, 0xe1000000, 0x87000000, 0x58000000,
+			0x72000000, 0xad000000, 0xcb000000, 0x14000000, 0x07000000, 0xd8000000,
+			0xbe000000, 0x61000000, 0x98000000, 0x47000000, 0x21000000, 0xfe000000,
+			0xed000000, 0x32000000, 0x54000000, 0x8b000000, 0x45000000, 0x9a000000,
+			0xfc000000, 0x23000000, 0x30000000, 0xef000000, 0x89000000, 0x56000000,
+			0xaf000000, 0x70000000, 0x16000000, 0xc9000000, 0xda000000, 0x05000000,
+			0x63000000, 0xbc000000, 0x96000000, 0x49000000, 0x2f000000, 0xf0000000,
+			0xe3000000, 0x3c000000, 0x5a000000, 0x85000000, 0x7c000000, 0xa3000000,
+			0xc5000000, 0x1a000000, 0x09000000, 0xd6000000, 0xb0000000, 0x6f000000,
+			0xe4000000, 0x3b000000, 0x5d000000, 0x82000000, 0x91000000, 0x4e000000,
+			0x28000000, 0xf7000000, 0x0e000000, 0xd1000000, 0xb7000000, 0x68000000,
+			0x7b000000, 0xa4000000, 0xc2000000, 0x1d000000, 0x37000000, 0xe8000000,
+			0x8e000000, 0x51000000, 0x42000000, 0x9d000000, 0xfb000000, 0x24000000,
+			0xdd000000, 0x02000000, 0x64000000, 0xbb000000, 0xa8000000, 0x77000000,
+			0x11000000, 0xce000000, 0x8a000000, 0x55000000, 0x33000000, 0xec000000,
+			0xff000000, 0x20000000, 0x46000000, 0x99000000, 0x60000000, 0xbf000000,
+			0xd9000000, 0x06000000, 0x15000000, 0xca000000, 0xac000000, 0x73000000,
+			0x59000000, 0x86000000, 0xe0000000, 0x3f000000, 0x2c000000, 0xf3000000,
+			0x95000000, 0x4a000000, 0xb3000000, 0x6c000000, 0x0a000000, 0xd5000000,
+			0xc6000000, 0x19000000, 0x7f000000, 0xa0000000, 0x2b000000, 0xf4000000,
+			0x92000000, 0x4d000000, 0x5e000000, 0x81000000, 0xe7000000, 0x38000000,
+			0xc1000000, 0x1e000000, 0x78000000, 0xa7000000, 0xb4000000, 0x6b000000,
+			0x0d000000, 0xd2000000, 0xf8000000, 0x27000000, 0x41000000, 0x9e000000,
+			0x8d000000, 0x52000000, 0x34000000, 0xeb000000, 0x12000000, 0xcd000000,
+			0xab000000, 0x74000000, 0x67000000, 0xb8000000, 0xde000000, 0x01000000,
+			0xcf000000, 0x10000000, 0x76000000, 0xa9000000, 0xba000000, 0x65000000,
+			0x03000000, 0xdc000000, 0x25000000, 0xfa000000, 0x9c000000, 0x43000000,
+			0x50000000, 0x8f000000, 0xe9000000, 0x36000000, 0x1c000000, 0xc3000000,
+			0xa5000000, 0x7a000000, 0x69000000, 0xb6000000, 0xd0000000, 0x0f000000,
+			0xf6000000, 0x29000000, 0x4f000000, 0x90000000, 0x83000000, 0x5c000000,
+			0x3a000000, 0xe5000000, 0x6e000000, 0xb1000000, 0xd7000000, 0x08000000,
+			0x1b000000, 0xc4000000, 0xa2000000, 0x7d000000, 0x84000000, 0x5b000000,
+			0x3d000000, 0xe2000000, 0xf1000000, 0x2e000000, 0x48000000, 0x97000000,
+			0xbd000000, 0x62000000, 0x04000000, 0xdb000000, 0xc8000000, 0x17000000,
+			0x71000000, 0xae000000, 0x57000000, 0x88000000, 0xee000000, 0x31000000,
+			0x22000000, 0xfd000000, 0x9b000000, 0x44000000,
+		},
+		{
+			0x00000000, 0x13000000, 0x26000000, 0x35000000, 0x4c000000, 0x5f000000,
+			0x6a000000, 0x79000000, 0x98000000, 0x8b000000, 0xbe000000, 0xad000000,
+			0xd4000000, 0xc7000000, 0xf2000000, 0xe1000000, 0x37000000, 0x24000000,
+			0x11000000, 0x02000000, 0x7b000000, 0x68000000, 0x5d000000, 0x4e000000,
+			0xaf000000, 0xbc000000, 0x89000000, 0x9a000000, 0xe3000000, 0xf0000000,
+			0xc5000000, 0xd6000000, 0x6e000000, 0x7d000000, 0x48000000, 0x5b000000,
+			0x22000000, 0x31000000, 0x04000000, 0x17000000, 0xf6000000, 0xe5000000,
+			0xd0000000, 0xc3000000, 0xba000000, 0xa9000000, 0x9c000000, 0x8f000000,
+			0x59000000, 0x4a000000, 0x7f000000, 0x6c000000, 0x15000000, 0x06000000,
+			0x33000000, 0x20000000, 0xc1000000, 0xd2000000, 0xe7000000, 0xf4000000,
+			0x8d000000, 0x9e000000, 0xab000000, 0xb8000000, 0xdc000000, 0xcf000000,
+			0xfa000000, 0xe9000000, 0x90000000, 0x83000000, 0xb6000000, 0xa5000000,
+			0x44000000, 0x57000000, 0x62000000, 0x71000000, 0x08000000, 0x1b000000,
+			0x2e000000, 0x3d000000, 0xeb000000, 0xf8000000, 0xcd000000, 0xde000000,
+			0xa7000000, 0xb4000000, 0x81000000, 0x92000000, 0x73000000, 0x60000000,
+			0x55000000, 0x46000000, 0x3f000000, 0x2c000000, 0x19000000, 0x0a000000,
+			0xb2000000, 0xa1000000, 0x94000000, 0x87000000, 0xfe000000, 0xed000000,
+			0xd8000000, 0xcb000000, 0x2a000000, 0x39000000, 0x0c000000, 0x1f000000,
+			0x66000000, 0x75000000, 0x40000000, 0x53000000, 0x85000000, 0x96000000,
+			0xa3000000, 0xb0000000, 0xc9000000, 0xda000000, 0xef000000, 0xfc000000,
+			0x1d000000, 0x0e000000, 0x3b000000, 0x28000000, 0x51000000, 0x42000000,
+			0x77000000, 0x64000000, 0xbf000000, 0xac000000, 0x99000000, 0x8a000000,
+			0xf3000000, 0xe0000000, 0xd5000000, 0xc6000000, 0x27000000, 0x34000000,
+			0x01000000, 0x12000000, 0x6b000000, 0x78000000, 0x4d000000, 0x5e000000,
+			0x88000000, 0x9b000000, 0xae000000, 0xbd000000, 0xc4000000, 0xd7000000,
+			0xe2000000, 0xf1000000, 0x10000000, 0x03000000, 0x36000000, 0x25000000,
+			0x5c000000, 0x4f000000, 0x7a000000, 0x69000000, 0xd1000000, 0xc2000000,
+			0xf7000000, 0xe4000000, 0x9d000000, 0x8e000000, 0xbb000000, 0xa8000000,
+			0x49000000, 0x5a000000, 0x6f000000, 0x7c000000, 0x05000000, 0x16000000,
+			0x23000000, 0x30000000, 0xe6000000, 0xf5000000, 0xc0000000, 0xd3000000,
+			0xaa000000, 0xb9000000, 0x8c000000, 0x9f000000, 0x7e000000, 0x6d000000,
+			0x58000000, 0x4b000000, 0x32000000, 0x21000000, 0x14000000, 0x07000000,
+			0x63000000, 0x70000000, 0x45000000, 0x56000000, 0x2f000000, 0x3c000000,
+			0x09000000, 0x1a000000, 0xfb000000, 0xe8000000, 0xdd000000, 0xce000000,
+			0xb7000000, 0xa4000000, 0x91000000, 0x82000000, 0x54000000, 0x47000000,
+			0x72000000, 0x61000000, 0x18000000, 0x0b000000, 0x3e000000, 0x2d000000,
+			0xcc000000, 0xdf000000, 0xea000000, 0xf9000000, 0x80000000, 0x93000000,
+			0xa6000000, 0xb5000000, 0x0d000000, 0x1e000000, 0x2b000000, 0x38000000,
+			0x41000000, 0x52000000, 0x67000000, 0x74000000, 0x95000000, 0x86000000,
+			0xb3000000, 0xa0000000, 0xd9000000, 0xca000000, 0xff000000, 0xec000000,
+			0x3a000000, 0x29000000, 0x1c000000, 0x0f000000, 0x76000000, 0x65000000,
+			0x50000000, 0x43000000, 0xa2000000, 0xb1000000, 0x84000000, 0x97000000,
+			0xee000000, 0xfd000000, 0xc8000000, 0xdb000000,
+		},
+	},
+};
@@ -6,26 +6,62 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
-#include "r_types.h"
+#include "r_hash.h"
 
-R_API double r_hash_entropy(const ut8 *data, ut64 size) {
-	if (!data || !size) {
-		return 0;
+R_API void r_hash_entropy_init(RHashEntropy *e) {
+	memset (e->count, 0, sizeof (e->count));
+	e->len = 0;
+}
+
+R_API void r_hash_entropy_add(RHashEntropy *e, const ut8 *buf, ut64 len) {
+	ut64 i;
+	for (i = 0; i < len; i++) {
+		e->count[buf[i]]++;
 	}
-	ut64 i, count[256] = {0};
+	e->len += len;
+}
+
+/* drops bytes previously added, used to slide a window over the data */
+R_API void r_hash_entropy_del(RHashEntropy *e, const ut8 *buf, ut64 len) {
+	ut64 i;
+	for (i = 0; i < len; i++) {
+		e->count[buf[i]]--;
+	}
+	e->len -= len;
+}
+
+R_API double r_hash_entropy_get(RHashEntropy *e) {
 	double h = 0;
-	for (i = 0; i < size; i++) {
-		count[data[i]]++;
+	int i;
+	if (!e->len) {
+		return 0;
 	}
 	for (i = 0; i < 256; i++) {
-		if (count[i]) {
-			double p = (double) count[i] / size;
+		if (e->count[i]) {
+			double p = (double) e->count[i] / e->len;
 			h -= p * log2 (p);
 		}
 	}
 	return h;
 }
+
+R_API double r_hash_entropy_get_fraction(RHashEntropy *e) {
+	return (e->len > 1)? r_hash_entropy_get (e) / \
+		log2 ((double) R_MIN (e->len, 256)): 0;
+}
+
+R_API double r_hash_entropy(const ut8 *data, ut64 size) {
+	RHashEntropy e;
+	if (!data || !size) {
+		return 0;
+	}
+	r_hash_entropy_init (&e);
+	r_hash_entropy_add (&e, data, size);
+	return r_hash_entropy_get (&e);
+}
+
 R_API double r_hash_entropy_fraction(const ut8 *data, ut64 size) {
 	return size ? r_hash_entropy (data, size) / \
 		log2 ((double) R_MIN (size, 256)) : 0;
@@ -10,7 +10,13 @@ int hash_pcprint(unsigned char *buffer, ut64 len);
 float get_px(ut8 x, ut8 const *data, ut64 size);
 ut16 crc16(ut16 crc, const ut8 *buffer, ut64 len);
 void mdfour(ut8 *out, const ut8 *in, ut64 n);
+void md4_init(R_MD4_CTX *ctx);
+void md4_update(R_MD4_CTX *ctx, const ut8 *in, ut64 n);
+void md4_final(R_MD4_CTX *ctx, ut8 *out);
 ut32 crc32(ut8 *buf, ut64 len);
+void crc_init_preset(R_CRC_CTX *ctx, enum CRC_PRESETS preset);
+void crc_update(R_CRC_CTX *ctx, const ut8 *data, ut32 sz);
+void crc_final(R_CRC_CTX *ctx, ut32 *r);
 
 ut64 r_hash_name_to_bits(const char *name);
 //extern ut16 const crc16_table[256];
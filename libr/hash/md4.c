@@ -21,6 +21,7 @@
  */
 
 #include <r_hash.h>
+#include "hash.h"
 
 static inline ut32 F(ut32 X, ut32 Y, ut32 Z) {
 	return (X & Y) | ((~X) & Z);
@@ -138,52 +139,74 @@ static void copy4(ut8 *out, ut32 x) {
 	out[3] = (x >> 24) & 0xFF;
 }
 
-static void mdfour(ut8 *out, const ut8 *in, int n) {
-	ut8 buf[128];
-	ut32 M[16];
-	ut32 b = n * 8;
-	int i;
-	ut32 A = 0x67452301;
-	ut32 B = 0xefcdab89;
-	ut32 C = 0x98badcfe;
-	ut32 D = 0x10325476;
+void md4_init(R_MD4_CTX *ctx) {
+	ctx->A = 0x67452301;
+	ctx->B = 0xefcdab89;
+	ctx->C = 0x98badcfe;
+	ctx->D = 0x10325476;
+	ctx->len = 0;
+}
 
-	while (n > 64) {
+/* the input is hashed 64 bytes at a time, the rest waits in ctx->buf */
+void md4_update(R_MD4_CTX *ctx, const ut8 *in, ut64 n) {
+	ut32 M[16];
+	ut32 used = ctx->len & 63;
+	ctx->len += n;
+	if (used) {
+		ut32 fill = 64 - used;
+		if (n < fill) {
+			memcpy (ctx->buf + used, in, n);
+			return;
+		}
+		memcpy (ctx->buf + used, in, fill);
+		copy64 (M, ctx->buf);
+		mdfour64 (M, &ctx->A, &ctx->B, &ctx->C, &ctx->D);
+		in += fill;
+		n -= fill;
+	}
+	for (; n >= 64; in += 64, n -= 64) {
 		copy64 (M, in);
-		mdfour64 (M, &A, &B, &C, &D);
-		in += 64;
-		n -= 64;
+		mdfour64 (M, &ctx->A, &ctx->B, &ctx->C, &ctx->D);
 	}
+	memcpy (ctx->buf, in, n);
+}
 
-	for (i = 0; i < 128; i++) {
-		buf[i] = 0;
-	}
-	memcpy (buf, in, n);
+void md4_final(R_MD4_CTX *ctx, ut8 *out) {
+	ut8 buf[128] = {0};
+	ut32 M[16];
+	ut32 n = ctx->len & 63;
+	ut64 b = ctx->len * 8;
+
+	memcpy (buf, ctx->buf, n);
 	buf[n] = 0x80;
 
 	if (n <= 55) {
 		copy4 (buf + 56, b);
+		copy4 (buf + 60, b >> 32);
 		copy64 (M, buf);
-		mdfour64 (M, &A, &B, &C, &D);
+		mdfour64 (M, &ctx->A, &ctx->B, &ctx->C, &ctx->D);
 	} else {
 		copy4 (buf + 120, b);
+		copy4 (buf + 124, b >> 32);
 		copy64 (M, buf);
-		mdfour64 (M, &A, &B, &C, &D);
+		mdfour64 (M, &ctx->A, &ctx->B, &ctx->C, &ctx->D);
 		copy64 (M, buf + 64);
-		mdfour64 (M, &A, &B, &C, &D);
+		mdfour64 (M, &ctx->A, &ctx->B, &ctx->C, &ctx->D);
 	}
 
-	for (i = 0; i < 128; i++) {
-		buf[i] = 0;
-	}
-	copy64 (M, buf);
+	copy4 (out, ctx->A);
+	copy4 (out + 4, ctx->B);
+	copy4 (out + 8, ctx->C);
+	copy4 (out + 12, ctx->D);
 
-	copy4 (out, A);
-	copy4 (out + 4, B);
-	copy4 (out + 8, C);
-	copy4 (out + 12, D);
+	memset (ctx, 0, sizeof (*ctx));
+}
 
-	A = B = C = D = 0;
+void mdfour(ut8 *out, const ut8 *in, ut64 n) {
+	R_MD4_CTX ctx;
+	md4_init (&ctx);
+	md4_update (&ctx, in, n);
+	md4_final (&ctx, out);
 }
 
 R_API ut8 *r_hash_do_md4(RHash *ctx, const ut8 *input, int len) {
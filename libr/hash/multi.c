@@ -0,0 +1,373 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+#include <r_hash.h>
+#include <math.h>
+#include "hash.h"
+#include "xxhash.h"
+
+/* computes several digests in a single pass: every chunk given to
+ * r_hash_multi_update is fed to all the selected algorithms, so the
+ * input only needs to be read once no matter how many are selected.
+ * all of them are computed incrementally */
+
+#define MOD_ADLER 65521
+/* max bytes to sum before adler32 must reduce, see zlib's NMAX */
+#define NMAX_ADLER 5552
+
+static const struct {
+	ut64 bit;
+	enum CRC_PRESETS preset;
+} crc_bits[] = {
+	{ R_HASH_CRC8_SMBUS, CRC_PRESET_8_SMBUS },
+	{ R_HASH_CRC15_CAN, CRC_PRESET_15_CAN },
+	{ R_HASH_CRC16, CRC_PRESET_16 },
+	{ R_HASH_CRC16_HDLC, CRC_PRESET_16_HDLC },
+	{ R_HASH_CRC16_USB, CRC_PRESET_16_USB },
+	{ R_HASH_CRC16_CITT, CRC_PRESET_16_CITT },
+	{ R_HASH_CRC24, CRC_PRESET_24 },
+	{ R_HASH_CRC32, CRC_PRESET_32 },
+	{ R_HASH_CRC32C, CRC_PRESET_32C },
+	{ R_HASH_CRC32_ECMA_267, CRC_PRESET_32_ECMA_267 },
+	{ 0 }
+};
+
+static int crc_preset_of(ut64 bit) {
+	int i;
+	for (i = 0; crc_bits[i].bit; i++) {
+		if (crc_bits[i].bit == bit) {
+			return crc_bits[i].preset;
+		}
+	}
+	return -1;
+}
+
+static int popcount8(ut8 x) {
+	int n = 0;
+	for (; x; x &= x - 1) {
+		n++;
+	}
+	return n;
+}
+
+/* xor of all the bytes, a word at a time */
+static ut8 xor_bytes(const ut8 *buf, int len) {
+	ut64 w, acc = 0;
+	int i = 0;
+	for (; i + 8 <= len; i += 8) {
+		memcpy (&w, buf + i, sizeof (w));
+		acc ^= w;
+	}
+	acc ^= acc >> 32;
+	acc ^= acc >> 16;
+	acc ^= acc >> 8;
+	for (; i < len; i++) {
+		acc ^= buf[i];
+	}
+	return (ut8)acc;
+}
+
+R_API RHashMulti *r_hash_multi_new(ut64 algobits) {
+	RHashMulti *hm;
+	ut64 bit;
+	int n = 0;
+	for (bit = 1; bit && bit <= algobits; bit <<= 1) {
+		if ((algobits & bit) && *r_hash_name (bit)) {
+			n++;
+		}
+	}
+	if (!n || !(hm = R_NEW0 (RHashMulti))) {
+		return NULL;
+	}
+	hm->algos = R_NEWS0 (RHashMultiAlgo, n);
+	if (!hm->algos) {
+		free (hm);
+		return NULL;
+	}
+	hm->algobits = algobits;
+	for (bit = 1; bit && bit <= algobits; bit <<= 1) {
+		if ((algobits & bit) && *r_hash_name (bit)) {
+			RHashMultiAlgo *a = &hm->algos[hm->count++];
+			a->bit = bit;
+			a->dlen = r_hash_size (bit);
+			a->ctx = r_hash_new (false, bit);
+			if (!a->ctx) {
+				r_hash_multi_free (hm);
+				return NULL;
+			}
+		}
+	}
+	r_hash_multi_begin (hm);
+	return hm;
+}
+
+R_API void r_hash_multi_free(RHashMulti *hm) {
+	int i;
+	if (!hm) {
+		return;
+	}
+	for (i = 0; i < hm->count; i++) {
+		RHashMultiAlgo *a = &hm->algos[i];
+		if (a->xxh) {
+			XXH32_result (a->xxh);
+		}
+		r_hash_free (a->ctx);
+	}
+	free (hm->algos);
+	free (hm);
+}
+
+R_API void r_hash_multi_begin(RHashMulti *hm) {
+	int i, preset;
+	for (i = 0; i < hm->count; i++) {
+		RHashMultiAlgo *a = &hm->algos[i];
+		r_hash_do_begin (a->ctx, a->bit);
+		memset (a->ctx->digest, 0, sizeof (a->ctx->digest));
+		a->len = 0;
+		a->acc = 0;
+		a->acc2 = 0;
+		a->value = 0;
+		a->entropy = 0;
+		switch (a->bit) {
+		case R_HASH_MD4:
+			md4_init (&a->md4);
+			break;
+		case R_HASH_ENTROPY:
+			memset (a->count, 0, sizeof (a->count));
+			break;
+		case R_HASH_ADLER32:
+			a->acc = 1;
+			break;
+		case R_HASH_XXHASH:
+			if (a->xxh) {
+				XXH32_result (a->xxh);
+			}
+			a->xxh = XXH32_init (0);
+			break;
+		default:
+			preset = crc_preset_of (a->bit);
+			if (preset != -1) {
+				crc_init_preset (&a->crc, preset);
+			}
+			break;
+		}
+	}
+}
+
+static bool algo_update(RHashMultiAlgo *a, const ut8 *buf, int len) {
+	int i, n;
+	switch (a->bit) {
+	case R_HASH_MD5:
+	case R_HASH_SHA1:
+	case R_HASH_SHA256:
+	case R_HASH_SHA384:
+	case R_HASH_SHA512:
+		r_hash_calculate (a->ctx, a->bit, buf, len);
+		break;
+	case R_HASH_MD4:
+		md4_update (&a->md4, buf, len);
+		break;
+	case R_HASH_XOR:
+	case R_HASH_PARITY:
+		/* the parity of all the bits is the parity of their xor */
+		a->acc ^= xor_bytes (buf, len);
+		break;
+	case R_HASH_XORPAIR:
+		for (i = 0; i < len; i++) {
+			a->pair[(a->len + i) & 1] = buf[i];
+			if ((a->len + i) & 1) {
+				ut16 w;
+				memcpy (&w, a->pair, sizeof (w));
+				a->acc ^= w;
+			}
+		}
+		break;
+	case R_HASH_MOD255:
+		for (i = 0; i < len; i++) {
+			a->acc += buf[i];
+		}
+		break;
+	case R_HASH_PCPRINT:
+		for (i = 0; i < len; i++) {
+			if (IS_PRINTABLE (buf[i])) {
+				a->acc++;
+			}
+		}
+		break;
+	case R_HASH_ENTROPY:
+		for (i = 0; i < len; i++) {
+			a->count[buf[i]]++;
+		}
+		break;
+	case R_HASH_HAMDIST:
+		for (i = 0; i < len; i++) {
+			a->acc = popcount8 ((ut8)a->acc ^ buf[i]);
+		}
+		break;
+	case R_HASH_LUHN:
+		/* which digits get doubled depends on the total length, so
+		 * both sums are kept and picked at the end */
+		for (i = 0; i < len; i++) {
+			int d = IS_DIGIT (buf[i])? buf[i] - '0': 0;
+			int dd = d * 2;
+			if ((a->len + i) & 1) {
+				a->acc += d;
+				a->acc2 += dd / 10 + dd % 10;
+			} else {
+				a->acc += dd / 10 + dd % 10;
+				a->acc2 += d;
+			}
+		}
+		break;
+	case R_HASH_ADLER32:
+		{
+			ut32 s1 = a->acc & 0xffff;
+			ut32 s2 = (a->acc >> 16) & 0xffff;
+			for (i = 0; i < len; i += n) {
+				int j;
+				n = R_MIN (len - i, NMAX_ADLER);
+				for (j = 0; j < n; j++) {
+					s1 += buf[i + j];
+					s2 += s1;
+				}
+				s1 %= MOD_ADLER;
+				s2 %= MOD_ADLER;
+			}
+			a->acc = (s2 << 16) | s1;
+		}
+		break;
+	case R_HASH_XXHASH:
+		XXH32_feed (a->xxh, buf, len);
+		break;
+	default:
+		if (crc_preset_of (a->bit) == -1) {
+			return false;
+		}
+		crc_update (&a->crc, buf, len);
+		break;
+	}
+	a->len += len;
+	return true;
+}
+
+R_API bool r_hash_multi_update(RHashMulti *hm, const ut8 *buf, int len) {
+	bool ret = true;
+	int i;
+	if (len < 0) {
+		return false;
+	}
+	/* an empty update would end the md5 and sha digests */
+	if (!len) {
+		return true;
+	}
+	for (i = 0; i < hm->count; i++) {
+		ret &= algo_update (&hm->algos[i], buf, len);
+	}
+	return ret;
+}
+
+static void algo_end(RHashMultiAlgo *a) {
+	ut8 *d = a->ctx->digest;
+	ut32 crc;
+	int i;
+	switch (a->bit) {
+	case R_HASH_MD5:
+	case R_HASH_SHA1:
+	case R_HASH_SHA256:
+	case R_HASH_SHA384:
+	case R_HASH_SHA512:
+		r_hash_do_end (a->ctx, a->bit);
+		break;
+	case R_HASH_MD4:
+		md4_final (&a->md4, d);
+		break;
+	case R_HASH_XOR:
+		a->value = a->acc;
+		*d = a->value;
+		break;
+	case R_HASH_PARITY:
+		a->value = popcount8 ((ut8)a->acc) & 1;
+		*d = a->value;
+		break;
+	case R_HASH_XORPAIR:
+		{
+			ut16 res = a->acc;
+			a->value = res;
+			memcpy (d, &res, sizeof (res));
+		}
+		break;
+	case R_HASH_MOD255:
+		a->value = a->acc % 255;
+		*d = a->value;
+		break;
+	case R_HASH_PCPRINT:
+		a->value = a->len? (100 * a->acc) / a->len: 0;
+		*d = a->value;
+		break;
+	case R_HASH_ENTROPY:
+		a->entropy = 0;
+		for (i = 0; i < 256; i++) {
+			if (a->count[i]) {
+				double p = (double)a->count[i] / a->len;
+				a->entropy -= p * log2 (p);
+			}
+		}
+		memset (d, 0, R_HASH_SIZE_ENTROPY);
+		*d = (ut8)a->entropy;
+		a->value = *d;
+		break;
+	case R_HASH_HAMDIST:
+		a->value = a->acc;
+		*d = a->value;
+		break;
+	case R_HASH_LUHN:
+		a->value = ((a->len & 1)? a->acc2: a->acc) % 10;
+		*d = a->value;
+		break;
+	case R_HASH_ADLER32:
+		{
+			ut32 res = a->acc;
+			a->value = res;
+			memcpy (d, &res, sizeof (res));
+		}
+		break;
+	case R_HASH_XXHASH:
+		{
+			ut32 res = XXH32_result (a->xxh);
+			a->xxh = NULL;
+			a->value = res;
+			memcpy (d, &res, sizeof (res));
+		}
+		break;
+	default:
+		/* same as r_hash_crc_preset, which gives 0 on empty input */
+		crc = 0;
+		if (a->len) {
+			crc_final (&a->crc, &crc);
+		}
+		a->value = crc;
+		switch (a->dlen) {
+		case 1: *d = crc; break;
+		case 2: r_write_be16 (d, crc); break;
+		case 3: r_write_be24 (d, crc); break;
+		default: r_write_be32 (d, crc); break;
+		}
+		break;
+	}
+}
+
+R_API void r_hash_multi_end(RHashMulti *hm) {
+	int i;
+	for (i = 0; i < hm->count; i++) {
+		algo_end (&hm->algos[i]);
+	}
+}
+
+R_API RHashMultiAlgo *r_hash_multi_get(RHashMulti *hm, ut64 bit) {
+	int i;
+	for (i = 0; i < hm->count; i++) {
+		if (hm->algos[i].bit == bit) {
+			return &hm->algos[i];
+		}
+	}
+	return NULL;
+}
@@ -4,8 +4,6 @@
 #include "sha1.h"
 #include "sha2.h"
 
-R_API void mdfour(ut8 *out, const ut8 *in, int n);
-
 #define CHKFLAG(x) if (!flags || flags & x)
 
 R_API RHash *r_hash_new(bool rst, int flags) {
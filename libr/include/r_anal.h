@@ -593,6 +593,33 @@ typedef struct r_anal_options_t {
 	bool armthumb; //
 } RAnalOptions;
 
+/* the names of the types used by the variables, an id is an index
+ * in names. the definitions stay in sdb_types */
+typedef struct r_anal_type_ids_t {
+	const char **names; // interned
+	int count;
+	int size;
+	SdbHash *ids; // name -> id + 1
+} RAnalTypeIds;
+
+/* a local variable or argument as it is kept in memory */
+typedef struct r_anal_var_item_t {
+	int delta;
+	int size;
+	int type; // id in RAnalTypeIds
+	const char *name; // interned
+	char kind;
+} RAnalVarItem;
+
+/* the local variables of a function, in the order they were added */
+typedef struct r_anal_fcn_vars_t {
+	ut64 addr;
+	RAnalVarItem *vars;
+	int count;
+	int size;
+	RBNode rb;
+} RAnalFcnVars;
+
 typedef struct r_anal_t {
 	char *cpu;
 	char *os;
@@ -605,6 +632,8 @@ typedef struct r_anal_t {
 	ut64 gp; // global pointer. used for mips. but can be used by other arches too in the future
 	RList *fcns;
 	RBNode *fcn_tree;
+	RBNode *var_tree; // RAnalFcnVars by function address
+	RAnalTypeIds type_ids;
 	RListRange *fcnstore;
 	RList *refs;
 	RList *vartypes;
@@ -634,6 +663,7 @@ typedef struct r_anal_t {
 	Sdb *sdb_xrefs;
 	Sdb *sdb_types;
 	Sdb *sdb_meta; // TODO: Future r_meta api
+	RBNode *meta_tree; // RAnalMetaItem by address, mirrors sdb_meta
 	Sdb *sdb_zigns;
 
 #if USE_DICT
@@ -1199,6 +1229,9 @@ R_API RList* r_anal_type_get_by_offset(RAnal *anal, ut64 offset);
 R_API RAnalType *r_anal_type_new(void);
 R_API void r_anal_type_add(RAnal *l, RAnalType *t);
 R_API void r_anal_type_del(RAnal *l, const char *name);
+R_API int r_anal_type_id(RAnal *anal, const char *name);
+R_API const char *r_anal_type_id_name(RAnal *anal, int id);
+R_API void r_anal_type_ids_fini(RAnal *anal);
 R_API RList *r_anal_type_list_new(void);
 R_API RAnalType *r_anal_type_find(RAnal *a, const char* name);
 R_API void r_anal_type_list(RAnal *a, short category, short enabled);
@@ -1373,6 +1406,7 @@ R_API int r_anal_var_count(RAnal *a, RAnalFunction *fcn, int kind, int type);
 R_API bool r_anal_var_display(RAnal *anal, int delta, char kind, const char *type);
 R_API ut32 r_anal_fcn_size(const RAnalFunction *fcn);
 R_API void r_anal_fcn_set_size(RAnalFunction *fcn, ut32 size);
+R_API void r_anal_fcn_set_name(RAnalFunction *fcn, const char *name);
 R_API ut32 r_anal_fcn_contsize(const RAnalFunction *fcn);
 R_API ut32 r_anal_fcn_realsize(const RAnalFunction *fcn);
 R_API int r_anal_fcn_cc(RAnalFunction *fcn);
@@ -1497,6 +1531,7 @@ R_API void r_anal_var_list_show(RAnal *anal, RAnalFunction *fcn, int kind, int m
 R_API RList *r_anal_var_list(RAnal *anal, RAnalFunction *fcn, int kind);
 R_API RList *r_anal_var_all_list(RAnal *anal, RAnalFunction *fcn);
 R_API RList *r_anal_var_list_dynamic(RAnal *anal, RAnalFunction *fcn, int kind);
+R_API void r_anal_var_fini(RAnal *a);
 
 // calling conventions API
 R_API int r_anal_cc_exist (RAnal *anal, const char *convention);
@@ -1524,7 +1559,8 @@ R_API void r_anal_data_free (RAnalData *d);
 #include <r_cons.h>
 R_API char *r_anal_data_to_string(RAnalData *d, RConsPalette *pal);
 
-R_API void r_meta_free(RAnal *m);
+R_API void r_meta_init(RAnal *m);
+R_API void r_meta_fini(RAnal *m);
 R_API void r_meta_space_unset_for(RAnal *a, int type);
 R_API int r_meta_space_count_for(RAnal *a, int space_idx);
 R_API RList *r_meta_enumerate(RAnal *a, int type);
@@ -1538,6 +1574,7 @@ R_API int r_meta_var_comment_del(RAnal *a, int type, ut64 idx, ut64 addr);
 R_API int r_meta_add(RAnal *m, int type, ut64 from, ut64 size, const char *str);
 R_API int r_meta_add_with_subtype(RAnal *m, int type, int subtype, ut64 from, ut64 size, const char *str);
 R_API RAnalMetaItem *r_meta_find(RAnal *m, ut64 off, int type, int where);
+R_API RList *r_meta_find_list_in(RAnal *m, ut64 from, ut64 to, int type);
 R_API int r_meta_cleanup(RAnal *m, ut64 from, ut64 to);
 R_API const char *r_meta_type_to_string(int type);
 R_API RList *r_meta_enumerate(RAnal *a, int type);
@@ -86,6 +86,30 @@ typedef struct r_asm_code_t {
 	int code_align;
 } RAsmCode;
 
+enum {
+	R_ASM_BATCH_VALID = 0,
+	R_ASM_BATCH_INVALID,
+};
+
+/* one instruction of a linear sweep, see r_asm_disassemble_batch */
+typedef struct r_asm_batch_op_t {
+	ut64 addr;
+	int size;
+	int type; // R_ASM_BATCH_*
+	int text; // offset of the nul terminated text in RAsmBatch.text
+} RAsmBatchOp;
+
+/* the text of all the instructions lives in a single string buffer */
+typedef struct r_asm_batch_t {
+	RAsmBatchOp *ops;
+	int count;
+	int ops_size;
+	char *text;
+	int text_len;
+	int text_size;
+	int len; // bytes taken by the ops
+} RAsmBatch;
+
 // TODO: Must use Hashtable instead of this hack
 typedef struct {
 	char *key;
@@ -134,6 +158,9 @@ typedef struct r_asm_plugin_t {
 	bool (*init)(void *user);
 	bool (*fini)(void *user);
 	int (*disassemble)(RAsm *a, RAsmOp *op, const ut8 *buf, int len);
+	/* decodes up to max valid instructions starting at a->pc, stops at
+	 * the first invalid one and returns how many were added */
+	int (*disassemble_batch)(RAsm *a, RAsmBatch *b, const ut8 *buf, int len, int max);
 	int (*assemble)(RAsm *a, RAsmOp *op, const char *buf);
 	RAsmModifyCallback modify;
 	int (*set_subarch)(RAsm *a, const char *buf);
@@ -164,6 +191,7 @@ R_API int r_asm_syntax_from_string(const char *name);
 R_API int r_asm_set_pc(RAsm *a, ut64 pc);
 R_API int r_asm_disassemble(RAsm *a, RAsmOp *op, const ut8 *buf, int len);
 R_API int r_asm_assemble(RAsm *a, RAsmOp *op, const char *buf);
+R_API int r_asm_disassemble_batch(RAsm *a, RAsmBatch *b, const ut8 *buf, int len, int max);
 R_API RAsmCode* r_asm_mdisassemble(RAsm *a, const ut8 *buf, int len);
 R_API RAsmCode* r_asm_mdisassemble_hexstr(RAsm *a, const char *hexstr);
 R_API RAsmCode* r_asm_massemble(RAsm *a, const char *buf);
@@ -185,6 +213,14 @@ R_API void r_asm_equ_item_free(RAsmEqu *equ);
 R_API bool r_asm_code_set_equ (RAsmCode *code, const char *key, const char *value);
 R_API char *r_asm_code_equ_replace (RAsmCode *code, char *str);
 
+/* batch.c */
+R_API RAsmBatch *r_asm_batch_new(void);
+R_API void r_asm_batch_free(RAsmBatch *b);
+R_API void r_asm_batch_reset(RAsmBatch *b);
+R_API bool r_asm_batch_add(RAsmBatch *b, ut64 addr, int size, int type, const char *text);
+R_API const char *r_asm_batch_text(RAsmBatch *b, int idx);
+R_API char *r_asm_batch_drain(RAsmBatch *b, char sep);
+
 // accessors, to make bindings happy
 R_API char *r_asm_op_get_hex(RAsmOp *op);
 R_API char *r_asm_op_get_asm(RAsmOp *op);
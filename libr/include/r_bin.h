@@ -244,6 +244,7 @@ typedef struct r_bin_file_t {
 	Sdb *sdb;
 	Sdb *sdb_info;
 	Sdb *sdb_addrinfo;
+	RBinDwarfLines *dwarf_lines;
 	struct r_bin_t *rbin;
 } RBinFile;
 
@@ -657,6 +658,7 @@ R_API int r_bin_dwarf_parse_info(RBinDwarfDebugAbbrev *da, RBin *a, int mode);
 R_API RList *r_bin_dwarf_parse_line(RBin *a, int mode);
 R_API RList *r_bin_dwarf_parse_aranges(RBin *a, int mode);
 R_API RBinDwarfDebugAbbrev *r_bin_dwarf_parse_abbrev(RBin *a, int mode);
+R_API RBinDwarfDebugInfo *r_bin_dwarf_info_new(RBin *a, const RBinDwarfDebugAbbrev *da);
 
 R_API RBinPlugin * r_bin_get_binplugin_by_bytes (RBin *bin, const ut8* bytes, ut64 sz);
 
@@ -28,6 +28,13 @@ extern "C" {
 #define DW_LNE_set_address              0x02
 #define DW_LNE_define_file              0x03
 #define DW_LNE_set_discriminator        0x04  /* DWARF4 */
+
+/* Line number header entry formats, DWARF5 */
+#define DW_LNCT_path                    0x1
+#define DW_LNCT_directory_index         0x2
+#define DW_LNCT_timestamp               0x3
+#define DW_LNCT_size                    0x4
+#define DW_LNCT_MD5                     0x5
 #define DW_LNE_lo_user			0x80
 #define DW_LNE_hi_user			0xff
 
@@ -216,6 +223,11 @@ extern "C" {
 #define DW_AT_const_expr		0x6c
 #define DW_AT_enum_class		0x6d
 #define DW_AT_linkage_name		0x6e
+/* DWARF5 */
+#define DW_AT_str_offsets_base		0x72
+#define DW_AT_addr_base			0x73
+#define DW_AT_rnglists_base		0x74
+#define DW_AT_loclists_base		0x8c
 #define DW_AT_lo_user			0x2000
 #define DW_AT_hi_user			0x3fff
 
@@ -244,6 +256,38 @@ extern "C" {
 #define DW_FORM_exprloc			0x18
 #define DW_FORM_flag_present		0x19
 #define DW_FORM_ref_sig8		0x20
+/* DWARF5 */
+#define DW_FORM_strx			0x1a
+#define DW_FORM_addrx			0x1b
+#define DW_FORM_ref_sup4		0x1c
+#define DW_FORM_strp_sup		0x1d
+#define DW_FORM_data16			0x1e
+#define DW_FORM_line_strp		0x1f
+#define DW_FORM_implicit_const		0x21
+#define DW_FORM_loclistx		0x22
+#define DW_FORM_rnglistx		0x23
+#define DW_FORM_ref_sup8		0x24
+#define DW_FORM_strx1			0x25
+#define DW_FORM_strx2			0x26
+#define DW_FORM_strx3			0x27
+#define DW_FORM_strx4			0x28
+#define DW_FORM_addrx1			0x29
+#define DW_FORM_addrx2			0x2a
+#define DW_FORM_addrx3			0x2b
+#define DW_FORM_addrx4			0x2c
+/* GNU extensions for split and dwz debug info */
+#define DW_FORM_GNU_addr_index		0x1f01
+#define DW_FORM_GNU_str_index		0x1f02
+#define DW_FORM_GNU_ref_alt		0x1f20
+#define DW_FORM_GNU_strp_alt		0x1f21
+
+/* Unit types, DWARF5 */
+#define DW_UT_compile			0x01
+#define DW_UT_type			0x02
+#define DW_UT_partial			0x03
+#define DW_UT_skeleton			0x04
+#define DW_UT_split_compile		0x05
+#define DW_UT_split_type		0x06
 
 #define DW_OP_addr			0x03
 #define DW_OP_deref			0x06
@@ -607,6 +651,7 @@ typedef struct {
 typedef struct {
 	ut64	attr_name;
 	ut64	attr_form;
+	st64	implicit_const; /* value of DW_FORM_implicit_const */
 } RBinDwarfAttrSpec;
 
 typedef struct {
@@ -635,10 +680,13 @@ typedef struct {
 } RBinDwarfAttrValue;
 
 typedef struct {
-	ut32	length;
+	ut64	length;
 	ut16	version;
-	ut32	abbrev_offset;
+	ut8	unit_type;	/* DW_UT_*, DWARF5 only */
+	ut64	abbrev_offset;
 	ut8	pointer_size;
+	ut8	offset_size;	/* 8 in 64bit DWARF */
+	ut64	header_size;	/* from the start of the unit to the first DIE */
 } RBinDwarfCompUnitHdr;
 
 typedef struct {
@@ -655,6 +703,10 @@ typedef struct {
 	size_t	length;
 	size_t	capacity;
 	RBinDwarfDIE *dies;
+	bool	parsed;		/* dies are read on the first r_bin_dwarf_info_unit */
+	size_t	abbrevs;	/* index of its table in RBinDwarfDebugAbbrev.tables */
+	ut64	str_offsets_base;
+	ut64	addr_base;
 } RBinDwarfCompUnit;
 
 #define COMP_UNIT_CAPACITY	8
@@ -663,6 +715,19 @@ typedef struct {
 	size_t length;
 	size_t capacity;
 	RBinDwarfCompUnit *comp_units;
+	/* sections the units are read from */
+	const struct r_bin_dwarf_debug_abbrev_t *da;
+	const ut8 *info;
+	size_t info_len;
+	const ut8 *str;
+	size_t str_len;
+	const ut8 *line_str;
+	size_t line_str_len;
+	const ut8 *str_offsets;
+	size_t str_offsets_len;
+	const ut8 *addr;
+	size_t addr_len;
+	ut8 *owned[5];
 } RBinDwarfDebugInfo;
 
 #define	ABBREV_DECL_CAP		8
@@ -679,10 +744,20 @@ typedef struct {
 
 #define DEBUG_ABBREV_CAP	32
 
+/* the decls of one unit, consecutive in RBinDwarfDebugAbbrev.decls */
 typedef struct {
+	ut64 offset;	/* in .debug_abbrev */
+	size_t first;
+	size_t count;
+	bool sequential; /* codes are 1..count, decls can be indexed */
+} RBinDwarfAbbrevTable;
+
+typedef struct r_bin_dwarf_debug_abbrev_t {
 	size_t length;
 	size_t capacity;
 	RBinDwarfAbbrevDecl *decls;
+	RBinDwarfAbbrevTable *tables; /* sorted by offset */
+	size_t tables_count;
 } RBinDwarfDebugAbbrev;
 
 #define		DWARF_FALSE	0
@@ -711,6 +786,7 @@ typedef struct {
 typedef struct {
 	initial_length unit_length;
 	ut16 version;
+	ut8 address_size;	/* DWARF5 */
 	ut64 header_length;
 	ut8 min_inst_len;
 	ut8 max_ops_per_inst;
@@ -720,17 +796,39 @@ typedef struct {
 	ut8 opcode_base;
 	ut8 *std_opcode_lengths;
 	char **include_directories;
+	size_t include_directories_count;
 	file_entry *file_names;
 	size_t file_names_count;
 } RBinDwarfLNPHeader;
 
 #define r_bin_dwarf_line_new(o,a,f,l) o->address=a, o->file = strdup (f?f:""), o->line = l, o->column =0,o
 
+/* address to source line table, sorted by address. file names are
+ * interned, rows are in the order they were decoded for a same address */
+typedef struct {
+	ut64 address;
+	const char *file;
+	ut32 line;
+	ut32 column;
+} RBinDwarfLine;
+
+typedef struct r_bin_dwarf_lines_t {
+	RBinDwarfLine *rows;
+	size_t count;
+	size_t size;
+	RList *files; /* references of the interned names */
+} RBinDwarfLines;
+
 R_API int r_bin_dwarf_parse_info_raw(Sdb *s, RBinDwarfDebugAbbrev *da,
 		const ut8 *obuf, size_t len,
 		const ut8 *debug_str, size_t debug_str_len, int mode);
 
 R_API void r_bin_dwarf_free_debug_abbrev(RBinDwarfDebugAbbrev *da);
+R_API RBinDwarfAbbrevDecl *r_bin_dwarf_abbrev_get(const RBinDwarfDebugAbbrev *da, size_t table, ut64 code);
+R_API RBinDwarfCompUnit *r_bin_dwarf_info_unit(RBinDwarfDebugInfo *inf, size_t idx);
+R_API void r_bin_dwarf_info_free(RBinDwarfDebugInfo *inf);
+R_API void r_bin_dwarf_lines_free(RBinDwarfLines *lt);
+R_API const RBinDwarfLine *r_bin_dwarf_lines_get(const RBinDwarfLines *lt, ut64 addr);
 #ifdef __cplusplus
 }
 #endif
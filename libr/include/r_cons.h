@@ -30,6 +30,7 @@ extern "C" {
 /* constants */
 #define ENUM_FOR_PAL 0
 #define CONS_MAX_USER 102400
+#define CONS_STREAM_CHUNK 0x10000
 #define CONS_BUFSZ 0x4f00
 #define STR_IS_NULL(x) (!x || !x[0])
 
@@ -361,6 +362,10 @@ typedef struct r_cons_t {
 	bool use_color;
 	bool use_tts;
 	bool filter;
+	bool stream; // write complete lines to fdout while the command runs
+	RConsGrep *stream_grep;
+	int stream_level; // nested r_cons_grep_stream_begin calls
+	bool stream_hold; // output of previous commands waits for the flush
 	char* (*rgbstr)(char *str, ut64 addr);
 } RCons;
 
@@ -567,6 +572,7 @@ R_API void r_cons_set_interactive(bool b);
 R_API void r_cons_set_last_interactive(void);
 
 /* output */
+R_API PJ *r_cons_pj_new(void);
 R_API void r_cons_printf(const char *format, ...);
 R_API void r_cons_printf_list(const char *format, va_list ap);
 R_API void r_cons_strcat(const char *str);
@@ -629,6 +635,10 @@ R_API char * r_cons_grep_strip(char *cmd, const char *quotestr);
 R_API void r_cons_grep_process(char * grep);
 R_API int r_cons_grep_line(char *buf, int len); // must be static
 R_API int r_cons_grepbuf(char *buf, int len);
+R_API RConsGrep *r_cons_grep_stream_begin(const char *str, bool last);
+R_API void r_cons_grep_stream_end(RConsGrep *prev);
+R_API bool r_cons_grep_is_streamable(void);
+R_API int r_cons_grep_lines(char *buf, int len);
 
 R_API void r_cons_rgb(ut8 r, ut8 g, ut8 b, int is_bg);
 R_API void r_cons_rgb_fgbg(ut8 r, ut8 g, ut8 b, ut8 R, ut8 G, ut8 B);
@@ -113,6 +113,24 @@ typedef struct r_core_asmsteps_t {
 	int cols;
 } RCoreAsmsteps;
 
+/* sorted addresses of one kind of item counted by r_core_anal_get_stats,
+ * rebuilt only after the items change so redraws don't walk them all */
+typedef struct r_core_stats_index_t {
+	ut64 *addrs;
+	int count;
+	ut64 stamp; // state of the source when the index was built
+	bool dirty;
+} RCoreStatsIndex;
+
+enum {
+	R_CORE_STATS_FLAGS = 0,
+	R_CORE_STATS_FUNCTIONS,
+	R_CORE_STATS_SYMBOLS,
+	R_CORE_STATS_STRINGS,
+	R_CORE_STATS_COMMENTS,
+	R_CORE_STATS_LAST
+};
+
 typedef struct r_core_t {
 	RBin *bin;
 	RConfig *config;
@@ -154,6 +172,7 @@ typedef struct r_core_t {
 	RAGraph *graph;
 	char *cmdqueue;
 	char *lastcmd;
+	SdbHash *cmdcache; // parsed templates of batched commands
 	char *cmdlog;
 	bool cfglog;
 	int cmdrepeat;
@@ -188,6 +207,8 @@ typedef struct r_core_t {
 	char *cmdfilter;
 	bool break_loop;
 	RThreadLock *lock;
+	RCoreStatsIndex stats[R_CORE_STATS_LAST];
+	ut64 fcn_changes;
 } RCore;
 
 R_API int r_core_bind(RCore *core, RCoreBind *bnd);
@@ -234,6 +255,8 @@ R_API void r_core_cmd_init(RCore *core);
 R_API int r_core_cmd_pipe(RCore *core, char *radare_cmd, char *shell_cmd);
 R_API char *r_core_cmd_str(RCore *core, const char *cmd);
 R_API char *r_core_cmd_strf(RCore *core, const char *fmt, ...);
+R_API int r_core_cmd_batch(RCore *core, RList *cmds);
+R_API RList *r_core_cmd_batch_parse(const char *json);
 R_API char *r_core_cmd_str_pipe(RCore *core, const char *cmd);
 R_API int r_core_cmd_file(RCore *core, const char *file);
 R_API int r_core_cmd_lines(RCore *core, const char *lines);
@@ -390,6 +413,7 @@ R_API char *r_core_anal_fcn_autoname(RCore *core, ut64 addr, int dump);
 R_API void r_core_anal_autoname_all_fcns(RCore *core);
 R_API int r_core_anal_fcn_list(RCore *core, const char *input, const char *rad);
 R_API int r_core_anal_fcn_list_size(RCore *core);
+R_API void r_core_anal_fcn_print_rad(RCore *core, RAnalFunction *fcn);
 R_API void r_core_anal_fcn_labels(RCore *core, RAnalFunction *fcn, int rad);
 R_API int r_core_anal_fcn_clean(RCore *core, ut64 addr);
 R_API int r_core_anal_graph(RCore *core, ut64 addr, int opts);
@@ -397,6 +421,10 @@ R_API int r_core_anal_graph_fcn(RCore *core, char *input, int opts);
 R_API RList* r_core_anal_graph_to(RCore *core, ut64 addr, int n);
 R_API int r_core_anal_ref_list(RCore *core, int rad);
 R_API int r_core_anal_all(RCore *core);
+/* acache.c */
+R_API char *r_core_anal_cache_path(RCore *core);
+R_API bool r_core_anal_cache_save(RCore *core, int level);
+R_API int r_core_anal_cache_load(RCore *core);
 R_API RList* r_core_anal_cycles (RCore *core, int ccl);
 
 /*tp.c*/
@@ -555,6 +583,7 @@ R_API RList* /*<RIOMap*>*/ r_core_get_boundaries (RCore *core, const char *mode)
 R_API RList* r_core_get_boundaries_ok(RCore *core);
 
 R_API int r_core_patch (RCore *core, const char *patch);
+R_API bool r_core_patch_binary(RCore *core, const ut8 *patch, ut64 len);
 
 R_API void r_core_hack_help(const RCore *core);
 R_API int r_core_hack(RCore *core, const char *op);
@@ -602,6 +631,7 @@ R_API char *r_core_anal_hasrefs(RCore *core, ut64 value, bool verbose);
 R_API char *r_core_anal_get_comments(RCore *core, ut64 addr);
 R_API RCoreAnalStats* r_core_anal_get_stats (RCore *a, ut64 from, ut64 to, ut64 step);
 R_API void r_core_anal_stats_free (RCoreAnalStats *s);
+R_API void r_core_anal_stats_fini(RCore *core);
 R_API void r_core_anal_list_vtables (void *core, bool printJson);
 R_API void r_core_anal_print_rtti (void *core);
 
@@ -36,6 +36,20 @@ typedef struct r_diff_t {
 
 typedef int (*RDiffCallback)(RDiff *diff, void *user, RDiffOp *op);
 
+#define R_DIFF_BLOCK_SIZE 32
+
+/* op of the rolling-hash block matcher, copies take len bytes from a_off
+ * in the old file, inserts take them from data */
+typedef struct r_diff_block_t {
+	bool copy;
+	ut64 a_off;
+	ut64 b_off;
+	ut64 len;
+	const ut8 *data;
+} RDiffBlock;
+
+typedef bool (*RDiffBlockCallback)(void *user, RDiffBlock *op);
+
 /* XXX: this api needs to be reviewed , constructor with offa+offb?? */
 #ifdef R_API
 R_API RDiff *r_diff_new(void);
@@ -51,6 +65,12 @@ R_API int r_diff_set_callback(RDiff *d, RDiffCallback callback, void *user);
 R_API bool r_diff_buffers_distance(RDiff *d, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity);
 R_API bool r_diff_buffers_distance_myers(RDiff *diff, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity);
 R_API bool r_diff_buffers_distance_levenstein(RDiff *d, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity);
+R_API bool r_diff_buffers_distance_bitparallel(RDiff *diff, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity);
+R_API bool r_diff_buffers_distance_anchored(RDiff *diff, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity);
+R_API bool r_diff_blocks(const ut8 *a, ut64 la, const ut8 *b, ut64 lb, int bsize, RDiffBlockCallback cb, void *user);
+R_API ut8 *r_diff_patch_new(const ut8 *a, ut64 la, const ut8 *b, ut64 lb, int bsize, ut64 *len);
+R_API ut8 *r_diff_patch_apply(const ut8 *a, ut64 la, const ut8 *patch, ut64 plen, ut64 *len);
+R_API bool r_diff_patch_info(const ut8 *patch, ut64 plen, ut64 *la, ut64 *lb);
 R_API int r_diff_buffers_unified(RDiff *d, const ut8 *a, int la, const ut8 *b, int lb);
 /* static method !??! */
 R_API int r_diff_lines(const char *file1, const char *sa, int la, const char *file2, const char *sb, int lb);
@@ -37,6 +37,8 @@ typedef struct r_flags_at_offset_t {
 	RList *flags;   /* list of RFlagItem at offset */
 } RFlagsAtOffset;
 
+/* name and realname are interned (r_strpool_intern), they must not be
+ * modified or freed, use r_flag_rename and r_flag_item_set_realname */
 typedef struct r_flag_item_t {
 	char *name;     /* unique name, escaped to avoid issues with r2 shell */
 	char *realname; /* real name, without any escaping */
@@ -56,7 +58,9 @@ typedef struct r_flag_t {
 	RNum *num;
 	RSkipList *by_off; /* flags sorted by offset, value=RFlagsAtOffset */
 	SdbHash *ht_name; /* hashmap key=item name, value=RList of items */
+	SdbHash *ht_next; /* next suffix to try in r_flag_set_next, by name */
 	RList *flags;   /* list of RFlagItem contained in the flag */
+	ut64 changes;   /* bumped when flags are added, removed or moved */
 	RList *spacestack;
 	PrintfCallback cb_printf;
 #if R_FLAG_ZONE_USE_SDB
@@ -66,6 +70,14 @@ typedef struct r_flag_t {
 #endif
 } RFlag;
 
+/* input of r_flag_set_batch */
+typedef struct r_flag_entry_t {
+	const char *name;
+	const char *realname; /* NULL to keep the name */
+	ut64 offset;
+	ut64 size;
+} RFlagEntry;
+
 /* compile time dependency */
 
 typedef bool (*RFlagExistAt)(RFlag *f, const char *flag_prefix, ut16 fp_size, ut64 off);
@@ -104,6 +116,7 @@ R_API int r_flag_unset_off(RFlag *f, ut64 addr);
 R_API void r_flag_unset_all (RFlag *f);
 R_API RFlagItem *r_flag_set(RFlag *fo, const char *name, ut64 addr, ut32 size);
 R_API RFlagItem *r_flag_set_next(RFlag *fo, const char *name, ut64 addr, ut32 size);
+R_API int r_flag_set_batch(RFlag *f, const RFlagEntry *entries, int count);
 R_API int r_flag_sort(RFlag *f, int namesort);
 R_API void r_flag_item_set_alias(RFlagItem *item, const char *alias);
 R_API void r_flag_item_free (RFlagItem *item);
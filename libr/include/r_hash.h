@@ -18,6 +18,12 @@ typedef struct {
 	ut8 buffer[64];
 } R_MD5_CTX;
 
+typedef struct {
+	ut32 A, B, C, D;
+	ut8 buf[64];
+	ut64 len;
+} R_MD4_CTX;
+
 typedef struct {
 	ut32 H[5];
 	ut32 W[80];
@@ -82,6 +88,56 @@ typedef struct r_hash_seed_t {
 	int len;
 } RHashSeed;
 
+/* state of one algorithm in a RHashMulti */
+typedef struct r_hash_multi_algo_t {
+	ut64 bit;
+	int dlen;
+	RHash *ctx;       // the digest ends up in ctx->digest
+	R_CRC_CTX crc;
+	void *xxh;
+	ut64 count[256];  // byte histogram for the entropy
+	ut64 acc, acc2;   // running value of the simple checksums
+	ut64 len;         // bytes seen so far
+	ut8 pair[2];
+	R_MD4_CTX md4;
+	ut64 value;       // numeric result of the checksums
+	double entropy;
+} RHashMultiAlgo;
+
+typedef struct r_hash_multi_t {
+	ut64 algobits;
+	int count;
+	RHashMultiAlgo *algos;
+} RHashMulti;
+
+/* byte histogram that can be updated one byte at a time */
+typedef struct r_hash_entropy_t {
+	ut64 count[256];
+	ut64 len;
+} RHashEntropy;
+
+typedef struct r_hash_blockmap_t RHashBlockMap;
+typedef void (*RHashBlockCallback)(RHashBlockMap *bm, void *user);
+
+/* per-block digests and entropy of a stream read only once */
+struct r_hash_blockmap_t {
+	ut64 algobits;
+	ut64 bsize;        // bytes per block
+	ut64 step;         // distance between blocks, smaller than bsize to overlap
+	RHashMulti *hm;    // digests of the last block, NULL if only entropy
+	RHashEntropy ent;  // histogram of the block being read
+	double entropy;    // entropy of the last block, and its fraction of the max
+	double fraction;
+	ut64 from;         // address of the first byte
+	ut64 addr;         // address and length of the last block
+	ut64 len;
+	ut64 seen;         // bytes fed so far
+	ut8 *ring;         // window contents, only for overlapping blocks
+	int threads;       // workers sharing the blocks of a chunk
+	RHashBlockCallback cb;
+	void *user;
+};
+
 #define R_HASH_SIZE_CRC8_SMBUS 1
 #define R_HASH_SIZE_CRC15_CAN 2
 #define R_HASH_SIZE_CRC16 2
@@ -189,6 +245,27 @@ R_API int r_hash_pcprint(const ut8 *buffer, ut64 len);
 R_API void r_hash_do_begin(RHash *ctx, int flags);
 R_API void r_hash_do_end(RHash *ctx, int flags);
 R_API void r_hash_do_spice(RHash *ctx, int algo, int loops, RHashSeed *seed);
+
+/* single pass over the input for several algorithms */
+R_API RHashMulti *r_hash_multi_new(ut64 algobits);
+R_API void r_hash_multi_free(RHashMulti *hm);
+R_API void r_hash_multi_begin(RHashMulti *hm);
+R_API bool r_hash_multi_update(RHashMulti *hm, const ut8 *buf, int len);
+R_API void r_hash_multi_end(RHashMulti *hm);
+R_API RHashMultiAlgo *r_hash_multi_get(RHashMulti *hm, ut64 bit);
+
+/* incremental entropy */
+R_API void r_hash_entropy_init(RHashEntropy *e);
+R_API void r_hash_entropy_add(RHashEntropy *e, const ut8 *buf, ut64 len);
+R_API void r_hash_entropy_del(RHashEntropy *e, const ut8 *buf, ut64 len);
+R_API double r_hash_entropy_get(RHashEntropy *e);
+R_API double r_hash_entropy_get_fraction(RHashEntropy *e);
+
+/* block maps */
+R_API RHashBlockMap *r_hash_blockmap_new(ut64 algobits, ut64 bsize, ut64 step, ut64 addr, RHashBlockCallback cb, void *user);
+R_API void r_hash_blockmap_free(RHashBlockMap *bm);
+R_API bool r_hash_blockmap_update(RHashBlockMap *bm, const ut8 *buf, ut64 len);
+R_API void r_hash_blockmap_end(RHashBlockMap *bm);
 #endif
 
 #ifdef __cplusplus
@@ -118,6 +118,12 @@ typedef struct {
 	RSocket *fd;
 	RSocket *client;
 	int listener;
+	/* rap v2, see r_socket.h */
+	bool v2;
+	ut32 features;
+	int maxlen;
+	ut64 off;
+	void *cache;	// pages and requests in flight, owned by io_rap
 } RIORap;
 
 #define RMT_MAX    4096
@@ -310,6 +310,31 @@ R_API int r_magic_load(RMagic*, const char *);
 R_API int r_magic_compile(RMagic*, const char *);
 R_API int r_magic_check(RMagic*, const char *);
 R_API int r_magic_errno(RMagic*);
+
+/* filter.c */
+typedef struct r_magic_sig_t {
+	ut32 offset;	/* where the bytes are, from the start of the match */
+	ut32 range;	/* how many positions they can be at, from offset on */
+	ut8 len;
+	ut8 bytes[MAXstring];
+} RMagicSig;
+
+typedef struct r_magic_filter_t {
+	RMagicSig *sigs;
+	int *next;	/* chains the sigs sharing their first bytes */
+	int nsigs;
+	int size;
+	int heads1[256];	/* one byte sigs */
+	int *heads2;	/* longer sigs, by their first two bytes */
+	ut32 lookahead;	/* bytes past an offset the sigs can look at */
+	RMagic *rest;	/* the rules without a sig */
+	int nrest;
+} RMagicFilter;
+
+R_API RMagicFilter *r_magic_filter_new(RMagic *ms);
+R_API void r_magic_filter_free(RMagicFilter *f);
+R_API int r_magic_filter_scan(RMagicFilter *f, const ut8 *buf, int len, ut8 *hits, int n);
+R_API const char *r_magic_filter_buffer(RMagicFilter *f, const void *buf, size_t nb);
 #endif
 
 
@@ -3,6 +3,7 @@
 
 #define _R_LIST_C
 #include "r_util.h"
+#include "r_vector.h"
 #include <stdio.h>
 
 #ifdef __cplusplus
@@ -14,6 +15,9 @@ extern "C" {
 struct R_PDB;
 struct R_PDB7_ROOT_STREAM;
 
+/* name is demangled but not filtered */
+typedef void (*RPdbGvarCallback)(void *user, const char *name, ut64 addr, int symtype, const char *section);
+
 typedef struct R_PDB {
 	bool (*pdb_parse)(struct R_PDB *pdb);
 	void (*finish_pdb_parse)(struct R_PDB *pdb);
@@ -22,12 +26,13 @@ typedef struct R_PDB {
 	PrintfCallback cb_printf;
 	struct R_PDB7_ROOT_STREAM *root_stream;
 	void *stream_map;
-	RList *pdb_streams;
+	RVector *pdb_streams; // by stream number, NULL when empty or in pdb_streams2
 	RList *pdb_streams2;
 	RBuffer *buf; // mmap of file
 //	int curr;
 
 	void (*print_gvars)(struct R_PDB *pdb, ut64 img_base, int format);
+	int (*foreach_gvar)(struct R_PDB *pdb, ut64 img_base, RPdbGvarCallback cb, void *user);
 } R_PDB;
 
 R_API bool init_pdb_parser(R_PDB *pdb, const char *filename);
@@ -134,9 +134,12 @@ typedef struct r_socket_http_request {
 	char *referer;
 	ut8 *data;
 	int data_length;
+	bool keepalive;	// the response leaves the connection open
+	bool chunked;	// the client speaks HTTP/1.1
 } RSocketHTTPRequest;
 
 R_API RSocketHTTPRequest *r_socket_http_accept(RSocket *s, int timeout);
+R_API RSocketHTTPRequest *r_socket_http_request(RSocket *c, int timeout);
 R_API void r_socket_http_response(RSocketHTTPRequest *rs, int code, const char *out, int x, const char *headers);
 R_API void r_socket_http_close(RSocketHTTPRequest *rs);
 R_API ut8 *r_socket_http_handle_upload(const ut8 *str, int len, int *olen);
@@ -147,6 +150,8 @@ typedef int (*rap_server_read)(void *user, ut8 *buf, int len);
 typedef int (*rap_server_write)(void *user, ut8 *buf, int len);
 typedef char *(*rap_server_cmd)(void *user, const char *command);
 typedef int (*rap_server_close)(void *user, int fd);
+typedef int (*rap_server_read_at)(void *user, ut64 addr, ut8 *buf, int len);
+typedef int (*rap_server_write_at)(void *user, ut64 addr, const ut8 *buf, int len);
 
 enum {
 	RAP_RMT_OPEN = 0x01,
@@ -155,10 +160,44 @@ enum {
 	RAP_RMT_SEEK,
 	RAP_RMT_CLOSE,
 	RAP_RMT_CMD,
+	RAP_RMT_READ2 = 0x08,
+	RAP_RMT_WRITE2 = 0x09,
 	RAP_RMT_REPLY = 0x80,
 	RAP_RMT_MAX = 4096
 };
 
+/* rap v2: the client sets RAP_V2 in the flags of the open request, a
+ * server that knows it sets it in the opcode of the reply and appends
+ * be32 features + be32 max transfer. after that reads and writes can be
+ * done with READ2 and WRITE2, which carry the address and a tag so many
+ * of them can be in flight:
+ *   READ2   tag:4 addr:8 len:4 flags:1 -> tag:4 len:4 zlen:4 data
+ *   WRITE2  tag:4 addr:8 len:4 data    -> tag:4 written:4
+ * zlen is 0 when the data is sent as is, otherwise the data is lz4 */
+#define RAP_V2 0x40
+#define RAP_V2_LZ4 1
+#define RAP_V2_MAX (4 * 1024 * 1024)
+#define RAP_V2_OPEN_REPLY 13
+#define RAP_V2_READ_REQ 18
+#define RAP_V2_READ_REPLY 13
+#define RAP_V2_WRITE_REQ 17
+#define RAP_V2_WRITE_REPLY 9
+
+typedef struct r_socket_rap_v2_t {
+	ut8 *buf;	// reused by all the requests
+	int size;
+	rap_server_read_at read_at;
+	rap_server_write_at write_at;
+	void *user;
+} RSocketRapV2;
+
+R_API int r_socket_rap_pack(ut8 *dst, int dlen, const ut8 *src, int len);
+R_API int r_socket_rap_pack_bound(int len);
+R_API bool r_socket_rap_unpack(ut8 *dst, int len, const ut8 *src, int zlen);
+R_API void r_socket_rap_v2_open_reply(ut8 *buf, int fd);
+R_API bool r_socket_rap_v2_serve(RSocketRapV2 *v, RSocket *s, ut8 op);
+R_API void r_socket_rap_v2_fini(RSocketRapV2 *v);
+
 typedef struct r_socket_rap_server_t {
 	RSocket *fd;
 	char port[5];
@@ -170,6 +209,9 @@ typedef struct r_socket_rap_server_t {
 	rap_server_cmd system;
 	rap_server_cmd cmd;
 	rap_server_close close;
+	rap_server_read_at read_at;	// v2 is only offered when both are set
+	rap_server_write_at write_at;
+	RSocketRapV2 v2;
 	void *user;	// Always first arg for callbacks
 } RSocketRapServer;
 
@@ -42,6 +42,7 @@ typedef struct r_th_t {
 	int breaked;   // thread aims to be interruped
 	int delay;     // delay the startup of the thread N seconds
 	int ready;     // thread is properly setup
+	int joined;    // already waited for, nothing to join or cancel
 } RThread;
 
 typedef struct r_th_pool_t {
@@ -57,6 +58,7 @@ R_API int r_th_wait_async(RThread *th);
 R_API void r_th_break(RThread *th);
 R_API void *r_th_free(RThread *th);
 R_API int r_th_kill(RThread *th, int force);
+R_API int r_th_ncpus(void);
 
 R_API RThreadLock *r_th_lock_new(bool recursive);
 R_API int r_th_lock_wait(RThreadLock *th);
@@ -65,6 +65,7 @@ int gettimeofday (struct timeval* p, void* tz);
 #include "r_util/r_id_storage.h"
 #include "r_util/r_asn1.h"
 #include "r_util/r_json.h"
+#include "r_util/r_pj.h"
 #include "r_util/r_x509.h"
 #include "r_util/r_pkcs7.h"
 
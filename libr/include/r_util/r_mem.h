@@ -53,6 +53,7 @@ R_API const ut8 *r_mem_mem_aligned(const ut8 *haystack, int hlen, const ut8 *nee
 R_API int r_mem_count(const ut8 **addr);
 R_API bool r_mem_is_printable (const ut8 *a, int la);
 R_API bool r_mem_is_zero(const ut8 *b, int l);
+R_API int r_mem_span(const ut8 *b, int l, ut8 ch);
 
 #ifdef __cplusplus
 }
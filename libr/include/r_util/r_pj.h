@@ -0,0 +1,59 @@
+#ifndef R_PJ_H
+#define R_PJ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* streaming json writer */
+
+#define R_PJ_DEPTH 128
+#define R_PJ_BUFSIZE 4096
+
+typedef void (*PJFlush)(void *user, const char *buf, int len);
+
+typedef struct pj_t {
+	char *buf;
+	int len;
+	int size;
+	char braces[R_PJ_DEPTH];
+	int level;
+	bool is_first;
+	bool is_key;
+	PJFlush flush; // if set, the buffer is drained here when full
+	void *user;
+} PJ;
+
+R_API PJ *pj_new(void);
+R_API PJ *pj_new_stream(PJFlush flush, void *user, int size);
+R_API void pj_free(PJ *j);
+R_API void pj_reset(PJ *j);
+R_API void pj_flush(PJ *j);
+R_API char *pj_drain(PJ *j);
+R_API const char *pj_string(PJ *j);
+R_API PJ *pj_raw(PJ *j, const char *k);
+R_API PJ *pj_o(PJ *j);
+R_API PJ *pj_a(PJ *j);
+R_API PJ *pj_end(PJ *j);
+R_API PJ *pj_k(PJ *j, const char *k);
+R_API PJ *pj_s(PJ *j, const char *s);
+R_API PJ *pj_ne(PJ *j, const char *s, int len);
+R_API PJ *pj_n(PJ *j, ut64 n);
+R_API PJ *pj_N(PJ *j, st64 n);
+R_API PJ *pj_i(PJ *j, int i);
+R_API PJ *pj_b(PJ *j, bool b);
+R_API PJ *pj_null(PJ *j);
+R_API PJ *pj_ks(PJ *j, const char *k, const char *s);
+R_API PJ *pj_kn(PJ *j, const char *k, ut64 n);
+R_API PJ *pj_kN(PJ *j, const char *k, st64 n);
+R_API PJ *pj_ki(PJ *j, const char *k, int i);
+R_API PJ *pj_kb(PJ *j, const char *k, bool b);
+R_API PJ *pj_ko(PJ *j, const char *k);
+R_API PJ *pj_ka(PJ *j, const char *k);
+R_API int r_json_escape(char *dst, const char *src, int len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //  R_PJ_H
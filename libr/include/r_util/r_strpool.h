@@ -26,6 +26,11 @@ R_API int r_strpool_get_index(RStrpool *p, const char *s);
 R_API char *r_strpool_next(RStrpool *p, int index);
 R_API char *r_strpool_slice(RStrpool *p, int index);
 R_API char *r_strpool_empty(RStrpool *p);
+R_API const char *r_strpool_intern(const char *s);
+R_API const char *r_strpool_intern_find(const char *s);
+R_API const char *r_strpool_intern_ref(const char *s);
+R_API ut32 r_strpool_intern_hash(const char *s);
+R_API void r_strpool_intern_release(const char *s);
 
 #ifdef __cplusplus
 }
@@ -1,156 +1,607 @@
 /* radare - LGPL - Copyright 2008-2017 - pancake */
 
+/* gzip files are not inflated at once. a pass over the file records a
+ * checkpoint every GZ_SPAN bytes of output (where the deflate block
+ * starts, with the 32K of output before it that the block can refer
+ * to), and that index is kept in the cache dir for the next time. reads
+ * go on from the checkpoint before them and the inflated chunks are kept
+ * in a small lru, so the memory used does not depend on the file size.
+ * the whole file is inflated only when it is written */
+
 #include "r_io.h"
 #include "r_lib.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+#define GZ_SPAN (1024 * 1024)	// output between checkpoints
+#define GZ_WINDOW 32768
+#define GZ_CHUNK (128 * 1024)	// inflated and cached at once
+#define GZ_CACHE 16
+#define GZ_IN (64 * 1024)
+#define GZ_MAGIC "R2GZIDX1"
+#define GZ_HDR 44	// magic, zsize, mtime, size, points at, count
+#define GZ_POINT 30	// out, in, bits, member, window at, window size
+
+typedef struct {
+	ut64 out;	// offset in the inflated data
+	ut64 in;	// offset in the file of the first whole byte
+	ut8 bits;	// bits of the byte before in that belong to the block
+	ut8 member;	// a gzip header starts at in, nothing to restore
+	ut64 woff;	// where the compressed window is
+	ut32 wlen;
+} GzPoint;
+
+typedef struct {
+	ut64 off;
+	ut64 used;
+	int len;
+	ut8 *buf;
+} GzChunk;
 
 typedef struct {
+	int fd;
+	ut64 zsize;
+	ut64 size;
+	GzPoint *points;
+	int count;
+	/* windows are read from the index file, or kept in memory
+	 * when it could not be written */
+	int idxfd;
+	ut8 *windows;
+	ut64 wsize;
+	GzChunk chunks[GZ_CACHE];
+	ut64 stamp;
+	/* the stream stays where the last chunk ended */
+	z_stream z;
+	bool live;
+	bool raw;
+	ut64 zout;
+	ut64 zin;
+	int skip;	// trailer bytes before the next member
+	ut8 in[GZ_IN];
+	ut8 scratch[GZ_WINDOW];
+	/* everything inflated, once it is written */
 	ut8 *buf;
-	ut32 size;
 	ut64 offset;
 } RIOGzip;
 
-static inline ut32 _io_malloc_sz(RIODesc *desc) {
-	if (!desc) {
-		return 0;
+/* r_sandbox_lseek returns an int, offsets past 2G look like errors.
+ * the fds come from r_sandbox_open, so the sandbox was checked there */
+static int gz_pread(int fd, ut64 off, ut8 *buf, int len) {
+#if __UNIX__
+	return pread (fd, buf, len, (off_t)off);
+#elif __WINDOWS__
+	if (_lseeki64 (fd, (__int64)off, SEEK_SET) == -1) {
+		return -1;
+	}
+	return read (fd, buf, len);
+#else
+	if (lseek (fd, (off_t)off, SEEK_SET) == (off_t)-1) {
+		return -1;
+	}
+	return read (fd, buf, len);
+#endif
+}
+
+static char *gz_index_path(const char *file) {
+	char *abs = r_file_abspath (file);
+	char *path = r_str_newf (R2_HOMEDIR R_SYS_DIR "cache" R_SYS_DIR "gzip" R_SYS_DIR
+		"%016"PFMT64x, r_str_hash64 (abs? abs: file));
+	char *home = r_str_home (path);
+	free (path);
+	free (abs);
+	return home;
+}
+
+static bool gz_index_load(RIOGzip *gz, const char *file, ut64 mtime) {
+	char *path = gz_index_path (file);
+	ut8 hdr[GZ_HDR], *pts = NULL;
+	ut64 at;
+	int i, fd = path? r_sandbox_open (path, O_RDONLY | O_BINARY, 0): -1;
+	free (path);
+	if (fd == -1) {
+		return false;
+	}
+	if (gz_pread (fd, 0, hdr, GZ_HDR) != GZ_HDR || memcmp (hdr, GZ_MAGIC, 8)
+			|| r_read_le64 (hdr + 8) != gz->zsize || r_read_le64 (hdr + 16) != mtime) {
+		goto fail;
+	}
+	gz->size = r_read_le64 (hdr + 24);
+	at = r_read_le64 (hdr + 32);
+	gz->count = r_read_le32 (hdr + 40);
+	if (gz->count < 1 || gz->count > ST32_MAX / GZ_POINT
+			|| !(gz->points = calloc (gz->count, sizeof (GzPoint)))
+			|| !(pts = malloc (gz->count * GZ_POINT))
+			|| gz_pread (fd, at, pts, gz->count * GZ_POINT) != gz->count * GZ_POINT) {
+		goto fail;
 	}
-	RIOGzip *mal = (RIOGzip*)desc->data;
-	return mal? mal->size: 0;
-} 
+	for (i = 0; i < gz->count; i++) {
+		const ut8 *p = pts + i * GZ_POINT;
+		gz->points[i].out = r_read_le64 (p);
+		gz->points[i].in = r_read_le64 (p + 8);
+		gz->points[i].bits = p[16];
+		gz->points[i].member = p[17];
+		gz->points[i].woff = r_read_le64 (p + 18);
+		gz->points[i].wlen = r_read_le32 (p + 26);
+	}
+	free (pts);
+	gz->idxfd = fd;
+	return true;
+fail:
+	free (pts);
+	R_FREE (gz->points);
+	gz->count = 0;
+	gz->size = 0;
+	r_sandbox_close (fd);
+	return false;
+}
 
-static inline void _io_malloc_set_sz(RIODesc *desc, ut32 sz) {
-	if (!desc) {
-		return;
+static bool gz_index_save(RIOGzip *gz, int fd, ut64 mtime) {
+	ut8 hdr[GZ_HDR], *pts = calloc (gz->count, GZ_POINT);
+	bool ret;
+	int i;
+	if (!pts) {
+		return false;
 	}
-	RIOGzip *mal = (RIOGzip*)desc->data;
-	if (mal) {
-		mal->size = sz;
+	for (i = 0; i < gz->count; i++) {
+		ut8 *p = pts + i * GZ_POINT;
+		r_write_le64 (p, gz->points[i].out);
+		r_write_le64 (p + 8, gz->points[i].in);
+		p[16] = gz->points[i].bits;
+		p[17] = gz->points[i].member;
+		r_write_le64 (p + 18, gz->points[i].woff);
+		r_write_le32 (p + 26, gz->points[i].wlen);
 	}
-} 
+	memcpy (hdr, GZ_MAGIC, 8);
+	r_write_le64 (hdr + 8, gz->zsize);
+	r_write_le64 (hdr + 16, mtime);
+	r_write_le64 (hdr + 24, gz->size);
+	r_write_le64 (hdr + 32, GZ_HDR + gz->wsize);
+	r_write_le32 (hdr + 40, gz->count);
+	ret = r_sandbox_write (fd, pts, gz->count * GZ_POINT) == gz->count * GZ_POINT
+		&& r_sandbox_lseek (fd, 0, SEEK_SET) == 0
+		&& r_sandbox_write (fd, hdr, GZ_HDR) == GZ_HDR;
+	free (pts);
+	return ret;
+}
 
-static inline ut8* _io_malloc_buf(RIODesc *desc) {
-	if (!desc) {
-		return NULL;
+/* the window is appended to fd, or to the windows in memory */
+static bool gz_add_point(RIOGzip *gz, int fd, ut64 out, ut64 in, int bits, bool member) {
+	ut8 win[GZ_WINDOW], zwin[GZ_WINDOW + 64];
+	uLongf zlen = sizeof (zwin);
+	uInt wlen = 0;
+	GzPoint *p;
+	if (!(gz->count & 63)) {
+		GzPoint *points = realloc (gz->points, (gz->count + 64) * sizeof (GzPoint));
+		if (!points) {
+			return false;
+		}
+		gz->points = points;
+	}
+	p = &gz->points[gz->count];
+	memset (p, 0, sizeof (GzPoint));
+	p->out = out;
+	p->in = in;
+	p->bits = bits;
+	p->member = member;
+	if (!member) {
+		/* the output the next blocks can refer to */
+		if (inflateGetDictionary (&gz->z, win, &wlen) != Z_OK
+				|| compress2 (zwin, &zlen, win, wlen, 1) != Z_OK) {
+			return false;
+		}
+		if (fd != -1) {
+			if (r_sandbox_write (fd, zwin, zlen) != zlen) {
+				return false;
+			}
+			p->woff = GZ_HDR + gz->wsize;
+		} else {
+			ut8 *w = realloc (gz->windows, gz->wsize + zlen);
+			if (!w) {
+				return false;
+			}
+			memcpy (w + gz->wsize, zwin, zlen);
+			gz->windows = w;
+			p->woff = gz->wsize;
+		}
+		p->wlen = zlen;
+		gz->wsize += zlen;
+	}
+	gz->count++;
+	return true;
+}
+
+/* one pass over the whole file, as zran.c in the zlib examples does */
+static bool gz_index_build(RIOGzip *gz, const char *file, ut64 mtime) {
+	char *path = gz_index_path (file), *tmp = NULL, *dir;
+	z_stream *z = &gz->z;
+	ut64 zin = 0, out = 0, last = 0;
+	bool end = false;
+	int ret = Z_OK, fd = -1;
+	if (path && (dir = r_file_dirname (path))) {
+		r_sys_mkdirp (dir);
+		free (dir);
+		tmp = r_str_newf ("%s.%d", path, r_sys_getpid ());
+		fd = tmp? r_sandbox_open (tmp, O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0644): -1;
+		if (fd != -1 && r_sandbox_lseek (fd, GZ_HDR, SEEK_SET) != GZ_HDR) {
+			r_sandbox_close (fd);
+			r_file_rm (tmp);
+			fd = -1;
+		}
+	}
+	memset (z, 0, sizeof (z_stream));
+	if (inflateInit2 (z, 47) != Z_OK) {
+		goto fail;
+	}
+	if (!gz_add_point (gz, fd, 0, 0, 0, true)) {
+		inflateEnd (z);
+		goto fail;
+	}
+	while (!end) {
+		int n = gz_pread (gz->fd, zin, gz->in, GZ_IN);
+		if (n < 1) {
+			break;
+		}
+		zin += n;
+		z->next_in = gz->in;
+		z->avail_in = n;
+		do {
+			z->next_out = gz->scratch;
+			z->avail_out = sizeof (gz->scratch);
+			ret = inflate (z, Z_BLOCK);
+			out += sizeof (gz->scratch) - z->avail_out;
+			if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+				/* garbage after the last member is fine */
+				end = true;
+				break;
+			}
+			if (ret == Z_STREAM_END) {
+				inflateReset (z);
+				if (out - last > GZ_SPAN) {
+					if (!gz_add_point (gz, fd, out, zin - z->avail_in, 0, true)) {
+						inflateEnd (z);
+						goto fail;
+					}
+					last = out;
+				}
+			} else if ((z->data_type & 128) && !(z->data_type & 64) && out - last > GZ_SPAN) {
+				/* at the end of a block that is not the last one */
+				if (!gz_add_point (gz, fd, out, zin - z->avail_in, z->data_type & 7, false)) {
+					inflateEnd (z);
+					goto fail;
+				}
+				last = out;
+			}
+		} while (z->avail_in);
 	}
-	RIOGzip *mal = (RIOGzip*)desc->data;
-	return mal->buf;
+	inflateEnd (z);
+	if (!out) {
+		goto fail;
+	}
+	gz->size = out;
+	if (fd != -1) {
+		/* the windows are there even if it cannot be renamed */
+		if (!gz_index_save (gz, fd, mtime) || rename (tmp, path)) {
+			r_file_rm (tmp);
+		}
+		gz->idxfd = fd;
+	}
+	free (path);
+	free (tmp);
+	return true;
+fail:
+	if (fd != -1) {
+		r_sandbox_close (fd);
+		r_file_rm (tmp);
+	}
+	R_FREE (gz->points);
+	gz->count = 0;
+	free (path);
+	free (tmp);
+	return false;
 }
 
+static void gz_stream_end(RIOGzip *gz) {
+	if (gz->live) {
+		inflateEnd (&gz->z);
+		gz->live = false;
+	}
+}
 
-static inline ut8* _io_malloc_set_buf(RIODesc *desc, ut8* buf) {
-	if (!desc) {
+/* the stream starts again at the last checkpoint before off */
+static bool gz_stream_seek(RIOGzip *gz, ut64 off) {
+	ut8 win[GZ_WINDOW], *zwin;
+	uLongf wlen = sizeof (win);
+	int lo = 0, hi = gz->count - 1;
+	GzPoint *p;
+	bool ok;
+	if (gz->live && gz->zout <= off && off - gz->zout < GZ_SPAN) {
+		return true;
+	}
+	while (lo < hi) {
+		int mid = (lo + hi + 1) / 2;
+		if (gz->points[mid].out <= off) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+	p = &gz->points[lo];
+	if (gz->live && gz->zout <= off && gz->zout >= p->out) {
+		/* closer than the checkpoint */
+		return true;
+	}
+	gz_stream_end (gz);
+	memset (&gz->z, 0, sizeof (z_stream));
+	gz->raw = !p->member;
+	if (inflateInit2 (&gz->z, gz->raw? -15: 47) != Z_OK) {
+		return false;
+	}
+	gz->live = true;
+	gz->zin = p->in;
+	gz->zout = p->out;
+	gz->skip = 0;
+	if (!gz->raw) {
+		return true;
+	}
+	if (!(zwin = malloc (p->wlen))) {
+		gz_stream_end (gz);
+		return false;
+	}
+	if (gz->idxfd != -1) {
+		ok = gz_pread (gz->idxfd, p->woff, zwin, p->wlen) == p->wlen;
+	} else {
+		memcpy (zwin, gz->windows + p->woff, p->wlen);
+		ok = true;
+	}
+	ok = ok && uncompress (win, &wlen, zwin, p->wlen) == Z_OK;
+	free (zwin);
+	if (ok && p->bits) {
+		ut8 c;
+		ok = gz_pread (gz->fd, p->in - 1, &c, 1) == 1
+			&& inflatePrime (&gz->z, p->bits, c >> (8 - p->bits)) == Z_OK;
+	}
+	if (!ok || inflateSetDictionary (&gz->z, win, wlen) != Z_OK) {
+		eprintf ("gzip: cannot restore the checkpoint at 0x%"PFMT64x"\n", p->out);
+		gz_stream_end (gz);
+		return false;
+	}
+	return true;
+}
+
+/* inflates the len bytes at off, returns how many there are */
+static int gz_stream_read(RIOGzip *gz, ut64 off, ut8 *buf, int len) {
+	z_stream *z = &gz->z;
+	int done = 0;
+	if (!gz_stream_seek (gz, off)) {
+		return 0;
+	}
+	while (done < len) {
+		int ret, skip = off > gz->zout? (int)R_MIN (off - gz->zout, sizeof (gz->scratch)): 0;
+		if (!z->avail_in) {
+			int n = gz_pread (gz->fd, gz->zin, gz->in, GZ_IN);
+			if (n < 1) {
+				break;
+			}
+			gz->zin += n;
+			z->next_in = gz->in;
+			z->avail_in = n;
+		}
+		if (gz->skip) {
+			int n = R_MIN (gz->skip, z->avail_in);
+			z->next_in += n;
+			z->avail_in -= n;
+			gz->skip -= n;
+			continue;
+		}
+		/* what comes before off is thrown away */
+		z->next_out = skip? gz->scratch: buf + done;
+		z->avail_out = skip? skip: len - done;
+		ret = inflate (z, Z_NO_FLUSH);
+		if (skip) {
+			gz->zout += skip - z->avail_out;
+		} else {
+			gz->zout += (len - done) - z->avail_out;
+			done = len - z->avail_out;
+		}
+		if (ret == Z_STREAM_END) {
+			/* the raw stream does not eat the trailer */
+			gz->skip = gz->raw? 8: 0;
+			gz->raw = false;
+			inflateReset2 (z, 47);
+		} else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+			gz_stream_end (gz);
+			break;
+		}
+	}
+	return done;
+}
+
+static GzChunk *gz_chunk(RIOGzip *gz, ut64 off) {
+	GzChunk *c = NULL;
+	int i;
+	gz->stamp++;
+	for (i = 0; i < GZ_CACHE; i++) {
+		GzChunk *ci = &gz->chunks[i];
+		if (ci->buf && ci->off == off) {
+			ci->used = gz->stamp;
+			return ci;
+		}
+		if (!c || !ci->buf || (c->buf && ci->used < c->used)) {
+			c = ci;
+		}
+	}
+	if (!c->buf && !(c->buf = malloc (GZ_CHUNK))) {
+		return NULL;
+	}
+	c->off = off;
+	c->used = gz->stamp;
+	c->len = gz_stream_read (gz, off, c->buf, (int)R_MIN (GZ_CHUNK, gz->size - off));
+	if (c->len < 1) {
+		R_FREE (c->buf);
 		return NULL;
 	}
-	RIOGzip *mal = (RIOGzip*)desc->data;
-	return mal->buf = buf;
+	return c;
 }
 
-static inline ut64 _io_malloc_off(RIODesc *desc) {
-	if (!desc) {
+static int gz_read(RIOGzip *gz, ut64 off, ut8 *buf, int len) {
+	int done = 0;
+	if (off >= gz->size) {
 		return 0;
 	}
-	RIOGzip *mal = (RIOGzip*)desc->data;
-	return mal->offset;
+	len = (int)R_MIN (len, gz->size - off);
+	while (done < len) {
+		ut64 at = off + done;
+		GzChunk *c = gz_chunk (gz, at - at % GZ_CHUNK);
+		int n, delta = at % GZ_CHUNK;
+		if (!c || delta >= c->len) {
+			break;
+		}
+		n = R_MIN (c->len - delta, len - done);
+		memcpy (buf + done, c->buf + delta, n);
+		done += n;
+	}
+	return done;
 }
 
-static inline void _io_malloc_set_off(RIODesc *desc, ut64 off) {
-	if (!desc) {
-		return;
+/* writes are done on a full copy, as they were before */
+static bool gz_inflate_all(RIOGzip *gz) {
+	if (gz->buf) {
+		return true;
 	}
-	RIOGzip *mal = (RIOGzip*)desc->data;
-	mal->offset = off;
+	if (gz->size > ST32_MAX) {
+		eprintf ("gzip: too big to be written in memory\n");
+		return false;
+	}
+	if (!(gz->buf = malloc (R_MAX (gz->size, 1)))) {
+		return false;
+	}
+	if (gz_read (gz, 0, gz->buf, gz->size) != gz->size) {
+		R_FREE (gz->buf);
+		return false;
+	}
+	return true;
 }
 
 static int __write(RIO *io, RIODesc *fd, const ut8 *buf, int count) {
+	RIOGzip *gz;
 	if (!fd || !buf || count < 0 || !fd->data) {
 		return -1;
 	}
-	if (_io_malloc_off (fd) > _io_malloc_sz (fd)) {
+	gz = fd->data;
+	if (gz->offset > gz->size || !gz_inflate_all (gz)) {
 		return -1;
 	}
-	if (_io_malloc_off (fd) + count > _io_malloc_sz (fd)) {
-		count -= (_io_malloc_off (fd) + count -_io_malloc_sz (fd));
+	if (gz->offset + count > gz->size) {
+		count -= (gz->offset + count - gz->size);
 	}
 	if (count > 0) {
-		memcpy (_io_malloc_buf (fd) + _io_malloc_off (fd), buf, count);
-		_io_malloc_set_off (fd, _io_malloc_off (fd) + count);
+		memcpy (gz->buf + gz->offset, buf, count);
+		gz->offset += count;
 		return count;
 	}
 	return -1;
 }
 
 static bool __resize(RIO *io, RIODesc *fd, ut64 count) {
-	ut8 * new_buf = NULL;
-	if (!fd || !fd->data || count == 0) {
+	RIOGzip *gz;
+	ut8 *new_buf;
+	if (!fd || !fd->data || count == 0 || count > ST32_MAX) {
 		return false;
 	}
-	ut32 mallocsz = _io_malloc_sz (fd);
-	if (_io_malloc_off (fd) > mallocsz) {
+	gz = fd->data;
+	if (gz->offset > gz->size || !gz_inflate_all (gz)) {
 		return false;
 	}
 	new_buf = malloc (count);
 	if (!new_buf) {
-		return -1;
+		return false;
 	}
-	memcpy (new_buf, _io_malloc_buf (fd), R_MIN (count, mallocsz));
-	if (count > mallocsz) {
-		memset (new_buf + mallocsz, 0, count - mallocsz);
+	memcpy (new_buf, gz->buf, R_MIN (count, gz->size));
+	if (count > gz->size) {
+		memset (new_buf + gz->size, 0, count - gz->size);
 	}
-	free (_io_malloc_buf (fd));
-	_io_malloc_set_buf (fd, new_buf);
-	_io_malloc_set_sz (fd, count);
+	free (gz->buf);
+	gz->buf = new_buf;
+	gz->size = count;
 	return true;
 }
 
 static int __read(RIO *io, RIODesc *fd, ut8 *buf, int count) {
+	RIOGzip *gz;
 	memset (buf, 0xff, count);
 	if (!fd || !fd->data) {
 		return -1;
 	}
-	ut32 mallocsz = _io_malloc_sz (fd);
-	if (_io_malloc_off (fd) > mallocsz) {
+	gz = fd->data;
+	if (gz->offset > gz->size) {
 		return -1;
 	}
-	if (_io_malloc_off (fd) + count >= mallocsz) {
-		count = mallocsz - _io_malloc_off (fd);
+	if (gz->offset + count >= gz->size) {
+		count = gz->size - gz->offset;
+	}
+	if (gz->buf) {
+		memcpy (buf, gz->buf + gz->offset, count);
+	} else {
+		count = gz_read (gz, gz->offset, buf, count);
 	}
-	memcpy (buf, _io_malloc_buf (fd) + _io_malloc_off (fd), count);
+	gz->offset += count;
 	return count;
 }
 
+static void gz_free(RIOGzip *gz) {
+	int i;
+	gz_stream_end (gz);
+	for (i = 0; i < GZ_CACHE; i++) {
+		free (gz->chunks[i].buf);
+	}
+	if (gz->idxfd != -1) {
+		r_sandbox_close (gz->idxfd);
+	}
+	if (gz->fd != -1) {
+		r_sandbox_close (gz->fd);
+	}
+	free (gz->points);
+	free (gz->windows);
+	free (gz->buf);
+	free (gz);
+}
+
 static int __close(RIODesc *fd) {
-	RIOGzip *riom;
+	RIOGzip *gz;
 	if (!fd || !fd->data) {
 		return -1;
 	}
-	riom = fd->data;
-	R_FREE (riom->buf);
-	R_FREE (fd->data);
-	eprintf ("TODO: Writing changes into gzipped files is not yet supported\n");
+	gz = fd->data;
+	if (gz->buf) {
+		eprintf ("TODO: Writing changes into gzipped files is not yet supported\n");
+	}
+	gz_free (gz);
+	fd->data = NULL;
 	return 0;
 }
 
 static ut64 __lseek(RIO* io, RIODesc *fd, ut64 offset, int whence) {
-	ut64 r_offset = offset;
+	RIOGzip *gz;
 	if (!fd || !fd->data) {
 		return offset;
 	}
-	ut32 mallocsz = _io_malloc_sz (fd);
+	gz = fd->data;
 	switch (whence) {
 	case SEEK_SET:
-		r_offset = (offset <= mallocsz) ? offset : mallocsz;
+		gz->offset = R_MIN (offset, gz->size);
 		break;
 	case SEEK_CUR:
-		r_offset = (_io_malloc_off (fd) + offset <= mallocsz ) ? _io_malloc_off (fd) + offset : mallocsz;
+		gz->offset = R_MIN (gz->offset + offset, gz->size);
 		break;
 	case SEEK_END:
-		r_offset = _io_malloc_sz (fd);
+		gz->offset = gz->size;
 		break;
 	}
-	_io_malloc_set_off (fd, r_offset);
-	return r_offset;
+	return gz->offset;
 }
 
 static bool __plugin_open(RIO *io, const char *pathname, bool many) {
@@ -158,23 +609,29 @@ static bool __plugin_open(RIO *io, const char *pathname, bool many) {
 }
 
 static RIODesc *__open(RIO *io, const char *pathname, int rw, int mode) {
-	if (__plugin_open (io, pathname, 0)) {
-		RIOGzip *mal = R_NEW0 (RIOGzip);
-		if (!mal) {
-			return NULL;
-		}
-		int len;
-		ut8 *data = (ut8*)r_file_slurp (pathname+7, &len);	//memleak here?
-		int *size = (int*)&mal->size;
-		mal->buf = r_inflate (data, len, NULL, size);
-		if (mal->buf) {
-			return r_io_desc_new (io, &r_io_plugin_gzip, pathname, rw, mode, mal);
-		}
-		free (data);
-		eprintf ("Cannot allocate (%s) %d byte(s)\n", pathname+9, mal->size);
-		free (mal);
+	const char *file = pathname + 7;
+	struct stat st;
+	RIOGzip *gz;
+	if (!__plugin_open (io, pathname, 0)) {
+		return NULL;
+	}
+	if (!(gz = R_NEW0 (RIOGzip))) {
+		return NULL;
+	}
+	gz->idxfd = -1;
+	gz->fd = r_sandbox_open (file, O_RDONLY | O_BINARY, 0);
+	if (gz->fd == -1 || fstat (gz->fd, &st)) {
+		eprintf ("Cannot open %s\n", file);
+		gz_free (gz);
+		return NULL;
+	}
+	gz->zsize = st.st_size;
+	if (!gz_index_load (gz, file, st.st_mtime) && !gz_index_build (gz, file, st.st_mtime)) {
+		eprintf ("Cannot inflate %s\n", file);
+		gz_free (gz);
+		return NULL;
 	}
-	return NULL;
+	return r_io_desc_new (io, &r_io_plugin_gzip, pathname, rw, mode, gz);
 }
 
 RIOPlugin r_io_plugin_gzip = {
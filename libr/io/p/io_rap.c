@@ -11,15 +11,342 @@
 #define RIORAP_IS_LISTEN(x) (((RIORap*)(x->data))->listener)
 #define RIORAP_IS_VALID(x) ((x) && (x->data) && (x->plugin == &r_io_plugin_rap))
 
-static int rap__write(RIO *io, RIODesc *fd, const ut8 *buf, int count) {
-	RSocket *s = RIORAP_FD (fd);
-	ut8 *tmp;
-	int ret;
+/* rap v2 client side. reads go through a cache of pages, the pages
+ * after a sequential read are asked for before they are needed and the
+ * replies are collected on the next calls, so many requests can be in
+ * flight. reads bigger than a few pages skip the cache and are split in
+ * chunks that are all asked for at once */
+#define RAP_PAGE 0x8000
+#define RAP_PAGES 128
+#define RAP_AHEAD 32	// pages asked ahead of a sequential read at most
+#define RAP_QUEUE 64	// requests in flight
+#define RAP_CHUNK (512 * 1024)
+#define RAP_DIRECT (4 * RAP_PAGE)
 
-	if (count < 1) {
+enum {
+	PAGE_FREE,
+	PAGE_PENDING,
+	PAGE_READY
+};
+
+typedef struct {
+	ut64 addr;
+	ut64 used;	// stamp of the last read that touched it
+	int state;
+	ut8 *data;
+} RapPage;
+
+typedef struct {
+	ut32 tag;
+	int len;
+	ut8 *dst;
+	RapPage *page;
+} RapReq;
+
+typedef struct {
+	RapPage pages[RAP_PAGES];
+	ut8 *mem;
+	RapReq q[RAP_QUEUE];
+	int qhead;
+	int qlen;
+	ut8 out[RAP_QUEUE * RAP_V2_READ_REQ];	// requests not sent yet
+	int outlen;
+	ut32 tag;
+	ut64 stamp;
+	ut64 prev;	// where the last read started
+	ut64 next;	// and ended
+	int ahead;
+	ut8 *zbuf;
+	int zsize;
+} RapCache;
+
+static RapCache *rap_cache_new(void) {
+	RapCache *c = R_NEW0 (RapCache);
+	int i;
+	if (!c) {
+		return NULL;
+	}
+	if (!(c->mem = malloc (RAP_PAGES * RAP_PAGE))) {
+		free (c);
+		return NULL;
+	}
+	for (i = 0; i < RAP_PAGES; i++) {
+		c->pages[i].data = c->mem + i * RAP_PAGE;
+	}
+	return c;
+}
+
+static void rap_cache_free(RapCache *c) {
+	if (c) {
+		free (c->mem);
+		free (c->zbuf);
+		free (c);
+	}
+}
+
+/* forgets the pages and the requests in flight */
+static void rap_cache_reset(RapCache *c) {
+	int i;
+	for (i = 0; i < RAP_PAGES; i++) {
+		c->pages[i].state = PAGE_FREE;
+	}
+	c->qlen = 0;
+	c->outlen = 0;
+	c->ahead = 0;
+}
+
+static bool rap_push(RIORap *r, RapCache *c) {
+	int n = c->outlen;
+	c->outlen = 0;
+	if (n > 0) {
+		if (r_socket_write (r->client, c->out, n) != n) {
+			return false;
+		}
+		r_socket_flush (r->client);
+	}
+	return true;
+}
+
+/* gets the reply of the oldest request in flight */
+static bool rap_recv(RIORap *r, RapCache *c) {
+	ut8 hdr[RAP_V2_READ_REPLY];
+	RapReq *q = &c->q[c->qhead];
+	int len, zlen;
+	if (!c->qlen || !rap_push (r, c)) {
+		return false;
+	}
+	if (r_socket_read_block (r->client, hdr, sizeof (hdr)) != sizeof (hdr)
+			|| hdr[0] != (RAP_RMT_READ2 | RAP_RMT_REPLY)
+			|| r_read_be32 (hdr + 1) != q->tag) {
+		eprintf ("rap: unexpected read reply\n");
+		return false;
+	}
+	len = (int)r_read_be32 (hdr + 5);
+	zlen = (int)r_read_be32 (hdr + 9);
+	if (len != q->len || zlen < 0 || zlen > r_socket_rap_pack_bound (len)) {
+		eprintf ("rap: unexpected read size %d\n", len);
+		return false;
+	}
+	if (zlen) {
+		if (zlen > c->zsize) {
+			ut8 *z = realloc (c->zbuf, zlen);
+			if (!z) {
+				return false;
+			}
+			c->zbuf = z;
+			c->zsize = zlen;
+		}
+		if (r_socket_read_block (r->client, c->zbuf, zlen) != zlen
+				|| !r_socket_rap_unpack (q->dst, len, c->zbuf, zlen)) {
+			eprintf ("rap: broken read reply\n");
+			return false;
+		}
+	} else if (len > 0 && r_socket_read_block (r->client, q->dst, len) != len) {
+		return false;
+	}
+	if (q->page) {
+		q->page->state = PAGE_READY;
+	}
+	c->qhead = (c->qhead + 1) % RAP_QUEUE;
+	c->qlen--;
+	return true;
+}
+
+static bool rap_drain(RIORap *r, RapCache *c) {
+	while (c->qlen > 0) {
+		if (!rap_recv (r, c)) {
+			rap_cache_reset (c);
+			return false;
+		}
+	}
+	return rap_push (r, c);
+}
+
+/* queues a read, the reply goes to dst */
+static bool rap_ask(RIORap *r, RapCache *c, ut64 addr, int len, ut8 *dst, RapPage *page) {
+	RapReq *q;
+	ut8 *p;
+	if (c->qlen == RAP_QUEUE && !rap_recv (r, c)) {
+		return false;
+	}
+	q = &c->q[(c->qhead + c->qlen) % RAP_QUEUE];
+	q->tag = c->tag++;
+	q->len = len;
+	q->dst = dst;
+	q->page = page;
+	c->qlen++;
+	p = c->out + c->outlen;
+	p[0] = RAP_RMT_READ2;
+	r_write_be32 (p + 1, q->tag);
+	r_write_be64 (p + 5, addr);
+	r_write_be32 (p + 13, len);
+	p[17] = (r->features & RAP_V2_LZ4)? RAP_V2_LZ4: 0;
+	c->outlen += RAP_V2_READ_REQ;
+	if (page) {
+		page->addr = addr;
+		page->state = PAGE_PENDING;
+		page->used = c->stamp;
+	}
+	return true;
+}
+
+static RapPage *rap_page_find(RapCache *c, ut64 addr) {
+	int i;
+	for (i = 0; i < RAP_PAGES; i++) {
+		RapPage *p = &c->pages[i];
+		if (p->state != PAGE_FREE && p->addr == addr) {
+			return p;
+		}
+	}
+	return NULL;
+}
+
+/* a free page or the least used one, never one in flight or in use by
+ * the current read */
+static RapPage *rap_page_new(RapCache *c) {
+	RapPage *best = NULL;
+	int i;
+	for (i = 0; i < RAP_PAGES; i++) {
+		RapPage *p = &c->pages[i];
+		if (p->state == PAGE_FREE) {
+			return p;
+		}
+		if (p->state == PAGE_READY && p->used < c->stamp
+				&& (!best || p->used < best->used)) {
+			best = p;
+		}
+	}
+	return best;
+}
+
+/* asks for the page at addr unless it is cached or coming */
+static RapPage *rap_page_ask(RIORap *r, RapCache *c, ut64 addr, bool wait) {
+	RapPage *p = rap_page_find (c, addr);
+	if (p) {
+		p->used = c->stamp;
+		return p;
+	}
+	p = rap_page_new (c);
+	if (!p && wait && rap_drain (r, c)) {
+		p = rap_page_new (c);
+	}
+	if (p && !rap_ask (r, c, addr, RAP_PAGE, p->data, p)) {
+		return NULL;
+	}
+	return p;
+}
+
+static int rap_read_v2(RIORap *r, RapCache *c, ut8 *buf, int count) {
+	ut64 addr = r->off, first, last, a;
+	bool seq = addr >= c->prev && addr <= c->next + RAP_PAGE;
+	int i, n;
+	if (addr + count - 1 < addr) {
+		count = (int)(UT64_MAX - addr) + 1;
+	}
+	c->prev = addr;
+	c->next = addr + count;
+	if (count >= RAP_DIRECT) {
+		for (i = 0; i < count; i += n) {
+			n = R_MIN (count - i, R_MIN (RAP_CHUNK, r->maxlen));
+			if (!rap_ask (r, c, addr + i, n, buf + i, NULL)) {
+				goto fail;
+			}
+		}
+		if (!rap_drain (r, c)) {
+			goto fail;
+		}
+		r->off += count;
 		return count;
 	}
-	// TOOD: if count > RMT_MAX iterate !
+	c->stamp++;
+	first = addr & ~(ut64)(RAP_PAGE - 1);
+	last = (addr + count - 1) & ~(ut64)(RAP_PAGE - 1);
+	for (a = first;; a += RAP_PAGE) {
+		if (!rap_page_ask (r, c, a, true)) {
+			goto fail;
+		}
+		if (a == last) {
+			break;
+		}
+	}
+	c->ahead = seq? R_MIN (R_MAX (c->ahead * 2, 1), RAP_AHEAD): 0;
+	for (i = 0, a = last + RAP_PAGE; i < c->ahead && a > last; i++, a += RAP_PAGE) {
+		if (!rap_page_ask (r, c, a, false)) {
+			break;
+		}
+	}
+	for (a = first, i = 0; i < count; a += RAP_PAGE) {
+		RapPage *p = rap_page_find (c, a);
+		int delta = (int)(addr + i - a);
+		while (p && p->state == PAGE_PENDING) {
+			if (!rap_recv (r, c)) {
+				goto fail;
+			}
+		}
+		if (!p) {
+			goto fail;
+		}
+		n = R_MIN (RAP_PAGE - delta, count - i);
+		memcpy (buf + i, p->data + delta, n);
+		i += n;
+	}
+	if (!rap_push (r, c)) {
+		goto fail;
+	}
+	r->off += count;
+	return count;
+fail:
+	rap_cache_reset (c);
+	return -1;
+}
+
+static int rap_write_v2(RIORap *r, RapCache *c, const ut8 *buf, int count) {
+	ut8 tmp[RAP_V2_WRITE_REQ];
+	int i, n, done = 0;
+	if (!rap_drain (r, c)) {
+		return -1;
+	}
+	while (done < count) {
+		ut64 addr = r->off + done;
+		n = R_MIN (count - done, r->maxlen);
+		tmp[0] = RAP_RMT_WRITE2;
+		r_write_be32 (tmp + 1, c->tag);
+		r_write_be64 (tmp + 5, addr);
+		r_write_be32 (tmp + 13, n);
+		r_socket_write (r->client, tmp, RAP_V2_WRITE_REQ);
+		r_socket_write (r->client, (void *)(buf + done), n);
+		r_socket_flush (r->client);
+		if (r_socket_read_block (r->client, tmp, RAP_V2_WRITE_REPLY) != RAP_V2_WRITE_REPLY
+				|| tmp[0] != (RAP_RMT_WRITE2 | RAP_RMT_REPLY)
+				|| r_read_be32 (tmp + 1) != c->tag) {
+			eprintf ("rap: unexpected write reply\n");
+			rap_cache_reset (c);
+			break;
+		}
+		c->tag++;
+		n = (int)r_read_be32 (tmp + 5);
+		if (n < 1) {
+			break;
+		}
+		/* keep the cached pages in sync */
+		for (i = 0; i < RAP_PAGES; i++) {
+			RapPage *p = &c->pages[i];
+			if (p->state == PAGE_READY && p->addr < addr + n && addr < p->addr + RAP_PAGE) {
+				ut64 from = R_MAX (p->addr, addr);
+				ut64 to = R_MIN (p->addr + RAP_PAGE, addr + n);
+				memcpy (p->data + (from - p->addr), buf + done + (from - addr), to - from);
+			}
+		}
+		done += n;
+	}
+	r->off += done;
+	return done? done: -1;
+}
+
+static int rap_write_v1(RSocket *s, const ut8 *buf, int count) {
+	ut8 *tmp;
+	int ret;
+
 	if (count > RMT_MAX) {
 		count = RMT_MAX;
 	}
@@ -46,6 +373,17 @@ static int rap__write(RIO *io, RIODesc *fd, const ut8 *buf, int count) {
 	return ret;
 }
 
+static int rap__write(RIO *io, RIODesc *fd, const ut8 *buf, int count) {
+	RIORap *r = fd->data;
+	if (count < 1) {
+		return count;
+	}
+	if (r->v2) {
+		return rap_write_v2 (r, r->cache, buf, count);
+	}
+	return rap_write_v1 (r->client, buf, count);
+}
+
 static bool rap__accept(RIO *io, RIODesc *desc, int fd) {
 	RIORap *rap = desc->data;
 	if (rap) {
@@ -55,15 +393,10 @@ static bool rap__accept(RIO *io, RIODesc *desc, int fd) {
 	return false;
 }
 
-static int rap__read(RIO *io, RIODesc *fd, ut8 *buf, int count) {
-	RSocket *s = RIORAP_FD (fd);
-	int ret, i = (int)count;
+static int rap_read_v1(RSocket *s, ut8 *buf, int count) {
+	int ret, i;
 	ut8 tmp[5];
 
-	// XXX. if count is > RMT_MAX, just perform multiple queries
-	if (count > RMT_MAX) {
-		count = RMT_MAX;
-	}
 	// send
 	tmp[0] = RMT_READ;
 	r_write_be32 (tmp + 1, count);
@@ -78,7 +411,7 @@ static int rap__read(RIO *io, RIODesc *fd, ut8 *buf, int count) {
 		return -1;
 	}
 	i = r_read_at_be32 (tmp, 1);
-	if (i >count) {
+	if (i > count) {
 		eprintf ("rap__read: Unexpected data size %d\n", i);
 		return -1;
 	}
@@ -86,6 +419,28 @@ static int rap__read(RIO *io, RIODesc *fd, ut8 *buf, int count) {
 	return count;
 }
 
+static ut64 rap__lseek(RIO *io, RIODesc *fd, ut64 offset, int whence);
+
+static int rap__read(RIO *io, RIODesc *fd, ut8 *buf, int count) {
+	RIORap *r = fd->data;
+	ut64 off = r->off;
+	int n, done;
+	if (r->v2) {
+		return rap_read_v2 (r, r->cache, buf, count);
+	}
+	/* the old protocol reads at the remote seek, RMT_MAX at most */
+	for (done = 0; done < count; done += n) {
+		if (done && rap__lseek (io, fd, off + done, R_IO_SEEK_SET) != off + done) {
+			break;
+		}
+		n = rap_read_v1 (r->client, buf + done, R_MIN (count - done, RMT_MAX));
+		if (n < 1) {
+			return done? done: -1;
+		}
+	}
+	return done;
+}
+
 static int rap__close(RIODesc *fd) {
 	int ret = -1;
 	if (RIORAP_IS_VALID (fd)) {
@@ -94,6 +449,7 @@ static int rap__close(RIODesc *fd) {
 			ret = r_socket_close (r->fd);
 			ret = r_socket_close (r->client);
 			//ret = r_socket_close (r->client);
+			rap_cache_free (r->cache);
 			free (fd->data);
 			fd->data = NULL;
 		}
@@ -102,9 +458,22 @@ static int rap__close(RIODesc *fd) {
 }
 
 static ut64 rap__lseek(RIO *io, RIODesc *fd, ut64 offset, int whence) {
+	RIORap *r = fd->data;
 	RSocket *s = RIORAP_FD (fd);
 	ut8 tmp[10];
 	int ret;
+	if (r->v2) {
+		/* reads and writes carry the address */
+		switch (whence) {
+		case R_IO_SEEK_SET:
+			return r->off = offset;
+		case R_IO_SEEK_CUR:
+			return r->off += offset;
+		}
+		if (!rap_drain (r, r->cache)) {
+			return -1;
+		}
+	}
 	// query
 	tmp[0] = RMT_SEEK;
 	tmp[1] = (ut8)whence;
@@ -121,6 +490,7 @@ static ut64 rap__lseek(RIO *io, RIODesc *fd, ut64 offset, int whence) {
 		return -1;
 	}
 	offset = r_read_at_be64 (tmp, 1);
+	r->off = offset;
 	return offset;
 }
 
@@ -209,7 +579,7 @@ static RIODesc *rap__open(RIO *io, const char *pathname, int rw, int mode) {
 	if (file && *file) {
 		// send
 		buf[0] = RMT_OPEN;
-		buf[1] = rw;
+		buf[1] = (rw & ~RAP_V2) | RAP_V2;
 		buf[2] = (ut8)strlen (file);
 		memcpy (buf + 3, file, buf[2]);
 		r_socket_write (rap_fd, buf, buf[2] + 3);
@@ -218,9 +588,19 @@ static RIODesc *rap__open(RIO *io, const char *pathname, int rw, int mode) {
 		eprintf ("waiting... ");
 		buf[0] = 0;
 		r_socket_read_block (rap_fd, (ut8*)buf, 5);
+		if (buf[0] == (char)(RMT_OPEN | RMT_REPLY | RAP_V2)) {
+			/* the server knows v2, old ones just ignore the flag */
+			r_socket_read_block (rap_fd, (ut8*)buf + 5, RAP_V2_OPEN_REPLY - 5);
+			rior->features = r_read_at_be32 (buf, 5);
+			rior->maxlen = R_MIN (r_read_at_be32 (buf, 9), RAP_V2_MAX);
+			rior->cache = rap_cache_new ();
+			rior->v2 = rior->cache && rior->maxlen > 0;
+			buf[0] = RMT_OPEN | RMT_REPLY;
+		}
 		if (buf[0] != (char)(RMT_OPEN | RMT_REPLY)) {
 			eprintf ("rap: Expecting OPEN|REPLY packet. got %02x\n", buf[0]);
 			r_socket_free (rap_fd);
+			rap_cache_free (rior->cache);
 			free (rior);
 			return NULL;
 		}
@@ -264,6 +644,12 @@ static char *rap__system(RIO *io, RIODesc *fd, const char *command) {
 	char *ptr, *res, *str;
 	ut8 buf[RMT_MAX];
 
+	if (RIORAP_IS_VALID (fd) && ((RIORap *)fd->data)->v2) {
+		/* the command can change what is cached */
+		RapCache *c = ((RIORap *)fd->data)->cache;
+		rap_drain (fd->data, c);
+		rap_cache_reset (c);
+	}
 	buf[0] = RMT_CMD;
 	i = strlen (command) + 1;
 	if (i > RMT_MAX - 5) {
@@ -0,0 +1,289 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+/* prefilter for carving (/m). most top-level rules compare bytes at a
+ * fixed offset, those bytes are taken out of the loaded rules once and
+ * searched in the whole buffer, so the full rule walk only runs at the
+ * offsets where one of them is found. the rules without usable bytes
+ * (indirect offsets, ranges, regexes, ..) are kept in a smaller set that
+ * is still tried at every offset, which keeps the results the same */
+
+#include <r_userconf.h>
+#include <r_types.h>
+
+#if !USE_LIB_MAGIC
+
+#include <r_magic.h>
+#include <r_util.h>
+#include "file.h"
+
+#define PAIR(a,b) (((a) << 8) | (b))
+
+static bool string_sig(struct r_magic *m, RMagicSig *s) {
+	int i, len = R_MIN (m->vallen, MAXstring);
+	int from = 0, best = 0, bestlen = 0;
+	const ut8 *v = (const ut8 *)m->value.s;
+	ut32 flags = m->str_flags;
+	/* a compacted blank matches any number of them, the bytes after it
+	 * are not at a fixed position */
+	if (flags & (STRING_COMPACT_BLANK | STRING_COMPACT_OPTIONAL_BLANK)) {
+		for (i = 0; i < len && !isspace (v[i]); i++) {
+		}
+		len = i;
+	}
+	/* zeroes can come from reading past the end of the buffer */
+	while (len > 0 && !v[len - 1]) {
+		len--;
+	}
+	for (i = 0; i <= len; i++) {
+		bool any = i < len && (((flags & STRING_IGNORE_LOWERCASE) && islower (v[i]))
+			|| ((flags & STRING_IGNORE_UPPERCASE) && isupper (v[i])));
+		if (i == len || any) {
+			if (i - from > bestlen) {
+				best = from;
+				bestlen = i - from;
+			}
+			from = i + 1;
+		}
+	}
+	if (bestlen < 1) {
+		return false;
+	}
+	s->offset += best;
+	s->len = bestlen;
+	memcpy (s->bytes, v + best, bestlen);
+	return true;
+}
+
+static bool number_sig(struct r_magic *m, RMagicSig *s) {
+	ut8 v[8], mask[8];
+	int i, size, from = 0, best = 0, bestlen = 0;
+	bool be;
+	switch (m->type) {
+	case FILE_BYTE: size = 1; be = false; break;
+	case FILE_SHORT: size = 2; be = R_SYS_ENDIAN; break;
+	case FILE_BESHORT: size = 2; be = true; break;
+	case FILE_LESHORT: size = 2; be = false; break;
+	case FILE_LONG: size = 4; be = R_SYS_ENDIAN; break;
+	case FILE_BELONG: size = 4; be = true; break;
+	case FILE_LELONG: size = 4; be = false; break;
+	case FILE_QUAD: size = 8; be = R_SYS_ENDIAN; break;
+	case FILE_BEQUAD: size = 8; be = true; break;
+	case FILE_LEQUAD: size = 8; be = false; break;
+	default:
+		return false;
+	}
+	if (m->num_mask && ((m->mask_op & FILE_OPS_MASK) != FILE_OPAND
+			|| (m->mask_op & FILE_OPINVERSE))) {
+		return false;
+	}
+	for (i = 0; i < size; i++) {
+		int shift = 8 * (be? size - 1 - i: i);
+		v[i] = (m->value.q >> shift) & 0xff;
+		mask[i] = m->num_mask? (m->num_mask >> shift) & 0xff: 0xff;
+	}
+	for (i = 0; i <= size; i++) {
+		if (i == size || mask[i] != 0xff) {
+			if (i - from > bestlen) {
+				best = from;
+				bestlen = i - from;
+			}
+			from = i + 1;
+		}
+	}
+	if (bestlen < 1) {
+		return false;
+	}
+	s->offset += best;
+	s->len = bestlen;
+	memcpy (s->bytes, v + best, bestlen);
+	return true;
+}
+
+/* the bytes that must be there for the top-level test m to match */
+static bool magic_sig(struct r_magic *m, RMagicSig *s) {
+	memset (s, 0, sizeof (RMagicSig));
+	if (m->reln != '=' || (m->flag & (INDIR | OFFADD | INDIROFFADD))) {
+		return false;
+	}
+	s->offset = m->offset;
+	s->range = 1;
+	switch (m->type) {
+	case FILE_STRING:
+		return string_sig (m, s);
+	case FILE_SEARCH:
+		if (!m->str_range) {
+			return false;
+		}
+		s->range = m->str_range;
+		return string_sig (m, s);
+	default:
+		return number_sig (m, s);
+	}
+}
+
+static ut32 next_test(struct r_magic *magic, ut32 n, ut32 i) {
+	for (i++; i < n && magic[i].cont_level; i++) {
+	}
+	return i;
+}
+
+static bool filter_add(RMagicFilter *f, RMagicSig *s) {
+	ut32 end = s->offset + s->range - 1 + s->len;
+	if (f->nsigs == f->size) {
+		int n = f->size? f->size * 2: 256;
+		RMagicSig *sigs = realloc (f->sigs, n * sizeof (RMagicSig));
+		int *next = realloc (f->next, n * sizeof (int));
+		if (sigs) {
+			f->sigs = sigs;
+		}
+		if (next) {
+			f->next = next;
+		}
+		if (!sigs || !next) {
+			return false;
+		}
+		f->size = n;
+	}
+	f->sigs[f->nsigs] = *s;
+	if (s->len == 1) {
+		f->next[f->nsigs] = f->heads1[s->bytes[0]];
+		f->heads1[s->bytes[0]] = f->nsigs;
+	} else {
+		int k = PAIR (s->bytes[0], s->bytes[1]);
+		f->next[f->nsigs] = f->heads2[k];
+		f->heads2[k] = f->nsigs;
+	}
+	f->nsigs++;
+	f->lookahead = R_MAX (f->lookahead, end);
+	return true;
+}
+
+/* copies the tests without a signature with their continuations */
+static bool filter_rest(RMagicFilter *f, struct mlist *ml, bool *keep) {
+	struct mlist *rl = R_NEW0 (struct mlist);
+	ut32 i, n = 0;
+	if (!rl) {
+		return false;
+	}
+	for (i = 0; i < ml->nmagic; i++) {
+		n += keep[i];
+	}
+	if (n && !(rl->magic = calloc (n, sizeof (struct r_magic)))) {
+		free (rl);
+		return false;
+	}
+	for (i = 0; i < ml->nmagic; i++) {
+		if (keep[i]) {
+			rl->magic[rl->nmagic++] = ml->magic[i];
+		}
+	}
+	rl->mapped = 0;
+	rl->prev = f->rest->mlist->prev;
+	rl->next = f->rest->mlist;
+	f->rest->mlist->prev->next = rl;
+	f->rest->mlist->prev = rl;
+	f->nrest += n;
+	return true;
+}
+
+R_API RMagicFilter *r_magic_filter_new(RMagic *ms) {
+	RMagicFilter *f;
+	struct mlist *ml;
+	if (!ms || !ms->mlist || !(f = R_NEW0 (RMagicFilter))) {
+		return NULL;
+	}
+	memset (f->heads1, -1, sizeof (f->heads1));
+	if (!(f->heads2 = malloc (65536 * sizeof (int)))) {
+		free (f);
+		return NULL;
+	}
+	memset (f->heads2, -1, 65536 * sizeof (int));
+	if (!(f->rest = r_magic_new (ms->flags))
+			|| !(f->rest->mlist = R_NEW0 (struct mlist))) {
+		r_magic_filter_free (f);
+		return NULL;
+	}
+	f->rest->mlist->next = f->rest->mlist->prev = f->rest->mlist;
+	for (ml = ms->mlist->next; ml != ms->mlist; ml = ml->next) {
+		bool *keep = calloc (ml->nmagic + 1, sizeof (bool));
+		ut32 i, j, end;
+		if (!keep) {
+			r_magic_filter_free (f);
+			return NULL;
+		}
+		for (i = 0; i < ml->nmagic; i = end) {
+			RMagicSig s;
+			end = next_test (ml->magic, ml->nmagic, i);
+			if (magic_sig (&ml->magic[i], &s) && filter_add (f, &s)) {
+				continue;
+			}
+			for (j = i; j < end; j++) {
+				keep[j] = true;
+			}
+		}
+		if (!filter_rest (f, ml, keep)) {
+			free (keep);
+			r_magic_filter_free (f);
+			return NULL;
+		}
+		free (keep);
+	}
+	return f;
+}
+
+R_API void r_magic_filter_free(RMagicFilter *f) {
+	if (f) {
+		r_magic_free (f->rest);
+		free (f->heads2);
+		free (f->sigs);
+		free (f->next);
+		free (f);
+	}
+}
+
+static void mark(RMagicFilter *f, int sig, const ut8 *buf, int len, int p, ut8 *hits, int n) {
+	for (; sig != -1; sig = f->next[sig]) {
+		RMagicSig *s = &f->sigs[sig];
+		int c, from, to;
+		if (p + s->len > len || memcmp (buf + p, s->bytes, s->len)) {
+			continue;
+		}
+		/* the candidates this occurrence can belong to */
+		to = p - (int)s->offset;
+		from = to - (int)s->range + 1;
+		for (c = R_MAX (from, 0); c <= to && c < n; c++) {
+			hits[c] = 1;
+		}
+	}
+}
+
+/* sets hits[i] for every offset i < n of buf where a rule with a
+ * signature can match, buf should hold n + lookahead bytes. returns
+ * how many offsets were marked */
+R_API int r_magic_filter_scan(RMagicFilter *f, const ut8 *buf, int len, ut8 *hits, int n) {
+	int p, i, count = 0;
+	memset (hits, 0, n);
+	for (p = 0; p < len; p++) {
+		int k = f->heads1[buf[p]];
+		if (k != -1) {
+			mark (f, k, buf, len, p, hits, n);
+		}
+		if (p + 1 < len) {
+			k = f->heads2[PAIR (buf[p], buf[p + 1])];
+			if (k != -1) {
+				mark (f, k, buf, len, p, hits, n);
+			}
+		}
+	}
+	for (i = 0; i < n; i++) {
+		count += hits[i];
+	}
+	return count;
+}
+
+/* what the rules without a signature say about buf */
+R_API const char *r_magic_filter_buffer(RMagicFilter *f, const void *buf, size_t nb) {
+	return r_magic_buffer (f->rest, buf, nb);
+}
+
+#endif
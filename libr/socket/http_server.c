@@ -1,6 +1,9 @@
 /* radare - LGPL - Copyright 2012-2016 - pancake */
 
 #include <r_socket.h>
+#include <r_util.h>
+
+#define HTTP_CHUNK (64 * 1024)
 
 static bool *breaked = NULL;
 
@@ -9,16 +12,33 @@ R_API void r_socket_http_server_set_breaked(bool *b) {
 }
 
 R_API RSocketHTTPRequest *r_socket_http_accept (RSocket *s, int timeout) {
+	RSocketHTTPRequest *hr;
+	RSocket *c = r_socket_accept (s);
+	if (!c) {
+		return NULL;
+	}
+	hr = r_socket_http_request (c, timeout);
+	if (hr) {
+		/* one request per connection */
+		hr->keepalive = false;
+		hr->chunked = false;
+	}
+	return hr;
+}
+
+/* reads a request from a connected client, the socket belongs to the
+ * request from now on and it is freed with it */
+R_API RSocketHTTPRequest *r_socket_http_request (RSocket *c, int timeout) {
 	int content_length = 0, xx, yy;
 	int pxx = 1, first = 0;
+	bool close = false, keep = false;
 	char buf[1500], *p, *q;
 	RSocketHTTPRequest *hr = R_NEW0 (RSocketHTTPRequest);
-	if (!hr) return NULL;
-	hr->s = r_socket_accept (s);
-	if (!hr->s) {
-		free (hr);
+	if (!hr) {
+		r_socket_free (c);
 		return NULL;
 	}
+	hr->s = c;
 	if (timeout>0)
 		r_socket_block_time (hr->s, 1, timeout);
 	for (;;) {
@@ -46,7 +66,10 @@ R_API RSocketHTTPRequest *r_socket_http_accept (RSocket *s, int timeout) {
 			hr->method = strdup (buf);
 			if (p) {
 				q = strstr (p+1, " HTTP"); //strchr (p+1, ' ');
-				if (q) *q = 0;
+				if (q) {
+					hr->chunked = !strncmp (q, " HTTP/1.1", 9);
+					*q = 0;
+				}
 				hr->path = strdup (p+1);
 			}
 		} else {
@@ -61,11 +84,26 @@ R_API RSocketHTTPRequest *r_socket_http_accept (RSocket *s, int timeout) {
 			} else
 			if (!strncmp (buf, "Content-Length: ", 16)) {
 				content_length = atoi (buf+16);
+			} else
+			if (!strncmp (buf, "Connection: ", 12)) {
+				close = r_str_casestr (buf + 12, "close") != NULL;
+				keep = r_str_casestr (buf + 12, "keep-alive") != NULL;
 			}
 		}
 	}
+	hr->keepalive = !close && (hr->chunked || keep);
+#if __UNIX__
+	if (hr->keepalive) {
+		/* the response is written in pieces, do not wait for acks */
+		int one = 1;
+		setsockopt (hr->s->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof (one));
+	}
+#endif
+	if (content_length > 0 || (hr->keepalive && r_socket_ready (hr->s, 0, 0) > 0)) {
+		/* the \n of the last \r\n is still there */
+		r_socket_read_block (hr->s, (ut8*)buf, 1);
+	}
 	if (content_length>0) {
-		r_socket_read_block (hr->s, (ut8*)buf, 1); // one missing byte wtf
 		hr->data = malloc (content_length+1);
 		hr->data_length = content_length;
 		r_socket_read_block (hr->s, hr->data, hr->data_length);
@@ -83,9 +121,29 @@ R_API void r_socket_http_response (RSocketHTTPRequest *rs, int code, const char
 		"UNKNOWN";
 	if (len<1) len = out? strlen (out): 0;
 	if (!headers) headers = "";
-	r_socket_printf (rs->s, "HTTP/1.0 %d %s\r\n%s"
-		"Connection: close\r\nContent-Length: %d\r\n\r\n",
-		code, strcode, headers, len);
+	if (!rs->keepalive) {
+		r_socket_printf (rs->s, "HTTP/1.0 %d %s\r\n%s"
+			"Connection: close\r\nContent-Length: %d\r\n\r\n",
+			code, strcode, headers, len);
+	} else if (rs->chunked && len > HTTP_CHUNK) {
+		/* big outputs go in pieces, the client can start with the first */
+		int i, n;
+		r_socket_printf (rs->s, "HTTP/1.1 %d %s\r\n%s"
+			"Connection: keep-alive\r\nTransfer-Encoding: chunked\r\n\r\n",
+			code, strcode, headers);
+		for (i = 0; i < len; i += n) {
+			n = R_MIN (len - i, HTTP_CHUNK);
+			r_socket_printf (rs->s, "%x\r\n", n);
+			r_socket_write (rs->s, (void*)(out + i), n);
+			r_socket_write (rs->s, "\r\n", 2);
+		}
+		r_socket_write (rs->s, "0\r\n\r\n", 5);
+		return;
+	} else {
+		r_socket_printf (rs->s, "HTTP/1.%d %d %s\r\n%s"
+			"Connection: keep-alive\r\nContent-Length: %d\r\n\r\n",
+			rs->chunked, code, strcode, headers, len);
+	}
 	if (out && len>0) r_socket_write (rs->s, (void*)out, len);
 }
 
@@ -124,7 +182,9 @@ R_API ut8 *r_socket_http_handle_upload(const ut8 *str, int len, int *retlen) {
 
 /* close client socket and free struct */
 R_API void r_socket_http_close (RSocketHTTPRequest *rs) {
-	r_socket_free (rs->s);
+	if (rs->s) {
+		r_socket_free (rs->s);
+	}
 	free (rs->path);
 	free (rs->host);
 	free (rs->agent);
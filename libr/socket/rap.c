@@ -0,0 +1,126 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+/* rap v2 bits shared by the io plugin and the servers */
+
+#include <r_socket.h>
+#include <r_util.h>
+#include "../../shlr/lz4/lz4.h"
+
+/* smaller blocks are not worth the time */
+#define PACK_MIN 512
+
+R_API int r_socket_rap_pack_bound(int len) {
+	return LZ4_compressBound (len);
+}
+
+/* compresses src into dst, returns 0 when it does not pay off */
+R_API int r_socket_rap_pack(ut8 *dst, int dlen, const ut8 *src, int len) {
+	int n;
+	if (len < PACK_MIN) {
+		return 0;
+	}
+	n = LZ4_compress_default ((const char *)src, (char *)dst, len, dlen);
+	return (n > 0 && n < len - len / 8)? n: 0;
+}
+
+R_API bool r_socket_rap_unpack(ut8 *dst, int len, const ut8 *src, int zlen) {
+	return LZ4_decompress_safe ((const char *)src, (char *)dst, zlen, len) == len;
+}
+
+R_API void r_socket_rap_v2_open_reply(ut8 *buf, int fd) {
+	buf[0] = RAP_RMT_OPEN | RAP_RMT_REPLY | RAP_V2;
+	r_write_be32 (buf + 1, fd);
+	r_write_be32 (buf + 5, RAP_V2_LZ4);
+	r_write_be32 (buf + 9, RAP_V2_MAX);
+}
+
+static bool grow(RSocketRapV2 *v, int size) {
+	if (size > v->size) {
+		ut8 *buf = realloc (v->buf, size);
+		if (!buf) {
+			return false;
+		}
+		v->buf = buf;
+		v->size = size;
+	}
+	return true;
+}
+
+static bool serve_read(RSocketRapV2 *v, RSocket *s) {
+	ut8 req[RAP_V2_READ_REQ], *out, *z;
+	int len, n, zlen = 0, bound;
+	ut64 addr;
+	if (r_socket_read_block (s, req + 1, RAP_V2_READ_REQ - 1) != RAP_V2_READ_REQ - 1) {
+		return false;
+	}
+	addr = r_read_be64 (req + 5);
+	len = (int)R_MIN (r_read_be32 (req + 13), RAP_V2_MAX);
+	bound = r_socket_rap_pack_bound (len);
+	/* reply header and data, then room for the packed copy */
+	if (!grow (v, 2 * RAP_V2_READ_REPLY + len + bound)) {
+		return false;
+	}
+	out = v->buf;
+	n = len > 0? v->read_at (v->user, addr, out + RAP_V2_READ_REPLY, len): 0;
+	if (n < 0) {
+		n = 0;
+	}
+	if (n < len) {
+		/* past the end of the file */
+		memset (out + RAP_V2_READ_REPLY + n, 0xff, len - n);
+	}
+	if (req[17] & RAP_V2_LZ4) {
+		z = out + 2 * RAP_V2_READ_REPLY + len;
+		zlen = r_socket_rap_pack (z, bound, out + RAP_V2_READ_REPLY, len);
+		if (zlen) {
+			out = z - RAP_V2_READ_REPLY;
+		}
+	}
+	out[0] = RAP_RMT_READ2 | RAP_RMT_REPLY;
+	memcpy (out + 1, req + 1, 4);
+	r_write_be32 (out + 5, len);
+	r_write_be32 (out + 9, zlen);
+	r_socket_write (s, out, RAP_V2_READ_REPLY + (zlen? zlen: len));
+	r_socket_flush (s);
+	return true;
+}
+
+static bool serve_write(RSocketRapV2 *v, RSocket *s) {
+	ut8 req[RAP_V2_WRITE_REQ];
+	int len, ret;
+	ut64 addr;
+	if (r_socket_read_block (s, req + 1, RAP_V2_WRITE_REQ - 1) != RAP_V2_WRITE_REQ - 1) {
+		return false;
+	}
+	addr = r_read_be64 (req + 5);
+	len = (int)r_read_be32 (req + 13);
+	if (len < 0 || len > RAP_V2_MAX || !grow (v, R_MAX (len, RAP_V2_WRITE_REPLY))) {
+		return false;
+	}
+	if (len > 0 && r_socket_read_block (s, v->buf, len) != len) {
+		return false;
+	}
+	ret = len? v->write_at (v->user, addr, v->buf, len): 0;
+	req[0] = RAP_RMT_WRITE2 | RAP_RMT_REPLY;
+	r_write_be32 (req + 5, ret);
+	r_socket_write (s, req, RAP_V2_WRITE_REPLY);
+	r_socket_flush (s);
+	return true;
+}
+
+/* handles a READ2 or WRITE2 request whose opcode was already read,
+ * returns false when the connection is not usable anymore */
+R_API bool r_socket_rap_v2_serve(RSocketRapV2 *v, RSocket *s, ut8 op) {
+	switch (op) {
+	case RAP_RMT_READ2:
+		return v->read_at && serve_read (v, s);
+	case RAP_RMT_WRITE2:
+		return v->write_at && serve_write (v, s);
+	}
+	return false;
+}
+
+R_API void r_socket_rap_v2_fini(RSocketRapV2 *v) {
+	R_FREE (v->buf);
+	v->size = 0;
+}
@@ -42,6 +42,7 @@ R_API RSocketRapServer *r_socket_rap_server_create (const char *pathname) {
 R_API void r_socket_rap_server_free (RSocketRapServer *rap_s) {
 	if (rap_s) {
 		r_socket_free (rap_s->fd);
+		r_socket_rap_v2_fini (&rap_s->v2);
 	}
 	free (rap_s);
 }
@@ -77,9 +78,19 @@ R_API bool r_socket_rap_server_continue (RSocketRapServer *rap_s) {
 	case RAP_RMT_OPEN:
 		r_socket_read_block (rap_s->fd, &rap_s->buf[1], 2);
 		r_socket_read_block (rap_s->fd, &rap_s->buf[3], (int)rap_s->buf[2]);
-		rap_s->open (rap_s->user, (const char *)&rap_s->buf[3], (int)rap_s->buf[1], 0);
-		rap_s->buf[0] = RAP_RMT_OPEN | RAP_RMT_REPLY;
-		r_socket_write (rap_s->fd, rap_s->buf, 5);
+		rap_s->buf[3 + rap_s->buf[2]] = 0;
+		{
+		bool v2 = (rap_s->buf[1] & RAP_V2) && rap_s->read_at && rap_s->write_at;
+		int fd = rap_s->open (rap_s->user, (const char *)&rap_s->buf[3],
+			(int)(rap_s->buf[1] & ~RAP_V2), 0);
+		if (v2) {
+			r_socket_rap_v2_open_reply (rap_s->buf, fd);
+			r_socket_write (rap_s->fd, rap_s->buf, RAP_V2_OPEN_REPLY);
+		} else {
+			rap_s->buf[0] = RAP_RMT_OPEN | RAP_RMT_REPLY;
+			r_socket_write (rap_s->fd, rap_s->buf, 5);
+		}
+		}
 		r_socket_flush (rap_s->fd);
 		break;
 	case RAP_RMT_READ:
@@ -141,6 +152,16 @@ R_API bool r_socket_rap_server_continue (RSocketRapServer *rap_s) {
 		r_socket_write (rap_s->fd, rap_s->buf, 5);
 		r_socket_flush (rap_s->fd);
 		break;
+	case RAP_RMT_READ2:
+	case RAP_RMT_WRITE2:
+		rap_s->v2.read_at = rap_s->read_at;
+		rap_s->v2.write_at = rap_s->write_at;
+		rap_s->v2.user = rap_s->user;
+		if (!r_socket_rap_v2_serve (&rap_s->v2, rap_s->fd, rap_s->buf[0])) {
+			r_socket_close (rap_s->fd);
+			return false;
+		}
+		break;
 	default:
 		eprintf ("unknown command 0x%02x\n", (ut8)(rap_s->buf[0] & 0xff));
 		r_socket_close (rap_s->fd);
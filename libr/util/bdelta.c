@@ -0,0 +1,375 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+#include <r_util.h>
+#include <r_diff.h>
+
+/* rsync-style block matcher: the old file is split in bsize blocks which
+ * are indexed by a rolling rabin-karp hash, then a window of the same size
+ * slides over the new file one byte at a time and every hit is verified
+ * and grown in both directions. the result is a list of copy (from the old
+ * file) and insert (literal bytes) ops that rebuilds the new file, found in
+ * linear time no matter how much data was inserted or shifted around.
+ *
+ * the binary patch format built on top of it:
+ *
+ *   "R2DP" 0x01
+ *   uleb128 old size, uleb128 new size
+ *   le32 adler32 of the old file, le32 adler32 of the new file
+ *   ops, terminated by a 0 byte:
+ *     uleb128 (len << 1) | 1, zigzag uleb128 (src - last copy end)   copy
+ *     uleb128 len << 1, len bytes                                    insert
+ */
+
+#define RK_PRIME 0x100000001b3ULL
+#define RK_MIX 0x9e3779b97f4a7c15ULL
+#define MOD_ADLER 65521
+#define NMAX_ADLER 5552
+#define PATCH_MAGIC "R2DP\x01"
+#define PATCH_MAGIC_LEN 5
+
+typedef struct {
+	ut32 tag;	/* low bits of the hash */
+	ut32 idx;	/* block index + 1, 0 is an empty slot */
+} BlockSlot;
+
+typedef struct {
+	BlockSlot *slots;
+	ut64 mask;
+	int bits;
+	/* one bit per 8 bytes of the table, small enough to stay in cache
+	 * so most misses never touch the table itself */
+	ut64 *filter;
+	ut64 fmask;
+} BlockIndex;
+
+typedef struct {
+	ut8 *buf;
+	ut64 len;
+	ut64 size;
+	ut64 last;	/* end of the last copy in the old file */
+} PatchBuf;
+
+static inline ut64 rk_hash(const ut8 *buf, int len) {
+	ut64 h = 0;
+	int i;
+	for (i = 0; i < len; i++) {
+		h = h * RK_PRIME + buf[i];
+	}
+	return h;
+}
+
+static inline ut64 rk_slot(BlockIndex *bi, ut64 h) {
+	return (h * RK_MIX) >> (64 - bi->bits);
+}
+
+static inline ut64 rk_filter(BlockIndex *bi, ut64 h) {
+	return (h * RK_MIX) & bi->fmask;
+}
+
+static bool index_build(BlockIndex *bi, const ut8 *a, ut64 la, int bsize) {
+	ut64 i, s, f, n = la / bsize;
+	bi->bits = 4;
+	while ((1ULL << bi->bits) < n * 2) {
+		bi->bits++;
+	}
+	bi->mask = (1ULL << bi->bits) - 1;
+	bi->fmask = (bi->mask + 1) * 8 - 1;
+	bi->slots = calloc (bi->mask + 1, sizeof (BlockSlot));
+	bi->filter = calloc ((bi->fmask + 1) / 64, sizeof (ut64));
+	if (!bi->slots || !bi->filter) {
+		return false;
+	}
+	for (i = 0; i < n; i++) {
+		ut64 h = rk_hash (a + i * bsize, bsize);
+		/* repeated blocks keep the first one, so runs of padding
+		 * do not pile up in a single probe chain */
+		for (s = rk_slot (bi, h); bi->slots[s].idx; s = (s + 1) & bi->mask) {
+			if (bi->slots[s].tag == (ut32)h) {
+				break;
+			}
+		}
+		if (!bi->slots[s].idx) {
+			bi->slots[s].tag = (ut32)h;
+			bi->slots[s].idx = (ut32)(i + 1);
+			f = rk_filter (bi, h);
+			bi->filter[f >> 6] |= 1ULL << (f & 63);
+		}
+	}
+	return true;
+}
+
+/* candidate block for the hash, the caller verifies the contents */
+static ut64 index_find(BlockIndex *bi, ut64 h) {
+	ut64 s, f = rk_filter (bi, h);
+	if (!(bi->filter[f >> 6] & (1ULL << (f & 63)))) {
+		return 0;
+	}
+	for (s = rk_slot (bi, h); bi->slots[s].idx; s = (s + 1) & bi->mask) {
+		if (bi->slots[s].tag == (ut32)h) {
+			return bi->slots[s].idx;
+		}
+	}
+	return 0;
+}
+
+static void index_fini(BlockIndex *bi) {
+	free (bi->slots);
+	free (bi->filter);
+}
+
+/* length of the common prefix, compared a word at a time */
+static ut64 match_forward(const ut8 *a, const ut8 *b, ut64 max) {
+	ut64 wa, wb, i = 0;
+	for (; i + 8 <= max; i += 8) {
+		memcpy (&wa, a + i, sizeof (wa));
+		memcpy (&wb, b + i, sizeof (wb));
+		if (wa != wb) {
+			break;
+		}
+	}
+	for (; i < max && a[i] == b[i]; i++) {
+		;
+	}
+	return i;
+}
+
+static bool emit(RDiffBlockCallback cb, void *user, bool copy, ut64 a_off, ut64 b_off, ut64 len, const ut8 *data) {
+	RDiffBlock op = { copy, a_off, b_off, len, copy? NULL: data };
+	return !len || cb (user, &op);
+}
+
+R_API bool r_diff_blocks(const ut8 *a, ut64 la, const ut8 *b, ut64 lb, int bsize, RDiffBlockCallback cb, void *user) {
+	BlockIndex bi = {0};
+	ut64 h, pow = 1, pos = 0, ins = 0;
+	int i;
+
+	if (!cb || (la && !a) || (lb && !b)) {
+		return false;
+	}
+	if (bsize < 1) {
+		bsize = R_DIFF_BLOCK_SIZE;
+	}
+	if (la / bsize >= UT32_MAX) {
+		eprintf ("r_diff_blocks: too many blocks, use a bigger block size\n");
+		return false;
+	}
+	if (la < bsize || lb < bsize) {
+		return emit (cb, user, false, 0, 0, lb, b);
+	}
+	if (!index_build (&bi, a, la, bsize)) {
+		index_fini (&bi);
+		return false;
+	}
+	for (i = 1; i < bsize; i++) {
+		pow *= RK_PRIME;
+	}
+	h = rk_hash (b, bsize);
+	while (pos + bsize <= lb) {
+		ut64 idx = index_find (&bi, h);
+		if (idx) {
+			ut64 src = (idx - 1) * bsize;
+			if (!memcmp (a + src, b + pos, bsize)) {
+				ut64 back = 0, len;
+				while (pos - back > ins && src > back && a[src - back - 1] == b[pos - back - 1]) {
+					back++;
+				}
+				src -= back;
+				pos -= back;
+				len = bsize + back;
+				len += match_forward (a + src + len, b + pos + len, R_MIN (la - src - len, lb - pos - len));
+				if (!emit (cb, user, false, 0, ins, pos - ins, b + ins)
+						|| !emit (cb, user, true, src, pos, len, NULL)) {
+					index_fini (&bi);
+					return false;
+				}
+				pos += len;
+				ins = pos;
+				if (pos + bsize <= lb) {
+					h = rk_hash (b + pos, bsize);
+				}
+				continue;
+			}
+		}
+		if (pos + bsize < lb) {
+			h = (h - b[pos] * pow) * RK_PRIME + b[pos + bsize];
+		}
+		pos++;
+	}
+	index_fini (&bi);
+	return emit (cb, user, false, 0, ins, lb - ins, b + ins);
+}
+
+static ut32 adler32(const ut8 *buf, ut64 len) {
+	ut32 s1 = 1, s2 = 0;
+	ut64 i, j, n;
+	for (i = 0; i < len; i += n) {
+		n = R_MIN (len - i, NMAX_ADLER);
+		for (j = 0; j < n; j++) {
+			s1 += buf[i + j];
+			s2 += s1;
+		}
+		s1 %= MOD_ADLER;
+		s2 %= MOD_ADLER;
+	}
+	return (s2 << 16) | s1;
+}
+
+static bool patch_reserve(PatchBuf *pb, ut64 n) {
+	if (pb->len + n > pb->size) {
+		ut64 size = R_MAX (pb->size * 2, pb->len + n);
+		ut8 *buf = realloc (pb->buf, size);
+		if (!buf) {
+			return false;
+		}
+		pb->buf = buf;
+		pb->size = size;
+	}
+	return true;
+}
+
+static bool patch_uleb(PatchBuf *pb, ut64 v) {
+	if (!patch_reserve (pb, 10)) {
+		return false;
+	}
+	do {
+		ut8 c = v & 0x7f;
+		v >>= 7;
+		pb->buf[pb->len++] = v? c | 0x80: c;
+	} while (v);
+	return true;
+}
+
+static bool patch_bytes(PatchBuf *pb, const ut8 *buf, ut64 len) {
+	if (!patch_reserve (pb, len)) {
+		return false;
+	}
+	memcpy (pb->buf + pb->len, buf, len);
+	pb->len += len;
+	return true;
+}
+
+static bool patch_op(void *user, RDiffBlock *op) {
+	PatchBuf *pb = user;
+	if (op->copy) {
+		st64 d = (st64)(op->a_off - pb->last);
+		pb->last = op->a_off + op->len;
+		return patch_uleb (pb, (op->len << 1) | 1)
+			&& patch_uleb (pb, ((ut64)d << 1) ^ (ut64)(d >> 63));
+	}
+	return patch_uleb (pb, op->len << 1) && patch_bytes (pb, op->data, op->len);
+}
+
+R_API ut8 *r_diff_patch_new(const ut8 *a, ut64 la, const ut8 *b, ut64 lb, int bsize, ut64 *len) {
+	PatchBuf pb = {0};
+	ut8 sums[8];
+	r_write_le32 (sums, adler32 (a, la));
+	r_write_le32 (sums + 4, adler32 (b, lb));
+	if (!patch_bytes (&pb, (const ut8 *)PATCH_MAGIC, PATCH_MAGIC_LEN)
+			|| !patch_uleb (&pb, la) || !patch_uleb (&pb, lb)
+			|| !patch_bytes (&pb, sums, sizeof (sums))
+			|| !r_diff_blocks (a, la, b, lb, bsize, patch_op, &pb)
+			|| !patch_uleb (&pb, 0)) {
+		free (pb.buf);
+		return NULL;
+	}
+	if (len) {
+		*len = pb.len;
+	}
+	return pb.buf;
+}
+
+static const ut8 *read_uleb(const ut8 *p, const ut8 *end, ut64 *v) {
+	int s;
+	*v = 0;
+	for (s = 0; p < end && s < 64; s += 7) {
+		ut8 c = *p++;
+		*v |= (ut64)(c & 0x7f) << s;
+		if (!(c & 0x80)) {
+			return p;
+		}
+	}
+	return NULL;
+}
+
+static const ut8 *patch_header(const ut8 *patch, ut64 plen, ut64 *la, ut64 *lb, ut32 *suma, ut32 *sumb) {
+	const ut8 *end = patch + plen;
+	const ut8 *p = patch + PATCH_MAGIC_LEN;
+	if (plen < PATCH_MAGIC_LEN || memcmp (patch, PATCH_MAGIC, PATCH_MAGIC_LEN)) {
+		return NULL;
+	}
+	if (!(p = read_uleb (p, end, la)) || !(p = read_uleb (p, end, lb)) || end - p < 8) {
+		return NULL;
+	}
+	*suma = r_read_le32 (p);
+	*sumb = r_read_le32 (p + 4);
+	return p + 8;
+}
+
+R_API bool r_diff_patch_info(const ut8 *patch, ut64 plen, ut64 *la, ut64 *lb) {
+	ut64 a, b;
+	ut32 suma, sumb;
+	if (!patch || !patch_header (patch, plen, &a, &b, &suma, &sumb)) {
+		return false;
+	}
+	if (la) {
+		*la = a;
+	}
+	if (lb) {
+		*lb = b;
+	}
+	return true;
+}
+
+R_API ut8 *r_diff_patch_apply(const ut8 *a, ut64 la, const ut8 *patch, ut64 plen, ut64 *len) {
+	const ut8 *end = patch + plen;
+	const ut8 *p;
+	ut64 ola, olb, v, last = 0, at = 0;
+	ut32 suma, sumb;
+	ut8 *out;
+
+	if (!patch || !(p = patch_header (patch, plen, &ola, &olb, &suma, &sumb))) {
+		eprintf ("r_diff_patch_apply: invalid patch\n");
+		return NULL;
+	}
+	if (ola != la || adler32 (a, la) != suma) {
+		eprintf ("r_diff_patch_apply: the patch was made for a different file\n");
+		return NULL;
+	}
+	if (!(out = malloc (olb + 1))) {
+		return NULL;
+	}
+	while ((p = read_uleb (p, end, &v)) && v) {
+		ut64 n = v >> 1;
+		if (n > olb - at) {
+			break;
+		}
+		if (v & 1) {
+			ut64 z;
+			if (!(p = read_uleb (p, end, &z))) {
+				break;
+			}
+			last += (ut64)((st64)(z >> 1) ^ -(st64)(z & 1));
+			if (last > la || n > la - last) {
+				break;
+			}
+			memcpy (out + at, a + last, n);
+			last += n;
+		} else {
+			if (n > (ut64)(end - p)) {
+				break;
+			}
+			memcpy (out + at, p, n);
+			p += n;
+		}
+		at += n;
+	}
+	if (!p || v || at != olb || adler32 (out, olb) != sumb) {
+		eprintf ("r_diff_patch_apply: corrupted patch\n");
+		free (out);
+		return NULL;
+	}
+	if (len) {
+		*len = olb;
+	}
+	return out;
+}
@@ -413,16 +413,337 @@ R_API bool r_diff_buffers_distance_original(RDiff *diff, const ut8 *a, ut32 la,
 	return true;
 }
 
+/* Myers' bit-vector edit distance with Hyyrö's multi-word blocks: the
+ * column of the DP matrix over the shorter buffer is kept as vertical
+ * +1/-1 deltas packed in 64 bit words, so every byte of the longer buffer
+ * costs ceil(m/64) word steps instead of m cell updates. the result is the
+ * same Levenshtein distance computed by r_diff_buffers_distance_original */
+static bool bitvector_distance(const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, bool verbose) {
+	const ut8 *t;
+	ut64 *peq, *pv, *mv;
+	ut32 i, j, w, blk, lastbit;
+	st64 score;
+
+	if (la < lb) {
+		i = la;
+		la = lb;
+		lb = i;
+		t = a;
+		a = b;
+		b = t;
+	}
+	if (!lb) {
+		*distance = la;
+		return true;
+	}
+	w = (lb + 63) / 64;
+	peq = calloc ((size_t)w * 256, sizeof (ut64));
+	pv = malloc ((size_t)w * sizeof (ut64));
+	mv = calloc (w, sizeof (ut64));
+	if (!peq || !pv || !mv) {
+		free (peq);
+		free (pv);
+		free (mv);
+		return false;
+	}
+	for (i = 0; i < lb; i++) {
+		peq[(size_t)b[i] * w + i / 64] |= 1ULL << (i % 64);
+	}
+	memset (pv, 0xff, (size_t)w * sizeof (ut64));
+	lastbit = (lb - 1) % 64;
+	score = lb;
+	for (j = 0; j < la; j++) {
+		const ut64 *eqs = peq + (size_t)a[j] * w;
+		/* the top row of the matrix grows by one on every column */
+		int hin = 1;
+		for (blk = 0; blk < w; blk++) {
+			ut64 Pv = pv[blk], Mv = mv[blk], Eq = eqs[blk];
+			ut64 hneg = hin < 0, hpos = hin > 0;
+			ut64 Xv = Eq | Mv;
+			Eq |= hneg;
+			ut64 Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+			ut64 Ph = Mv | ~(Xh | Pv);
+			ut64 Mh = Pv & Xh;
+			int bit = (blk + 1 == w)? lastbit: 63;
+			hin = (int)((Ph >> bit) & 1) - (int)((Mh >> bit) & 1);
+			Ph = (Ph << 1) | hpos;
+			Mh = (Mh << 1) | hneg;
+			pv[blk] = Mh | ~(Xv | Ph);
+			mv[blk] = Ph & Xv;
+		}
+		score += hin;
+		if (verbose && !(j % 100000)) {
+			eprintf ("\rProcessing %" PFMT32u " of %" PFMT32u "\r", j, la);
+		}
+	}
+	free (peq);
+	free (pv);
+	free (mv);
+	*distance = (ut32)score;
+	return true;
+}
+
+R_API bool r_diff_buffers_distance_bitparallel(RDiff *diff, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity) {
+	const bool verbose = diff ? diff->verbose : false;
+	const ut32 length = R_MAX (la, lb);
+	const ut8 *ea = a + la, *eb = b + lb;
+	ut32 d;
+	if (!a || !b) {
+		return false;
+	}
+	// Strip prefix
+	for (; a < ea && b < eb && *a == *b; a++, b++) {}
+	// Strip suffix
+	for (; a < ea && b < eb && ea[-1] == eb[-1]; ea--, eb--) {}
+	if (!bitvector_distance (a, ea - a, b, eb - b, &d, verbose)) {
+		return false;
+	}
+	if (verbose) {
+		eprintf ("\n");
+	}
+	if (distance) {
+		*distance = d;
+	}
+	if (similarity) {
+		*similarity = length ? 1.0 - (double)d / length : 1.0;
+	}
+	return true;
+}
+
+/* anchored approximation for inputs too big for the exact kernels: windows
+ * of ANCHOR_K bytes are sampled by content (their rolling hash has the low
+ * ANCHOR_MASK bits clear, so the same data is sampled in both buffers),
+ * the windows that appear once in each buffer become anchors, and the
+ * longest chain of anchors in the same order splits the buffers into
+ * matching runs and small gaps. only the gaps go through the bit-vector
+ * kernel, so the result is an upper bound of the real distance */
+#define ANCHOR_K 32
+#define ANCHOR_MASK 0xff
+#define ANCHOR_BASE 0x100000001b3ULL
+
+typedef struct {
+	ut64 hash;
+	ut32 pos;
+} DiffAnchor;
+
+typedef struct {
+	ut32 a;
+	ut32 b;
+} DiffAnchorPair;
+
+static int anchor_cmp(const void *x, const void *y) {
+	const DiffAnchor *a = x, *b = y;
+	if (a->hash != b->hash) {
+		return (a->hash > b->hash) - (a->hash < b->hash);
+	}
+	return (a->pos > b->pos) - (a->pos < b->pos);
+}
+
+static int anchor_pair_cmp(const void *x, const void *y) {
+	const DiffAnchorPair *a = x, *b = y;
+	return (a->a > b->a) - (a->a < b->a);
+}
+
+/* stores the sampled windows of buf in out (if any), returns their count */
+static int anchor_sample(const ut8 *buf, ut32 len, DiffAnchor *out) {
+	ut64 h = 0, pw = 1;
+	ut32 i, n = 0;
+	if (len < ANCHOR_K) {
+		return 0;
+	}
+	for (i = 0; i < ANCHOR_K; i++) {
+		h = h * ANCHOR_BASE + buf[i];
+		pw *= ANCHOR_BASE;
+	}
+	for (i = 0; ; i++) {
+		if (!((h >> 20) & ANCHOR_MASK)) {
+			if (out) {
+				out[n].hash = h;
+				out[n].pos = i;
+			}
+			n++;
+		}
+		if (i + ANCHOR_K >= len) {
+			break;
+		}
+		h = h * ANCHOR_BASE + buf[i + ANCHOR_K] - pw * buf[i];
+	}
+	return n;
+}
+
+static bool anchor_unique(const DiffAnchor *tab, int n, int i) {
+	return (!i || tab[i - 1].hash != tab[i].hash)
+		&& (i + 1 == n || tab[i + 1].hash != tab[i].hash);
+}
+
+/* index of the window with the given hash, if it is unique in the table */
+static int anchor_find(const DiffAnchor *tab, int n, ut64 hash) {
+	int lo = 0, hi = n;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (tab[mid].hash < hash) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return (lo < n && tab[lo].hash == hash && anchor_unique (tab, n, lo))? lo: -1;
+}
+
+static bool anchored_gap(const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut64 *total) {
+	const ut8 *ea = a + la, *eb = b + lb;
+	ut32 d;
+	for (; a < ea && b < eb && *a == *b; a++, b++) {}
+	for (; a < ea && b < eb && ea[-1] == eb[-1]; ea--, eb--) {}
+	if (!bitvector_distance (a, ea - a, b, eb - b, &d, false)) {
+		return false;
+	}
+	*total += d;
+	return true;
+}
+
+R_API bool r_diff_buffers_distance_anchored(RDiff *diff, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity) {
+	const bool verbose = diff ? diff->verbose : false;
+	const ut32 length = R_MAX (la, lb);
+	DiffAnchor *ta = NULL, *tb = NULL;
+	DiffAnchorPair *pairs = NULL;
+	int *tails = NULL, *prev = NULL, *chain = NULL;
+	int na, nb, i, k, n = 0, len = 0;
+	ut32 cur_a = 0, cur_b = 0;
+	ut64 total = 0;
+	bool ret = false;
+
+	if (!a || !b) {
+		return false;
+	}
+	na = anchor_sample (a, la, NULL);
+	nb = anchor_sample (b, lb, NULL);
+	ta = malloc ((na + 1) * sizeof (DiffAnchor));
+	tb = malloc ((nb + 1) * sizeof (DiffAnchor));
+	pairs = malloc ((na + 1) * sizeof (DiffAnchorPair));
+	tails = malloc ((na + 1) * sizeof (int));
+	prev = malloc ((na + 1) * sizeof (int));
+	chain = malloc ((na + 1) * sizeof (int));
+	if (!ta || !tb || !pairs || !tails || !prev || !chain) {
+		goto beach;
+	}
+	anchor_sample (a, la, ta);
+	anchor_sample (b, lb, tb);
+	qsort (ta, na, sizeof (DiffAnchor), anchor_cmp);
+	qsort (tb, nb, sizeof (DiffAnchor), anchor_cmp);
+	/* windows found once in each buffer */
+	for (i = 0; i < na; i++) {
+		if (anchor_unique (ta, na, i) && (k = anchor_find (tb, nb, ta[i].hash)) != -1
+				&& !memcmp (a + ta[i].pos, b + tb[k].pos, ANCHOR_K)) {
+			pairs[n].a = ta[i].pos;
+			pairs[n].b = tb[k].pos;
+			n++;
+		}
+	}
+	qsort (pairs, n, sizeof (DiffAnchorPair), anchor_pair_cmp);
+	/* longest chain of pairs also increasing in b (patience sorting) */
+	for (i = 0; i < n; i++) {
+		int lo = 0, hi = len;
+		while (lo < hi) {
+			int mid = lo + (hi - lo) / 2;
+			if (pairs[tails[mid]].b < pairs[i].b) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		prev[i] = lo? tails[lo - 1]: -1;
+		tails[lo] = i;
+		if (lo == len) {
+			len++;
+		}
+	}
+	for (i = len - 1, k = len? tails[len - 1]: -1; i >= 0; i--) {
+		chain[i] = k;
+		k = prev[k];
+	}
+	/* the gaps between the anchors go through the exact kernel, and the
+	 * anchors are extended forward while the bytes keep matching */
+	for (i = 0; i < len; i++) {
+		ut32 xa = pairs[chain[i]].a, xb = pairs[chain[i]].b;
+		if (xa < cur_a || xb < cur_b) {
+			continue;
+		}
+		if (!anchored_gap (a + cur_a, xa - cur_a, b + cur_b, xb - cur_b, &total)) {
+			goto beach;
+		}
+		for (cur_a = xa, cur_b = xb; cur_a < la && cur_b < lb && a[cur_a] == b[cur_b]; cur_a++, cur_b++) {}
+		if (verbose && !(i % 1000)) {
+			eprintf ("\rProcessing anchor %d of %d\r", i, len);
+		}
+	}
+	if (!anchored_gap (a + cur_a, la - cur_a, b + cur_b, lb - cur_b, &total)) {
+		goto beach;
+	}
+	if (verbose) {
+		eprintf ("\n");
+	}
+	if (distance) {
+		*distance = (ut32)total;
+	}
+	if (similarity) {
+		*similarity = length ? 1.0 - (double)total / length : 1.0;
+	}
+	ret = true;
+beach:
+	free (ta);
+	free (tb);
+	free (pairs);
+	free (tails);
+	free (prev);
+	free (chain);
+	return ret;
+}
+
+/* word steps of the bit-vector kernel above which the anchored
+ * approximation is used, about a minute of work */
+#define BITVECTOR_MAX_STEPS (1ULL << 36)
+/* and the largest match table it can allocate */
+#define BITVECTOR_MAX_WORDS (1ULL << 16)
+
 R_API bool r_diff_buffers_distance(RDiff *d, const ut8 *a, ut32 la, const ut8 *b, ut32 lb, ut32 *distance, double *similarity) {
+	const bool verbose = d? d->verbose: false;
+	const char *name = "levenshtein (bit-vector)";
+	ut64 t0 = r_sys_now ();
+	ut64 w = (R_MIN (la, lb) + 63) / 64;
+	bool ret;
 	if (d) {
 		switch (d->type) {
 		case 'm':
-			return r_diff_buffers_distance_myers (d, a, la, b, lb, distance, similarity);
+			name = "myers (O(ND), no substitution)";
+			ret = r_diff_buffers_distance_myers (d, a, la, b, lb, distance, similarity);
+			goto out;
 		case 'l':
-			return r_diff_buffers_distance_levenstein (d, a, la, b, lb, distance, similarity);
+			name = "levenshtein (diagonal)";
+			ret = r_diff_buffers_distance_levenstein (d, a, la, b, lb, distance, similarity);
+			goto out;
+		case 'a':
+			name = "approximate (anchored)";
+			ret = r_diff_buffers_distance_anchored (d, a, la, b, lb, distance, similarity);
+			goto out;
 		default:
 			break;
 		}
 	}
-	return r_diff_buffers_distance_original (d, a, la, b, lb, distance, similarity);
+	if (w > BITVECTOR_MAX_WORDS || w * R_MAX (la, lb) > BITVECTOR_MAX_STEPS) {
+		eprintf ("Warning: inputs too big for the exact distance, using an approximation\n");
+		name = "approximate (anchored)";
+		ret = r_diff_buffers_distance_anchored (d, a, la, b, lb, distance, similarity);
+	} else {
+		ret = r_diff_buffers_distance_bitparallel (d, a, la, b, lb, distance, similarity);
+	}
+out:
+	if (verbose) {
+		/* r_sys_now keeps the seconds above the low 20 bits */
+		ut64 t1 = r_sys_now ();
+		double secs = (double)((t1 >> 20) - (t0 >> 20))
+			+ ((double)(t1 & 0xfffff) - (double)(t0 & 0xfffff)) / 1000000;
+		eprintf ("algorithm: %s, %.3f seconds\n", name, secs);
+	}
+	return ret;
 }
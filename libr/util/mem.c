@@ -319,6 +319,27 @@ R_API bool r_mem_is_zero(const ut8 *b, int l) {
 	return true;
 }
 
+/* length of the run of ch at the start of b, compared a word at a time */
+R_API int r_mem_span(const ut8 *b, int l, ut8 ch) {
+	const ut64 pat = 0x0101010101010101ULL * ch;
+	int i = 0;
+	while (i < l && ((size_t)(b + i) & 7)) {
+		if (b[i] != ch) {
+			return i;
+		}
+		i++;
+	}
+	for (; i + 8 <= l; i += 8) {
+		if (*(const ut64 *)(b + i) != pat) {
+			break;
+		}
+	}
+	while (i < l && b[i] == ch) {
+		i++;
+	}
+	return i;
+}
+
 R_API void *r_mem_alloc(int sz) {
 	return calloc (sz, 1);
 }
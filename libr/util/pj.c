@@ -0,0 +1,275 @@
+/* radare - LGPL - Copyright 2018 - agent */
+
+#include <r_util.h>
+
+/* streaming json writer: values are appended to a pre-sized buffer which is
+ * drained into the flush callback (if any) when full, so big listings never
+ * need the whole document in memory */
+
+#define ONES 0x0101010101010101ULL
+#define HIGHS 0x8080808080808080ULL
+
+/* true if none of the 8 bytes needs to be escaped, checked a word at a time */
+static inline bool word_is_clean(ut64 v) {
+	ut64 ctl = (v - ONES * 0x20) & ~v & HIGHS;
+	ut64 dq = v ^ (ONES * '"');
+	ut64 bs = v ^ (ONES * '\\');
+	ut64 del = v ^ (ONES * 0x7f);
+	dq = (dq - ONES) & ~dq & HIGHS;
+	bs = (bs - ONES) & ~bs & HIGHS;
+	del = (del - ONES) & ~del & HIGHS;
+	return !((v & HIGHS) | ctl | dq | bs | del);
+}
+
+/* same output as r_str_utf16_encode, dst must fit len * 6 bytes */
+R_API int r_json_escape(char *dst, const char *src, int len) {
+	static const char hex[] = "0123456789abcdef";
+	char *d = dst;
+	int i = 0, run;
+	while (i < len) {
+		ut64 v;
+		for (run = i; run + 8 <= len; run += 8) {
+			memcpy (&v, src + run, sizeof (v));
+			if (!word_is_clean (v)) {
+				break;
+			}
+		}
+		if (run > i) {
+			memcpy (d, src + i, run - i);
+			d += run - i;
+			i = run;
+			if (i >= len) {
+				break;
+			}
+		}
+		ut8 c = src[i++];
+		if (c == '"' || c == '\\') {
+			*d++ = '\\';
+			*d++ = c;
+		} else if (c < 0x20 || c > 0x7e) {
+			memcpy (d, "\\u00", 4);
+			d[4] = hex[c >> 4];
+			d[5] = hex[c & 0xf];
+			d += 6;
+		} else {
+			*d++ = c;
+		}
+	}
+	return d - dst;
+}
+
+static bool pj_reserve(PJ *j, int n) {
+	if (j->len + n + 1 <= j->size) {
+		return true;
+	}
+	pj_flush (j);
+	if (j->len + n + 1 > j->size) {
+		int size = R_MAX (j->size * 2, j->len + n + 1);
+		char *buf = realloc (j->buf, size);
+		if (!buf) {
+			return false;
+		}
+		j->buf = buf;
+		j->size = size;
+	}
+	return true;
+}
+
+static void pj_append(PJ *j, const char *s, int n) {
+	if (n > 0 && pj_reserve (j, n)) {
+		memcpy (j->buf + j->len, s, n);
+		j->len += n;
+		j->buf[j->len] = 0;
+	}
+}
+
+static void pj_comma(PJ *j) {
+	if (!j->is_key && j->level > 0 && !j->is_first) {
+		pj_append (j, ",", 1);
+	}
+	j->is_first = false;
+	j->is_key = false;
+}
+
+static void pj_quoted(PJ *j, const char *s, int n) {
+	if (!pj_reserve (j, (n * 6) + 2)) {
+		return;
+	}
+	j->buf[j->len++] = '"';
+	j->len += r_json_escape (j->buf + j->len, s, n);
+	j->buf[j->len++] = '"';
+	j->buf[j->len] = 0;
+}
+
+R_API PJ *pj_new_stream(PJFlush flush, void *user, int size) {
+	PJ *j = R_NEW0 (PJ);
+	if (!j) {
+		return NULL;
+	}
+	j->size = (size > 0)? size: R_PJ_BUFSIZE;
+	j->buf = malloc (j->size);
+	if (!j->buf) {
+		free (j);
+		return NULL;
+	}
+	j->buf[0] = 0;
+	j->is_first = true;
+	j->flush = flush;
+	j->user = user;
+	return j;
+}
+
+R_API PJ *pj_new() {
+	return pj_new_stream (NULL, NULL, 0);
+}
+
+/* streamed writers get their pending output flushed */
+R_API void pj_free(PJ *j) {
+	if (j) {
+		pj_flush (j);
+		free (j->buf);
+		free (j);
+	}
+}
+
+R_API void pj_reset(PJ *j) {
+	j->len = 0;
+	j->level = 0;
+	j->is_first = true;
+	j->is_key = false;
+	j->buf[0] = 0;
+}
+
+R_API void pj_flush(PJ *j) {
+	if (j->flush && j->len > 0) {
+		j->flush (j->user, j->buf, j->len);
+		j->len = 0;
+		j->buf[0] = 0;
+	}
+}
+
+R_API char *pj_drain(PJ *j) {
+	char *res = j->buf;
+	j->buf = NULL;
+	free (j);
+	return res;
+}
+
+R_API const char *pj_string(PJ *j) {
+	return j->buf;
+}
+
+R_API PJ *pj_raw(PJ *j, const char *k) {
+	if (k) {
+		pj_append (j, k, strlen (k));
+	}
+	return j;
+}
+
+static PJ *pj_open(PJ *j, char open, char close) {
+	pj_comma (j);
+	if (j->level >= R_PJ_DEPTH) {
+		eprintf ("pj: too deep\n");
+		return j;
+	}
+	pj_append (j, &open, 1);
+	j->braces[j->level++] = close;
+	j->is_first = true;
+	return j;
+}
+
+R_API PJ *pj_o(PJ *j) {
+	return pj_open (j, '{', '}');
+}
+
+R_API PJ *pj_a(PJ *j) {
+	return pj_open (j, '[', ']');
+}
+
+R_API PJ *pj_end(PJ *j) {
+	if (j->level < 1) {
+		eprintf ("pj: unbalanced end\n");
+		return j;
+	}
+	j->level--;
+	pj_append (j, j->braces + j->level, 1);
+	j->is_first = false;
+	j->is_key = false;
+	return j;
+}
+
+R_API PJ *pj_k(PJ *j, const char *k) {
+	pj_comma (j);
+	pj_quoted (j, k, strlen (k));
+	pj_append (j, ":", 1);
+	j->is_key = true;
+	return j;
+}
+
+R_API PJ *pj_ne(PJ *j, const char *s, int len) {
+	pj_comma (j);
+	pj_quoted (j, s, len);
+	return j;
+}
+
+R_API PJ *pj_s(PJ *j, const char *s) {
+	return pj_ne (j, s? s: "", s? strlen (s): 0);
+}
+
+static PJ *pj_num(PJ *j, const char *fmt, ut64 n) {
+	char num[32];
+	int len = snprintf (num, sizeof (num), fmt, n);
+	pj_comma (j);
+	pj_append (j, num, len);
+	return j;
+}
+
+R_API PJ *pj_n(PJ *j, ut64 n) {
+	return pj_num (j, "%"PFMT64u, n);
+}
+
+R_API PJ *pj_N(PJ *j, st64 n) {
+	return pj_num (j, "%"PFMT64d, (ut64)n);
+}
+
+R_API PJ *pj_i(PJ *j, int i) {
+	return pj_N (j, i);
+}
+
+R_API PJ *pj_b(PJ *j, bool b) {
+	pj_comma (j);
+	return pj_raw (j, r_str_bool (b));
+}
+
+R_API PJ *pj_null(PJ *j) {
+	pj_comma (j);
+	return pj_raw (j, "null");
+}
+
+R_API PJ *pj_ks(PJ *j, const char *k, const char *s) {
+	return pj_s (pj_k (j, k), s);
+}
+
+R_API PJ *pj_kn(PJ *j, const char *k, ut64 n) {
+	return pj_n (pj_k (j, k), n);
+}
+
+R_API PJ *pj_kN(PJ *j, const char *k, st64 n) {
+	return pj_N (pj_k (j, k), n);
+}
+
+R_API PJ *pj_ki(PJ *j, const char *k, int i) {
+	return pj_i (pj_k (j, k), i);
+}
+
+R_API PJ *pj_kb(PJ *j, const char *k, bool b) {
+	return pj_b (pj_k (j, k), b);
+}
+
+R_API PJ *pj_ko(PJ *j, const char *k) {
+	return pj_o (pj_k (j, k));
+}
+
+R_API PJ *pj_ka(PJ *j, const char *k) {
+	return pj_a (pj_k (j, k));
+}
@@ -115,23 +115,24 @@ R_API int r_strbuf_appendf(RStrBuf *sb, const char *fmt, ...) {
 	va_list ap;
 
 	va_start (ap, fmt);
-	ret = vsnprintf (string, sizeof (string) - 1, fmt, ap);
+	ret = vsnprintf (string, sizeof (string), fmt, ap);
+	va_end (ap);
+	if (ret < 0) {
+		return false;
+	}
 	if (ret >= sizeof (string)) {
-		char *p = malloc (ret + 2);
+		char *p = malloc (ret + 1);
 		if (!p) {
-			va_end (ap);
 			return false;
 		}
-		*p = 0;
 		va_start (ap, fmt);
-		(void)vsnprintf (p, ret, fmt, ap);
+		(void)vsnprintf (p, ret + 1, fmt, ap);
+		va_end (ap);
 		ret = r_strbuf_append (sb, p);
 		free (p);
 	} else {
-		string[ret] = 0;
 		ret = r_strbuf_append (sb, string);
 	}
-	va_end (ap);
 	return ret;
 }
 
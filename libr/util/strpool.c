@@ -157,6 +157,129 @@ R_API char *r_strpool_slice (RStrpool *p, int index) {
 	return o;
 }
 
+/* interned strings. every distinct string is stored once with its hash
+ * and a reference count, so the same name kept by the flags and the
+ * functions takes memory once and two interned names are equal only when
+ * they are the same pointer. entries are allocated one by one instead
+ * of in the pool buffer above because that buffer moves when it grows */
+
+typedef struct r_strpool_str_t {
+	struct r_strpool_str_t *next;
+	ut32 hash;
+	ut32 refs;
+	char str[1];
+} RStrpoolStr;
+
+static RStrpoolStr **itab = NULL;
+static ut32 isize = 0;
+static ut32 icount = 0;
+
+#define INTERN_ENTRY(s) ((RStrpoolStr *)((char *)(s) - offsetof (RStrpoolStr, str)))
+
+static bool intern_grow(void) {
+	ut32 i, size = isize? isize * 2: 4096;
+	RStrpoolStr **tab = calloc (size, sizeof (RStrpoolStr *));
+	if (!tab) {
+		return false;
+	}
+	for (i = 0; i < isize; i++) {
+		RStrpoolStr *e, *next;
+		for (e = itab[i]; e; e = next) {
+			next = e->next;
+			e->next = tab[e->hash & (size - 1)];
+			tab[e->hash & (size - 1)] = e;
+		}
+	}
+	free (itab);
+	itab = tab;
+	isize = size;
+	return true;
+}
+
+static RStrpoolStr **intern_slot(const char *s, ut32 hash) {
+	RStrpoolStr **e = &itab[hash & (isize - 1)];
+	for (; *e; e = &(*e)->next) {
+		if ((*e)->hash == hash && !strcmp ((*e)->str, s)) {
+			break;
+		}
+	}
+	return e;
+}
+
+/* returns the interned copy of s with one more reference */
+R_API const char *r_strpool_intern(const char *s) {
+	RStrpoolStr **slot, *e;
+	ut32 hash;
+	int len;
+	if (!s) {
+		return NULL;
+	}
+	if (icount >= isize && !intern_grow ()) {
+		return NULL;
+	}
+	hash = r_str_hash (s);
+	slot = intern_slot (s, hash);
+	if (*slot) {
+		(*slot)->refs++;
+		return (*slot)->str;
+	}
+	len = strlen (s);
+	e = malloc (sizeof (RStrpoolStr) + len);
+	if (!e) {
+		return NULL;
+	}
+	memcpy (e->str, s, len + 1);
+	e->hash = hash;
+	e->refs = 1;
+	e->next = NULL;
+	*slot = e;
+	icount++;
+	return e->str;
+}
+
+/* the interned copy of s if there is one, without taking a reference */
+R_API const char *r_strpool_intern_find(const char *s) {
+	RStrpoolStr *e;
+	if (!s || !isize) {
+		return NULL;
+	}
+	e = *intern_slot (s, r_str_hash (s));
+	return e? e->str: NULL;
+}
+
+/* takes one more reference of an interned string */
+R_API const char *r_strpool_intern_ref(const char *s) {
+	if (s) {
+		INTERN_ENTRY (s)->refs++;
+	}
+	return s;
+}
+
+/* the hash of an interned string, without reading it */
+R_API ut32 r_strpool_intern_hash(const char *s) {
+	return s? INTERN_ENTRY (s)->hash: 0;
+}
+
+/* drops a reference of an interned string. s must come from
+ * r_strpool_intern, anything else is reported and left alone */
+R_API void r_strpool_intern_release(const char *s) {
+	RStrpoolStr **slot, *e;
+	if (!s) {
+		return;
+	}
+	slot = isize? intern_slot (s, r_str_hash (s)): NULL;
+	e = slot? *slot: NULL;
+	if (!e || e->str != s) {
+		eprintf ("r_strpool_intern_release: %p is not interned\n", s);
+		return;
+	}
+	if (--e->refs == 0) {
+		*slot = e->next;
+		icount--;
+		free (e);
+	}
+}
+
 #if TEST
 int main() {
 	RStrpool *p = r_strpool_new (1024);
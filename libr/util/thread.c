@@ -70,6 +70,9 @@ R_API int r_th_kill(RThread *th, int force) {
 	if (!th) {
 		return false;
 	}
+	if (th->joined) {
+		return 0;
+	}
 	th->breaked = true;
 	r_th_break (th);
 	r_th_wait (th);
@@ -109,13 +112,14 @@ R_API bool r_th_start(RThread *th, int enable) {
 R_API int r_th_wait(struct r_th_t *th) {
 	int ret = false;
 	void *thret;
-	if (th) {
+	if (th && !th->joined) {
 #if HAVE_PTHREAD
 		ret = pthread_join (th->tid, &thret);
 #elif __WINDOWS__ && !defined(__CYGWIN__)
 		ret = WaitForSingleObject (th->tid, INFINITE);
 #endif
 		th->running = false;
+		th->joined = true;
 	}
 	return ret;
 }
@@ -134,6 +138,20 @@ R_API void *r_th_free(struct r_th_t *th) {
 	return NULL;
 }
 
+/* number of online processors, 1 when it can't be known */
+R_API int r_th_ncpus() {
+#if __WINDOWS__ && !defined(__CYGWIN__)
+	SYSTEM_INFO si;
+	GetSystemInfo (&si);
+	return R_MAX ((int)si.dwNumberOfProcessors, 1);
+#elif defined(_SC_NPROCESSORS_ONLN)
+	long n = sysconf (_SC_NPROCESSORS_ONLN);
+	return n > 0? (int)n: 1;
+#else
+	return 1;
+#endif
+}
+
 #if 0
 
 // Thread Pipes
@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+
+""" r2pipe stand-in that compares one command per round-trip against
+batched commands (a json array per line, see '?' in r2) over r2 -0
+
+    python sys/bench-batch.py [-n count] [-r r2] [-t template] file
+
+Every reply of a batch is '%08x\\n<output>', the outputs of both modes
+must match. Numbers on /bin/ls (x86-64, -n 20000):
+
+    p8 4 @ %d     single 0.46s  batch 0.15s  (81 msgs)
+    pxj 8 @ %d    single 0.59s  batch 0.28s  (86 msgs)
+    px 16 @ %d    single 0.64s  batch 0.36s  (86 msgs)
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+import time
+
+# r2 -0 reads up to 4096 bytes per line
+MAX_LINE = 4000
+
+def main():
+    parser = argparse.ArgumentParser(description='Batched r2pipe commands benchmark')
+    parser.add_argument('-n', type=int, default=20000, help='number of commands')
+    parser.add_argument('-r', default='radare2', help='radare2 binary')
+    parser.add_argument('-t', default='p8 4 @ %d', help='command template, gets an address')
+    parser.add_argument('-a', type=lambda x: int(x, 0), default=0x5000, help='first address')
+    parser.add_argument('file')
+    args = parser.parse_args()
+
+    r2 = subprocess.Popen([args.r, '-q0', args.file], stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+
+    def read_reply():
+        out = b''
+        while not out.endswith(b'\0'):
+            chunk = r2.stdout.read1(65536)
+            if not chunk:
+                sys.exit('r2 exited')
+            out += chunk
+        return out[:-1]
+
+    def cmd(line):
+        r2.stdin.write(line.encode() + b'\n')
+        r2.stdin.flush()
+        return read_reply()
+
+    read_reply()
+    cmds = [args.t % (args.a + i * 4) for i in range(args.n)]
+    batches = []
+    cur = []
+    size = 2
+    for c in cmds:
+        if size + len(c) + 4 > MAX_LINE:
+            batches.append(json.dumps(cur))
+            cur = []
+            size = 2
+        cur.append(c)
+        size += len(c) + 4
+    batches.append(json.dumps(cur))
+
+    t = time.time()
+    single = [cmd(c) for c in cmds]
+    t_single = time.time() - t
+
+    t = time.time()
+    batched = []
+    for b in batches:
+        res = cmd(b)
+        i = 0
+        while i < len(res):
+            n = int(res[i:i + 8], 16)
+            batched.append(res[i + 9:i + 9 + n])
+            i += 9 + n
+    t_batch = time.time() - t
+    r2.kill()
+
+    print('%s  single %.2fs  batch %.2fs  (%d msgs)' % (args.t, t_single, t_batch, len(batches)))
+    if single != batched:
+        sys.exit('outputs differ')
+
+if __name__ == '__main__':
+    main()
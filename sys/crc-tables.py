@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+
+""" writes the slicing-by-8 tables of the crc presets in libr/hash/crca.c
+
+    python sys/crc-tables.py > libr/hash/crca_tables.h
+
+Keep PRESETS in the order of enum CRC_PRESETS in r_hash.h. Reflected
+presets use the table of the reflected register, the rest the register
+aligned to the top of 32 bits.
+"""
+
+# name, width, reflected, polynomial
+PRESETS = [
+    ('CRC_PRESET_32', 32, True, 0x04C11DB7),
+    ('CRC_PRESET_16', 16, True, 0x8005),
+    ('CRC_PRESET_32_ECMA_267', 32, False, 0x80000011),
+    ('CRC_PRESET_32C', 32, True, 0x1EDC6F41),
+    ('CRC_PRESET_24', 24, False, 0x864CFB),
+    ('CRC_PRESET_16_CITT', 16, False, 0x1021),
+    ('CRC_PRESET_16_USB', 16, True, 0x8005),
+    ('CRC_PRESET_16_HDLC', 16, True, 0x1021),
+    ('CRC_PRESET_15_CAN', 15, False, 0x4599),
+    ('CRC_PRESET_8_SMBUS', 8, False, 0x07),
+]
+
+def reflect(v, bits):
+    r = 0
+    for i in range(bits):
+        r = (r << 1) | ((v >> i) & 1)
+    return r
+
+def tables(width, reflected, poly):
+    t0 = []
+    for i in range(256):
+        if reflected:
+            rpoly = reflect(poly, width)
+            crc = i
+            for j in range(8):
+                crc = (crc >> 1) ^ rpoly if crc & 1 else crc >> 1
+        else:
+            apoly = (poly << (32 - width)) & 0xffffffff
+            crc = i << 24
+            for j in range(8):
+                crc = ((crc << 1) ^ apoly if crc & 0x80000000 else crc << 1) & 0xffffffff
+        t0.append(crc)
+    t = [t0]
+    for k in range(1, 8):
+        prev = t[k - 1]
+        if reflected:
+            t.append([(p >> 8) ^ t0[p & 0xff] for p in prev])
+        else:
+            t.append([((p << 8) & 0xffffffff) ^ t0[p >> 24] for p in prev])
+    return t
+
+def main():
+    print('/* generated by sys/crc-tables.py, do not edit */')
+    print('')
+    print('static const ut32 crc_tables[CRC_PRESET_SIZE][8][256] = {')
+    for name, width, reflected, poly in PRESETS:
+        print('\t{ /* %s */' % name)
+        for t in tables(width, reflected, poly):
+            print('\t\t{')
+            for i in range(0, 256, 6):
+                row = ', '.join('0x%08x' % v for v in t[i:i + 6])
+                print('\t\t\t%s,' % row)
+            print('\t\t},')
+        print('\t},')
+    print('};')
+
+if __name__ == '__main__':
+    main()